@@ -0,0 +1,104 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+#include <zmq.hpp>
+
+using namespace std;
+
+#include "../vm/types.hpp"
+#include "../vm/opcodes.hpp"
+#include "../vm/memory.hpp"
+#include "../vm/hash.hpp"
+#include "../vm/vm.hpp"
+#include "../vm/batch.hpp"
+#include "../vm/coverage.hpp"
+
+using namespace paiv;
+
+
+static string
+readFile(const string& fn)
+{
+  ifstream ifs(fn, ios::binary);
+  return string(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+}
+
+
+int main(int argc, char* argv[])
+{
+  size_t threads = 0;
+  u64 budget = BatchRunner::DefaultBudget;
+  u8 quiet = false;
+  string coverageFn;
+
+  int argi = 1;
+  for (; argi < argc; argi++)
+  {
+    string arg = argv[argi];
+    if (arg == "-q")
+      quiet = true;
+    else if (arg == "-j" && argi + 1 < argc)
+      threads = stoul(argv[++argi]);
+    else if (arg == "--budget" && argi + 1 < argc)
+      budget = stoull(argv[++argi]);
+    else if (arg == "--coverage" && argi + 1 < argc)
+      coverageFn = argv[++argi];
+    else
+      break;
+  }
+
+  if (argc - argi < 2)
+  {
+    cout << "usage: batch [-q] [-j threads] [--budget instr] [--coverage <bitmap>] <snapshot> <transcript>..." << endl;
+    return 0;
+  }
+
+  unique_ptr<Snapshot> snapshot(new Snapshot());
+  if (!snapshot->load(argv[argi]))
+  {
+    cerr << "failed to load snapshot " << argv[argi] << endl;
+    return 1;
+  }
+
+  vector<string> names(argv + argi + 1, argv + argc);
+  vector<string> transcripts;
+  for (auto& fn : names)
+    transcripts.push_back(readFile(fn));
+
+  Coverage coverage;
+  BatchRunner runner(*snapshot, budget);
+  if (coverageFn.size() > 0)
+    runner.setCoverage(&coverage);
+  auto results = runner.run(transcripts, threads);
+
+  if (coverageFn.size() > 0 && !coverage.accumulate(coverageFn))
+  {
+    cerr << "failed to write coverage " << coverageFn << endl;
+    return 1;
+  }
+
+  for (size_t i = 0; i < results.size(); i++)
+  {
+    auto& res = results[i];
+    cout << "== " << names[i] << ' ' << setfill('0') << setw(16) << hex << res.hash
+      << dec << ' ' << res.ticks << (res.halted ? " halted" : "") << endl;
+    if (!quiet)
+      cout << res.output << endl;
+  }
+
+  return 0;
+}
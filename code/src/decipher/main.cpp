@@ -1,16 +1,23 @@
+#include <algorithm>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <sstream>
 #include <vector>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 
 #include "../vm/types.hpp"
+#include "../vm/memory.hpp"
 #include "../vm/loader.hpp"
 #include "../vm/opcodes.hpp"
-#include "../ida/disasm.cpp"
+#include "../vm/disasm.hpp"
 
 using namespace paiv;
 
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <vector>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+
+#include "../vm/types.hpp"
+#include "../vm/opcodes.hpp"
+#include "../vm/memory.hpp"
+#include "../vm/loader.hpp"
+
+#include "../vm/disasm.hpp"
+
+using namespace paiv;
+
+
+namespace paiv
+{
+  static string
+  hex4(u16 x)
+  {
+    stringstream so;
+    so << "0x" << setfill('0') << setw(4) << hex << x;
+    return so.str();
+  }
+
+  static string
+  opsymbol(Op opcode)
+  {
+    string name = opinfo(opcode).name;
+    transform(begin(name), end(name), begin(name), ::toupper);
+    return name;
+  }
+
+  static void
+  writeImage(ostream& so, const vector<u16>& image)
+  {
+    so << "constexpr u16 embedded_image[] = {";
+    for (size_t i = 0; i < image.size(); i++)
+    {
+      so << (i % 8 == 0 ? "\n  " : " ") << hex4(image[i]) << ',';
+    }
+    so << "\n};" << endl;
+  }
+
+  static void
+  writeDecoded(ostream& so, const vector<Operation>& ops)
+  {
+    so << "constexpr DecodedOp embedded_decoded[] = {" << endl;
+    for (auto& op : ops)
+    {
+      so << "  { " << hex4(op.offset) << ", Op::" << opsymbol(op.opcode) << ", " << (int)op.size
+        << ", " << hex4(op.a) << ", " << hex4(op.b) << ", " << hex4(op.c) << " }," << endl;
+    }
+    so << "};" << endl;
+  }
+}
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    cout << "usage: embed <image>" << endl;
+    return 0;
+  }
+
+  ImageLoader loader;
+  auto image = loader.read(argv[1]);
+
+  Disassembler disasm;
+  auto ops = disasm.decode(image);
+
+  cout << "// generated by embed from " << argv[1] << endl;
+  cout << endl;
+  writeImage(cout, image);
+  cout << endl;
+  writeDecoded(cout, ops);
+
+  return 0;
+}
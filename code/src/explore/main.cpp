@@ -0,0 +1,569 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <thread>
+#include <tuple>
+#include <unistd.h>
+#include <unordered_set>
+#include <vector>
+#include <zmq.hpp>
+
+using namespace std;
+
+#include "../vm/types.hpp"
+#include "../vm/opcodes.hpp"
+#include "../vm/memory.hpp"
+#include "../vm/loader.hpp"
+#include "../vm/hash.hpp"
+#include "../vm/vm.hpp"
+#include "../vm/warm.hpp"
+#include "../vm/fork.hpp"
+#include "../mapper/world.hpp"
+
+using namespace paiv;
+
+
+namespace paiv
+{
+  static const size_t AddressSpace = 32768;
+
+
+  // Game state parked at IN, stored as the difference from the root state
+
+  class Node
+  {
+  public:
+    u64 hash;
+    u16 ip;
+    u16 sp;
+    array<u16, 8> reg;
+    vector<u16> stack;
+    vector<pair<u16, u16>> delta;
+
+    shared_ptr<const Node> parent;
+    string command;
+
+    vector<string> path() const;
+  };
+
+  vector<string>
+  Node::path() const
+  {
+    vector<string> res;
+    for (const Node* p = this; p->parent; p = p->parent.get())
+      res.push_back(p->command);
+    reverse(begin(res), end(res));
+    return res;
+  }
+
+
+  typedef struct
+  {
+    string kind;
+    string name;
+    vector<string> path;
+  } Discovery;
+
+
+  class WorkDeque
+  {
+  public:
+    void push(const shared_ptr<const Node>& node)
+    {
+      lock_guard<mutex> lock(guard);
+      items.push_back(node);
+    }
+
+    // owner takes from the back, thieves from the front
+    u8 pop(shared_ptr<const Node>& node)
+    {
+      lock_guard<mutex> lock(guard);
+      if (items.empty())
+        return false;
+      node = items.back();
+      items.pop_back();
+      return true;
+    }
+
+    u8 steal(shared_ptr<const Node>& node)
+    {
+      lock_guard<mutex> lock(guard);
+      if (items.empty())
+        return false;
+      node = items.front();
+      items.pop_front();
+      return true;
+    }
+
+  private:
+    mutex guard;
+    deque<shared_ptr<const Node>> items;
+  };
+
+
+  class VisitedSet
+  {
+  public:
+    // true if the hash was not seen before
+    u8 insert(u64 hash)
+    {
+      auto& shard = shards[hash % Shards];
+      lock_guard<mutex> lock(shard.guard);
+      return shard.hashes.insert(hash).second;
+    }
+
+    size_t size()
+    {
+      size_t n = 0;
+      for (auto& shard : shards)
+      {
+        lock_guard<mutex> lock(shard.guard);
+        n += shard.hashes.size();
+      }
+      return n;
+    }
+
+  private:
+    static const size_t Shards = 64;
+
+    struct Shard
+    {
+      mutex guard;
+      unordered_set<u64> hashes;
+    };
+
+    array<Shard, Shards> shards;
+  };
+
+
+  // Per-thread VM and scratch snapshots, reused for every expansion
+  typedef struct
+  {
+    unique_ptr<SynacorVM> vm;
+    unique_ptr<Snapshot> scratch;
+    vector<u16> dirty;
+    vector<shared_ptr<const Node>> next;
+    vector<Discovery> found;
+  } Worker;
+
+
+  // Breadth-first search over game states. Edges are commands built from
+  // the game's own verb table and the rooms and objects in memory; states
+  // are deduplicated by VM hash. Each level is dealt onto per-thread
+  // deques and idle threads steal, so the first path reaching a room, item
+  // or code is a shortest one. With a fork brancher, one thread expands
+  // each state and the commands run in forked children instead.
+
+  class Explorer
+  {
+  public:
+    static const u64 DefaultBudget = 1 << 24;
+
+    Explorer(const Snapshot& root, u64 budget = DefaultBudget, const ForkBrancher* brancher = nullptr)
+      : root(root), budget(budget), brancher(brancher)
+    {
+    }
+
+    void run(ostream& so, size_t depth, size_t threads = 0);
+
+  private:
+    void work(size_t id);
+    void expand(const shared_ptr<const Node>& node, Worker& worker);
+    void accept(const shared_ptr<const Node>& node, const string& command, shared_ptr<Node> child,
+      const string& output, const vector<u16>& before, Worker& worker);
+    shared_ptr<Node> capture(Worker& worker) const;
+    void restore(const Node& node, Worker& worker) const;
+    vector<string> commands(const vector<u16>& mem) const;
+    void discover(const vector<u16>& before, const vector<u16>& after, const string& output,
+      const Node& node, vector<Discovery>& found) const;
+
+  private:
+    const Snapshot& root;
+    u64 budget;
+    const ForkBrancher* brancher;
+    VisitedSet visited;
+    vector<Worker> workers;
+    vector<WorkDeque> deques;
+  };
+
+
+  void
+  Explorer::run(ostream& so, size_t depth, size_t threads)
+  {
+    if (brancher)
+      threads = 1;
+    if (threads == 0)
+      threads = max(1u, thread::hardware_concurrency());
+
+    workers = vector<Worker>(threads);
+    for (auto& worker : workers)
+    {
+      worker.vm = unique_ptr<SynacorVM>(new SynacorVM());
+      worker.scratch = unique_ptr<Snapshot>(new Snapshot(root));
+    }
+
+    workers[0].vm->load(root);
+    shared_ptr<const Node> start = capture(workers[0]);
+    visited.insert(start->hash);
+
+    vector<shared_ptr<const Node>> frontier = { start };
+    set<pair<string, string>> reported;
+
+    for (size_t level = 0; level < depth && frontier.size() > 0; level++)
+    {
+      deques = vector<WorkDeque>(threads);
+      for (size_t i = 0; i < frontier.size(); i++)
+        deques[i % threads].push(frontier[i]);
+
+      vector<thread> pool;
+      for (size_t i = 1; i < threads; i++)
+        pool.push_back(thread(&Explorer::work, this, i));
+      work(0);
+      for (auto& t : pool)
+        t.join();
+
+      // all paths found on one level are equally short, pick the first
+      // in order so the report does not depend on scheduling
+      vector<Discovery> found;
+      frontier.clear();
+      for (auto& worker : workers)
+      {
+        found.insert(end(found), begin(worker.found), end(worker.found));
+        frontier.insert(end(frontier), begin(worker.next), end(worker.next));
+        worker.found.clear();
+        worker.next.clear();
+      }
+
+      sort(begin(found), end(found), [](const Discovery& a, const Discovery& b) {
+        return tie(a.kind, a.name, a.path) < tie(b.kind, b.name, b.path);
+      });
+
+      for (auto& d : found)
+      {
+        if (!reported.insert(make_pair(d.kind, d.name)).second)
+          continue;
+
+        so << d.kind << ' ' << d.name << ':';
+        for (size_t i = 0; i < d.path.size(); i++)
+          so << (i > 0 ? ", " : " ") << d.path[i];
+        so << endl;
+      }
+
+      cerr << "depth " << level + 1 << ": " << frontier.size() << " new states, "
+        << visited.size() << " total" << endl;
+    }
+  }
+
+  void
+  Explorer::work(size_t id)
+  {
+    size_t threads = deques.size();
+    shared_ptr<const Node> node;
+
+    while (true)
+    {
+      u8 taken = deques[id].pop(node);
+      for (size_t i = 1; !taken && i < threads; i++)
+        taken = deques[(id + i) % threads].steal(node);
+      if (!taken)
+        break;
+
+      expand(node, workers[id]);
+    }
+  }
+
+  void
+  Explorer::expand(const shared_ptr<const Node>& node, Worker& worker)
+  {
+    restore(*node, worker);
+    vector<u16> before(worker.scratch->mem.begin(), worker.scratch->mem.begin() + AddressSpace);
+    vector<string> inputs = commands(before);
+
+    if (brancher)
+    {
+      vector<string> lines;
+      for (auto& command : inputs)
+        lines.push_back(command + "\n");
+
+      auto branches = brancher->run(worker.vm.get(), lines);
+
+      for (size_t i = 0; i < branches.size(); i++)
+      {
+        auto& branch = branches[i];
+        if (!branch.waiting)
+          continue;
+
+        shared_ptr<Node> child(new Node());
+        child->hash = branch.hash;
+        child->ip = branch.ip;
+        child->sp = branch.sp;
+        child->reg = branch.reg;
+        child->stack = move(branch.stack);
+        child->delta = move(branch.delta);
+
+        accept(node, inputs[i], child, branch.output, before, worker);
+      }
+
+      return;
+    }
+
+    for (auto& command : inputs)
+    {
+      restore(*node, worker);
+
+      SynacorVM* vm = worker.vm.get();
+      string input = command + "\n";
+      string output;
+      size_t p = 0;
+
+      vm->setInput([&input, &p]() { return p < input.size() ? (int)(u8)input[p++] : InputPending; });
+      vm->setOutput([&output](u16 c) { output.push_back((char)c); });
+      vm->runUntil(vm->clock() + budget);
+
+      // died, or stuck in a loop we are not going to wait out
+      if (!vm->isWaiting())
+        continue;
+
+      accept(node, command, capture(worker), output, before, worker);
+    }
+  }
+
+  void
+  Explorer::accept(const shared_ptr<const Node>& node, const string& command, shared_ptr<Node> child,
+    const string& output, const vector<u16>& before, Worker& worker)
+  {
+    if (!visited.insert(child->hash))
+      return;
+
+    child->parent = node;
+    child->command = command;
+
+    vector<u16> after(root.mem.begin(), root.mem.begin() + AddressSpace);
+    for (auto& d : child->delta)
+      after[d.first] = d.second;
+
+    discover(before, after, output, *child, worker.found);
+
+    worker.next.push_back(child);
+  }
+
+  shared_ptr<Node>
+  Explorer::capture(Worker& worker) const
+  {
+    Snapshot& state = *worker.scratch;
+    state.take(worker.vm.get());
+
+    shared_ptr<Node> node(new Node());
+    node->hash = worker.vm->hash();
+    node->ip = state.ip;
+    node->sp = state.sp;
+    node->reg = state.reg;
+    node->stack.assign(state.stack.begin(), state.stack.begin() + state.sp);
+
+    worker.dirty.clear();
+    for (size_t i = 0; i < AddressSpace; i++)
+      if (state.mem[i] != root.mem[i])
+      {
+        node->delta.push_back(make_pair((u16)i, state.mem[i]));
+        worker.dirty.push_back(i);
+      }
+
+    return node;
+  }
+
+  void
+  Explorer::restore(const Node& node, Worker& worker) const
+  {
+    Snapshot& state = *worker.scratch;
+
+    // scratch memory differs from the root only at the dirty words, left
+    // by the last capture or restore; put those back, then apply the delta
+    for (u16 i : worker.dirty)
+      state.mem[i] = root.mem[i];
+    worker.dirty.clear();
+    for (auto& d : node.delta)
+    {
+      state.mem[d.first] = d.second;
+      worker.dirty.push_back(d.first);
+    }
+
+    state.ip = node.ip;
+    state.sp = node.sp;
+    state.reg = node.reg;
+    state.ticks = root.ticks;
+    copy(begin(node.stack), end(node.stack), state.stack.begin());
+
+    worker.vm->load(state);
+  }
+
+  vector<string>
+  Explorer::commands(const vector<u16>& mem) const
+  {
+    World world(mem);
+    auto here = world.room(world.location());
+
+    vector<u16> present;
+    vector<u16> carried;
+    for (u16 object : world.objects())
+    {
+      if (world.objectLocation(object) == world.location())
+        present.push_back(object);
+      else if (world.objectLocation(object) == World::Inventory)
+        carried.push_back(object);
+    }
+
+    vector<string> res;
+    for (auto& verb : world.verbs())
+    {
+      if (verb == "go")
+      {
+        for (auto& exit : here.exits())
+          res.push_back(verb + " " + exit);
+      }
+      else if (verb == "take")
+      {
+        for (u16 object : present)
+          res.push_back(verb + " " + world.objectName(object));
+      }
+      else if (verb == "drop" || verb == "use")
+      {
+        for (u16 object : carried)
+          res.push_back(verb + " " + world.objectName(object));
+      }
+      else if (verb != "help")
+      {
+        res.push_back(verb);
+      }
+    }
+
+    return res;
+  }
+
+  void
+  Explorer::discover(const vector<u16>& before, const vector<u16>& after, const string& output,
+    const Node& node, vector<Discovery>& found) const
+  {
+    World was(before);
+    World now(after);
+
+    if (now.location() != was.location())
+    {
+      auto room = now.room(now.location());
+      found.push_back({ "room", room.id() + " " + room.title(), node.path() });
+    }
+
+    for (u16 object : now.objects())
+      if (now.objectLocation(object) == World::Inventory && was.objectLocation(object) != World::Inventory)
+        found.push_back({ "item", now.objectName(object), node.path() });
+
+    // codes are 12 letters and digits with capitals inside, unlike any word
+    // of the game text
+    stringstream si(output);
+    string token;
+    while (si >> token)
+    {
+      auto first = find_if(begin(token), end(token), [](char c) { return isalnum(c); });
+      auto last = find_if(token.rbegin(), token.rend(), [](char c) { return isalnum(c); }).base();
+      token = first < last ? string(first, last) : string();
+
+      if (token.size() != 12)
+        continue;
+      if (!all_of(begin(token), end(token), [](char c) { return isalnum(c); }))
+        continue;
+      if (!any_of(begin(token) + 1, end(token), [](char c) { return isupper(c); }))
+        continue;
+      found.push_back({ "code", token, node.path() });
+    }
+  }
+
+}
+
+
+int main(int argc, char* argv[])
+{
+  size_t threads = 0;
+  size_t depth = 8;
+  u64 budget = Explorer::DefaultBudget;
+  u8 forked = false;
+
+  int argi = 1;
+  for (; argi < argc; argi++)
+  {
+    string arg = argv[argi];
+    if (arg == "-j" && argi + 1 < argc)
+      threads = stoul(argv[++argi]);
+    else if (arg == "--depth" && argi + 1 < argc)
+      depth = stoul(argv[++argi]);
+    else if (arg == "--budget" && argi + 1 < argc)
+      budget = stoull(argv[++argi]);
+    else if (arg == "--fork")
+      forked = true;
+    else
+      break;
+  }
+
+  if (argi >= argc)
+  {
+    cout << "usage: explore [-j threads] [--fork] [--depth commands] [--budget instr] <snapshot | image>" << endl;
+    return 0;
+  }
+
+  unique_ptr<SynacorVM> vm(new SynacorVM());
+  unique_ptr<Snapshot> root(new Snapshot());
+
+  if (root->load(argv[argi]))
+  {
+    vm->load(*root);
+  }
+  else
+  {
+    ImageLoader loader;
+    vector<u16> image = loader.read(argv[argi]);
+    WarmStart warm(image);
+    if (image.size() == 0 || !warm.restore(vm.get()))
+    {
+      cerr << "failed to load " << argv[argi] << endl;
+      return 1;
+    }
+  }
+
+  // park at the next IN, so that every command starts from a prompt
+  vm->setInput([]() { return InputPending; });
+  vm->setOutput([](u16) {});
+  vm->runUntil(vm->clock() + budget);
+  if (!vm->isWaiting())
+  {
+    cerr << "no input prompt within " << budget << " instructions" << endl;
+    return 1;
+  }
+  vm->setInput(nullptr);
+  vm->setOutput(nullptr);
+
+  root->take(vm.get());
+
+  // with --fork, -j is the number of child processes
+  unique_ptr<ForkBrancher> brancher;
+  if (forked)
+    brancher = unique_ptr<ForkBrancher>(new ForkBrancher(*root, threads, budget));
+
+  Explorer explorer(*root, budget, brancher.get());
+  explorer.run(cout, depth, threads);
+
+  return 0;
+}
@@ -1,32 +1,112 @@
+#include <algorithm>
 #include <array>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <sstream>
 #include <vector>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 
 #include "../vm/types.hpp"
 #include "../vm/opcodes.hpp"
+#include "../vm/memory.hpp"
 #include "../vm/loader.hpp"
 
-#include "disasm.cpp"
+#include "../vm/disasm.hpp"
+#include "../vm/vm.hpp"
+#include "../vm/namemap.hpp"
+#include "../vm/coverage.hpp"
 
 using namespace paiv;
 
+#ifdef SYNACOR_EMBED_IMAGE
+#include "embedded_image.hpp"
+#endif
+
+
+// listing of a snapshot's memory, or the image, with executed code marked
+static int
+annotate(const string& fn, const string& coverageFn, const string& namesFn)
+{
+  Coverage coverage;
+  if (!coverage.load(coverageFn))
+  {
+    cerr << "failed to load coverage " << coverageFn << endl;
+    return 1;
+  }
+
+  NameMap names;
+  if (namesFn.size() > 0 && !names.load(namesFn))
+  {
+    cerr << "failed to load names " << namesFn << endl;
+    return 1;
+  }
+
+  vector<u16> memory(32768, 0);
+  unique_ptr<Snapshot> snapshot(new Snapshot());
+  if (snapshot->load(fn))
+    copy(&snapshot->mem[0], &snapshot->mem[0] + 32768, begin(memory));
+  else
+  {
+    ImageLoader loader;
+    auto image = loader.read(fn);
+    if (image.size() == 0)
+    {
+      cerr << "failed to load " << fn << endl;
+      return 1;
+    }
+    copy(begin(image), begin(image) + min<size_t>(image.size(), 32768), begin(memory));
+  }
+
+  coverage.summary(cout, &memory[0], names);
+  cout << endl;
+  coverage.listing(cout, &memory[0], names);
+  return 0;
+}
+
 
 int main(int argc, char* argv[])
 {
-  if (argc < 2)
+  string coverageFn;
+  string namesFn;
+
+  int argi = 1;
+  for (; argi < argc; argi++)
+  {
+    string arg = argv[argi];
+    if (arg == "--coverage" && argi + 1 < argc)
+      coverageFn = argv[++argi];
+    else if (arg == "--names" && argi + 1 < argc)
+      namesFn = argv[++argi];
+    else
+      break;
+  }
+
+  if (coverageFn.size() > 0 && argi < argc)
+    return annotate(argv[argi], coverageFn, namesFn);
+
+  if (argi >= argc)
   {
-    cout << "usage: ida <image>" << endl;
+#ifdef SYNACOR_EMBED_IMAGE
+    Disassembler disasm;
+    auto ops = disasm.decode(embedded_decoded, sizeof(embedded_decoded) / sizeof(embedded_decoded[0]));
+    disasm.disassemble(ops, cout);
+#else
+    cout << "usage: ida [--coverage <bitmap> [--names <namemap>]] <image|snapshot>" << endl;
+#endif
     return 0;
   }
 
   ImageLoader loader;
-  auto image = loader.read(argv[1]);
+  auto image = loader.read(argv[argi]);
 
   Disassembler disasm;
   disasm.disassemble(image, cout);
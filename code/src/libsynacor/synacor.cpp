@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <deque>
+#include <fcntl.h>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+#include <zmq.hpp>
+
+using namespace std;
+
+#include "../vm/types.hpp"
+#include "../vm/opcodes.hpp"
+#include "../vm/memory.hpp"
+#include "../vm/loader.hpp"
+#include "../vm/hash.hpp"
+#include "../vm/vm.hpp"
+#include "synacor.h"
+
+using namespace paiv;
+
+
+namespace paiv
+{
+  // VM with queued input and buffered output, behind the C handle
+  class NativeMachine
+  {
+  public:
+    NativeMachine()
+    {
+      vm.setInput([this]() { return next(); });
+      vm.setOutput([this](u16 c) { output.push_back((char)c); });
+    }
+
+    u8 loadImage(const string& fn)
+    {
+      MappedFile file;
+      if (!file.open(fn) || file.size() < 2)
+        return false;
+      vm.load(file);
+      reset();
+      return true;
+    }
+
+    u8 loadImage(const u16* words, size_t count)
+    {
+      if (count == 0)
+        return false;
+      vm.load(vector<u16>(words, words + min(count, (size_t)32768)));
+      reset();
+      return true;
+    }
+
+    u8 loadSnapshot(const string& fn)
+    {
+      unique_ptr<Snapshot> snapshot(new Snapshot());
+      if (!snapshot->load(fn))
+        return false;
+      vm.load(*snapshot);
+      reset();
+      return true;
+    }
+
+    u8 saveSnapshot(const string& fn)
+    {
+      unique_ptr<Snapshot> snapshot(new Snapshot());
+      snapshot->take(&vm);
+      return snapshot->save(fn);
+    }
+
+    int run(u64 budget)
+    {
+      vm.runUntil(vm.clock() + min(budget, UINT64_MAX - vm.clock()));
+      return status();
+    }
+
+    int step()
+    {
+      if (!vm.halted)
+      {
+        vm.waiting = false;
+        vm.step();
+      }
+      return status();
+    }
+
+    u64 clock() const { return vm.clock(); }
+    u64 hash() const { return vm.hash(); }
+
+    void feed(const char* data, size_t size)
+    {
+      input.insert(end(input), data, data + size);
+    }
+
+    size_t readOutput(char* buffer, size_t size)
+    {
+      size_t n = min(size, output.size());
+      copy(begin(output), begin(output) + n, buffer);
+      output.erase(begin(output), begin(output) + n);
+      return n;
+    }
+
+    u16 getRegister(int index) const
+    {
+      switch (index)
+      {
+        case SYNACOR_REG_IP: return vm.ip;
+        case SYNACOR_REG_SP: return vm.sp;
+        default: return vm.reg[index];
+      }
+    }
+
+    void setRegister(int index, u16 value)
+    {
+      switch (index)
+      {
+        case SYNACOR_REG_IP: vm.ip = value; break;
+        case SYNACOR_REG_SP: vm.sp = value; break;
+        default: vm.reg[index] = value; break;
+      }
+    }
+
+    u16 peek(u16 address) const { return vm.mem[address]; }
+    void poke(u16 address, u16 value) { vm.mem[address] = value; vm.touch(address); }
+    u16 peekStack(u16 index) const { return vm.stack[index]; }
+
+  private:
+    int next()
+    {
+      if (input.empty())
+        return InputPending;
+      int c = (u8)input.front();
+      input.pop_front();
+      return c;
+    }
+
+    int status() const
+    {
+      if (vm.halted)
+        return SYNACOR_HALTED;
+      if (vm.waiting)
+        return SYNACOR_WAITING;
+      return SYNACOR_RUNNING;
+    }
+
+    void reset()
+    {
+      input.clear();
+      output.clear();
+    }
+
+  private:
+    SynacorVM vm;
+    deque<char> input;
+    string output;
+  };
+}
+
+
+struct synacor_vm
+{
+  NativeMachine machine;
+};
+
+
+extern "C" {
+
+int
+synacor_abi_version(void)
+{
+  return SYNACOR_ABI_VERSION;
+}
+
+// the machine's memory is mapped in its constructor, and bad_alloc from
+// there, or from loading a snapshot, must not cross the C interface
+
+synacor_vm*
+synacor_create(void)
+{
+  try
+  {
+    return new synacor_vm();
+  }
+  catch (const bad_alloc&)
+  {
+    return NULL;
+  }
+}
+
+void
+synacor_destroy(synacor_vm* vm)
+{
+  delete vm;
+}
+
+int
+synacor_load_image(synacor_vm* vm, const char* fn)
+{
+  try
+  {
+    return fn && vm->machine.loadImage(fn) ? 0 : -1;
+  }
+  catch (const bad_alloc&)
+  {
+    return -1;
+  }
+}
+
+int
+synacor_load_image_data(synacor_vm* vm, const uint16_t* words, size_t count)
+{
+  try
+  {
+    return words && vm->machine.loadImage(words, count) ? 0 : -1;
+  }
+  catch (const bad_alloc&)
+  {
+    return -1;
+  }
+}
+
+int
+synacor_load_snapshot(synacor_vm* vm, const char* fn)
+{
+  try
+  {
+    return fn && vm->machine.loadSnapshot(fn) ? 0 : -1;
+  }
+  catch (const bad_alloc&)
+  {
+    return -1;
+  }
+}
+
+int
+synacor_save_snapshot(synacor_vm* vm, const char* fn)
+{
+  try
+  {
+    return fn && vm->machine.saveSnapshot(fn) ? 0 : -1;
+  }
+  catch (const bad_alloc&)
+  {
+    return -1;
+  }
+}
+
+int
+synacor_run(synacor_vm* vm, uint64_t budget)
+{
+  return vm->machine.run(budget);
+}
+
+int
+synacor_step(synacor_vm* vm)
+{
+  return vm->machine.step();
+}
+
+uint64_t
+synacor_clock(const synacor_vm* vm)
+{
+  return vm->machine.clock();
+}
+
+uint64_t
+synacor_hash(const synacor_vm* vm)
+{
+  return vm->machine.hash();
+}
+
+void
+synacor_feed(synacor_vm* vm, const char* data, size_t size)
+{
+  if (data)
+    vm->machine.feed(data, size);
+}
+
+size_t
+synacor_read_output(synacor_vm* vm, char* buffer, size_t size)
+{
+  return buffer ? vm->machine.readOutput(buffer, size) : 0;
+}
+
+uint16_t
+synacor_get_register(const synacor_vm* vm, int index)
+{
+  if (index < 0 || index > SYNACOR_REG_SP)
+    return 0;
+  return vm->machine.getRegister(index);
+}
+
+int
+synacor_set_register(synacor_vm* vm, int index, uint16_t value)
+{
+  if (index < 0 || index > SYNACOR_REG_SP)
+    return -1;
+  vm->machine.setRegister(index, value);
+  return 0;
+}
+
+uint16_t
+synacor_peek(const synacor_vm* vm, uint16_t address)
+{
+  return address < 32768 ? vm->machine.peek(address) : 0;
+}
+
+int
+synacor_poke(synacor_vm* vm, uint16_t address, uint16_t value)
+{
+  if (address >= 32768)
+    return -1;
+  vm->machine.poke(address, value);
+  return 0;
+}
+
+uint16_t
+synacor_peek_stack(const synacor_vm* vm, uint16_t index)
+{
+  return index < synacor_get_register(vm, SYNACOR_REG_SP) ? vm->machine.peekStack(index) : 0;
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * libsynacor - C interface to the Synacor virtual machine
+ *
+ * All functions take a handle from synacor_create(). A handle is not
+ * thread-safe, but separate handles can be used from separate threads.
+ * Entries are only ever added to this interface; check
+ * synacor_abi_version() before using ones newer than version 1.
+ */
+
+#ifndef SYNACOR_H
+#define SYNACOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SYNACOR_ABI_VERSION 1
+
+#if defined(__GNUC__)
+#define SYNACOR_API __attribute__((visibility("default")))
+#else
+#define SYNACOR_API
+#endif
+
+typedef struct synacor_vm synacor_vm;
+
+/* machine state after synacor_run() or synacor_step() */
+enum
+{
+  SYNACOR_RUNNING = 0,   /* budget used up, more to run */
+  SYNACOR_WAITING = 1,   /* parked at IN with no input queued */
+  SYNACOR_HALTED = 2,    /* HALT, bad opcode or register, division by zero, or end of memory */
+};
+
+/* registers beyond r0..r7 */
+enum
+{
+  SYNACOR_REG_IP = 8,
+  SYNACOR_REG_SP = 9,
+};
+
+SYNACOR_API int synacor_abi_version(void);
+
+/* NULL when the machine's memory cannot be mapped */
+SYNACOR_API synacor_vm* synacor_create(void);
+SYNACOR_API void synacor_destroy(synacor_vm* vm);
+
+/* return 0 on success, -1 on failure */
+SYNACOR_API int synacor_load_image(synacor_vm* vm, const char* fn);
+SYNACOR_API int synacor_load_image_data(synacor_vm* vm, const uint16_t* words, size_t count);
+SYNACOR_API int synacor_load_snapshot(synacor_vm* vm, const char* fn);
+SYNACOR_API int synacor_save_snapshot(synacor_vm* vm, const char* fn);
+
+/* run up to budget instructions, stopping early at HALT or at IN with an
+   empty input queue */
+SYNACOR_API int synacor_run(synacor_vm* vm, uint64_t budget);
+SYNACOR_API int synacor_step(synacor_vm* vm);
+
+/* instructions retired since load */
+SYNACOR_API uint64_t synacor_clock(const synacor_vm* vm);
+SYNACOR_API uint64_t synacor_hash(const synacor_vm* vm);
+
+/* queue characters for IN */
+SYNACOR_API void synacor_feed(synacor_vm* vm, const char* data, size_t size);
+
+/* move up to size pending OUT characters into buffer, return the count */
+SYNACOR_API size_t synacor_read_output(synacor_vm* vm, char* buffer, size_t size);
+
+/* register index 0..7, SYNACOR_REG_IP or SYNACOR_REG_SP */
+SYNACOR_API uint16_t synacor_get_register(const synacor_vm* vm, int index);
+SYNACOR_API int synacor_set_register(synacor_vm* vm, int index, uint16_t value);
+
+/* 15-bit address space, and the stack from 0 (bottom) to SP */
+SYNACOR_API uint16_t synacor_peek(const synacor_vm* vm, uint16_t address);
+SYNACOR_API int synacor_poke(synacor_vm* vm, uint16_t address, uint16_t value);
+SYNACOR_API uint16_t synacor_peek_stack(const synacor_vm* vm, uint16_t index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,96 +1,28 @@
+#include <algorithm>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <queue>
 #include <sstream>
 #include <vector>
 #include <unordered_set>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 using namespace std;
 
 #include "../vm/types.hpp"
+#include "../vm/memory.hpp"
 #include "../vm/loader.hpp"
+#include "world.hpp"
 
 using namespace paiv;
 
 
-namespace paiv
-{
-  typedef vector<u16> chunk;
-
-  class Entry
-  {
-  public:
-    Entry(const chunk& image, u16 offset, u16 size)
-      : image(image), off(offset), chunk(begin(image) + offset, begin(image) + offset + size)
-    {}
-
-    u16 offset() const { return off; }
-    string title() const { return str(chunk[0]); }
-    string description() const { return str(chunk[1]); }
-
-    vector<string> exits() const;
-    vector<Entry> links() const;
-
-    string id() const {
-      stringstream so;
-      so << setfill('0') << hex << setw(4) << off;
-      return so.str();
-    }
-
-  private:
-    string strref(size_t offset) const;
-    string str(u16 offset) const;
-
-  private:
-    const chunk& image;
-    u16 off;
-    chunk chunk;
-  };
-
-  string Entry::strref(size_t offset) const
-  {
-    return str(image[offset]);
-  }
-
-  string Entry::str(u16 offset) const
-  {
-    u16 len = image[offset++];
-    auto it = begin(image) + offset;
-    string so(len, '@');
-    transform(it, it + len, begin(so), [](u16 x){ return (char)x; });
-    return so;
-  }
-
-
-  vector<string> Entry::exits() const
-  {
-    u16 p = chunk[2];
-    int n = image[p++];
-
-    vector<string> res;
-
-    for (; n > 0; n--)
-      res.push_back(strref(p++));
-
-    return res;
-  }
-
-  vector<Entry> Entry::links() const
-  {
-    u16 p = chunk[3];
-    int n = image[p++];
-
-    vector<Entry> res;
-
-    for (; n > 0; n--)
-      res.push_back(Entry(image, image[p++], 4));
-
-    return res;
-  }
-}
-
-
 static unordered_set<u16>
 walkDungeon(ostream& so, const chunk& image, u16 address, unordered_set<u16> visited,
   const function<bool(const Entry&)>& mapper)
@@ -168,10 +100,10 @@ typedef struct
 static VaultLock
 vaultLock(const chunk& image, const Entry& entry)
 {
-  u16 handler = image[entry.offset() + 4];
-  u16 x = image[handler + 6];
-  u16 y = image[handler + 9];
-  u16 opf = image[handler + 11];
+  u16 handler = word(image, entry.offset() + 4);
+  u16 x = word(image, handler + 6);
+  u16 y = word(image, handler + 9);
+  u16 opf = word(image, handler + 11);
   LockOp op = LockOp::err;
 
   switch (opf)
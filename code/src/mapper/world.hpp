@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../vm/types.hpp"
+
+namespace paiv
+{
+  using namespace std;
+
+  typedef vector<u16> chunk;
+
+  // Addresses come from game memory, and may point anywhere; words past
+  // the end of the image read as zeros
+  inline u16
+  word(const chunk& image, size_t offset)
+  {
+    return offset < image.size() ? image[offset] : 0;
+  }
+
+  inline string
+  str(const chunk& image, u16 offset)
+  {
+    u16 len = word(image, offset++);
+    string so(len, '@');
+    for (u16 i = 0; i < len; i++)
+      so[i] = (char)word(image, offset + i);
+    return so;
+  }
+
+
+  class Entry
+  {
+  public:
+    Entry(const chunk& image, u16 offset, u16 size)
+      : image(image), off(offset), fields(size)
+    {
+      for (u16 i = 0; i < size; i++)
+        fields[i] = word(image, offset + i);
+    }
+
+    u16 offset() const { return off; }
+    string title() const { return str(fields[0]); }
+    string description() const { return str(fields[1]); }
+
+    vector<string> exits() const;
+    vector<Entry> links() const;
+
+    string id() const {
+      stringstream so;
+      so << setfill('0') << hex << setw(4) << off;
+      return so.str();
+    }
+
+  private:
+    string strref(size_t offset) const;
+    string str(u16 offset) const;
+
+  private:
+    const chunk& image;
+    u16 off;
+    chunk fields;
+  };
+
+  inline string Entry::strref(size_t offset) const
+  {
+    return str(word(image, offset));
+  }
+
+  inline string Entry::str(u16 offset) const
+  {
+    return paiv::str(image, offset);
+  }
+
+
+  inline vector<string> Entry::exits() const
+  {
+    u16 p = fields[2];
+    int n = word(image, p++);
+
+    vector<string> res;
+
+    for (; n > 0; n--)
+      res.push_back(strref(p++));
+
+    return res;
+  }
+
+  inline vector<Entry> Entry::links() const
+  {
+    u16 p = fields[3];
+    int n = word(image, p++);
+
+    vector<Entry> res;
+
+    for (; n > 0; n--)
+      res.push_back(Entry(image, word(image, p++), 4));
+
+    return res;
+  }
+
+
+  // Game state layout in a running (decrypted) image, see notes/namemap.txt
+
+  class World
+  {
+  public:
+    static const u16 PlayerLocation = 0x0AAC;
+    static const u16 ObjectTable = 0x6AF5;
+    static const u16 VerbTable = 0x6B06;
+    static const u16 Inventory = 0;
+
+    World(const chunk& image) : image(image) {}
+
+    u16 location() const { return word(image, PlayerLocation); }
+    Entry room(u16 address) const { return Entry(image, address, 4); }
+
+    // objects are { name, description, location, handler }
+    vector<u16> objects() const { return table(ObjectTable); }
+    string objectName(u16 object) const { return str(word(image, object)); }
+    u16 objectLocation(u16 object) const { return word(image, object + 2); }
+
+    vector<string> verbs() const;
+
+  private:
+    vector<u16> table(u16 address) const;
+    string str(u16 offset) const;
+
+  private:
+    const chunk& image;
+  };
+
+  inline vector<string> World::verbs() const
+  {
+    vector<string> res;
+    for (u16 p : table(VerbTable))
+      res.push_back(str(p));
+    return res;
+  }
+
+  inline vector<u16> World::table(u16 address) const
+  {
+    u16 n = word(image, address);
+    vector<u16> res(n);
+    for (u16 i = 0; i < n; i++)
+      res[i] = word(image, address + 1 + i);
+    return res;
+  }
+
+  inline string World::str(u16 offset) const
+  {
+    return paiv::str(image, offset);
+  }
+}
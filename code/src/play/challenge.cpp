@@ -1,5012 +0,0 @@
-// challenge.bin
-const u8 challenge_bin[] = {
-  0x15, 0x00, 0x15, 0x00, 0x13, 0x00, 0x57, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x63, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x68, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x53, 0x00, 0x13, 0x00, 0x79, 0x00,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x63, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x43, 0x00, 0x13, 0x00, 0x68, 0x00, 0x13, 0x00, 0x61, 0x00,
-  0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x67, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x21, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x50, 0x00,
-  0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x61, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x63, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x64, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x79, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x75, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x67, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x62, 0x00, 0x13, 0x00, 0x79, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x75, 0x00, 0x13, 0x00, 0x74, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x6e, 0x00,
-  0x13, 0x00, 0x67, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x63, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6c, 0x00,
-  0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x6b, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x68, 0x00,
-  0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x6e, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x68, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x63, 0x00, 0x13, 0x00, 0x68, 0x00,
-  0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x6c, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x67, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x77, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x62, 0x00, 0x13, 0x00, 0x73, 0x00,
-  0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x3a, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x58, 0x00,
-  0x13, 0x00, 0x46, 0x00, 0x13, 0x00, 0x62, 0x00, 0x13, 0x00, 0x51, 0x00,
-  0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x49, 0x00, 0x13, 0x00, 0x52, 0x00,
-  0x13, 0x00, 0x76, 0x00, 0x13, 0x00, 0x46, 0x00, 0x13, 0x00, 0x57, 0x00,
-  0x13, 0x00, 0x63, 0x00, 0x13, 0x00, 0x47, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x13, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x45, 0x00, 0x13, 0x00, 0x78, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x63, 0x00, 0x13, 0x00, 0x75, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x6e, 0x00,
-  0x13, 0x00, 0x67, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x73, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x66, 0x00,
-  0x13, 0x00, 0x2d, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x2e, 0x00,
-  0x13, 0x00, 0x2e, 0x00, 0x13, 0x00, 0x2e, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x13, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x5b, 0x01, 0x13, 0x00, 0x6a, 0x00,
-  0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x66, 0x00, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x69, 0x00,
-  0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00,
-  0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x06, 0x00, 0x66, 0x01,
-  0x06, 0x00, 0x70, 0x01, 0x06, 0x00, 0x8d, 0x01, 0x06, 0x00, 0xe4, 0x01,
-  0x06, 0x00, 0xa8, 0x01, 0x06, 0x00, 0xc5, 0x01, 0x15, 0x00, 0x15, 0x00,
-  0x15, 0x00, 0x15, 0x00, 0x13, 0x00, 0x6a, 0x00, 0x13, 0x00, 0x6d, 0x00,
-  0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6c, 0x00,
-  0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x64, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x2d, 0x00,
-  0x13, 0x00, 0x32, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x00,
-  0x15, 0x00, 0x13, 0x00, 0x6a, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00,
-  0x70, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00,
-  0x61, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00,
-  0x73, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x2d, 0x00, 0x13, 0x00,
-  0x31, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00,
-  0x13, 0x00, 0x6a, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x70, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x61, 0x00,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00, 0x73, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x13, 0x00, 0x31, 0x00,
-  0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00,
-  0x15, 0x00, 0x13, 0x00, 0x6a, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00,
-  0x70, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00,
-  0x61, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00,
-  0x73, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x2b, 0x00, 0x13, 0x00,
-  0x32, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
-  0x32, 0x04, 0x08, 0x00, 0x01, 0x00, 0x32, 0x04, 0x07, 0x00, 0x01, 0x00,
-  0xef, 0x01, 0x06, 0x00, 0x32, 0x04, 0x08, 0x00, 0x00, 0x00, 0xf4, 0x01,
-  0x06, 0x00, 0x32, 0x04, 0x07, 0x00, 0x00, 0x80, 0x45, 0x04, 0x07, 0x00,
-  0x01, 0x80, 0x45, 0x04, 0x07, 0x00, 0x02, 0x80, 0x45, 0x04, 0x07, 0x00,
-  0x03, 0x80, 0x45, 0x04, 0x07, 0x00, 0x04, 0x80, 0x45, 0x04, 0x07, 0x00,
-  0x05, 0x80, 0x45, 0x04, 0x07, 0x00, 0x06, 0x80, 0x45, 0x04, 0x07, 0x00,
-  0x07, 0x80, 0x45, 0x04, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x08, 0x00,
-  0x00, 0x80, 0x5e, 0x04, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x07, 0x00,
-  0x00, 0x80, 0x5e, 0x04, 0x09, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00,
-  0x07, 0x00, 0x00, 0x80, 0x34, 0x02, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00,
-  0x64, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x02, 0x00, 0x07, 0x00, 0x01, 0x80,
-  0x4e, 0x02, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x71, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x01, 0x80, 0x04, 0x00, 0x02, 0x80,
-  0x01, 0x80, 0x02, 0x00, 0x08, 0x00, 0x02, 0x80, 0x86, 0x04, 0x04, 0x00,
-  0x02, 0x80, 0x00, 0x80, 0x01, 0x00, 0x08, 0x00, 0x02, 0x80, 0x86, 0x04,
-  0x05, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x80, 0x08, 0x00, 0x02, 0x80,
-  0x73, 0x04, 0x05, 0x00, 0x02, 0x80, 0x00, 0x80, 0x01, 0x80, 0x07, 0x00,
-  0x02, 0x80, 0x73, 0x04, 0x05, 0x00, 0x02, 0x80, 0x2a, 0x00, 0x2a, 0x00,
-  0x07, 0x00, 0x02, 0x80, 0x73, 0x04, 0x0c, 0x00, 0x00, 0x80, 0xf0, 0x70,
-  0xaa, 0x4c, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xa0, 0x40, 0x08, 0x00,
-  0x01, 0x80, 0x99, 0x04, 0x0d, 0x00, 0x01, 0x80, 0xf0, 0x70, 0xaa, 0x4c,
-  0x04, 0x00, 0x00, 0x80, 0x01, 0x80, 0xfa, 0x7c, 0x07, 0x00, 0x00, 0x80,
-  0xac, 0x02, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x62, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00,
-  0x74, 0x00, 0x13, 0x00, 0x77, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00,
-  0x73, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x0e, 0x00, 0x00, 0x80, 0x00, 0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0xff, 0x7f, 0x08, 0x00, 0x01, 0x80, 0xb8, 0x04, 0x0e, 0x00, 0x00, 0x80,
-  0x55, 0x55, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xaa, 0x2a, 0x08, 0x00,
-  0x01, 0x80, 0xb8, 0x04, 0x11, 0x00, 0x05, 0x05, 0x06, 0x00, 0x09, 0x05,
-  0x03, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xc4, 0x02,
-  0x07, 0x00, 0x01, 0x80, 0x09, 0x05, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0xc2, 0x02, 0x08, 0x00, 0x01, 0x80, 0x09, 0x05, 0x01, 0x00, 0x00, 0x80,
-  0x07, 0x05, 0x11, 0x00, 0x00, 0x80, 0x06, 0x00, 0x09, 0x05, 0x03, 0x00,
-  0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xdb, 0x02, 0x07, 0x00,
-  0x01, 0x80, 0x09, 0x05, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xd9, 0x02,
-  0x08, 0x00, 0x01, 0x80, 0x09, 0x05, 0x09, 0x00, 0x00, 0x80, 0xff, 0x7f,
-  0xff, 0x7f, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xfe, 0x7f, 0x08, 0x00,
-  0x01, 0x80, 0x20, 0x05, 0x04, 0x00, 0x01, 0x80, 0xfe, 0x7f, 0x00, 0x80,
-  0x08, 0x00, 0x01, 0x80, 0x20, 0x05, 0x09, 0x00, 0x00, 0x80, 0x00, 0x40,
-  0x00, 0x40, 0x07, 0x00, 0x00, 0x80, 0x20, 0x05, 0x09, 0x00, 0x00, 0x80,
-  0x00, 0x40, 0x00, 0x40, 0x07, 0x00, 0x00, 0x80, 0x20, 0x05, 0x0a, 0x00,
-  0x00, 0x80, 0x06, 0x00, 0x09, 0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0x2a, 0x00, 0x07, 0x00, 0x01, 0x80, 0x65, 0x05, 0x04, 0x00, 0x01, 0x80,
-  0x00, 0x80, 0x36, 0x00, 0x08, 0x00, 0x01, 0x80, 0x86, 0x05, 0x0a, 0x00,
-  0x00, 0x80, 0x39, 0x30, 0x7b, 0x7d, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0x63, 0x00, 0x08, 0x00, 0x01, 0x80, 0x20, 0x05, 0x0b, 0x00, 0x00, 0x80,
-  0x06, 0x00, 0x03, 0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00,
-  0x08, 0x00, 0x01, 0x80, 0x9d, 0x05, 0x0b, 0x00, 0x00, 0x80, 0x46, 0x00,
-  0x06, 0x00, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x04, 0x00, 0x08, 0x00,
-  0x01, 0x80, 0x9d, 0x05, 0x0a, 0x00, 0x00, 0x80, 0xfe, 0x7f, 0x0f, 0x00,
-  0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xe2, 0x7f, 0x08, 0x00, 0x01, 0x80,
-  0x20, 0x05, 0x06, 0x00, 0x4d, 0x03, 0x20, 0x4e, 0x10, 0x27, 0x0f, 0x00,
-  0x00, 0x80, 0x4b, 0x03, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x20, 0x4e,
-  0x08, 0x00, 0x01, 0x80, 0xd7, 0x04, 0x09, 0x00, 0x02, 0x80, 0x4b, 0x03,
-  0x01, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x01, 0x80,
-  0x00, 0x80, 0x10, 0x27, 0x08, 0x00, 0x01, 0x80, 0xd7, 0x04, 0x01, 0x00,
-  0x00, 0x80, 0x4b, 0x03, 0x10, 0x00, 0x00, 0x80, 0x30, 0x75, 0x0f, 0x00,
-  0x02, 0x80, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x02, 0x80, 0x30, 0x75,
-  0x08, 0x00, 0x01, 0x80, 0xee, 0x04, 0x11, 0x00, 0xbb, 0x06, 0x0f, 0x00,
-  0x00, 0x80, 0xb4, 0x17, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x0b, 0x00,
-  0x08, 0x00, 0x01, 0x80, 0xd7, 0x04, 0x09, 0x00, 0x02, 0x80, 0xb4, 0x17,
-  0x01, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00, 0x01, 0x80,
-  0x00, 0x80, 0x74, 0x00, 0x08, 0x00, 0x01, 0x80, 0xd7, 0x04, 0x10, 0x00,
-  0x02, 0x80, 0x54, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x02, 0x80, 0x04, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x74, 0x00, 0x07, 0x00, 0x01, 0x80, 0xee, 0x04,
-  0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x54, 0x00, 0x08, 0x00, 0x01, 0x80,
-  0xee, 0x04, 0x10, 0x00, 0xa9, 0x03, 0x15, 0x00, 0x10, 0x00, 0xaa, 0x03,
-  0x07, 0x00, 0x06, 0x00, 0xad, 0x03, 0x13, 0x00, 0xd2, 0x03, 0x13, 0x00,
-  0x77, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00,
-  0x6d, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x70, 0x00, 0x13, 0x00, 0x77, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00,
-  0x69, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x66, 0x00, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00,
-  0x69, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x09, 0x00, 0x01, 0x80, 0x0a, 0x00, 0xc0, 0x17, 0x09, 0x00, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0x00, 0x0f, 0x00, 0x02, 0x80, 0xe4, 0x17, 0x09, 0x00,
-  0x02, 0x80, 0x02, 0x80, 0xe4, 0x17, 0x01, 0x00, 0x00, 0x80, 0xe4, 0x17,
-  0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x05, 0x00, 0x03, 0x80,
-  0x00, 0x80, 0x02, 0x80, 0x07, 0x00, 0x03, 0x80, 0xff, 0x03, 0x0f, 0x00,
-  0x04, 0x80, 0x00, 0x80, 0x10, 0x00, 0x01, 0x80, 0x04, 0x80, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x09, 0x00, 0x01, 0x80, 0x01, 0x80,
-  0x01, 0x00, 0x06, 0x00, 0xe8, 0x03, 0x0f, 0x00, 0x00, 0x80, 0xc0, 0x17,
-  0x0f, 0x00, 0x01, 0x80, 0xd3, 0x17, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x01, 0x80, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00,
-  0xc0, 0x17, 0x00, 0x80, 0x10, 0x00, 0xd3, 0x17, 0x2c, 0x00, 0x01, 0x00,
-  0x00, 0x80, 0xc0, 0x17, 0x11, 0x00, 0xee, 0x05, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0xe3, 0x68, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80,
-  0x2e, 0x0a, 0xd0, 0x2a, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x06, 0x00, 0xae, 0x0a,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x6a, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x2f, 0x00,
-  0x13, 0x00, 0x6a, 0x00, 0x13, 0x00, 0x66, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x6e, 0x00, 0x13, 0x00, 0x7a, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00,
-  0x72, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x72, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x67, 0x00, 0x13, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x65, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00,
-  0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x67, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x61, 0x00,
-  0x13, 0x00, 0x63, 0x00, 0x13, 0x00, 0x6b, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x62, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00,
-  0x74, 0x00, 0x13, 0x00, 0x77, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00,
-  0x73, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x61, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x62, 0x00, 0x13, 0x00, 0x69, 0x00,
-  0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x77, 0x00, 0x13, 0x00, 0x69, 0x00,
-  0x13, 0x00, 0x73, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x74, 0x00,
-  0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00,
-  0x6d, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00,
-  0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x77, 0x00, 0x13, 0x00, 0x6d, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x06, 0x00, 0xc4, 0x02, 0x06, 0x00, 0xdb, 0x02, 0x13, 0x00,
-  0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x63, 0x00, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00,
-  0x6c, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x70, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6d, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00, 0x75, 0x00,
-  0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x74, 0x00,
-  0x13, 0x00, 0x68, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x64, 0x00,
-  0x13, 0x00, 0x75, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00, 0x69, 0x00,
-  0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x67, 0x00, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00, 0x64, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x72, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00, 0x75, 0x00,
-  0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00,
-  0x74, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x68, 0x00, 0x13, 0x00,
-  0x69, 0x00, 0x13, 0x00, 0x74, 0x00, 0x13, 0x00, 0x63, 0x00, 0x13, 0x00,
-  0x68, 0x00, 0x13, 0x00, 0x68, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00,
-  0x6b, 0x00, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00,
-  0x67, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00,
-  0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6d, 0x00,
-  0x13, 0x00, 0x75, 0x00, 0x13, 0x00, 0x6c, 0x00, 0x13, 0x00, 0x74, 0x00,
-  0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6f, 0x00, 0x13, 0x00, 0x70, 0x00,
-  0x13, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x13, 0x00, 0x6e, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00, 0x6d, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x64, 0x00, 0x13, 0x00, 0x20, 0x00, 0x13, 0x00,
-  0x6f, 0x00, 0x13, 0x00, 0x70, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x00, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00, 0x04, 0x80,
-  0x02, 0x00, 0x05, 0x80, 0x02, 0x00, 0x06, 0x80, 0x01, 0x00, 0x06, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x05, 0x80, 0x01, 0x80, 0x0f, 0x00, 0x04, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x09, 0x00, 0x03, 0x80,
-  0x01, 0x00, 0x01, 0x80, 0x05, 0x00, 0x00, 0x80, 0x03, 0x80, 0x04, 0x80,
-  0x07, 0x00, 0x00, 0x80, 0xe3, 0x05, 0x09, 0x00, 0x03, 0x80, 0x03, 0x80,
-  0x06, 0x80, 0x0f, 0x00, 0x00, 0x80, 0x03, 0x80, 0x11, 0x00, 0x05, 0x80,
-  0x09, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x07, 0x00, 0x01, 0x80,
-  0xc8, 0x05, 0x03, 0x00, 0x06, 0x80, 0x03, 0x00, 0x05, 0x80, 0x03, 0x00,
-  0x04, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0xf8, 0x05, 0x11, 0x00,
-  0xb2, 0x05, 0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x13, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0x02, 0x80,
-  0x11, 0x00, 0x4d, 0x08, 0x13, 0x00, 0x00, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x03, 0x80, 0x0f, 0x00,
-  0x03, 0x80, 0x00, 0x80, 0x08, 0x00, 0x03, 0x80, 0x1b, 0x06, 0x11, 0x00,
-  0xb2, 0x05, 0x07, 0x00, 0x01, 0x80, 0x1b, 0x06, 0x01, 0x00, 0x00, 0x80,
-  0x02, 0x80, 0x06, 0x00, 0x1e, 0x06, 0x01, 0x00, 0x00, 0x80, 0xff, 0x7f,
-  0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80,
-  0x01, 0x00, 0x01, 0x80, 0x45, 0x06, 0x11, 0x00, 0x07, 0x06, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80, 0x01, 0x00,
-  0x01, 0x80, 0x70, 0x06, 0x11, 0x00, 0x07, 0x06, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x04, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x02, 0x80, 0x08, 0x00, 0x00, 0x80, 0x52, 0x06, 0x01, 0x00, 0x02, 0x80,
-  0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x7f, 0x12, 0x00, 0x02, 0x00,
-  0x03, 0x80, 0x09, 0x00, 0x03, 0x80, 0x02, 0x80, 0x01, 0x00, 0x09, 0x00,
-  0x03, 0x80, 0x03, 0x80, 0x01, 0x80, 0x0f, 0x00, 0x03, 0x80, 0x03, 0x80,
-  0x04, 0x00, 0x03, 0x80, 0x00, 0x80, 0x03, 0x80, 0x07, 0x00, 0x03, 0x80,
-  0x6d, 0x06, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80,
-  0xff, 0x7f, 0x03, 0x00, 0x03, 0x80, 0x12, 0x00, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x01, 0x80, 0x02, 0x80, 0x11, 0x00, 0x83, 0x06, 0x03, 0x00,
-  0x01, 0x80, 0x08, 0x00, 0x00, 0x80, 0x82, 0x06, 0x01, 0x00, 0x02, 0x80,
-  0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0xff, 0x7f, 0x12, 0x00, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00,
-  0x04, 0x80, 0x0f, 0x00, 0x03, 0x80, 0x00, 0x80, 0x0f, 0x00, 0x04, 0x80,
-  0x01, 0x80, 0x04, 0x00, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80, 0x08, 0x00,
-  0x02, 0x80, 0xaf, 0x06, 0x0d, 0x00, 0x02, 0x80, 0x03, 0x80, 0x04, 0x80,
-  0x08, 0x00, 0x02, 0x80, 0xaa, 0x06, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80,
-  0x01, 0x00, 0x01, 0x80, 0x53, 0x06, 0x11, 0x00, 0xb2, 0x05, 0x08, 0x00,
-  0x01, 0x80, 0xaf, 0x06, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x06, 0x00,
-  0xb2, 0x06, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x03, 0x00, 0x04, 0x80,
-  0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x01, 0x80, 0xb4, 0x17, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x0a, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x11, 0x00,
-  0x4d, 0x08, 0x01, 0x00, 0x01, 0x80, 0x54, 0x41, 0x11, 0x00, 0x4d, 0x08,
-  0x03, 0x00, 0x01, 0x80, 0x10, 0x00, 0x01, 0x80, 0x00, 0x80, 0x09, 0x00,
-  0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x04, 0x00, 0x00, 0x80, 0x62, 0x75,
-  0x01, 0x80, 0x08, 0x00, 0x00, 0x80, 0xc2, 0x06, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00, 0x04, 0x80, 0x02, 0x00,
-  0x05, 0x80, 0x09, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x05, 0x80, 0x00, 0x00, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x05, 0x00, 0x03, 0x80, 0x00, 0x80,
-  0x02, 0x80, 0x07, 0x00, 0x03, 0x80, 0x18, 0x07, 0x14, 0x00, 0x04, 0x80,
-  0x04, 0x00, 0x03, 0x80, 0x04, 0x80, 0x0a, 0x00, 0x07, 0x00, 0x03, 0x80,
-  0x18, 0x07, 0x10, 0x00, 0x00, 0x80, 0x04, 0x80, 0x09, 0x00, 0x05, 0x80,
-  0x05, 0x80, 0x01, 0x00, 0x06, 0x00, 0xfb, 0x06, 0x10, 0x00, 0x01, 0x80,
-  0x05, 0x80, 0x04, 0x00, 0x03, 0x80, 0x04, 0x80, 0x0a, 0x00, 0x07, 0x00,
-  0x03, 0x80, 0x26, 0x07, 0x14, 0x00, 0x04, 0x80, 0x06, 0x00, 0x1b, 0x07,
-  0x03, 0x00, 0x05, 0x80, 0x03, 0x00, 0x04, 0x80, 0x03, 0x00, 0x03, 0x80,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x03, 0x80, 0x02, 0x00, 0x04, 0x80, 0x02, 0x00, 0x05, 0x80, 0x02, 0x00,
-  0x06, 0x80, 0x01, 0x00, 0x06, 0x80, 0x01, 0x00, 0x09, 0x00, 0x04, 0x80,
-  0x03, 0x80, 0x06, 0x80, 0x0f, 0x00, 0x04, 0x80, 0x04, 0x80, 0x09, 0x00,
-  0x05, 0x80, 0xed, 0x17, 0x06, 0x80, 0x10, 0x00, 0x05, 0x80, 0x04, 0x80,
-  0x09, 0x00, 0x06, 0x80, 0x06, 0x80, 0x01, 0x00, 0x0f, 0x00, 0x05, 0x80,
-  0xed, 0x17, 0x05, 0x00, 0x04, 0x80, 0x06, 0x80, 0x05, 0x80, 0x08, 0x00,
-  0x04, 0x80, 0x3c, 0x07, 0x01, 0x00, 0x03, 0x80, 0x00, 0x00, 0x01, 0x00,
-  0x04, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x05, 0x80, 0xed, 0x17, 0x0b, 0x00,
-  0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x09, 0x00, 0x05, 0x80, 0x05, 0x80,
-  0xed, 0x17, 0x09, 0x00, 0x05, 0x80, 0x05, 0x80, 0x01, 0x00, 0x0f, 0x00,
-  0x06, 0x80, 0x05, 0x80, 0x0a, 0x00, 0x06, 0x80, 0x06, 0x80, 0x81, 0x14,
-  0x09, 0x00, 0x06, 0x80, 0x06, 0x80, 0x39, 0x30, 0x10, 0x00, 0x05, 0x80,
-  0x06, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x01, 0x80, 0x06, 0x80, 0x11, 0x00, 0x4d, 0x08, 0x01, 0x00, 0x06, 0x80,
-  0x00, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0f, 0x00,
-  0x05, 0x80, 0x01, 0x80, 0x0b, 0x00, 0x06, 0x80, 0x06, 0x80, 0x05, 0x80,
-  0x09, 0x00, 0x06, 0x80, 0x06, 0x80, 0x01, 0x00, 0x05, 0x00, 0x05, 0x80,
-  0x06, 0x80, 0x02, 0x80, 0x07, 0x00, 0x05, 0x80, 0xa0, 0x07, 0x01, 0x00,
-  0x03, 0x80, 0x01, 0x00, 0x09, 0x00, 0x06, 0x80, 0x06, 0x80, 0x01, 0x80,
-  0x0f, 0x00, 0x06, 0x80, 0x06, 0x80, 0x09, 0x00, 0x04, 0x80, 0x04, 0x80,
-  0x01, 0x00, 0x09, 0x00, 0x05, 0x80, 0x04, 0x80, 0xf1, 0x17, 0x10, 0x00,
-  0x05, 0x80, 0x06, 0x80, 0x0f, 0x00, 0x05, 0x80, 0xf1, 0x17, 0x04, 0x00,
-  0x05, 0x80, 0x04, 0x80, 0x05, 0x80, 0x08, 0x00, 0x05, 0x80, 0x5e, 0x07,
-  0x08, 0x00, 0x03, 0x80, 0x58, 0x07, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0xf1, 0x17, 0x11, 0x00, 0xee, 0x05, 0x03, 0x00, 0x00, 0x80,
-  0x03, 0x00, 0x06, 0x80, 0x03, 0x00, 0x05, 0x80, 0x03, 0x00, 0x04, 0x80,
-  0x03, 0x00, 0x03, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00,
-  0x04, 0x80, 0x02, 0x00, 0x05, 0x80, 0x01, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x01, 0x00, 0x05, 0x80, 0x00, 0x00, 0x08, 0x00, 0x00, 0x80, 0x2c, 0x08,
-  0x04, 0x00, 0x04, 0x80, 0x02, 0x80, 0x10, 0x27, 0x01, 0x00, 0x03, 0x80,
-  0x00, 0x80, 0x07, 0x00, 0x04, 0x80, 0xf8, 0x07, 0x0a, 0x00, 0x01, 0x80,
-  0x02, 0x80, 0x0a, 0x00, 0x0b, 0x00, 0x03, 0x80, 0x00, 0x80, 0x01, 0x80,
-  0x01, 0x00, 0x04, 0x80, 0x00, 0x00, 0x0a, 0x00, 0x02, 0x80, 0x02, 0x80,
-  0xff, 0x7f, 0x08, 0x00, 0x03, 0x80, 0x0c, 0x08, 0x09, 0x00, 0x04, 0x80,
-  0x04, 0x80, 0x01, 0x00, 0x09, 0x00, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80,
-  0x06, 0x00, 0xff, 0x07, 0x0a, 0x00, 0x02, 0x80, 0x02, 0x80, 0xff, 0x7f,
-  0x0a, 0x00, 0x03, 0x80, 0x04, 0x80, 0x02, 0x80, 0x0a, 0x00, 0x03, 0x80,
-  0x03, 0x80, 0xff, 0x7f, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x03, 0x80,
-  0x09, 0x00, 0x04, 0x80, 0x04, 0x80, 0x30, 0x00, 0x0a, 0x00, 0x02, 0x80,
-  0x02, 0x80, 0x0a, 0x00, 0x09, 0x00, 0x05, 0x80, 0x05, 0x80, 0x01, 0x00,
-  0x02, 0x00, 0x04, 0x80, 0x06, 0x00, 0xe3, 0x07, 0x07, 0x00, 0x05, 0x80,
-  0x33, 0x08, 0x13, 0x00, 0x30, 0x00, 0x06, 0x00, 0x40, 0x08, 0x08, 0x00,
-  0x05, 0x80, 0x40, 0x08, 0x03, 0x00, 0x00, 0x80, 0x13, 0x00, 0x00, 0x80,
-  0x09, 0x00, 0x05, 0x80, 0x05, 0x80, 0xff, 0x7f, 0x06, 0x00, 0x33, 0x08,
-  0x03, 0x00, 0x05, 0x80, 0x03, 0x00, 0x04, 0x80, 0x03, 0x00, 0x03, 0x80,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x0c, 0x00,
-  0x02, 0x80, 0x00, 0x80, 0x01, 0x80, 0x0e, 0x00, 0x02, 0x80, 0x02, 0x80,
-  0x0d, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x0c, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x12, 0x00, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x05, 0x00,
-  0x01, 0x80, 0x01, 0x80, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x02, 0x80,
-  0x05, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x80, 0x0a, 0x00, 0x01, 0x80,
-  0x01, 0x80, 0xff, 0x7f, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80,
-  0x01, 0x00, 0x01, 0x80, 0x02, 0x80, 0x03, 0x00, 0x02, 0x80, 0x12, 0x00,
-  0x08, 0x00, 0x00, 0x80, 0xc1, 0x08, 0x08, 0x00, 0x01, 0x80, 0xc1, 0x08,
-  0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x05, 0x00, 0x02, 0x80,
-  0x01, 0x80, 0x00, 0x80, 0x07, 0x00, 0x02, 0x80, 0x9c, 0x08, 0x01, 0x00,
-  0x02, 0x80, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00,
-  0x01, 0x80, 0x02, 0x80, 0x01, 0x00, 0x02, 0x80, 0x00, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80,
-  0x05, 0x00, 0x03, 0x80, 0x01, 0x80, 0x00, 0x80, 0x07, 0x00, 0x03, 0x80,
-  0xb9, 0x08, 0x09, 0x00, 0x02, 0x80, 0x02, 0x80, 0xff, 0x7f, 0x07, 0x00,
-  0x02, 0x80, 0xa2, 0x08, 0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x06, 0x00,
-  0xbc, 0x08, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x03, 0x00, 0x03, 0x80,
-  0x03, 0x00, 0x02, 0x80, 0x12, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00,
-  0x01, 0x00, 0x01, 0x80, 0x00, 0x00, 0x12, 0x00, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x08, 0x00, 0x01, 0x80, 0xe4, 0x08, 0x09, 0x00,
-  0x01, 0x80, 0x01, 0x80, 0xff, 0x7f, 0x0c, 0x00, 0x02, 0x80, 0x00, 0x80,
-  0x00, 0x40, 0x0a, 0x00, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x08, 0x00,
-  0x02, 0x80, 0xcc, 0x08, 0x0d, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00,
-  0x06, 0x00, 0xcc, 0x08, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x01, 0x80, 0x05, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0x0e, 0x00, 0x07, 0x00, 0x01, 0x80, 0x05, 0x09, 0x01, 0x00, 0x01, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x08, 0x00, 0x01, 0x80,
-  0x08, 0x09, 0x09, 0x00, 0x01, 0x80, 0x01, 0x80, 0xff, 0x7f, 0x0a, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x06, 0x00, 0xf8, 0x08, 0x01, 0x00,
-  0x00, 0x80, 0xff, 0x7f, 0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x06, 0x00,
-  0xae, 0x0a, 0xfe, 0x17, 0x08, 0x18, 0x14, 0x69, 0x17, 0x69, 0x00, 0x00,
-  0xce, 0x18, 0xd8, 0x18, 0x1a, 0x69, 0x1c, 0x69, 0x00, 0x00, 0x29, 0x19,
-  0x33, 0x19, 0x1e, 0x69, 0x21, 0x69, 0x00, 0x00, 0xc5, 0x19, 0xcf, 0x19,
-  0x24, 0x69, 0x27, 0x69, 0x00, 0x00, 0x37, 0x1a, 0x41, 0x1a, 0x2a, 0x69,
-  0x2d, 0x69, 0x00, 0x00, 0x0a, 0x1b, 0x16, 0x1b, 0x30, 0x69, 0x33, 0x69,
-  0x00, 0x00, 0x9e, 0x1b, 0xb7, 0x1b, 0x36, 0x69, 0x38, 0x69, 0x00, 0x00,
-  0x66, 0x1c, 0x72, 0x1c, 0x3a, 0x69, 0x3d, 0x69, 0x00, 0x00, 0x4e, 0x1d,
-  0x5a, 0x1d, 0x40, 0x69, 0x42, 0x69, 0x00, 0x00, 0xc0, 0x1d, 0xcc, 0x1d,
-  0x44, 0x69, 0x47, 0x69, 0x00, 0x00, 0x77, 0x1e, 0x7f, 0x1e, 0x4a, 0x69,
-  0x4e, 0x69, 0x00, 0x00, 0x47, 0x1f, 0x52, 0x69, 0x55, 0x69, 0x58, 0x69,
-  0x00, 0x00, 0xe3, 0x1f, 0xf3, 0x1f, 0x5b, 0x69, 0x61, 0x69, 0x9e, 0x0e,
-  0x8c, 0x20, 0x9c, 0x20, 0x67, 0x69, 0x6b, 0x69, 0xa2, 0x0e, 0xe5, 0x20,
-  0xf5, 0x20, 0x6f, 0x69, 0x73, 0x69, 0xac, 0x0e, 0x3e, 0x21, 0x4e, 0x21,
-  0x77, 0x69, 0x7c, 0x69, 0xb6, 0x0e, 0xe1, 0x21, 0xf1, 0x21, 0x81, 0x69,
-  0x85, 0x69, 0xc0, 0x0e, 0x3a, 0x22, 0x4a, 0x22, 0x89, 0x69, 0x8e, 0x69,
-  0xca, 0x0e, 0xe4, 0x22, 0xf4, 0x22, 0x93, 0x69, 0x97, 0x69, 0xd4, 0x0e,
-  0x3d, 0x23, 0x4d, 0x23, 0x9b, 0x69, 0x9d, 0x69, 0xde, 0x0e, 0x8a, 0x23,
-  0x9a, 0x23, 0x9f, 0x69, 0xa1, 0x69, 0x00, 0x00, 0xd7, 0x23, 0xe7, 0x23,
-  0xa3, 0x69, 0xa6, 0x69, 0x48, 0x0e, 0x2b, 0x24, 0x38, 0x24, 0xa9, 0x69,
-  0xac, 0x69, 0x48, 0x0e, 0xb5, 0x24, 0xc2, 0x24, 0xaf, 0x69, 0xb2, 0x69,
-  0x48, 0x0e, 0xef, 0x24, 0xfc, 0x24, 0xb5, 0x69, 0xb8, 0x69, 0x48, 0x0e,
-  0x29, 0x25, 0x36, 0x25, 0xbb, 0x69, 0xbe, 0x69, 0x48, 0x0e, 0xa5, 0x25,
-  0xab, 0x25, 0xc1, 0x69, 0xc4, 0x69, 0x00, 0x00, 0xaf, 0x26, 0xb5, 0x26,
-  0xc7, 0x69, 0xca, 0x69, 0x00, 0x00, 0x77, 0x27, 0x7d, 0x27, 0xcd, 0x69,
-  0xd2, 0x69, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x28, 0xbf, 0x28, 0xe3, 0x69,
-  0xe5, 0x69, 0x35, 0x0f, 0x6d, 0x29, 0x73, 0x29, 0xe7, 0x69, 0xea, 0x69,
-  0x00, 0x00, 0x08, 0x2a, 0x0e, 0x2a, 0xed, 0x69, 0xef, 0x69, 0x00, 0x00,
-  0x8c, 0x2a, 0x92, 0x2a, 0xf1, 0x69, 0xf4, 0x69, 0x00, 0x00, 0x4e, 0x2b,
-  0x54, 0x2b, 0xf7, 0x69, 0xf9, 0x69, 0x00, 0x00, 0x03, 0x2c, 0x18, 0x2c,
-  0xfb, 0x69, 0xfd, 0x69, 0x00, 0x00, 0x20, 0x2d, 0x35, 0x2d, 0xff, 0x69,
-  0x01, 0x6a, 0x00, 0x00, 0xce, 0x2d, 0xd4, 0x2d, 0x03, 0x6a, 0x07, 0x6a,
-  0x00, 0x00, 0x8f, 0x2e, 0x95, 0x2e, 0x0b, 0x6a, 0x0e, 0x6a, 0x00, 0x00,
-  0xa7, 0x2f, 0xad, 0x2f, 0x11, 0x6a, 0x14, 0x6a, 0x00, 0x00, 0xab, 0x30,
-  0xbb, 0x30, 0x17, 0x6a, 0x1b, 0x6a, 0x00, 0x00, 0x93, 0x31, 0xa3, 0x31,
-  0x1f, 0x6a, 0x23, 0x6a, 0x00, 0x00, 0x2f, 0x32, 0x3f, 0x32, 0x27, 0x6a,
-  0x2a, 0x6a, 0x00, 0x00, 0x32, 0x33, 0x42, 0x33, 0x2d, 0x6a, 0x30, 0x6a,
-  0x00, 0x00, 0x6c, 0x34, 0x7c, 0x34, 0x33, 0x6a, 0x36, 0x6a, 0x00, 0x00,
-  0x7e, 0x35, 0x8c, 0x35, 0x39, 0x6a, 0x3c, 0x6a, 0x00, 0x00, 0x75, 0x36,
-  0x83, 0x36, 0x3f, 0x6a, 0x42, 0x6a, 0x00, 0x00, 0x0a, 0x37, 0x18, 0x37,
-  0x45, 0x6a, 0x49, 0x6a, 0x00, 0x00, 0x6c, 0x38, 0x81, 0x38, 0x4d, 0x6a,
-  0x4f, 0x6a, 0x00, 0x00, 0x2a, 0x39, 0x38, 0x39, 0x51, 0x6a, 0x54, 0x6a,
-  0x03, 0x12, 0xad, 0x39, 0xb8, 0x39, 0x57, 0x6a, 0x5a, 0x6a, 0x76, 0x0f,
-  0x44, 0x3a, 0x4f, 0x3a, 0x5d, 0x6a, 0x61, 0x6a, 0x87, 0x0f, 0xe2, 0x3a,
-  0xed, 0x3a, 0x65, 0x6a, 0x69, 0x6a, 0x98, 0x0f, 0x7e, 0x3b, 0x89, 0x3b,
-  0x6d, 0x6a, 0x71, 0x6a, 0xa9, 0x0f, 0x91, 0x3c, 0x9c, 0x3c, 0x75, 0x6a,
-  0x79, 0x6a, 0xbc, 0x0f, 0x30, 0x3d, 0x3b, 0x3d, 0x7d, 0x6a, 0x82, 0x6a,
-  0xcd, 0x0f, 0xd2, 0x3d, 0xdd, 0x3d, 0x87, 0x6a, 0x8c, 0x6a, 0xde, 0x0f,
-  0x77, 0x3e, 0x82, 0x3e, 0x91, 0x6a, 0x95, 0x6a, 0xef, 0x0f, 0x14, 0x3f,
-  0x1f, 0x3f, 0x99, 0x6a, 0x9d, 0x6a, 0x00, 0x10, 0xb1, 0x3f, 0xbc, 0x3f,
-  0xa1, 0x6a, 0xa6, 0x6a, 0x11, 0x10, 0x55, 0x40, 0x60, 0x40, 0xab, 0x6a,
-  0xb0, 0x6a, 0x22, 0x10, 0xf7, 0x40, 0x02, 0x41, 0xb5, 0x6a, 0xb9, 0x6a,
-  0x33, 0x10, 0x97, 0x41, 0xa9, 0x41, 0xbd, 0x6a, 0xc1, 0x6a, 0x44, 0x10,
-  0x4b, 0x42, 0x56, 0x42, 0xc5, 0x6a, 0xc9, 0x6a, 0x47, 0x10, 0xe7, 0x42,
-  0xf2, 0x42, 0xcd, 0x6a, 0xd1, 0x6a, 0x58, 0x10, 0x85, 0x43, 0x90, 0x43,
-  0xd5, 0x6a, 0xd8, 0x6a, 0x69, 0x10, 0x1c, 0x44, 0x22, 0x44, 0xdb, 0x6a,
-  0xdd, 0x6a, 0x52, 0x12, 0xfd, 0x44, 0x1d, 0x45, 0xdf, 0x6a, 0xe2, 0x6a,
-  0x00, 0x00, 0x8e, 0x45, 0xae, 0x45, 0xe5, 0x6a, 0xe8, 0x6a, 0x00, 0x00,
-  0x1d, 0x46, 0x2f, 0x46, 0xeb, 0x6a, 0xef, 0x6a, 0x00, 0x00, 0x87, 0x46,
-  0x8d, 0x46, 0xf3, 0x6a, 0xf4, 0x6a, 0x75, 0x0e, 0x8e, 0x46, 0x95, 0x46,
-  0x0d, 0x09, 0x70, 0x12, 0x1e, 0x47, 0x2c, 0x47, 0x35, 0x09, 0x00, 0x00,
-  0xa8, 0x47, 0xb0, 0x47, 0xff, 0x7f, 0x15, 0x13, 0x24, 0x48, 0x30, 0x48,
-  0xff, 0x7f, 0x43, 0x13, 0x88, 0x48, 0x8c, 0x48, 0x71, 0x09, 0xbf, 0x12,
-  0xba, 0x48, 0xc3, 0x48, 0x94, 0x09, 0xf0, 0x14, 0x03, 0x49, 0x11, 0x49,
-  0xa9, 0x09, 0x01, 0x15, 0x51, 0x49, 0x5c, 0x49, 0xb3, 0x09, 0x12, 0x15,
-  0xa4, 0x49, 0xb1, 0x49, 0xa4, 0x09, 0x23, 0x15, 0x09, 0x4a, 0x13, 0x4a,
-  0xae, 0x09, 0x34, 0x15, 0x55, 0x4a, 0x60, 0x4a, 0x9f, 0x09, 0x45, 0x15,
-  0xa9, 0x4a, 0xb7, 0x4a, 0xb8, 0x09, 0x00, 0x00, 0xf8, 0x4a, 0xfc, 0x4a,
-  0x3f, 0x0a, 0x00, 0x00, 0x3a, 0x4b, 0x41, 0x4b, 0x53, 0x0a, 0x59, 0x16,
-  0xb8, 0x4b, 0xc5, 0x4b, 0xb8, 0x09, 0x00, 0x00, 0x4d, 0x56, 0x55, 0x56,
-  0xf9, 0x09, 0x00, 0x00, 0x0d, 0x09, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80,
-  0x0f, 0x00, 0x01, 0x80, 0xac, 0x0a, 0x0f, 0x00, 0x00, 0x80, 0xad, 0x0a,
-  0x04, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x07, 0x00, 0x00, 0x80,
-  0xd2, 0x0a, 0x0f, 0x00, 0x00, 0x80, 0xac, 0x0a, 0x09, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x04, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80, 0x08, 0x00,
-  0x00, 0x80, 0xd2, 0x0a, 0x11, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x01, 0x80,
-  0xac, 0x0a, 0x0f, 0x00, 0x00, 0x80, 0xad, 0x0a, 0x04, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x01, 0x80, 0x07, 0x00, 0x00, 0x80, 0xe7, 0x0a, 0x01, 0x00,
-  0x00, 0x80, 0x76, 0x65, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x11, 0x00,
-  0x94, 0x0b, 0x10, 0x00, 0xad, 0x0a, 0x01, 0x80, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x16, 0x6b, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80,
-  0xf0, 0x0b, 0x01, 0x00, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x20, 0x00, 0x01, 0x00, 0x01, 0x80, 0x76, 0x65, 0x11, 0x00, 0xe7, 0x06,
-  0x13, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x01, 0x00, 0x00, 0x80,
-  0x76, 0x65, 0x01, 0x00, 0x01, 0x80, 0x20, 0x00, 0x11, 0x00, 0x23, 0x06,
-  0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xff, 0x7f, 0x08, 0x00, 0x01, 0x80,
-  0x20, 0x0b, 0x0f, 0x00, 0x00, 0x80, 0x76, 0x65, 0x01, 0x00, 0x02, 0x80,
-  0x00, 0x80, 0x0f, 0x00, 0x01, 0x80, 0x76, 0x65, 0x02, 0x00, 0x01, 0x80,
-  0x10, 0x00, 0x76, 0x65, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x06, 0x6b,
-  0x01, 0x00, 0x01, 0x80, 0x76, 0x65, 0x11, 0x00, 0x34, 0x06, 0x03, 0x00,
-  0x01, 0x80, 0x10, 0x00, 0x76, 0x65, 0x01, 0x80, 0x04, 0x00, 0x01, 0x80,
-  0x00, 0x80, 0xff, 0x7f, 0x08, 0x00, 0x01, 0x80, 0x45, 0x0b, 0x01, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x09, 0x00,
-  0x01, 0x80, 0x0e, 0x6b, 0x01, 0x00, 0x09, 0x00, 0x01, 0x80, 0x01, 0x80,
-  0x00, 0x80, 0x0f, 0x00, 0x01, 0x80, 0x01, 0x80, 0x0f, 0x00, 0x03, 0x80,
-  0x76, 0x65, 0x04, 0x00, 0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x07, 0x00,
-  0x03, 0x80, 0x80, 0x0b, 0x0a, 0x00, 0x00, 0x80, 0x02, 0x80, 0xff, 0x7f,
-  0x0f, 0x00, 0x03, 0x80, 0x76, 0x65, 0x09, 0x00, 0x03, 0x80, 0x00, 0x80,
-  0x03, 0x80, 0x08, 0x00, 0x02, 0x80, 0x6c, 0x0b, 0x09, 0x00, 0x03, 0x80,
-  0x03, 0x80, 0xff, 0x7f, 0x0b, 0x00, 0x03, 0x80, 0x03, 0x80, 0x20, 0x00,
-  0x09, 0x00, 0x00, 0x80, 0x76, 0x65, 0x02, 0x80, 0x08, 0x00, 0x02, 0x80,
-  0x7b, 0x0b, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x10, 0x00,
-  0x00, 0x80, 0x03, 0x80, 0x06, 0x00, 0x86, 0x0b, 0x01, 0x00, 0x00, 0x80,
-  0x76, 0x65, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x11, 0x00, 0x01, 0x80,
-  0x07, 0x00, 0x01, 0x80, 0xb6, 0x0a, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x0f, 0x00, 0x01, 0x80, 0x00, 0x80, 0x08, 0x00, 0x01, 0x80, 0xd8, 0x0b,
-  0x11, 0x00, 0x21, 0x17, 0x08, 0x00, 0x00, 0x80, 0xbe, 0x0b, 0x02, 0x00,
-  0x00, 0x80, 0x11, 0x00, 0x66, 0x17, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x08, 0x00, 0x01, 0x80, 0xbe, 0x0b, 0x09, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x80,
-  0x11, 0x00, 0xee, 0x05, 0x13, 0x00, 0x0a, 0x00, 0x06, 0x00, 0xa6, 0x0c,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x28, 0x6b, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05,
-  0x09, 0x00, 0x02, 0x80, 0xc9, 0x07, 0x9e, 0x04, 0x11, 0x00, 0xb2, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x06, 0x00, 0xa6, 0x0c, 0x0f, 0x00, 0x00, 0x80, 0xac, 0x0a, 0x02, 0x00,
-  0x00, 0x80, 0x13, 0x00, 0x3d, 0x00, 0x13, 0x00, 0x3d, 0x00, 0x13, 0x00,
-  0x20, 0x00, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x0f, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x11, 0x00, 0xee, 0x05, 0x13, 0x00, 0x20, 0x00,
-  0x13, 0x00, 0x3d, 0x00, 0x13, 0x00, 0x3d, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x03, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80, 0x0f, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x04, 0x00, 0x01, 0x80, 0x01, 0x80, 0x02, 0x00,
-  0x08, 0x00, 0x01, 0x80, 0x20, 0x0c, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x78, 0x0a, 0x11, 0x00, 0x66, 0x17, 0x01, 0x00, 0x01, 0x80,
-  0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x01, 0x00, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x0f, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x11, 0x00, 0xee, 0x05, 0x13, 0x00, 0x0a, 0x00,
-  0x03, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x11, 0x00, 0xbf, 0x16,
-  0x08, 0x00, 0x00, 0x80, 0x4a, 0x0c, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x3f, 0x6b,
-  0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x9f, 0x14,
-  0x5c, 0x24, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x02, 0x80, 0xac, 0x0a,
-  0x11, 0x00, 0xf4, 0x16, 0x03, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80,
-  0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80, 0x04, 0x00, 0x02, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x54, 0x00,
-  0x13, 0x00, 0x68, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x72, 0x00,
-  0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x20, 0x00, 0x07, 0x00, 0x02, 0x80,
-  0x75, 0x0c, 0x13, 0x00, 0x61, 0x00, 0x13, 0x00, 0x72, 0x00, 0x13, 0x00,
-  0x65, 0x00, 0x06, 0x00, 0x79, 0x0c, 0x13, 0x00, 0x69, 0x00, 0x13, 0x00,
-  0x73, 0x00, 0x13, 0x00, 0x20, 0x00, 0x11, 0x00, 0xd1, 0x07, 0x13, 0x00,
-  0x20, 0x00, 0x13, 0x00, 0x65, 0x00, 0x13, 0x00, 0x78, 0x00, 0x13, 0x00,
-  0x69, 0x00, 0x13, 0x00, 0x74, 0x00, 0x04, 0x00, 0x02, 0x80, 0x00, 0x80,
-  0x01, 0x00, 0x07, 0x00, 0x02, 0x80, 0x90, 0x0c, 0x13, 0x00, 0x73, 0x00,
-  0x13, 0x00, 0x3a, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x03, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00,
-  0x0f, 0x00, 0x00, 0x80, 0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0xb6, 0x16,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x80, 0xac, 0x0a, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x11, 0x00, 0x34, 0x06, 0x04, 0x00, 0x02, 0x80, 0x00, 0x80, 0xff, 0x7f,
-  0x07, 0x00, 0x02, 0x80, 0xe6, 0x0c, 0x0f, 0x00, 0x02, 0x80, 0xac, 0x0a,
-  0x09, 0x00, 0x02, 0x80, 0x02, 0x80, 0x03, 0x00, 0x0f, 0x00, 0x02, 0x80,
-  0x02, 0x80, 0x09, 0x00, 0x02, 0x80, 0x02, 0x80, 0x01, 0x00, 0x09, 0x00,
-  0x02, 0x80, 0x02, 0x80, 0x00, 0x80, 0x0f, 0x00, 0x02, 0x80, 0x02, 0x80,
-  0x10, 0x00, 0xac, 0x0a, 0x02, 0x80, 0x10, 0x00, 0xad, 0x0a, 0x00, 0x00,
-  0x06, 0x00, 0xfe, 0x0c, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x5a, 0x6b, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xbd, 0x2f, 0x2e, 0x3e,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x8c, 0x6b, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0x5e, 0x03, 0x9a, 0x39, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x85, 0x6d, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05,
-  0x09, 0x00, 0x02, 0x80, 0x39, 0x09, 0x40, 0x6b, 0x11, 0x00, 0xb2, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x11, 0x00, 0xf4, 0x16, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x11, 0x00, 0x21, 0x17,
-  0x08, 0x00, 0x00, 0x80, 0x81, 0x0d, 0x09, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0x02, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x80, 0x0f, 0x00, 0x02, 0x80,
-  0xac, 0x0a, 0x04, 0x00, 0x02, 0x80, 0x00, 0x80, 0x02, 0x80, 0x08, 0x00,
-  0x02, 0x80, 0x81, 0x0d, 0x10, 0x00, 0x01, 0x80, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x96, 0x6d, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0xbb, 0x16, 0x2b, 0x59, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x06, 0x00,
-  0x99, 0x0d, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x9e, 0x6d, 0x01, 0x00, 0x01, 0x80,
-  0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x53, 0x1b, 0xa0, 0x2c, 0x11, 0x00,
-  0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x11, 0x00, 0x21, 0x17, 0x08, 0x00, 0x00, 0x80, 0xd3, 0x0d, 0x09, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x01, 0x80,
-  0x07, 0x00, 0x00, 0x80, 0xd3, 0x0d, 0x0f, 0x00, 0x00, 0x80, 0xac, 0x0a,
-  0x10, 0x00, 0x01, 0x80, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xba, 0x6d,
-  0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x08, 0x07,
-  0xec, 0x17, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x06, 0x00, 0xeb, 0x0d, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0xc4, 0x6d, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0x2b, 0x2b, 0x40, 0x2f, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x11, 0x00, 0x21, 0x17, 0x08, 0x00, 0x00, 0x80,
-  0x11, 0x0e, 0x09, 0x00, 0x01, 0x80, 0x00, 0x80, 0x02, 0x00, 0x0f, 0x00,
-  0x01, 0x80, 0x01, 0x80, 0x07, 0x00, 0x01, 0x80, 0x11, 0x0e, 0x09, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x03, 0x00, 0x0f, 0x00, 0x01, 0x80, 0x01, 0x80,
-  0x08, 0x00, 0x01, 0x80, 0x2b, 0x0e, 0x11, 0x00, 0x01, 0x80, 0x06, 0x00,
-  0x43, 0x0e, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xe7, 0x6d, 0x01, 0x00, 0x01, 0x80,
-  0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xd0, 0x23, 0x90, 0x13, 0x11, 0x00,
-  0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x06, 0x00, 0x43, 0x0e, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x0a, 0x6e,
-  0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x0b, 0x21,
-  0x6b, 0x03, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x78, 0x0a, 0x11, 0x00,
-  0x66, 0x17, 0x07, 0x00, 0x00, 0x80, 0x6e, 0x0e, 0x09, 0x00, 0x00, 0x80,
-  0x74, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0xff, 0x7f, 0x09, 0x00,
-  0x00, 0x80, 0x78, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0xff, 0x7f,
-  0x09, 0x00, 0x00, 0x80, 0x70, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80,
-  0xff, 0x7f, 0x10, 0x00, 0xac, 0x0a, 0x58, 0x0a, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x2c, 0x6e, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0xac, 0x1a, 0xb4, 0x2d, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x02, 0x00, 0x01, 0x80, 0x0f, 0x00, 0x01, 0x80, 0x8e, 0x0e,
-  0x0d, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x80, 0x10, 0x00, 0x8e, 0x0e,
-  0x01, 0x80, 0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x10, 0x00, 0x8e, 0x0e,
-  0x00, 0x00, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x11, 0x00, 0x8f, 0x0e, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00, 0x11, 0x00,
-  0x8f, 0x0e, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x04, 0x00, 0x11, 0x00, 0x8f, 0x0e, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x08, 0x00, 0x11, 0x00, 0x8f, 0x0e, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x10, 0x00, 0x11, 0x00,
-  0x8f, 0x0e, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x20, 0x00, 0x11, 0x00, 0x8f, 0x0e, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x40, 0x00, 0x11, 0x00, 0x8f, 0x0e, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x4c, 0x6e,
-  0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x20, 0x07,
-  0xc7, 0x39, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x80, 0x8e, 0x0e,
-  0x01, 0x00, 0x01, 0x80, 0x0a, 0x65, 0x01, 0x00, 0x02, 0x80, 0xff, 0x7f,
-  0x01, 0x00, 0x03, 0x80, 0x8b, 0x6e, 0x11, 0x00, 0x31, 0x07, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x8f, 0x6e, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0x0c, 0x32, 0xde, 0x39, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x10, 0x00,
-  0xac, 0x0a, 0x71, 0x09, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x0f, 0x00, 0x00, 0x80, 0x9e, 0x09,
-  0x0f, 0x00, 0x01, 0x80, 0xdd, 0x69, 0x04, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x01, 0x80, 0x07, 0x00, 0x00, 0x80, 0x64, 0x0f, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0xbb, 0x6e, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80,
-  0x07, 0x25, 0x5c, 0x1d, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x10, 0x00, 0xac, 0x0a,
-  0x99, 0x09, 0x10, 0x00, 0xad, 0x0a, 0x99, 0x09, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x97, 0x65, 0x9d, 0x65, 0xa1, 0x65,
-  0x65, 0x08, 0x6e, 0x08, 0x82, 0x08, 0x00, 0x00, 0x16, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x00,
-  0x01, 0x80, 0x00, 0x00, 0x11, 0x00, 0x7a, 0x10, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x08, 0x00, 0x01, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x11, 0x00, 0xb7, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x11, 0x00, 0x7a, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0x03, 0x00, 0x11, 0x00,
-  0xb7, 0x10, 0x11, 0x00, 0xb5, 0x11, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x01, 0x80, 0x04, 0x00,
-  0x11, 0x00, 0xb7, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x00, 0x01, 0x80, 0x05, 0x00, 0x11, 0x00,
-  0x7a, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x0b, 0x00, 0x01, 0x00, 0x01, 0x80, 0x06, 0x00, 0x11, 0x00, 0xb7, 0x10,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x00, 0x01, 0x80, 0x07, 0x00, 0x11, 0x00, 0x7a, 0x10, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00,
-  0x01, 0x80, 0x08, 0x00, 0x11, 0x00, 0x7a, 0x10, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x01, 0x80,
-  0x09, 0x00, 0x11, 0x00, 0xb7, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80, 0x0a, 0x00,
-  0x11, 0x00, 0x7a, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x01, 0x00, 0x01, 0x80, 0x0b, 0x00, 0x11, 0x00,
-  0xb7, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x11, 0x00, 0x03, 0x12, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80,
-  0x0c, 0x00, 0x11, 0x00, 0x7a, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x09, 0x00, 0x01, 0x00, 0x01, 0x80, 0x0d, 0x00,
-  0x11, 0x00, 0xb7, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x00, 0x01, 0x80, 0x0e, 0x00, 0x11, 0x00,
-  0x7a, 0x10, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x09, 0x00, 0x02, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x0f, 0x00, 0x02, 0x80,
-  0x02, 0x80, 0x07, 0x00, 0x02, 0x80, 0xb0, 0x10, 0x11, 0x00, 0x35, 0x11,
-  0x10, 0x00, 0x6f, 0x0f, 0x00, 0x80, 0x09, 0x00, 0x01, 0x80, 0x00, 0x80,
-  0x69, 0x0f, 0x0f, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0xa8, 0x65, 0x11, 0x00, 0xee, 0x05, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80,
-  0x11, 0x00, 0xee, 0x05, 0x01, 0x00, 0x00, 0x80, 0xe8, 0x65, 0x11, 0x00,
-  0xee, 0x05, 0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x11, 0x00, 0xee, 0x05,
-  0x13, 0x00, 0x2e, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x13, 0x00, 0x0a, 0x00,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x09, 0x00, 0x02, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x0f, 0x00,
-  0x02, 0x80, 0x02, 0x80, 0x07, 0x00, 0x02, 0x80, 0x2e, 0x11, 0x11, 0x00,
-  0x35, 0x11, 0x02, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x80, 0x6f, 0x0f,
-  0x09, 0x00, 0x01, 0x80, 0x00, 0x80, 0x69, 0x0f, 0x0f, 0x00, 0x01, 0x80,
-  0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x0a, 0x66, 0x11, 0x00, 0xee, 0x05,
-  0x01, 0x00, 0x00, 0x80, 0x01, 0x80, 0x11, 0x00, 0xee, 0x05, 0x01, 0x00,
-  0x00, 0x80, 0x3a, 0x66, 0x11, 0x00, 0xee, 0x05, 0x03, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x0f, 0x00, 0x00, 0x80, 0x70, 0x0f,
-  0x0f, 0x00, 0x02, 0x80, 0x6f, 0x0f, 0x09, 0x00, 0x02, 0x80, 0x02, 0x80,
-  0x6c, 0x0f, 0x0f, 0x00, 0x02, 0x80, 0x02, 0x80, 0x11, 0x00, 0x02, 0x80,
-  0x07, 0x00, 0x01, 0x80, 0x27, 0x11, 0x0f, 0x00, 0x01, 0x80, 0x70, 0x0f,
-  0x10, 0x00, 0x70, 0x0f, 0x00, 0x80, 0x05, 0x00, 0x02, 0x80, 0x00, 0x80,
-  0x01, 0x80, 0x08, 0x00, 0x02, 0x80, 0x11, 0x11, 0x02, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x7b, 0x66, 0x11, 0x00, 0xee, 0x05, 0x03, 0x00,
-  0x00, 0x80, 0x05, 0x00, 0x02, 0x80, 0x01, 0x80, 0x00, 0x80, 0x08, 0x00,
-  0x02, 0x80, 0x21, 0x11, 0x02, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x9b, 0x66, 0x11, 0x00, 0xee, 0x05, 0x03, 0x00, 0x00, 0x80, 0x13, 0x00,
-  0x0a, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x06, 0x00, 0x2e, 0x11, 0x11, 0x00,
-  0x34, 0x12, 0x01, 0x00, 0x00, 0x80, 0xbb, 0x66, 0x11, 0x00, 0xee, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00, 0x04, 0x80, 0x02, 0x00,
-  0x05, 0x80, 0x0f, 0x00, 0x05, 0x80, 0x71, 0x0f, 0x05, 0x00, 0x03, 0x80,
-  0x05, 0x80, 0x2f, 0x75, 0x07, 0x00, 0x03, 0x80, 0x52, 0x11, 0x09, 0x00,
-  0x05, 0x80, 0x05, 0x80, 0x01, 0x00, 0x10, 0x00, 0x71, 0x0f, 0x05, 0x80,
-  0x01, 0x00, 0x03, 0x80, 0x00, 0x80, 0x01, 0x00, 0x04, 0x80, 0x01, 0x80,
-  0x09, 0x00, 0x00, 0x80, 0x05, 0x80, 0x02, 0x00, 0x11, 0x00, 0xe9, 0x08,
-  0x0f, 0x00, 0x01, 0x80, 0x72, 0x0f, 0x0d, 0x00, 0x00, 0x80, 0x01, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x01, 0x80, 0x04, 0x80, 0x11, 0x00, 0xc8, 0x08,
-  0x10, 0x00, 0x72, 0x0f, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x73, 0x0f,
-  0x09, 0x00, 0x01, 0x80, 0x05, 0x80, 0x02, 0x00, 0x01, 0x00, 0x02, 0x80,
-  0x04, 0x80, 0x11, 0x00, 0xa3, 0x11, 0x01, 0x00, 0x00, 0x80, 0x74, 0x0f,
-  0x0a, 0x00, 0x01, 0x80, 0x05, 0x80, 0x05, 0x80, 0x0a, 0x00, 0x02, 0x80,
-  0x04, 0x80, 0x04, 0x80, 0x11, 0x00, 0xa3, 0x11, 0x01, 0x00, 0x00, 0x80,
-  0x75, 0x0f, 0x01, 0x00, 0x01, 0x80, 0x0d, 0x00, 0x0a, 0x00, 0x02, 0x80,
-  0x03, 0x80, 0x09, 0x00, 0x0a, 0x00, 0x02, 0x80, 0x02, 0x80, 0x02, 0x80,
-  0x11, 0x00, 0xa3, 0x11, 0x03, 0x00, 0x05, 0x80, 0x03, 0x00, 0x04, 0x80,
-  0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x0f, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x11, 0x00, 0xc8, 0x08, 0x01, 0x00, 0x01, 0x80,
-  0x02, 0x80, 0x11, 0x00, 0x4d, 0x08, 0x03, 0x00, 0x01, 0x80, 0x10, 0x00,
-  0x01, 0x80, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09, 0x00,
-  0x00, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x07, 0x00, 0x00, 0x80, 0x00, 0x12, 0x01, 0x00, 0x00, 0x80, 0xd1, 0x66,
-  0x11, 0x00, 0xee, 0x05, 0x0f, 0x00, 0x00, 0x80, 0x70, 0x0f, 0x04, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x1e, 0x00, 0x07, 0x00, 0x00, 0x80, 0xde, 0x11,
-  0x01, 0x00, 0x00, 0x80, 0xf2, 0x66, 0x11, 0x00, 0xee, 0x05, 0x01, 0x00,
-  0x00, 0x80, 0x1e, 0x67, 0x11, 0x00, 0xee, 0x05, 0x11, 0x00, 0x34, 0x12,
-  0x06, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x80, 0x48, 0x67, 0x11, 0x00,
-  0xee, 0x05, 0x0f, 0x00, 0x00, 0x80, 0x72, 0x0f, 0x09, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x01, 0x00, 0x07, 0x00, 0x00, 0x80, 0xf4, 0x11, 0x01, 0x00,
-  0x00, 0x80, 0x74, 0x67, 0x11, 0x00, 0xee, 0x05, 0x06, 0x00, 0xd5, 0x11,
-  0x01, 0x00, 0x00, 0x80, 0xd8, 0x67, 0x11, 0x00, 0xee, 0x05, 0x09, 0x00,
-  0x00, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0xff, 0x7f,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09, 0x00,
-  0x00, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x07, 0x00, 0x00, 0x80, 0x31, 0x12, 0x01, 0x00, 0x00, 0x80, 0x5d, 0x68,
-  0x11, 0x00, 0xee, 0x05, 0x0f, 0x00, 0x00, 0x80, 0xac, 0x0a, 0x04, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x3f, 0x0a, 0x07, 0x00, 0x00, 0x80, 0x25, 0x12,
-  0x01, 0x00, 0x00, 0x80, 0x65, 0x68, 0x11, 0x00, 0xee, 0x05, 0x06, 0x00,
-  0x2a, 0x12, 0x01, 0x00, 0x00, 0x80, 0x6b, 0x68, 0x11, 0x00, 0xee, 0x05,
-  0x01, 0x00, 0x00, 0x80, 0x71, 0x68, 0x11, 0x00, 0xee, 0x05, 0x11, 0x00,
-  0x34, 0x12, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x10, 0x00, 0x70, 0x0f, 0x16, 0x00, 0x10, 0x00, 0x71, 0x0f, 0x00, 0x00,
-  0x10, 0x00, 0x72, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x73, 0x0f, 0x00, 0x00,
-  0x10, 0x00, 0x74, 0x0f, 0x00, 0x00, 0x10, 0x00, 0x75, 0x0f, 0x00, 0x00,
-  0x09, 0x00, 0x00, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80,
-  0x3f, 0x0a, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x09, 0x00, 0x00, 0x80, 0x9c, 0x0a, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x04, 0x00, 0x00, 0x80, 0x00, 0x80, 0xff, 0x7f, 0x07, 0x00,
-  0x00, 0x80, 0x6d, 0x12, 0x01, 0x00, 0x00, 0x80, 0xc8, 0x68, 0x11, 0x00,
-  0xee, 0x05, 0x10, 0x00, 0xac, 0x0a, 0x12, 0x0a, 0x10, 0x00, 0xad, 0x0a,
-  0x12, 0x0a, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0xd1, 0x6e, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05,
-  0x09, 0x00, 0x02, 0x80, 0xa5, 0x4b, 0x49, 0x1e, 0x11, 0x00, 0xb2, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x92, 0x10, 0x01, 0x00, 0x01, 0x80, 0x0a, 0x65,
-  0x01, 0x00, 0x02, 0x80, 0xff, 0x7f, 0x01, 0x00, 0x03, 0x80, 0xed, 0x6e,
-  0x11, 0x00, 0x31, 0x07, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xf1, 0x6e, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xfe, 0x3f, 0x71, 0x07,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x09, 0x00, 0x00, 0x80, 0x70, 0x0a, 0x02, 0x00, 0x0f, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x07, 0x00, 0x00, 0x80, 0xfa, 0x12, 0x09, 0x00,
-  0x00, 0x80, 0x7c, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0xff, 0x7f,
-  0x09, 0x00, 0x00, 0x80, 0x70, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80,
-  0xff, 0x7f, 0x09, 0x00, 0x00, 0x80, 0x74, 0x0a, 0x02, 0x00, 0x10, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x25, 0x6f, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xc8, 0x05, 0xb5, 0x00,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x06, 0x00, 0x12, 0x13, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x5e, 0x6f, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80,
-  0x2a, 0x4a, 0x45, 0x03, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x09, 0x00, 0x00, 0x80, 0x74, 0x0a,
-  0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0xff, 0x7f, 0x09, 0x00, 0x00, 0x80,
-  0x78, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x00, 0x80, 0x00, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x99, 0x6f, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0x81, 0x1c, 0x76, 0x0c, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x10, 0x00,
-  0xad, 0x0a, 0x00, 0x00, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x09, 0x00, 0x00, 0x80, 0x74, 0x0a, 0x02, 0x00, 0x10, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0x09, 0x00, 0x00, 0x80, 0x78, 0x0a, 0x02, 0x00,
-  0x10, 0x00, 0x00, 0x80, 0xff, 0x7f, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xb3, 0x6f,
-  0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xf9, 0x15,
-  0xeb, 0x0b, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x10, 0x00, 0xad, 0x0a, 0x00, 0x00,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x02, 0x80, 0x02, 0x00,
-  0x03, 0x80, 0x0f, 0x00, 0x02, 0x80, 0xac, 0x0a, 0x04, 0x00, 0x02, 0x80,
-  0x02, 0x80, 0x99, 0x09, 0x07, 0x00, 0x02, 0x80, 0x99, 0x13, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0xcd, 0x6f, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0x09, 0x03, 0xf5, 0x6f, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x06, 0x00,
-  0xd8, 0x14, 0x09, 0x00, 0x02, 0x80, 0x00, 0x80, 0x02, 0x00, 0x10, 0x00,
-  0x02, 0x80, 0xff, 0x7f, 0x0f, 0x00, 0x02, 0x80, 0x9e, 0x09, 0x09, 0x00,
-  0x02, 0x80, 0x02, 0x80, 0xd7, 0x69, 0x09, 0x00, 0x02, 0x80, 0x02, 0x80,
-  0x01, 0x00, 0x0f, 0x00, 0x02, 0x80, 0x02, 0x80, 0x09, 0x00, 0x03, 0x80,
-  0x99, 0x09, 0x01, 0x00, 0x0f, 0x00, 0x03, 0x80, 0x03, 0x80, 0x09, 0x00,
-  0x03, 0x80, 0x03, 0x80, 0x02, 0x80, 0x09, 0x00, 0x02, 0x80, 0x01, 0x80,
-  0x30, 0x00, 0x10, 0x00, 0x03, 0x80, 0x02, 0x80, 0x0f, 0x00, 0x02, 0x80,
-  0x9e, 0x09, 0x09, 0x00, 0x02, 0x80, 0x02, 0x80, 0xdd, 0x69, 0x09, 0x00,
-  0x02, 0x80, 0x02, 0x80, 0x01, 0x00, 0x10, 0x00, 0x02, 0x80, 0x01, 0x80,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xf8, 0x6f, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xb7, 0x0c, 0x2a, 0x09,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0x80,
-  0x09, 0x00, 0x02, 0x80, 0x00, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x80,
-  0x02, 0x80, 0x11, 0x00, 0xee, 0x05, 0x03, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x07, 0x70, 0x01, 0x00, 0x01, 0x80,
-  0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x18, 0x14, 0x4e, 0x5e, 0x11, 0x00,
-  0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0f, 0x00, 0x02, 0x80, 0x9e, 0x09,
-  0x09, 0x00, 0x02, 0x80, 0x02, 0x80, 0x01, 0x00, 0x10, 0x00, 0x9e, 0x09,
-  0x02, 0x80, 0x0f, 0x00, 0x03, 0x80, 0xdd, 0x69, 0x04, 0x00, 0x03, 0x80,
-  0x02, 0x80, 0x03, 0x80, 0x08, 0x00, 0x03, 0x80, 0xd8, 0x14, 0x01, 0x00,
-  0x00, 0x80, 0x00, 0x00, 0x09, 0x00, 0x01, 0x80, 0xdd, 0x69, 0x01, 0x00,
-  0x0f, 0x00, 0x01, 0x80, 0x01, 0x80, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x01, 0x80, 0x09, 0x00, 0x01, 0x80, 0xdd, 0x69, 0x02, 0x00, 0x0f, 0x00,
-  0x01, 0x80, 0x01, 0x80, 0x09, 0x00, 0x02, 0x80, 0xdd, 0x69, 0x03, 0x00,
-  0x0f, 0x00, 0x02, 0x80, 0x02, 0x80, 0x0a, 0x00, 0x02, 0x80, 0x02, 0x80,
-  0x02, 0x80, 0x0a, 0x00, 0x01, 0x80, 0x01, 0x80, 0x02, 0x80, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x09, 0x00, 0x01, 0x80, 0xdd, 0x69,
-  0x04, 0x00, 0x0f, 0x00, 0x01, 0x80, 0x01, 0x80, 0x0a, 0x00, 0x02, 0x80,
-  0x01, 0x80, 0x01, 0x80, 0x0a, 0x00, 0x02, 0x80, 0x02, 0x80, 0x01, 0x80,
-  0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x02, 0x80, 0x09, 0x00, 0x01, 0x80,
-  0xdd, 0x69, 0x05, 0x00, 0x0f, 0x00, 0x01, 0x80, 0x01, 0x80, 0x0a, 0x00,
-  0x01, 0x80, 0x01, 0x80, 0xff, 0x7f, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x01, 0x80, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x8f, 0x01, 0x07, 0x00,
-  0x01, 0x80, 0xc0, 0x14, 0x09, 0x00, 0x02, 0x80, 0x80, 0x0a, 0x02, 0x00,
-  0x10, 0x00, 0x02, 0x80, 0x99, 0x09, 0x09, 0x00, 0x02, 0x80, 0x84, 0x0a,
-  0x02, 0x00, 0x10, 0x00, 0x02, 0x80, 0x99, 0x09, 0x09, 0x00, 0x02, 0x80,
-  0x88, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x02, 0x80, 0x99, 0x09, 0x09, 0x00,
-  0x02, 0x80, 0x8c, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x02, 0x80, 0x99, 0x09,
-  0x09, 0x00, 0x02, 0x80, 0x90, 0x0a, 0x02, 0x00, 0x10, 0x00, 0x02, 0x80,
-  0x99, 0x09, 0x10, 0x00, 0x9e, 0x09, 0x00, 0x00, 0x01, 0x00, 0x00, 0x80,
-  0xd7, 0x69, 0x01, 0x00, 0x01, 0x80, 0xdd, 0x14, 0x11, 0x00, 0xb2, 0x05,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x26, 0x70, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05,
-  0x09, 0x00, 0x02, 0x80, 0xae, 0x19, 0x3a, 0x2b, 0x11, 0x00, 0xb2, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x06, 0x00, 0xd8, 0x14, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x69, 0x70, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xf3, 0x03, 0x76, 0x0f,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00, 0x02, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x02, 0x80, 0x09, 0x00, 0x02, 0x80, 0x99, 0x09,
-  0x01, 0x00, 0x0f, 0x00, 0x02, 0x80, 0x02, 0x80, 0x09, 0x00, 0x02, 0x80,
-  0x02, 0x80, 0x00, 0x80, 0x10, 0x00, 0x02, 0x80, 0x5f, 0x00, 0x03, 0x00,
-  0x02, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0x80, 0x0a, 0x01, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x11, 0x00, 0x71, 0x13, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x84, 0x0a, 0x01, 0x00, 0x01, 0x80, 0x03, 0x00, 0x11, 0x00,
-  0x71, 0x13, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80,
-  0x88, 0x0a, 0x01, 0x00, 0x01, 0x80, 0x05, 0x00, 0x11, 0x00, 0x71, 0x13,
-  0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x8c, 0x0a,
-  0x01, 0x00, 0x01, 0x80, 0x07, 0x00, 0x11, 0x00, 0x71, 0x13, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80,
-  0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x00, 0x80, 0x90, 0x0a, 0x01, 0x00,
-  0x01, 0x80, 0x09, 0x00, 0x11, 0x00, 0x71, 0x13, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x08, 0x00, 0x07, 0x80, 0xe5, 0x15,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0xac, 0x70, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05,
-  0x09, 0x00, 0x02, 0x80, 0x33, 0x04, 0xc1, 0x00, 0x11, 0x00, 0xb2, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x15, 0x00, 0x01, 0x00,
-  0x00, 0x80, 0x04, 0x00, 0x01, 0x00, 0x01, 0x80, 0x01, 0x00, 0x11, 0x00,
-  0x8b, 0x17, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x06, 0x00, 0x08, 0x00,
-  0x01, 0x80, 0xcb, 0x15, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x56, 0x71, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xdd, 0x01, 0x15, 0x2d,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x07, 0x80, 0x01, 0x00,
-  0x01, 0x80, 0x0a, 0x65, 0x01, 0x00, 0x02, 0x80, 0xff, 0x7f, 0x02, 0x00,
-  0x03, 0x80, 0x01, 0x00, 0x03, 0x80, 0x39, 0x72, 0x11, 0x00, 0x31, 0x07,
-  0x03, 0x00, 0x03, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x3d, 0x72, 0x01, 0x00,
-  0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xb3, 0x21, 0xc2, 0x40,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x10, 0x00, 0xac, 0x0a, 0xc2, 0x09, 0x10, 0x00,
-  0xad, 0x0a, 0x00, 0x00, 0x09, 0x00, 0x01, 0x80, 0x94, 0x0a, 0x02, 0x00,
-  0x10, 0x00, 0x01, 0x80, 0xff, 0x7f, 0x06, 0x00, 0x52, 0x16, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0xd8, 0x72, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0xb6, 0x11, 0xaa, 0x1a, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x06, 0x00,
-  0x52, 0x16, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0x69, 0x73, 0x01, 0x00, 0x01, 0x80,
-  0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0x1a, 0x14, 0xd4, 0x3e, 0x11, 0x00,
-  0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x09, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0xdd, 0x69, 0x0f, 0x00, 0x01, 0x80, 0x02, 0x80, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x01, 0x80, 0x0a, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0xac, 0x7b, 0x11, 0x00, 0x4d, 0x08, 0x0f, 0x00, 0x01, 0x80, 0xdd, 0x69,
-  0x09, 0x00, 0x01, 0x80, 0x01, 0x80, 0xdd, 0x69, 0x09, 0x00, 0x02, 0x80,
-  0x02, 0x80, 0x01, 0x00, 0x05, 0x00, 0x01, 0x80, 0x02, 0x80, 0x01, 0x80,
-  0x08, 0x00, 0x01, 0x80, 0x04, 0x16, 0x01, 0x00, 0x01, 0x80, 0x0a, 0x65,
-  0x01, 0x00, 0x02, 0x80, 0xff, 0x7f, 0x02, 0x00, 0x03, 0x80, 0x01, 0x00,
-  0x03, 0x80, 0xdf, 0x73, 0x11, 0x00, 0x31, 0x07, 0x03, 0x00, 0x03, 0x80,
-  0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0xe3, 0x73, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05,
-  0x09, 0x00, 0x02, 0x80, 0x51, 0x09, 0x2e, 0x02, 0x11, 0x00, 0xb2, 0x05,
-  0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x10, 0x00, 0xac, 0x0a, 0xb8, 0x09, 0x10, 0x00, 0xad, 0x0a, 0x00, 0x00,
-  0x06, 0x00, 0x52, 0x16, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80,
-  0x03, 0x00, 0x00, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00,
-  0x00, 0x80, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00,
-  0x00, 0x80, 0x3d, 0x74, 0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00,
-  0x02, 0x80, 0x27, 0x5e, 0x4f, 0x06, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x0f, 0x00,
-  0x00, 0x80, 0x73, 0x0f, 0x0f, 0x00, 0x01, 0x80, 0x74, 0x0f, 0x11, 0x00,
-  0x4d, 0x08, 0x0f, 0x00, 0x01, 0x80, 0x75, 0x0f, 0x11, 0x00, 0x4d, 0x08,
-  0x01, 0x00, 0x01, 0x80, 0x3f, 0x65, 0x01, 0x00, 0x02, 0x80, 0x04, 0x00,
-  0x02, 0x00, 0x03, 0x80, 0x01, 0x00, 0x03, 0x80, 0xf6, 0x74, 0x11, 0x00,
-  0x31, 0x07, 0x03, 0x00, 0x03, 0x80, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xfa, 0x74,
-  0x01, 0x00, 0x01, 0x80, 0xfb, 0x05, 0x09, 0x00, 0x02, 0x80, 0xb9, 0x38,
-  0xb3, 0x2b, 0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x03, 0x80, 0x03, 0x00,
-  0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80, 0x12, 0x00,
-  0x13, 0x00, 0x2d, 0x00, 0x13, 0x00, 0x20, 0x00, 0x11, 0x00, 0xee, 0x05,
-  0x13, 0x00, 0x0a, 0x00, 0x12, 0x00, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00,
-  0x02, 0x80, 0x01, 0x00, 0x00, 0x80, 0xf5, 0x6a, 0x01, 0x00, 0x01, 0x80,
-  0xd6, 0x16, 0x01, 0x00, 0x02, 0x80, 0x00, 0x00, 0x11, 0x00, 0xb2, 0x05,
-  0x01, 0x00, 0x00, 0x80, 0x02, 0x80, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00,
-  0x01, 0x80, 0x12, 0x00, 0x02, 0x00, 0x03, 0x80, 0x02, 0x00, 0x04, 0x80,
-  0x0f, 0x00, 0x03, 0x80, 0xac, 0x0a, 0x09, 0x00, 0x04, 0x80, 0x00, 0x80,
-  0x02, 0x00, 0x0f, 0x00, 0x04, 0x80, 0x04, 0x80, 0x04, 0x00, 0x03, 0x80,
-  0x03, 0x80, 0x04, 0x80, 0x08, 0x00, 0x03, 0x80, 0xef, 0x16, 0x09, 0x00,
-  0x02, 0x80, 0x02, 0x80, 0x01, 0x00, 0x03, 0x00, 0x04, 0x80, 0x03, 0x00,
-  0x03, 0x80, 0x12, 0x00, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x01, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0xf5, 0x6a, 0x01, 0x00, 0x01, 0x80, 0x05, 0x17,
-  0x11, 0x00, 0xb2, 0x05, 0x03, 0x00, 0x01, 0x80, 0x03, 0x00, 0x00, 0x80,
-  0x12, 0x00, 0x02, 0x00, 0x03, 0x80, 0x09, 0x00, 0x03, 0x80, 0x00, 0x80,
-  0x02, 0x00, 0x0f, 0x00, 0x03, 0x80, 0x03, 0x80, 0x04, 0x00, 0x03, 0x80,
-  0x02, 0x80, 0x03, 0x80, 0x08, 0x00, 0x03, 0x80, 0x1e, 0x17, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x11, 0x00, 0xb6, 0x16, 0x03, 0x00, 0x03, 0x80, 0x12, 0x00, 0x02, 0x00,
-  0x01, 0x80, 0x02, 0x00, 0x02, 0x80, 0x01, 0x00, 0x02, 0x80, 0x00, 0x80,
-  0x01, 0x00, 0x00, 0x80, 0xf5, 0x6a, 0x01, 0x00, 0x01, 0x80, 0x4c, 0x17,
-  0x11, 0x00, 0x07, 0x06, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0xff, 0x7f,
-  0x07, 0x00, 0x01, 0x80, 0x44, 0x17, 0x09, 0x00, 0x01, 0x80, 0xf5, 0x6a,
-  0x00, 0x80, 0x09, 0x00, 0x01, 0x80, 0x01, 0x80, 0x01, 0x00, 0x0f, 0x00,
-  0x00, 0x80, 0x01, 0x80, 0x06, 0x00, 0x47, 0x17, 0x01, 0x00, 0x00, 0x80,
-  0x00, 0x00, 0x03, 0x00, 0x02, 0x80, 0x03, 0x00, 0x01, 0x80, 0x12, 0x00,
-  0x02, 0x00, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80, 0x02, 0x80, 0x09, 0x00,
-  0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x80, 0x00, 0x80,
-  0x11, 0x00, 0x83, 0x06, 0x03, 0x00, 0x01, 0x80, 0x08, 0x00, 0x00, 0x80,
-  0x65, 0x17, 0x01, 0x00, 0x02, 0x80, 0x01, 0x80, 0x01, 0x00, 0x01, 0x80,
-  0xff, 0x7f, 0x12, 0x00, 0x02, 0x00, 0x01, 0x80, 0x02, 0x00, 0x02, 0x80,
-  0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0x02, 0x00, 0x0f, 0x00, 0x00, 0x80,
-  0x00, 0x80, 0x08, 0x00, 0x00, 0x80, 0x83, 0x17, 0x0f, 0x00, 0x01, 0x80,
-  0xac, 0x0a, 0x04, 0x00, 0x01, 0x80, 0x00, 0x80, 0x01, 0x80, 0x07, 0x00,
-  0x01, 0x80, 0x83, 0x17, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x06, 0x00,
-  0x86, 0x17, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x03, 0x00, 0x02, 0x80,
-  0x03, 0x00, 0x01, 0x80, 0x12, 0x00, 0x07, 0x00, 0x00, 0x80, 0x93, 0x17,
-  0x09, 0x00, 0x00, 0x80, 0x01, 0x80, 0x01, 0x00, 0x12, 0x00, 0x07, 0x00,
-  0x01, 0x80, 0xa0, 0x17, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0xff, 0x7f,
-  0x01, 0x00, 0x01, 0x80, 0x07, 0x80, 0x11, 0x00, 0x8b, 0x17, 0x12, 0x00,
-  0x02, 0x00, 0x00, 0x80, 0x09, 0x00, 0x01, 0x80, 0x01, 0x80, 0xff, 0x7f,
-  0x11, 0x00, 0x8b, 0x17, 0x01, 0x00, 0x01, 0x80, 0x00, 0x80, 0x03, 0x00,
-  0x00, 0x80, 0x09, 0x00, 0x00, 0x80, 0x00, 0x80, 0xff, 0x7f, 0x11, 0x00,
-  0x8b, 0x17, 0x12, 0x00, 0xcf, 0x17, 0xd9, 0x44, 0x55, 0x74, 0xf6, 0x25,
-  0x60, 0x55, 0xc5, 0x02, 0x03, 0x32, 0xb9, 0x63, 0x36, 0x13, 0xb4, 0x40,
-  0x3e, 0x70, 0xb2, 0x21, 0x46, 0x51, 0xa6, 0x7e, 0x35, 0x2e, 0xb1, 0x5f,
-  0x22, 0x0f, 0xe0, 0x3c, 0x04, 0x6c, 0x80, 0x1d, 0x67, 0x4d, 0xf1, 0x7a,
-  0x10, 0x2a, 0xeb, 0x5b, 0x85, 0x0b, 0x34, 0x3b, 0xdc, 0x68, 0x70, 0x18,
-  0x10, 0x48, 0xd4, 0x79, 0x31, 0x29, 0xad, 0x56, 0xe4, 0x06, 0x0c, 0x36,
-  0xdc, 0x67, 0xa9, 0x17, 0x34, 0x47, 0xd1, 0x74, 0x95, 0x24, 0x7e, 0x54,
-  0x30, 0x04, 0xee, 0x35, 0xf0, 0x65, 0x65, 0x15, 0x35, 0x45, 0xe6, 0x72,
-  0xa3, 0x22, 0x17, 0x52, 0x4c, 0x02, 0xee, 0x33, 0x9f, 0x63, 0x48, 0x13,
-  0x64, 0x43, 0x29, 0x73, 0xd5, 0x20, 0x99, 0x50, 0xa1, 0x00, 0x3e, 0x30,
-  0x10, 0x60, 0x75, 0x10, 0x54, 0x40, 0xb9, 0x71, 0x90, 0x21, 0xfd, 0x51,
-  0xc4, 0x01, 0x2d, 0x31, 0x30, 0x61, 0x05, 0x11, 0x14, 0x41, 0x65, 0x71,
-  0x70, 0x21, 0x4d, 0x51, 0x44, 0x01, 0x5d, 0x31, 0x59, 0x61, 0x13, 0x11,
-  0x3b, 0x41, 0x3a, 0x71, 0x24, 0x21, 0x35, 0x51, 0x2d, 0x01, 0x21, 0x31,
-  0x1c, 0x61, 0x16, 0x11, 0xa3, 0x41, 0x5c, 0x71, 0x5f, 0x21, 0x58, 0x51,
-  0xe4, 0x01, 0x9b, 0x31, 0xf9, 0x61, 0xdb, 0x11, 0x30, 0x40, 0x55, 0x70,
-  0x69, 0x20, 0x52, 0x50, 0xb1, 0x00, 0x9f, 0x30, 0xc3, 0x60, 0x20, 0x13,
-  0x78, 0x43, 0x43, 0x73, 0xd0, 0x23, 0xfe, 0x53, 0x30, 0x02, 0x7c, 0x32,
-  0xbe, 0x62, 0xf1, 0x12, 0x3d, 0x45, 0x7b, 0x75, 0xb7, 0x25, 0xbd, 0x55,
-  0x25, 0x04, 0x79, 0x34, 0xd0, 0x64, 0xd1, 0x14, 0x7c, 0x47, 0xa0, 0x77,
-  0x90, 0x27, 0x0f, 0x56, 0xa5, 0x06, 0xce, 0x36, 0x75, 0x69, 0xd5, 0x19,
-  0x3b, 0x48, 0x53, 0x78, 0xb0, 0x28, 0x1c, 0x5b, 0xaa, 0x0b, 0x8d, 0x3b,
-  0x55, 0x6a, 0xeb, 0x1a, 0x7b, 0x4d, 0x97, 0x7d, 0x1d, 0x2c, 0xa2, 0x5c,
-  0x31, 0x0f, 0xae, 0x3f, 0x70, 0x6e, 0xb8, 0x1e, 0x3b, 0x51, 0xa0, 0x01,
-  0x3e, 0x30, 0xa9, 0x60, 0x25, 0x13, 0xa4, 0x43, 0x1e, 0x72, 0xcb, 0x22,
-  0x34, 0x55, 0xa5, 0x05, 0x71, 0x34, 0xd9, 0x64, 0xe4, 0x17, 0x14, 0x46,
-  0xe4, 0x76, 0x46, 0x29, 0x74, 0x58, 0x97, 0x08, 0x71, 0x3b, 0xce, 0x6b,
-  0xa1, 0x1a, 0x4d, 0x4d, 0xc4, 0x7d, 0xaa, 0x2c, 0x34, 0x5f, 0xd1, 0x0f,
-  0x98, 0x3e, 0x68, 0x71, 0x64, 0x20, 0xf3, 0x50, 0xbf, 0x03, 0x67, 0x32,
-  0x20, 0x65, 0xfd, 0x15, 0xfc, 0x44, 0x3d, 0x77, 0x30, 0x26, 0xe5, 0x56,
-  0x95, 0x09, 0x57, 0x38, 0x71, 0x6b, 0x65, 0x1a, 0xd9, 0x4a, 0x9e, 0x7d,
-  0xe4, 0x2c, 0x5c, 0x5f, 0x30, 0x0e, 0x18, 0x41, 0x35, 0x70, 0xc6, 0x20,
-  0xe3, 0x53, 0x94, 0x02, 0xb2, 0x35, 0x48, 0x64, 0x10, 0x17, 0x61, 0x46,
-  0x7b, 0x79, 0x0a, 0x28, 0x02, 0x5b, 0x3a, 0x0a, 0x25, 0x3d, 0x24, 0x6c,
-  0x7e, 0x1f, 0x75, 0x4e, 0x74, 0x01, 0x14, 0x30, 0x70, 0x63, 0x2e, 0x12,
-  0x2d, 0x45, 0x2a, 0x74, 0x1e, 0x27, 0x45, 0x56, 0x7a, 0x09, 0x60, 0x38,
-  0x51, 0x6b, 0x5f, 0x1a, 0xa6, 0x4d, 0x84, 0x7c, 0xb0, 0x2f, 0xc7, 0x5e,
-  0x31, 0x10, 0x14, 0x43, 0x74, 0x72, 0x4e, 0x25, 0xe4, 0x54, 0xcf, 0x07,
-  0xfb, 0x36, 0x20, 0x68, 0x71, 0x1b, 0x55, 0x4a, 0xd0, 0x7d, 0xe2, 0x2c,
-  0x31, 0x5e, 0x69, 0x11, 0xf1, 0x40, 0xb5, 0x73, 0x74, 0x25, 0x51, 0x54,
-  0xb5, 0x07, 0xfb, 0x36, 0x2d, 0x68, 0x63, 0x1b, 0x99, 0x4a, 0xd1, 0x7d,
-  0x71, 0x2f, 0xa9, 0x5e, 0xc9, 0x11, 0x4d, 0x43, 0xaa, 0x72, 0xd2, 0x25,
-  0x30, 0x57, 0x81, 0x06, 0x26, 0x38, 0x50, 0x6b, 0xf1, 0x1a, 0x0e, 0x4c,
-  0xb1, 0x7f, 0xdf, 0x2e, 0x55, 0x60, 0xa5, 0x13, 0x63, 0x45, 0x8c, 0x74,
-  0x04, 0x26, 0xa5, 0x59, 0x2d, 0x0b, 0xb3, 0x3a, 0x71, 0x6c, 0xf7, 0x1f,
-  0x53, 0x51, 0xb1, 0x00, 0x3f, 0x32, 0xb2, 0x65, 0x36, 0x17, 0xba, 0x46,
-  0x11, 0x78, 0x9c, 0x2b, 0x11, 0x5d, 0xf6, 0x0c, 0x5f, 0x3e, 0xd8, 0x71,
-  0xb0, 0x23, 0x15, 0x55, 0x99, 0x04, 0x73, 0x36, 0x3b, 0x68, 0x9a, 0x1b,
-  0x64, 0x4d, 0xd5, 0x7c, 0xad, 0x2e, 0x01, 0x60, 0xdc, 0x13, 0xb6, 0x45,
-  0x5e, 0x77, 0xe4, 0x26, 0x83, 0x58, 0x2d, 0x0a, 0x3d, 0x3c, 0xf2, 0x6f,
-  0xa5, 0x21, 0x35, 0x53, 0x36, 0x05, 0xf0, 0x34, 0xb7, 0x66, 0x74, 0x18,
-  0x2a, 0x4a, 0xad, 0x7d, 0x84, 0x2f, 0x4a, 0x61, 0x34, 0x13, 0x29, 0x45,
-  0xd5, 0x74, 0x8c, 0x26, 0xb2, 0x58, 0x58, 0x0a, 0x3c, 0x3c, 0x55, 0x6e,
-  0x2d, 0x20, 0xda, 0x53, 0xe5, 0x05, 0xdd, 0x37, 0xa2, 0x69, 0x48, 0x1b,
-  0x55, 0x4d, 0x69, 0x7f, 0x34, 0x31, 0x11, 0x63, 0x18, 0x15, 0x28, 0x47,
-  0x64, 0x79, 0x28, 0x2b, 0x22, 0x5d, 0x32, 0x0f, 0x31, 0x41, 0x75, 0x73,
-  0x36, 0x25, 0x32, 0x57, 0x36, 0x09, 0x6d, 0x3b, 0x11, 0x6d, 0x01, 0x1f,
-  0x62, 0x51, 0x60, 0x03, 0x5e, 0x35, 0x59, 0x67, 0xb1, 0x19, 0x8f, 0x4b,
-  0xf5, 0x7d, 0x95, 0x2f, 0x24, 0x60, 0x00, 0x12, 0x7c, 0x44, 0x51, 0x76,
-  0xad, 0x28, 0x83, 0x5a, 0xd7, 0x0c, 0x65, 0x41, 0x6d, 0x73, 0x4a, 0x25,
-  0x85, 0x57, 0xad, 0x09, 0x26, 0x3a, 0x7c, 0x6c, 0xb3, 0x1e, 0xfe, 0x50,
-  0x7a, 0x05, 0x3b, 0x37, 0xfe, 0x69, 0x98, 0x1b, 0x2a, 0x4c, 0x62, 0x7e,
-  0x82, 0x30, 0xd1, 0x62, 0x7c, 0x17, 0xcc, 0x49, 0xf4, 0x7b, 0x0c, 0x2c,
-  0xb6, 0x5e, 0xd6, 0x10, 0x30, 0x45, 0x96, 0x77, 0x35, 0x28, 0x43, 0x5a,
-  0xf5, 0x0c, 0xf8, 0x41, 0x90, 0x73, 0xc5, 0x25, 0x59, 0x56, 0xf6, 0x08,
-  0x34, 0x3d, 0x96, 0x6f, 0x15, 0x20, 0xa8, 0x52, 0x29, 0x07, 0xae, 0x39,
-  0x70, 0x6a, 0xa1, 0x1c, 0x3b, 0x51, 0xf5, 0x03, 0x32, 0x34, 0xb8, 0x66,
-  0x64, 0x1b, 0xb9, 0x4d, 0x18, 0x7e, 0x80, 0x30, 0x34, 0x65, 0xe8, 0x17,
-  0x5f, 0x48, 0xd8, 0x7a, 0xb0, 0x2f, 0x15, 0x60, 0xb0, 0x12, 0x5a, 0x47,
-  0x32, 0x78, 0xd5, 0x2a, 0x71, 0x5f, 0x9d, 0x11, 0xa0, 0x42, 0x08, 0x77,
-  0xd5, 0x29, 0xb5, 0x5a, 0x34, 0x0f, 0xc6, 0x41, 0x91, 0x72, 0x7b, 0x27,
-  0x21, 0x58, 0xb3, 0x0a, 0xf0, 0x3f, 0x35, 0x70, 0x15, 0x25, 0xe6, 0x57,
-  0xf0, 0x08, 0x64, 0x3d, 0x2b, 0x6e, 0xf8, 0x20, 0xd0, 0x55, 0x55, 0x06,
-  0x71, 0x3b, 0x20, 0x6c, 0xc2, 0x1e, 0xcd, 0x53, 0xaa, 0x04, 0x52, 0x39,
-  0x62, 0x6a, 0x01, 0x1f, 0x3c, 0x50, 0x95, 0x02, 0xf9, 0x37, 0x93, 0x68,
-  0xb0, 0x1d, 0x42, 0x4e, 0x10, 0x03, 0x71, 0x34, 0x7c, 0x69, 0x00, 0x1a,
-  0x50, 0x4f, 0x29, 0x00, 0x25, 0x35, 0x2f, 0x66, 0x3b, 0x1b, 0x3b, 0x4c,
-  0x31, 0x01, 0x26, 0x32, 0x23, 0x67, 0x71, 0x18, 0x64, 0x4d, 0x34, 0x7e,
-  0x1f, 0x33, 0x10, 0x64, 0x34, 0x19, 0x71, 0x4a, 0x58, 0x7f, 0x44, 0x30,
-  0xaa, 0x65, 0x96, 0x16, 0xb0, 0x4b, 0xcc, 0x7c, 0x3b, 0x30, 0x00, 0x65,
-  0x30, 0x16, 0x55, 0x4b, 0xa1, 0x7c, 0x8c, 0x31, 0xc2, 0x62, 0x65, 0x16,
-  0x60, 0x4b, 0x4d, 0x7c, 0x95, 0x31, 0xad, 0x62, 0x21, 0x16, 0x7e, 0x4b,
-  0xb8, 0x7c, 0xfa, 0x31, 0x31, 0x65, 0x66, 0x16, 0xf0, 0x4b, 0xf2, 0x7c,
-  0x22, 0x30, 0x2d, 0x65, 0x92, 0x16, 0xc4, 0x4b, 0x60, 0x7f, 0xb6, 0x30,
-  0x90, 0x65, 0x09, 0x19, 0xa1, 0x4a, 0xd8, 0x7f, 0x60, 0x33, 0x90, 0x64,
-  0x26, 0x18, 0x15, 0x4d, 0xe7, 0x7e, 0x14, 0x32, 0xb0, 0x67, 0xc5, 0x18,
-  0x59, 0x4c, 0xeb, 0x01, 0x3a, 0x35, 0xe0, 0x66, 0x1e, 0x1a, 0xa2, 0x4f,
-  0x36, 0x03, 0xa9, 0x34, 0x38, 0x68, 0xd0, 0x1d, 0x27, 0x51, 0xba, 0x02,
-  0x25, 0x36, 0xa9, 0x6b, 0x2c, 0x1f, 0xc4, 0x50, 0x34, 0x04, 0x84, 0x39,
-  0x66, 0x6d, 0xee, 0x1e, 0x10, 0x52, 0xce, 0x07, 0xa5, 0x3b, 0x0b, 0x6f,
-  0xf5, 0x20, 0x6e, 0x54, 0x00, 0x08, 0x9d, 0x3d, 0x75, 0x71, 0x9d, 0x22,
-  0xa7, 0x56, 0x0c, 0x0a, 0xc6, 0x3f, 0xa0, 0x73, 0x34, 0x27, 0xcc, 0x58,
-  0x83, 0x0c, 0x2d, 0x40, 0x37, 0x74, 0xf2, 0x29, 0xbd, 0x5d, 0x70, 0x11,
-  0x23, 0x45, 0xfd, 0x76, 0xb1, 0x2a, 0x69, 0x5e, 0x64, 0x12, 0xe3, 0x47,
-  0x91, 0x7b, 0x57, 0x2f, 0x66, 0x63, 0x2a, 0x17, 0xc7, 0x48, 0xcd, 0x7c,
-  0xac, 0x30, 0x58, 0x64, 0x62, 0x18, 0x10, 0x4c, 0x78, 0x00, 0x95, 0x35,
-  0xf1, 0x69, 0x93, 0x1d, 0xa0, 0x51, 0x0d, 0x05, 0x44, 0x39, 0x6d, 0x6d,
-  0x71, 0x21, 0x45, 0x55, 0x1c, 0x09, 0x24, 0x3d, 0x23, 0x71, 0x35, 0x25,
-  0x24, 0x59, 0x75, 0x0d, 0x32, 0x41, 0x27, 0x75, 0x3f, 0x29, 0x30, 0x5d,
-  0x64, 0x11, 0x39, 0x45, 0x18, 0x79, 0x00, 0x2d, 0x34, 0x61, 0x61, 0x15,
-  0x5f, 0x49, 0x42, 0x7d, 0xb6, 0x31, 0x8a, 0x65, 0xf1, 0x19, 0xcc, 0x4d,
-  0x74, 0x00, 0x01, 0x34, 0x7f, 0x68, 0x1d, 0x1c, 0xb0, 0x50, 0x85, 0x04,
-  0xd5, 0x38, 0x65, 0x6f, 0x67, 0x23, 0x4a, 0x57, 0x85, 0x0b, 0xf9, 0x3f,
-  0x2c, 0x72, 0x3d, 0x26, 0xb9, 0x5a, 0xe6, 0x0e, 0x74, 0x45, 0x64, 0x79,
-  0xa5, 0x2d, 0xf4, 0x61, 0x30, 0x14, 0x68, 0x48, 0xd0, 0x7c, 0xc1, 0x30,
-  0x7d, 0x67, 0xa8, 0x1b, 0x9e, 0x4f, 0x68, 0x02, 0xaa, 0x36, 0xd2, 0x6a,
-  0x62, 0x21, 0x81, 0x55, 0x3c, 0x08, 0x30, 0x3c, 0xe3, 0x70, 0x12, 0x27,
-  0xb1, 0x5b, 0xd9, 0x0f, 0x58, 0x42, 0x8c, 0x76, 0x50, 0x2d, 0x84, 0x61,
-  0x02, 0x14, 0xa6, 0x48, 0x64, 0x7f, 0xbe, 0x33, 0x31, 0x66, 0xa3, 0x1a,
-  0x31, 0x51, 0x6e, 0x05, 0x04, 0x38, 0xb5, 0x6c, 0x21, 0x23, 0xed, 0x57,
-  0x13, 0x0a, 0x84, 0x3e, 0x62, 0x75, 0xe0, 0x29, 0x10, 0x5c, 0xcc, 0x10,
-  0xa7, 0x47, 0x12, 0x7a, 0xe5, 0x2e, 0x46, 0x65, 0x20, 0x18, 0x9c, 0x4c,
-  0x73, 0x03, 0xce, 0x37, 0xe4, 0x6a, 0x09, 0x21, 0xc2, 0x55, 0xa4, 0x08,
-  0x79, 0x3f, 0xc4, 0x73, 0x84, 0x26, 0x64, 0x5d, 0x27, 0x10, 0xfc, 0x44,
-  0xbc, 0x7b, 0x79, 0x2e, 0x2d, 0x65, 0xb5, 0x19, 0xb3, 0x4c, 0x75, 0x03,
-  0x25, 0x36, 0xe3, 0x6a, 0x97, 0x21, 0x40, 0x54, 0x34, 0x0b, 0x24, 0x3e,
-  0xc3, 0x72, 0xcd, 0x29, 0xbd, 0x5c, 0x52, 0x13, 0x65, 0x46, 0x55, 0x7d,
-  0x32, 0x30, 0xdc, 0x64, 0xfe, 0x1b, 0x99, 0x4e, 0xe4, 0x05, 0x54, 0x38,
-  0x5f, 0x6f, 0x70, 0x22, 0x66, 0x59, 0x16, 0x0c, 0x15, 0x43, 0x21, 0x76,
-  0x22, 0x2d, 0x7d, 0x60, 0x31, 0x17, 0x21, 0x4a, 0x74, 0x01, 0x34, 0x34,
-  0x70, 0x6b, 0x31, 0x1e, 0x21, 0x55, 0x2a, 0x08, 0x14, 0x3f, 0x00, 0x72,
-  0x34, 0x29, 0x64, 0x5c, 0x52, 0x13, 0x42, 0x46, 0xb2, 0x7d, 0x98, 0x30,
-  0xb0, 0x67, 0xd4, 0x1a, 0x74, 0x50, 0x19, 0x07, 0x71, 0x3a, 0x4f, 0x71,
-  0xa3, 0x24, 0x88, 0x5b, 0x90, 0x0e, 0x26, 0x44, 0x7c, 0x7b, 0x44, 0x2e,
-  0x83, 0x65, 0xe0, 0x18, 0x6a, 0x4e, 0x3d, 0x05, 0xf0, 0x38, 0xc1, 0x6f,
-  0x3c, 0x25, 0x70, 0x58, 0xa2, 0x0f, 0xf8, 0x42, 0x64, 0x78, 0x64, 0x2f,
-  0x83, 0x62, 0x85, 0x19, 0x76, 0x4f, 0xa4, 0x02, 0xc2, 0x39, 0x08, 0x6f,
-  0xa8, 0x22, 0xc4, 0x59, 0x30, 0x0f, 0x90, 0x42, 0x3a, 0x78, 0x5a, 0x2f,
-  0xe5, 0x62, 0x1a, 0x18, 0xac, 0x4f, 0x8d, 0x02, 0x5c, 0x38, 0xec, 0x6f,
-  0x73, 0x25, 0x8d, 0x58, 0x04, 0x0e, 0xed, 0x45, 0x2c, 0x7b, 0xb8, 0x2e,
-  0x22, 0x64, 0xb0, 0x1b, 0x74, 0x51, 0xa1, 0x04, 0x3f, 0x3a, 0xfd, 0x71,
-  0x2a, 0x27, 0xa2, 0x5a, 0x04, 0x10, 0x8c, 0x47, 0x77, 0x7d, 0xe0, 0x30,
-  0x10, 0x66, 0xcc, 0x1d, 0xe4, 0x53, 0x0f, 0x09, 0xff, 0x3c, 0x45, 0x72,
-  0x31, 0x28, 0xd5, 0x5f, 0x72, 0x15, 0xcf, 0x48, 0xad, 0x7e, 0x09, 0x34,
-  0xd7, 0x6b, 0xa0, 0x21, 0x34, 0x57, 0xc9, 0x0a, 0x95, 0x40, 0x6c, 0x76,
-  0x20, 0x2c, 0xf4, 0x63, 0xbe, 0x19, 0x72, 0x4f, 0x74, 0x05, 0xfa, 0x38,
-  0xa5, 0x6e, 0x69, 0x24, 0x64, 0x5a, 0xe4, 0x11, 0x9e, 0x47, 0x51, 0x7d,
-  0x7b, 0x33, 0x65, 0x69, 0xc4, 0x1c, 0x85, 0x52, 0xa1, 0x08, 0x1d, 0x3e,
-  0x74, 0x74, 0x14, 0x2a, 0x26, 0x60, 0xde, 0x17, 0xb0, 0x4d, 0x98, 0x03,
-  0xa9, 0x39, 0x5d, 0x6f, 0x44, 0x25, 0x6c, 0x5b, 0x7a, 0x11, 0x00, 0x47,
-  0x03, 0x7d, 0x3e, 0x33, 0x6a, 0x69, 0x5b, 0x1f, 0x32, 0x55, 0x27, 0x0b,
-  0x3d, 0x41, 0x31, 0x77, 0x37, 0x2d, 0x38, 0x63, 0x41, 0x19, 0x3e, 0x4f,
-  0x1f, 0x05, 0x10, 0x3b, 0x60, 0x71, 0x6d, 0x27, 0x3b, 0x5d, 0x7f, 0x13,
-  0xab, 0x49, 0x8d, 0x7f, 0xf5, 0x35, 0x95, 0x6b, 0x36, 0x20, 0x07, 0x56,
-  0x79, 0x0c, 0x59, 0x42, 0xa3, 0x78, 0x88, 0x2e, 0xc9, 0x64, 0x11, 0x1d,
-  0x7c, 0x53, 0x4c, 0x09, 0x83, 0x3f, 0xad, 0x75, 0x36, 0x2a, 0x72, 0x60,
-  0xa0, 0x16, 0xf0, 0x4c, 0x74, 0x05, 0x77, 0x3b, 0xa2, 0x71, 0xf4, 0x27,
-  0x20, 0x5c, 0x6a, 0x12, 0x95, 0x48, 0x85, 0x7e, 0x77, 0x37, 0xb7, 0x6d,
-  0xd5, 0x23, 0x0c, 0x58, 0xaf, 0x0e, 0xce, 0x44, 0x30, 0x7d, 0x94, 0x33,
-  0x27, 0x68, 0x15, 0x1e, 0xe9, 0x54, 0x12, 0x0d, 0xb1, 0x43, 0x8d, 0x79,
-  0x47, 0x2e, 0xe4, 0x64, 0x78, 0x1d, 0x8e, 0x53, 0x50, 0x08, 0xac, 0x3e,
-  0x28, 0x77, 0xb2, 0x2d, 0x3e, 0x62, 0xb2, 0x18, 0x74, 0x51, 0xbc, 0x07,
-  0x24, 0x3c, 0xf3, 0x72, 0x64, 0x2b, 0xed, 0x61, 0x29, 0x16, 0x8a, 0x4c,
-  0x61, 0x05, 0xa5, 0x3b, 0x51, 0x70, 0xdf, 0x26, 0xa1, 0x5f, 0x13, 0x14,
-  0xb7, 0x4a, 0x41, 0x03, 0x74, 0x38, 0x86, 0x6e, 0x65, 0x27, 0xcf, 0x5d,
-  0xa1, 0x12, 0x4d, 0x4b, 0xd8, 0x01, 0xaa, 0x36, 0x63, 0x6f, 0x85, 0x25,
-  0x9f, 0x5a, 0x61, 0x13, 0x20, 0x48, 0xbd, 0x7e, 0xb9, 0x37, 0x61, 0x6c,
-  0x74, 0x25, 0xfc, 0x5b, 0xa3, 0x10, 0x31, 0x49, 0x64, 0x7e, 0xe2, 0x34,
-  0x82, 0x6d, 0x05, 0x22, 0x63, 0x5b, 0x2d, 0x10, 0xd5, 0x46, 0x99, 0x7f,
-  0xac, 0x34, 0x58, 0x6d, 0x62, 0x22, 0x55, 0x5b, 0x3d, 0x10, 0xc1, 0x46,
-  0xb0, 0x7f, 0x9e, 0x34, 0xa5, 0x6d, 0x43, 0x22, 0x10, 0x5b, 0x60, 0x10,
-  0x62, 0x49, 0x00, 0x7e, 0x1e, 0x37, 0x6d, 0x6c, 0x37, 0x25, 0x28, 0x5a,
-  0x20, 0x13, 0x25, 0x48, 0x3b, 0x01, 0x27, 0x36, 0x24, 0x6f, 0x7d, 0x24,
-  0x3d, 0x5d, 0x22, 0x12, 0x05, 0x4b, 0x17, 0x00, 0x34, 0x39, 0x72, 0x6e,
-  0x55, 0x27, 0x44, 0x5c, 0xa3, 0x15, 0x95, 0x4a, 0xe4, 0x03, 0x9b, 0x38,
-  0x5c, 0x70, 0x16, 0x29, 0x7f, 0x5e, 0x53, 0x17, 0xb0, 0x4c, 0x84, 0x05,
-  0xde, 0x3a, 0x30, 0x72, 0x71, 0x2b, 0x21, 0x60, 0x92, 0x19, 0xec, 0x4e,
-  0x27, 0x06, 0x76, 0x3f, 0xc8, 0x74, 0xd3, 0x2d, 0x35, 0x65, 0x79, 0x1a,
-  0xbc, 0x53, 0xf4, 0x08, 0x2a, 0x40, 0x6a, 0x79, 0xd0, 0x2e, 0xd1, 0x67,
-  0x7c, 0x1f, 0xb7, 0x54, 0xdf, 0x0d, 0x18, 0x45, 0xa3, 0x7a, 0xd5, 0x33,
-  0x30, 0x6b, 0x81, 0x20, 0x3c, 0x58, 0x50, 0x11, 0xb0, 0x46, 0x1c, 0x7e,
-  0xad, 0x37, 0xdf, 0x6c, 0x11, 0x24, 0x2c, 0x5d, 0x55, 0x15, 0x96, 0x4a,
-  0x50, 0x02, 0xb4, 0x3b, 0x2b, 0x73, 0xa8, 0x28, 0x70, 0x60, 0xb6, 0x19,
-  0x3b, 0x51, 0xbb, 0x06, 0x24, 0x3e, 0xb4, 0x77, 0x2a, 0x2f, 0xb8, 0x64,
-  0x15, 0x1c, 0xc5, 0x55, 0x75, 0x0d, 0xe9, 0x42, 0x5f, 0x7a, 0xc3, 0x33,
-  0xa3, 0x6b, 0x5d, 0x23, 0xe4, 0x58, 0x5d, 0x10, 0x31, 0x48, 0xd5, 0x01,
-  0x72, 0x39, 0xcf, 0x6e, 0xad, 0x26, 0x09, 0x5e, 0xd7, 0x17, 0xa0, 0x4f,
-  0x38, 0x07, 0x85, 0x3c, 0x99, 0x74, 0x79, 0x2c, 0x64, 0x64, 0xee, 0x1d,
-  0xbe, 0x55, 0x74, 0x0d, 0x24, 0x45, 0xe6, 0x7a, 0xf1, 0x32, 0x3d, 0x6a,
-  0x64, 0x22, 0xd4, 0x5b, 0x9f, 0x13, 0x50, 0x4b, 0x34, 0x03, 0x31, 0x3b,
-  0xc2, 0x70, 0x94, 0x28, 0xe4, 0x60, 0x49, 0x18, 0x7f, 0x50, 0x55, 0x08,
-  0x33, 0x40, 0xc7, 0x79, 0xf1, 0x31, 0x9f, 0x69, 0xe4, 0x21, 0x59, 0x59,
-  0x58, 0x11, 0x60, 0x49, 0x34, 0x01, 0x07, 0x39, 0x02, 0x71, 0x24, 0x29,
-  0x20, 0x61, 0x3a, 0x19, 0x35, 0x51, 0x79, 0x09, 0x74, 0x41, 0x37, 0x79,
-  0x25, 0x31, 0x29, 0x69, 0x64, 0x21, 0x24, 0x59, 0x04, 0x11, 0x45, 0x49,
-  0x71, 0x01, 0x73, 0x39, 0x51, 0x71, 0x49, 0x29, 0xa1, 0x61, 0x8e, 0x19,
-  0xb0, 0x51, 0xcc, 0x09, 0x3b, 0x40, 0x00, 0x78, 0x62, 0x30, 0x1d, 0x68,
-  0xa3, 0x20, 0x9f, 0x58, 0xd1, 0x10, 0x36, 0x4b, 0x64, 0x03, 0x05, 0x3b,
-  0x99, 0x73, 0xe3, 0x2b, 0x64, 0x62, 0x69, 0x1a, 0xb8, 0x52, 0xf0, 0x0a,
-  0x74, 0x45, 0x71, 0x7d, 0xb1, 0x35, 0xef, 0x6d, 0x2f, 0x24, 0x63, 0x5c,
-  0x95, 0x14, 0xd6, 0x4c, 0x67, 0x07, 0xeb, 0x3f, 0x90, 0x77, 0x4d, 0x2e,
-  0x9d, 0x66, 0xd2, 0x1e, 0x65, 0x59, 0xd5, 0x11, 0x35, 0x48, 0x47, 0x00,
-  0xf5, 0x38, 0x5d, 0x73, 0xb4, 0x2b, 0xc1, 0x63, 0x45, 0x1a, 0xe8, 0x52,
-  0x79, 0x0d, 0x80, 0x45, 0x04, 0x7c, 0xa4, 0x34, 0x2a, 0x6f, 0xba, 0x27,
-  0x70, 0x5e, 0xa4, 0x16, 0x21, 0x51, 0xbc, 0x09, 0x33, 0x40, 0xb6, 0x78,
-  0x28, 0x33, 0xb4, 0x6b, 0x50, 0x22, 0x81, 0x5a, 0x7b, 0x15, 0xf2, 0x4d,
-  0x5e, 0x04, 0xda, 0x3c, 0xa5, 0x77, 0x0f, 0x2e, 0xf4, 0x66, 0x15, 0x21,
-  0x3d, 0x58, 0x9b, 0x10, 0x64, 0x4b, 0xd2, 0x03, 0xe4, 0x3a, 0x19, 0x75,
-  0xd8, 0x2d, 0xa0, 0x64, 0x34, 0x1f, 0xc6, 0x57, 0x98, 0x0e, 0x6c, 0x49,
-  0x37, 0x00, 0xf0, 0x38, 0xfe, 0x73, 0x3b, 0x2a, 0x7a, 0x65, 0x91, 0x1d,
-  0xb4, 0x54, 0x72, 0x0f, 0x33, 0x46, 0xe3, 0x7e, 0xfb, 0x39, 0x68, 0x70,
-  0x7b, 0x2b, 0x36, 0x62, 0xc3, 0x1a, 0xcd, 0x55, 0xa7, 0x0c, 0x5c, 0x47,
-  0x66, 0x7e, 0x10, 0x39, 0x26, 0x70, 0xdb, 0x28, 0x41, 0x63, 0xa4, 0x1a,
-  0xab, 0x55, 0x58, 0x0c, 0x10, 0x47, 0x64, 0x7e, 0x66, 0x39, 0x00, 0x70,
-  0x50, 0x2b, 0x3e, 0x62, 0x30, 0x1d, 0x3c, 0x54, 0x3e, 0x0f, 0x31, 0x46,
-  0x3d, 0x01, 0x3b, 0x38, 0x37, 0x73, 0x7d, 0x2a, 0x2d, 0x65, 0x23, 0x1c,
-  0x50, 0x57, 0x04, 0x0e, 0x34, 0x49, 0x69, 0x00, 0x51, 0x3b, 0x5f, 0x72,
-  0xa3, 0x2d, 0x98, 0x64, 0xb0, 0x1f, 0xd6, 0x56, 0x35, 0x10, 0x03, 0x4b,
-  0x75, 0x02, 0x4f, 0x3d, 0xaa, 0x74, 0xcd, 0x2f, 0xd6, 0x66, 0x30, 0x20,
-  0x78, 0x5b, 0x49, 0x12, 0xd0, 0x4d, 0xe2, 0x04, 0x22, 0x3e, 0x3d, 0x79,
-  0xb2, 0x30, 0xfc, 0x6b, 0x3b, 0x25, 0x79, 0x5c, 0xa5, 0x17, 0xf0, 0x4e,
-  0x2d, 0x08, 0x63, 0x43, 0x95, 0x7a, 0xd6, 0x35, 0x77, 0x6f, 0xa0, 0x26,
-  0xde, 0x61, 0x19, 0x1b, 0xe4, 0x52, 0xd0, 0x0d, 0x7f, 0x47, 0x86, 0x7e,
-  0x27, 0x38, 0x1b, 0x73, 0xb0, 0x2a, 0x5d, 0x64, 0x8d, 0x1f, 0xd9, 0x56,
-  0x10, 0x10, 0xe8, 0x4b, 0x61, 0x05, 0x96, 0x3c, 0x04, 0x76, 0xed, 0x31,
-  0x2c, 0x6b, 0xbc, 0x22, 0x26, 0x5c, 0xb0, 0x17, 0x74, 0x51, 0xb7, 0x08,
-  0x22, 0x42, 0xb2, 0x7d, 0x2f, 0x37, 0xa8, 0x6e, 0x1e, 0x28, 0xc5, 0x63,
-  0x6d, 0x1d, 0xea, 0x54, 0x45, 0x0e, 0xdf, 0x49, 0xe4, 0x03, 0x1b, 0x3d,
-  0xf1, 0x74, 0x59, 0x2e, 0x38, 0x68, 0xd4, 0x23, 0x30, 0x5d, 0x9d, 0x14,
-  0x90, 0x4e, 0x05, 0x08, 0xd5, 0x43, 0xe5, 0x7d, 0x77, 0x37, 0xc4, 0x6e,
-  0x86, 0x28, 0x68, 0x62, 0x36, 0x1c, 0xf3, 0x57, 0xf0, 0x11, 0x70, 0x4b,
-  0x2c, 0x05, 0xe1, 0x3c, 0xb5, 0x76, 0x73, 0x30, 0x20, 0x6a, 0xfe, 0x25,
-  0xd0, 0x5f, 0x51, 0x19, 0x7b, 0x53, 0x65, 0x0d, 0xc4, 0x44, 0x85, 0x7e,
-  0xa1, 0x38, 0x1d, 0x72, 0x75, 0x2c, 0x14, 0x66, 0x27, 0x20, 0xc1, 0x5b,
-  0xb0, 0x15, 0x9c, 0x4f, 0xaa, 0x09, 0x49, 0x43, 0x10, 0x7d, 0x72, 0x37,
-  0x71, 0x71, 0x16, 0x2b, 0x04, 0x65, 0x76, 0x1f, 0x64, 0x59, 0x3c, 0x13,
-  0x24, 0x4d, 0x75, 0x07, 0x20, 0x41, 0x3d, 0x7b, 0x35, 0x35, 0x7d, 0x6f,
-  0x33, 0x29, 0x28, 0x63, 0x03, 0x1d, 0x11, 0x57, 0x34, 0x11, 0x60, 0x4b,
-  0x5e, 0x05, 0x49, 0x3f, 0xe8, 0x79, 0xdd, 0x33, 0xe9, 0x6d, 0xda, 0x27,
-  0x21, 0x60, 0x55, 0x1a, 0x64, 0x54, 0x55, 0x0e, 0xad, 0x48, 0x83, 0x02,
-  0xdb, 0x3c, 0x65, 0x79, 0x6d, 0x33, 0x4a, 0x6d, 0x85, 0x27, 0xad, 0x61,
-  0x37, 0x1a, 0x78, 0x54, 0xb5, 0x0e, 0xb5, 0x48, 0x35, 0x05, 0x35, 0x3f,
-  0xa0, 0x79, 0xfc, 0x33, 0x37, 0x6c, 0x7e, 0x26, 0x91, 0x60, 0xc2, 0x1a,
-  0x71, 0x57, 0xe5, 0x11, 0xdc, 0x4b, 0x08, 0x04, 0xa5, 0x3e, 0xd9, 0x78,
-  0x79, 0x35, 0x9b, 0x6f, 0x33, 0x28, 0x15, 0x62, 0xff, 0x1c, 0x08, 0x59,
-  0xb0, 0x13, 0x8d, 0x4d, 0x5f, 0x06, 0xe3, 0x40, 0x34, 0x7d, 0x91, 0x37,
-  0x18, 0x70, 0xa8, 0x2a, 0x64, 0x67, 0xbe, 0x21, 0x31, 0x5a, 0xa3, 0x14,
-  0x31, 0x51, 0xa7, 0x0b, 0x3e, 0x44, 0xf3, 0x7e, 0x40, 0x3b, 0xba, 0x75,
-  0x15, 0x2e, 0x96, 0x68, 0x60, 0x25, 0x81, 0x5f, 0x55, 0x18, 0xcc, 0x52,
-  0xb7, 0x0f, 0x09, 0x48, 0x9b, 0x02, 0x78, 0x3f, 0x3b, 0x78, 0x86, 0x32,
-  0x63, 0x6f, 0x9d, 0x29, 0xa7, 0x62, 0x0c, 0x1f, 0xc6, 0x59, 0xa0, 0x12,
-  0x66, 0x4f, 0xcb, 0x09, 0x90, 0x42, 0x54, 0x7f, 0x2b, 0x38, 0xe8, 0x72,
-  0xf0, 0x2f, 0x74, 0x68, 0x26, 0x25, 0xf0, 0x5f, 0xf0, 0x18, 0x6e, 0x55,
-  0x30, 0x0e, 0xec, 0x48, 0x9e, 0x05, 0x41, 0x3e, 0x7d, 0x7b, 0x2b, 0x34,
-  0xd7, 0x6e, 0xcd, 0x2b, 0xad, 0x64, 0x53, 0x21, 0x30, 0x5a, 0x14, 0x17,
-  0x74, 0x50, 0xd9, 0x0a, 0xf1, 0x47, 0x8f, 0x00, 0xa3, 0x3d, 0x48, 0x76,
-  0x10, 0x33, 0x66, 0x6c, 0x75, 0x29, 0x13, 0x62, 0x15, 0x1f, 0x3f, 0x58,
-  0x2a, 0x15, 0x7d, 0x4e, 0x36, 0x0b, 0x20, 0x44, 0x38, 0x01, 0x39, 0x3a,
-  0x70, 0x77, 0x32, 0x30, 0x22, 0x6d, 0x6d, 0x26, 0x12, 0x63, 0x0c, 0x1c,
-  0x7b, 0x59, 0x69, 0x12, 0x45, 0x4f, 0x40, 0x08, 0xad, 0x45, 0x93, 0x7e,
-  0xf5, 0x3b, 0xc6, 0x74, 0x37, 0x30, 0x10, 0x6d, 0x7e, 0x26, 0x49, 0x63,
-  0xe4, 0x1c, 0x80, 0x59, 0xdf, 0x12, 0x36, 0x4e, 0x67, 0x0b, 0x0b, 0x44,
-  0xd0, 0x01, 0xad, 0x3a, 0x10, 0x76, 0x75, 0x33, 0xb5, 0x6c, 0xb5, 0x29,
-  0x37, 0x65, 0x74, 0x1e, 0xa6, 0x5b, 0xf8, 0x14, 0x36, 0x50, 0x63, 0x0d,
-  0xd0, 0x46, 0xc0, 0x03, 0x6c, 0x3f, 0xb1, 0x78, 0xd5, 0x35, 0x03, 0x71,
-  0xa0, 0x2a, 0xce, 0x67, 0x30, 0x23, 0x81, 0x5c, 0x3b, 0x18, 0x15, 0x55,
-  0xe4, 0x0e, 0x15, 0x4a, 0xa1, 0x07, 0x8d, 0x40, 0x47, 0x7c, 0xe0, 0x39,
-  0x67, 0x75, 0x91, 0x2e, 0x5e, 0x6a, 0xc9, 0x27, 0x33, 0x63, 0xb8, 0x1c,
-  0x23, 0x58, 0xa1, 0x15, 0x5f, 0x51, 0x98, 0x0a, 0x3f, 0x46, 0xae, 0x03,
-  0x37, 0x3f, 0xed, 0x78, 0x13, 0x34, 0x84, 0x71, 0x62, 0x2d, 0xe0, 0x66,
-  0x42, 0x22, 0xc3, 0x5f, 0x59, 0x1b, 0x24, 0x57, 0xff, 0x10, 0x40, 0x4c,
-  0x74, 0x08, 0x94, 0x45, 0x62, 0x01, 0xd8, 0x3a, 0xe4, 0x76, 0x1e, 0x32,
-  0xc4, 0x6f, 0xa4, 0x2b, 0x7a, 0x67, 0xc1, 0x20, 0x99, 0x5c, 0x63, 0x18,
-  0x23, 0x54, 0xbd, 0x11, 0xb9, 0x4d, 0x7b, 0x09, 0x74, 0x45, 0xf4, 0x7e,
-  0xf0, 0x3a, 0x71, 0x76, 0x25, 0x32, 0xff, 0x6f, 0x97, 0x2b, 0x40, 0x67,
-  0x34, 0x23, 0x26, 0x5f, 0xd1, 0x18, 0x9b, 0x54, 0xa1, 0x10, 0x4f, 0x4c,
-  0x7e, 0x08, 0x55, 0x44, 0x32, 0x00, 0xc0, 0x3d, 0xfc, 0x79, 0x91, 0x35,
-  0xe4, 0x71, 0x42, 0x2d, 0x56, 0x69, 0x25, 0x25, 0x76, 0x61, 0x0c, 0x1d,
-  0x1f, 0x59, 0x21, 0x15, 0x31, 0x51, 0x30, 0x0d, 0x39, 0x49, 0x3b, 0x05,
-  0x31, 0x41, 0x26, 0x7d, 0x33, 0x39, 0x38, 0x75, 0x2a, 0x31, 0x39, 0x6d,
-  0x50, 0x29, 0x08, 0x65, 0x7b, 0x21, 0x76, 0x5d, 0x43, 0x19, 0x03, 0x55,
-  0xe4, 0x11, 0xdd, 0x4d, 0xc4, 0x09, 0xdd, 0x45, 0x31, 0x00, 0x55, 0x3c,
-  0x73, 0x78, 0x5c, 0x34, 0xb2, 0x70, 0x88, 0x2c, 0xc2, 0x68, 0x2b, 0x27,
-  0x34, 0x63, 0x40, 0x1f, 0x88, 0x5b, 0xf9, 0x17, 0x21, 0x52, 0x73, 0x0e,
-  0xb4, 0x4a, 0xe6, 0x06, 0x74, 0x45, 0x61, 0x01, 0xbf, 0x3d, 0xbd, 0x79,
-  0x30, 0x34, 0x65, 0x70, 0x95, 0x2c, 0x85, 0x68, 0x71, 0x27, 0xa4, 0x63,
-  0xc3, 0x1f, 0x19, 0x5a, 0xea, 0x16, 0x9d, 0x52, 0x30, 0x11, 0xa1, 0x4d,
-  0x3c, 0x08, 0x50, 0x44, 0xe2, 0x00, 0x18, 0x3f, 0xe4, 0x7b, 0xc4, 0x37,
-  0x43, 0x72, 0xa5, 0x2e, 0x75, 0x6d, 0xc5, 0x29, 0x13, 0x64, 0xbf, 0x20,
-  0x21, 0x5f, 0xab, 0x1b, 0x39, 0x56, 0xa6, 0x12, 0x31, 0x51, 0xf5, 0x0d,
-  0x39, 0x48, 0xb3, 0x04, 0x64, 0x43, 0xb9, 0x7f, 0x18, 0x3a, 0x80, 0x76,
-  0x34, 0x35, 0xf7, 0x71, 0x5f, 0x2c, 0xce, 0x68, 0xaf, 0x27, 0x0e, 0x62,
-  0xb0, 0x1e, 0x42, 0x5d, 0x3c, 0x18, 0x9c, 0x54, 0x73, 0x13, 0xd5, 0x4f,
-  0xe4, 0x0a, 0x02, 0x49, 0xc0, 0x05, 0xa0, 0x40, 0x7a, 0x7f, 0xd6, 0x3b,
-  0xd0, 0x76, 0x64, 0x35, 0x2a, 0x70, 0xe9, 0x2c, 0xbf, 0x6b, 0x35, 0x26,
-  0x35, 0x65, 0xb5, 0x21, 0xa0, 0x5c, 0x7c, 0x1b, 0x37, 0x56, 0xfe, 0x12,
-  0x91, 0x51, 0x42, 0x0c, 0x71, 0x4b, 0x6b, 0x06, 0xb4, 0x42, 0x88, 0x01,
-  0xa5, 0x3c, 0x4e, 0x7b, 0x64, 0x36, 0x72, 0x75, 0x24, 0x30, 0xd4, 0x6c,
-  0xe3, 0x2b, 0x8e, 0x66, 0xa5, 0x25, 0x4a, 0x60, 0x55, 0x1f, 0x02, 0x5a,
-  0x44, 0x19, 0x04, 0x54, 0x03, 0x13, 0x3e, 0x4e, 0x25, 0x0d, 0x3a, 0x48,
-  0x35, 0x07, 0xe5, 0x42, 0x0d, 0x01, 0x3a, 0x3c, 0x25, 0x7b, 0x7d, 0x36,
-  0x25, 0x75, 0x3f, 0x30, 0x15, 0x6f, 0x45, 0x2a, 0x7d, 0x69, 0x6b, 0x24,
-  0x10, 0x63, 0x4c, 0x1e, 0xe4, 0x5d, 0x9e, 0x18, 0xe2, 0x57, 0xd0, 0x12,
-  0x22, 0x50, 0x1c, 0x0f, 0x63, 0x4a, 0x58, 0x09, 0xe4, 0x44, 0x82, 0x03,
-  0xde, 0x3e, 0x65, 0x7c, 0x60, 0x3b, 0x4d, 0x76, 0x95, 0x35, 0xad, 0x70,
-  0x33, 0x2e, 0x78, 0x6d, 0xa3, 0x28, 0xe1, 0x67, 0x74, 0x25, 0x62, 0x60,
-  0xb1, 0x1f, 0xf1, 0x5a, 0x28, 0x18, 0x2d, 0x57, 0x9f, 0x12, 0xc3, 0x51,
-  0x34, 0x0f, 0xb1, 0x4a, 0xd8, 0x09, 0x08, 0x47, 0xe4, 0x02, 0xd0, 0x41,
-  0x7f, 0x7f, 0x86, 0x3a, 0x27, 0x78, 0x15, 0x37, 0xf3, 0x72, 0x1c, 0x30,
-  0xb2, 0x6f, 0xc8, 0x2a, 0x42, 0x68, 0xeb, 0x27, 0x3a, 0x65, 0xc5, 0x20,
-  0x50, 0x5e, 0x8c, 0x1d, 0x64, 0x5b, 0xb9, 0x16, 0x31, 0x54, 0xa7, 0x13,
-  0x3f, 0x51, 0xf5, 0x0c, 0x20, 0x4a, 0xbc, 0x09, 0x37, 0x47, 0xbe, 0x02,
-  0x11, 0x40, 0x82, 0x7f, 0x71, 0x3d, 0xa5, 0x78, 0x5c, 0x36, 0xc8, 0x75,
-  0xa5, 0x33, 0x19, 0x71, 0xe3, 0x2c, 0x15, 0x6a, 0x32, 0x28, 0x80, 0x67,
-  0x62, 0x25, 0xc9, 0x60, 0xac, 0x1e, 0x08, 0x5c, 0xc2, 0x1b, 0xe5, 0x59,
-  0x63, 0x17, 0xc0, 0x52, 0x83, 0x10, 0x79, 0x4e, 0x6a, 0x0c, 0xbd, 0x4b,
-  0xf0, 0x09, 0x41, 0x47, 0x3c, 0x05, 0xf0, 0x40, 0xa2, 0x7e, 0x78, 0x3c,
-  0x64, 0x7a, 0xe4, 0x39, 0x83, 0x77, 0x05, 0x35, 0x75, 0x73, 0x65, 0x31,
-  0xdc, 0x6c, 0x8c, 0x2a, 0xa0, 0x68, 0x59, 0x26, 0x75, 0x64, 0x07, 0x22,
-  0x74, 0x60, 0xdd, 0x1f, 0xf5, 0x5d, 0x8f, 0x1b, 0xa1, 0x59, 0x0d, 0x17,
-  0x47, 0x55, 0x6d, 0x13, 0x7d, 0x51, 0x06, 0x0f, 0x18, 0x4d, 0x6d, 0x0b,
-  0x28, 0x49, 0x38, 0x07, 0x31, 0x45, 0x31, 0x03, 0x27, 0x41, 0x75, 0x7f,
-  0x34, 0x3d, 0x32, 0x7b, 0x33, 0x39, 0x23, 0x77, 0x50, 0x35, 0x0c, 0x73,
-  0x7a, 0x31, 0x71, 0x6f, 0x5f, 0x2d, 0x0d, 0x6b, 0xa5, 0x29, 0xdd, 0x67,
-  0xe3, 0x25, 0xd8, 0x63, 0x35, 0x20, 0x19, 0x5e, 0x7c, 0x1c, 0x58, 0x5a,
-  0xb6, 0x18, 0xc1, 0x56, 0x90, 0x14, 0x28, 0x55, 0x7b, 0x13, 0x56, 0x51,
-  0x83, 0x0f, 0xa0, 0x4d, 0x22, 0x0a, 0x74, 0x48, 0xbc, 0x06, 0xf9, 0x44,
-  0x31, 0x05, 0x71, 0x43, 0xf0, 0x01, 0xfe, 0x3f, 0x25, 0x7c, 0x7b, 0x3a,
-  0x95, 0x78, 0xd7, 0x36, 0x7a, 0x77, 0xe5, 0x35, 0xd2, 0x73, 0x08, 0x30,
-  0xa8, 0x6e, 0xd2, 0x2c, 0x67, 0x6d, 0xdb, 0x2b, 0x52, 0x68, 0x56, 0x26,
-  0xf1, 0x64, 0x0b, 0x25, 0xa1, 0x63, 0xdf, 0x21, 0x5e, 0x5e, 0x83, 0x1c,
-  0x78, 0x5d, 0x84, 0x1b, 0x14, 0x58, 0xa9, 0x16, 0x21, 0x57, 0xaf, 0x15,
-  0x58, 0x52, 0xb1, 0x10, 0x35, 0x51, 0xa7, 0x0f, 0x3b, 0x4c, 0xb3, 0x0a,
-  0x21, 0x4b, 0xbe, 0x09, 0x03, 0x46, 0xe2, 0x04, 0x44, 0x45, 0xe4, 0x03,
-  0x43, 0x40, 0xde, 0x7e, 0xa5, 0x3f, 0x1a, 0x7c, 0xf5, 0x3a, 0x0c, 0x7b,
-  0x1d, 0x38, 0x81, 0x76, 0x30, 0x37, 0xd4, 0x75, 0xb7, 0x32, 0x4d, 0x73,
-  0xc0, 0x31, 0xac, 0x6e, 0x60, 0x2f, 0xc6, 0x6d, 0x98, 0x2a, 0x2d, 0x6b,
-  0x26, 0x28, 0xf1, 0x66, 0xb1, 0x27, 0x76, 0x64, 0x3f, 0x25, 0xbb, 0x63,
-  0xf0, 0x20, 0x3d, 0x61, 0x1d, 0x1e, 0xe2, 0x5c, 0x85, 0x1d, 0x05, 0x5a,
-  0x75, 0x1b, 0x37, 0x58, 0xd5, 0x16, 0xcd, 0x57, 0xa8, 0x14, 0x54, 0x55,
-  0x7b, 0x12, 0x10, 0x53, 0x38, 0x10, 0xcc, 0x4e, 0xb0, 0x0f, 0x89, 0x4c,
-  0xab, 0x0d, 0x0d, 0x4a, 0x52, 0x0b, 0x60, 0x48, 0x34, 0x09, 0x00, 0x46,
-  0x11, 0x07, 0x39, 0x44, 0x21, 0x05, 0x33, 0x42, 0x70, 0x03, 0x37, 0x40,
-  0x2d, 0x01, 0x75, 0x3e, 0x31, 0x7f, 0x7d, 0x3c, 0x23, 0x7d, 0x3f, 0x3a,
-  0x05, 0x7b, 0x00, 0x38, 0x3a, 0x79, 0x4e, 0x36, 0x69, 0x77, 0x42, 0x34,
-  0xb1, 0x75, 0xdd, 0x32, 0xf6, 0x73, 0xd0, 0x30, 0x31, 0x70, 0x19, 0x31,
-  0x30, 0x6e, 0x49, 0x2f, 0xac, 0x6c, 0x8c, 0x2d, 0xc4, 0x6a, 0x65, 0x2a,
-  0x6d, 0x6b, 0x4a, 0x28, 0x85, 0x69, 0xff, 0x26, 0x64, 0x66, 0x71, 0x27,
-  0xb9, 0x64, 0xf2, 0x25, 0x3c, 0x65, 0x61, 0x22, 0xf0, 0x63, 0xee, 0x20,
-  0x2b, 0x60, 0x78, 0x21, 0x82, 0x5e, 0xc6, 0x1f, 0x71, 0x5f, 0xe5, 0x1c,
-  0xd9, 0x5d, 0x1e, 0x1d, 0xe4, 0x5a, 0xd0, 0x1b, 0x7f, 0x5b, 0x87, 0x18,
-  0x31, 0x58, 0x15, 0x19, 0xe4, 0x56, 0x15, 0x16, 0xa5, 0x57, 0xc3, 0x14,
-  0x10, 0x54, 0xf6, 0x15, 0x61, 0x55, 0x83, 0x12, 0x16, 0x52, 0xa4, 0x13,
-  0x27, 0x53, 0xb4, 0x10, 0x35, 0x50, 0xbb, 0x11, 0x20, 0x51, 0xf5, 0x0e,
-  0x24, 0x4e, 0xb2, 0x0f, 0x64, 0x4f, 0xa6, 0x0c, 0x15, 0x4c, 0x80, 0x0d,
-  0x64, 0x4d, 0xa5, 0x0a, 0x57, 0x4a, 0xdf, 0x0b, 0xb1, 0x4b, 0x18, 0x0b,
-  0xe3, 0x48, 0x15, 0x08, 0x35, 0x48, 0x82, 0x09, 0x71, 0x49, 0xc4, 0x06,
-  0xea, 0x46, 0x65, 0x06, 0xd3, 0x47, 0xaa, 0x07, 0x7a, 0x47, 0xd1, 0x04,
-  0x99, 0x44, 0x63, 0x04, 0x31, 0x44, 0xf8, 0x05, 0xd4, 0x45, 0x77, 0x05,
-  0x35, 0x45, 0xf6, 0x02, 0xbb, 0x42, 0x12, 0x02, 0x10, 0x42, 0xfa, 0x03,
-  0x99, 0x43, 0x56, 0x03, 0x60, 0x43, 0x3c, 0x03, 0x90, 0x40, 0x9d, 0x00,
-  0xa5, 0x40, 0x4e, 0x00, 0x63, 0x40, 0x14, 0x00, 0x33, 0x40, 0xd0, 0x01,
-  0xe3, 0x41, 0x86, 0x01, 0x9d, 0x41, 0x42, 0x01, 0x45, 0x41, 0x25, 0x01,
-  0x75, 0x41, 0x17, 0x01, 0x15, 0x41, 0x6d, 0x01, 0x2d, 0x41, 0x33, 0x01,
-  0x70, 0x41, 0x34, 0x01, 0x74, 0x41, 0x38, 0x01, 0x31, 0x41, 0x27, 0x01,
-  0x21, 0x41, 0x6d, 0x01, 0x1f, 0x41, 0x03, 0x01, 0x34, 0x41, 0x71, 0x01,
-  0x47, 0x41, 0x44, 0x01, 0xb7, 0x41, 0x89, 0x01, 0xe9, 0x41, 0x95, 0x01,
-  0x38, 0x40, 0x1c, 0x00, 0x64, 0x40, 0x49, 0x00, 0xa8, 0x40, 0x88, 0x00,
-  0x90, 0x40, 0x35, 0x03, 0x75, 0x43, 0x56, 0x03, 0x83, 0x43, 0xec, 0x03,
-  0x23, 0x42, 0x78, 0x02, 0xa3, 0x42, 0xb9, 0x02, 0x74, 0x45, 0x74, 0x05,
-  0xbc, 0x45, 0xf1, 0x05, 0x64, 0x44, 0x69, 0x04, 0x99, 0x44, 0xc8, 0x04,
-  0x78, 0x47, 0xbc, 0x07, 0x90, 0x47, 0x01, 0x06, 0xad, 0x46, 0xc9, 0x06,
-  0x30, 0x49, 0x97, 0x09, 0x2d, 0x48, 0x15, 0x08, 0xfd, 0x48, 0x12, 0x0b,
-  0xb6, 0x4b, 0xc8, 0x0b, 0x10, 0x4a, 0xe7, 0x0a, 0x7d, 0x4d, 0x8a, 0x0d,
-  0x1c, 0x4c, 0xb8, 0x0c, 0x29, 0x4f, 0xb4, 0x0f, 0x3e, 0x4e, 0xb0, 0x0e,
-  0x27, 0x51, 0xb6, 0x11, 0x35, 0x50, 0xb3, 0x10, 0x30, 0x53, 0xed, 0x13,
-  0x1d, 0x52, 0x8a, 0x12, 0x67, 0x55, 0xf6, 0x15, 0x1e, 0x54, 0x8d, 0x14,
-  0xe4, 0x57, 0x29, 0x16, 0xf8, 0x56, 0x50, 0x19, 0x26, 0x58, 0x90, 0x18,
-  0x30, 0x5b, 0xd4, 0x1b, 0xb7, 0x5a, 0x4d, 0x1d, 0xd1, 0x5d, 0xe5, 0x1c,
-  0x78, 0x5f, 0xc4, 0x1f, 0x94, 0x5e, 0x69, 0x21, 0x21, 0x60, 0xef, 0x20,
-  0xf0, 0x63, 0x7d, 0x22, 0x31, 0x65, 0xe7, 0x25, 0xb5, 0x64, 0x3d, 0x27,
-  0x28, 0x66, 0xe8, 0x26, 0x91, 0x69, 0x41, 0x28, 0x7d, 0x6b, 0x2b, 0x2a,
-  0xd7, 0x6a, 0xcd, 0x2d, 0xb1, 0x6c, 0x4d, 0x2f, 0x3e, 0x6e, 0x73, 0x31,
-  0x38, 0x70, 0xd4, 0x30, 0xf4, 0x73, 0x99, 0x32, 0xa1, 0x75, 0x5f, 0x34,
-  0x35, 0x77, 0x6b, 0x36, 0x7b, 0x79, 0x17, 0x38, 0x04, 0x7b, 0x25, 0x3a,
-  0x41, 0x7d, 0x2e, 0x3c, 0x3f, 0x7f, 0x20, 0x3e, 0x20, 0x01, 0x3d, 0x40,
-  0x54, 0x03, 0x38, 0x42, 0x25, 0x05, 0x3e, 0x44, 0x04, 0x07, 0x61, 0x46,
-  0x63, 0x09, 0x60, 0x48, 0x43, 0x0b, 0x59, 0x4a, 0xcb, 0x0d, 0xa9, 0x4c,
-  0xe7, 0x0f, 0xdc, 0x4e, 0x27, 0x10, 0x01, 0x53, 0x69, 0x12, 0x1d, 0x55,
-  0xb4, 0x14, 0x8c, 0x57, 0xc3, 0x16, 0x36, 0x58, 0x75, 0x1b, 0x42, 0x5a,
-  0x95, 0x1d, 0xfe, 0x5c, 0x73, 0x1e, 0x44, 0x61, 0xbf, 0x20, 0xe0, 0x63,
-  0x74, 0x25, 0x74, 0x64, 0xa2, 0x27, 0xf8, 0x66, 0x64, 0x28, 0x64, 0x6b,
-  0x9e, 0x2a, 0x85, 0x6d, 0x75, 0x2f, 0xe5, 0x6e, 0xc4, 0x31, 0x1a, 0x73,
-  0xad, 0x32, 0xce, 0x75, 0x64, 0x37, 0x8c, 0x76, 0x74, 0x38, 0x58, 0x7b,
-  0xf1, 0x3a, 0x07, 0x7c, 0xa1, 0x3f, 0x8d, 0x7e, 0x5f, 0x40, 0xe3, 0x03,
-  0x34, 0x45, 0x89, 0x04, 0x19, 0x46, 0xb9, 0x09, 0x30, 0x4b, 0xb1, 0x0a,
-  0x35, 0x4c, 0xf5, 0x0f, 0x24, 0x51, 0xb4, 0x10, 0x23, 0x52, 0xae, 0x15,
-  0x25, 0x57, 0xaa, 0x16, 0x15, 0x58, 0x96, 0x1b, 0x38, 0x5d, 0xa5, 0x1c,
-  0x51, 0x5e, 0xc1, 0x21, 0xa8, 0x63, 0x5d, 0x25, 0xf1, 0x64, 0x59, 0x26,
-  0x3d, 0x68, 0x9e, 0x2b, 0x75, 0x6d, 0x93, 0x2c, 0xc1, 0x6e, 0x03, 0x30,
-  0xdf, 0x73, 0xb7, 0x35, 0x60, 0x77, 0xcd, 0x36, 0xf5, 0x78, 0x7e, 0x3a,
-  0x2b, 0x7c, 0xe8, 0x3f, 0xa4, 0x01, 0x7d, 0x43, 0x50, 0x05, 0xe2, 0x44,
-  0xb5, 0x06, 0x6e, 0x48, 0x30, 0x0a, 0x82, 0x4d, 0xa4, 0x0f, 0x52, 0x51,
-  0x7d, 0x13, 0x36, 0x55, 0xc4, 0x14, 0x94, 0x56, 0xe4, 0x18, 0x4d, 0x5a,
-  0x71, 0x1c, 0x06, 0x5e, 0x27, 0x20, 0xd4, 0x63, 0xf7, 0x25, 0x98, 0x67,
-  0xb7, 0x29, 0x1a, 0x6b, 0x69, 0x2d, 0x6a, 0x6f, 0x61, 0x31, 0x45, 0x73,
-  0x11, 0x35, 0x3f, 0x77, 0x21, 0x39, 0x7d, 0x7b, 0x39, 0x3d, 0x3b, 0x7f,
-  0x74, 0x41, 0x34, 0x03, 0x70, 0x45, 0x30, 0x07, 0x25, 0x49, 0x37, 0x0b,
-  0x15, 0x4d, 0x45, 0x0f, 0x7b, 0x51, 0x63, 0x13, 0x10, 0x55, 0x41, 0x17,
-  0xad, 0x59, 0x89, 0x1b, 0xe4, 0x5d, 0xd9, 0x1f, 0x31, 0x60, 0x55, 0x22,
-  0x64, 0x64, 0x4a, 0x26, 0xad, 0x68, 0x9e, 0x2a, 0xc4, 0x6c, 0x3c, 0x31,
-  0x34, 0x73, 0x55, 0x35, 0x91, 0x77, 0xfe, 0x39, 0x37, 0x7a, 0x7c, 0x3c,
-  0xb7, 0x7e, 0xf0, 0x40, 0x27, 0x05, 0x39, 0x47, 0xf0, 0x09, 0xfc, 0x4b,
-  0x28, 0x0c, 0x61, 0x4e, 0xd0, 0x10, 0xc4, 0x52, 0x78, 0x17, 0xac, 0x59,
-  0xdb, 0x1b, 0x08, 0x5c, 0xea, 0x1e, 0xb8, 0x60, 0x7e, 0x25, 0x9a, 0x67,
-  0x26, 0x28, 0x41, 0x6a, 0xf8, 0x2c, 0x78, 0x71, 0xb7, 0x33, 0xc2, 0x75,
-  0x45, 0x36, 0xf1, 0x78, 0x7c, 0x3d, 0xe1, 0x7f, 0x15, 0x40, 0xac, 0x02,
-  0x37, 0x47, 0xa9, 0x09, 0x5f, 0x4a, 0x81, 0x0c, 0x23, 0x51, 0xbc, 0x13,
-  0x23, 0x54, 0xa9, 0x16, 0x3d, 0x5b, 0xed, 0x1d, 0x00, 0x5e, 0x84, 0x20,
-  0x67, 0x65, 0xf6, 0x27, 0x51, 0x68, 0xca, 0x2a, 0xa1, 0x6f, 0x0e, 0x30,
-  0xec, 0x72, 0x6c, 0x37, 0x3b, 0x78, 0x80, 0x3a, 0x30, 0x7f, 0xdc, 0x41,
-  0xb6, 0x02, 0x08, 0x47, 0x90, 0x09, 0xac, 0x4a, 0x7a, 0x0f, 0x85, 0x51,
-  0x91, 0x12, 0x2d, 0x57, 0x29, 0x18, 0xfc, 0x5a, 0xaa, 0x1f, 0x70, 0x60,
-  0x74, 0x25, 0xfa, 0x67, 0xb6, 0x28, 0x3d, 0x6d, 0x25, 0x2e, 0xe1, 0x70,
-  0x99, 0x35, 0x4e, 0x76, 0x71, 0x3b, 0x65, 0x7c, 0xdc, 0x3e, 0x84, 0x03,
-  0xb0, 0x44, 0x49, 0x09, 0x7c, 0x4a, 0x10, 0x0f, 0x74, 0x50, 0xc5, 0x12,
-  0xf1, 0x57, 0x8e, 0x18, 0xb7, 0x5d, 0x4c, 0x1e, 0x57, 0x63, 0x60, 0x24,
-  0x67, 0x69, 0x49, 0x2a, 0x50, 0x6f, 0x2c, 0x30, 0x28, 0x75, 0x31, 0x36,
-  0x70, 0x7b, 0x21, 0x3c, 0x23, 0x01, 0x3c, 0x42, 0x23, 0x07, 0x29, 0x48,
-  0x3d, 0x0d, 0x63, 0x4e, 0x7a, 0x13, 0x6f, 0x54, 0x40, 0x19, 0x6d, 0x5a,
-  0x55, 0x1f, 0x0d, 0x60, 0xb4, 0x25, 0x9c, 0x66, 0xe3, 0x2b, 0xc6, 0x6c,
-  0x35, 0x30, 0x12, 0x75, 0x75, 0x36, 0x1d, 0x7b, 0xb0, 0x3c, 0x82, 0x01,
-  0x90, 0x42, 0x31, 0x06, 0x7c, 0x4b, 0x40, 0x0c, 0xd0, 0x51, 0xe8, 0x12,
-  0x25, 0x56, 0x6e, 0x1b, 0xa4, 0x5c, 0xb5, 0x21, 0x38, 0x65, 0x7a, 0x26,
-  0xbf, 0x6b, 0xf6, 0x2c, 0x37, 0x70, 0x2d, 0x35, 0x86, 0x76, 0xc0, 0x3b,
-  0x66, 0x7f, 0xbc, 0x40, 0x90, 0x05, 0x09, 0x49, 0xa5, 0x0a, 0xcf, 0x4f,
-  0x7b, 0x13, 0xce, 0x54, 0x74, 0x18, 0x4c, 0x5d, 0xff, 0x1e, 0x08, 0x62,
-  0xe4, 0x27, 0xd9, 0x68, 0x58, 0x2c, 0xec, 0x71, 0x7a, 0x35, 0x8e, 0x76,
-  0x50, 0x3a, 0xb4, 0x7f, 0x2b, 0x43, 0xa8, 0x04, 0x70, 0x48, 0xbd, 0x0d,
-  0x31, 0x51, 0xb4, 0x12, 0x22, 0x56, 0xfd, 0x1b, 0x25, 0x5f, 0xed, 0x20,
-  0x37, 0x64, 0x97, 0x29, 0x61, 0x6d, 0xe0, 0x2e, 0x1e, 0x72, 0xa8, 0x37,
-  0xaa, 0x7b, 0x12, 0x3f, 0xe2, 0x00, 0x41, 0x44, 0x3c, 0x08, 0xf0, 0x4d,
-  0x63, 0x11, 0xd2, 0x52, 0xb1, 0x16, 0x19, 0x5a, 0xd8, 0x1f, 0xc1, 0x63,
-  0x63, 0x27, 0xc0, 0x68, 0x83, 0x2c, 0x79, 0x70, 0x40, 0x34, 0xf8, 0x79,
-  0xb1, 0x3d, 0x66, 0x01, 0x20, 0x45, 0x9a, 0x06, 0x84, 0x4a, 0x6a, 0x0e,
-  0x2d, 0x52, 0xfe, 0x17, 0x84, 0x5b, 0x5c, 0x1f, 0x34, 0x63, 0x35, 0x27,
-  0xd1, 0x68, 0x9e, 0x2c, 0xb7, 0x70, 0x5c, 0x34, 0x77, 0x78, 0x10, 0x3c,
-  0x27, 0x00, 0x82, 0x45, 0xc9, 0x09, 0x92, 0x4d, 0xb1, 0x11, 0x0d, 0x55,
-  0x51, 0x19, 0x77, 0x5d, 0x71, 0x21, 0x45, 0x65, 0x19, 0x29, 0x23, 0x6d,
-  0x64, 0x31, 0x3c, 0x75, 0x70, 0x39, 0x39, 0x7d, 0x3d, 0x41, 0x21, 0x05,
-  0x24, 0x49, 0x31, 0x0d, 0x21, 0x51, 0x6d, 0x15, 0x1d, 0x59, 0x04, 0x1d,
-  0x6e, 0x61, 0x60, 0x25, 0x10, 0x69, 0x42, 0x2d, 0xa2, 0x71, 0xdd, 0x35,
-  0xe4, 0x79, 0xc2, 0x3d, 0x3d, 0x00, 0x06, 0x44, 0x64, 0x08, 0x44, 0x4c,
-  0xe4, 0x10, 0x9d, 0x54, 0xd1, 0x18, 0x36, 0x5f, 0x67, 0x23, 0x44, 0x67,
-  0x97, 0x2b, 0xe8, 0x6f, 0x37, 0x32, 0x31, 0x76, 0xf0, 0x3a, 0xf4, 0x7e,
-  0x38, 0x45, 0x79, 0x09, 0xf0, 0x4d, 0xfc, 0x11, 0x28, 0x54, 0x64, 0x18,
-  0x9b, 0x5c, 0xc0, 0x20, 0x3a, 0x67, 0xc0, 0x2b, 0xde, 0x6f, 0x02, 0x32,
-  0xb6, 0x76, 0xc9, 0x3a, 0x78, 0x01, 0xf0, 0x45, 0x27, 0x08, 0x5a, 0x4c,
-  0xe5, 0x10, 0x09, 0x57, 0xac, 0x1b, 0xa9, 0x5f, 0x55, 0x22, 0xe4, 0x66,
-  0x67, 0x2d, 0x91, 0x71, 0x7f, 0x34, 0x99, 0x78, 0x33, 0x3f, 0xb4, 0x03,
-  0x23, 0x46, 0xa1, 0x0a, 0x2d, 0x51, 0xf5, 0x15, 0x20, 0x58, 0xbc, 0x1c,
-  0x37, 0x63, 0xbe, 0x27, 0x11, 0x6a, 0x82, 0x2e, 0x71, 0x75, 0xf6, 0x39,
-  0xb3, 0x7c, 0xf4, 0x40, 0xab, 0x07, 0x08, 0x4a, 0xb0, 0x0e, 0x54, 0x55,
-  0x26, 0x18, 0x90, 0x5c, 0x30, 0x23, 0xd4, 0x67, 0xaa, 0x2a, 0x4d, 0x71,
-  0xd1, 0x35, 0xe5, 0x78, 0x60, 0x3f, 0xd2, 0x03, 0x99, 0x46, 0x7e, 0x0d,
-  0x30, 0x50, 0xe4, 0x14, 0xf0, 0x5b, 0x74, 0x1e, 0x38, 0x65, 0xfc, 0x29,
-  0xbb, 0x6c, 0x78, 0x33, 0x64, 0x76, 0xe2, 0x3a, 0x96, 0x01, 0x05, 0x44,
-  0x78, 0x0b, 0x2c, 0x4e, 0xc4, 0x12, 0x99, 0x59, 0xa8, 0x1c, 0x58, 0x63,
-  0x30, 0x26, 0x05, 0x6d, 0x35, 0x30, 0xc6, 0x74, 0xe3, 0x3b, 0x9c, 0x7e,
-  0xa3, 0x45, 0x48, 0x08, 0x43, 0x4f, 0x29, 0x12, 0x34, 0x59, 0x04, 0x1c,
-  0x1c, 0x63, 0x21, 0x26, 0x64, 0x6d, 0x30, 0x30, 0x31, 0x77, 0x2f, 0x3a,
-  0x31, 0x01, 0x7b, 0x44, 0x5a, 0x0b, 0x57, 0x4e, 0x10, 0x15, 0x25, 0x58,
-  0x15, 0x1f, 0x45, 0x62, 0x71, 0x29, 0x64, 0x6c, 0x43, 0x33, 0x59, 0x76,
-  0xe4, 0x3d, 0x8d, 0x00, 0xf1, 0x47, 0xc6, 0x0a, 0x27, 0x50, 0x14, 0x17,
-  0x77, 0x5a, 0x58, 0x21, 0xe4, 0x64, 0x8c, 0x2b, 0xc0, 0x6e, 0x35, 0x34,
-  0x71, 0x7b, 0x44, 0x3e, 0x82, 0x05, 0xfe, 0x48, 0x64, 0x0e, 0x6b, 0x55,
-  0xb5, 0x18, 0xe7, 0x5f, 0x2d, 0x25, 0x35, 0x68, 0xb4, 0x2f, 0xfc, 0x72,
-  0x36, 0x38, 0x66, 0x7f, 0xcb, 0x42, 0x85, 0x09, 0x6d, 0x4f, 0xaa, 0x12,
-  0xc5, 0x59, 0x4d, 0x1f, 0xa2, 0x62, 0xd8, 0x29, 0x75, 0x6f, 0x99, 0x32,
-  0x74, 0x78, 0x59, 0x3f, 0xf9, 0x02, 0x16, 0x48, 0xa1, 0x0f, 0xc1, 0x52,
-  0x49, 0x18, 0xa5, 0x5f, 0x60, 0x25, 0x8a, 0x68, 0x50, 0x2e, 0xaf, 0x75,
-  0x21, 0x3b, 0xfd, 0x7e, 0x35, 0x44, 0xb4, 0x0b, 0x20, 0x51, 0xb0, 0x14,
-  0x3e, 0x5a, 0xfd, 0x21, 0x26, 0x67, 0xb4, 0x2a, 0x50, 0x70, 0x84, 0x37,
-  0x34, 0x7d, 0xc2, 0x40, 0x42, 0x06, 0xd8, 0x4d, 0xa1, 0x13, 0x53, 0x59,
-  0x95, 0x1c, 0x5b, 0x62, 0x3b, 0x28, 0x87, 0x6f, 0x64, 0x35, 0xd5, 0x78,
-  0xc1, 0x3e, 0x1e, 0x04, 0xdf, 0x4b, 0xb0, 0x11, 0x60, 0x57, 0xcd, 0x1a,
-  0xf4, 0x60, 0x7a, 0x26, 0x21, 0x6c, 0xee, 0x33, 0xa4, 0x79, 0x11, 0x3f,
-  0x31, 0x05, 0xf4, 0x48, 0xa3, 0x0e, 0x69, 0x54, 0x4b, 0x1a, 0xd9, 0x61,
-  0x87, 0x27, 0x4c, 0x6d, 0x67, 0x33, 0x31, 0x79, 0xc9, 0x3c, 0xcd, 0x02,
-  0xb4, 0x48, 0x5c, 0x0e, 0x63, 0x54, 0x06, 0x1a, 0x35, 0x60, 0xd2, 0x27,
-  0xf5, 0x6d, 0x8e, 0x33, 0xf3, 0x79, 0x74, 0x3f, 0x5f, 0x05, 0x70, 0x4b,
-  0x34, 0x11, 0x04, 0x57, 0x02, 0x1d, 0x28, 0x63, 0x64, 0x29, 0x34, 0x6f,
-  0x3e, 0x35, 0x75, 0x7b, 0x35, 0x41, 0x75, 0x07, 0x3d, 0x4d, 0x3c, 0x13,
-  0x3e, 0x59, 0x28, 0x1f, 0x50, 0x65, 0x0a, 0x2b, 0x72, 0x71, 0x25, 0x37,
-  0x51, 0x7d, 0x41, 0x43, 0xad, 0x09, 0x96, 0x4f, 0xf5, 0x15, 0x95, 0x5b,
-  0x20, 0x20, 0x02, 0x66, 0x79, 0x2c, 0x4e, 0x72, 0xb0, 0x38, 0x94, 0x7e,
-  0x90, 0x44, 0x35, 0x0d, 0x75, 0x53, 0x56, 0x19, 0x83, 0x5f, 0xec, 0x25,
-  0x23, 0x6a, 0x78, 0x30, 0xa3, 0x76, 0xb9, 0x3c, 0x74, 0x05, 0x74, 0x4b,
-  0xbc, 0x11, 0xf1, 0x57, 0x64, 0x1c, 0x61, 0x62, 0x99, 0x28, 0xd1, 0x6e,
-  0x60, 0x37, 0xa9, 0x7d, 0xd5, 0x43, 0x43, 0x08, 0xc1, 0x4e, 0xd3, 0x14,
-  0x7f, 0x5d, 0x87, 0x23, 0x20, 0x68, 0x5d, 0x2e, 0x94, 0x74, 0x18, 0x3d,
-  0xa5, 0x03, 0xde, 0x49, 0x44, 0x0e, 0x80, 0x54, 0x67, 0x1d, 0x8a, 0x63,
-  0x05, 0x28, 0xb9, 0x6e, 0x2c, 0x37, 0xd2, 0x7d, 0x04, 0x42, 0xa2, 0x08,
-  0x3d, 0x51, 0xa6, 0x17, 0x24, 0x5c, 0xa4, 0x22, 0x64, 0x6b, 0xbd, 0x31,
-  0x11, 0x76, 0x96, 0x3c, 0x67, 0x05, 0xe4, 0x4b, 0x57, 0x10, 0xc8, 0x56,
-  0xb7, 0x1f, 0x4a, 0x64, 0xc9, 0x2a, 0x5a, 0x73, 0x21, 0x38, 0xd5, 0x7e,
-  0x71, 0x47, 0xcf, 0x0d, 0xa1, 0x52, 0x4d, 0x1b, 0xd9, 0x61, 0xab, 0x26,
-  0x34, 0x6f, 0xc4, 0x35, 0xd0, 0x7a, 0x60, 0x43, 0x25, 0x08, 0xe7, 0x4e,
-  0xb5, 0x17, 0x35, 0x5c, 0x3b, 0x25, 0xf3, 0x6b, 0xf0, 0x30, 0x69, 0x79,
-  0x33, 0x3e, 0xe4, 0x04, 0x83, 0x4d, 0x51, 0x12, 0x6d, 0x5b, 0x65, 0x20,
-  0xdc, 0x66, 0x84, 0x2f, 0xb0, 0x74, 0x49, 0x3d, 0x7c, 0x02, 0x10, 0x4b,
-  0x74, 0x10, 0xc5, 0x56, 0xf1, 0x1f, 0x8e, 0x64, 0xb7, 0x2d, 0x4c, 0x72,
-  0x57, 0x3b, 0x60, 0x00, 0x67, 0x49, 0x49, 0x0e, 0x50, 0x57, 0x2c, 0x1c,
-  0x28, 0x65, 0x31, 0x2a, 0x70, 0x73, 0x34, 0x38, 0x38, 0x01, 0x3c, 0x46,
-  0x3b, 0x0f, 0x38, 0x54, 0x6a, 0x1d, 0x49, 0x62, 0x07, 0x2b, 0x00, 0x70,
-  0x67, 0x39, 0x71, 0x7e, 0x3f, 0x47, 0x79, 0x0c, 0xb3, 0x55, 0x94, 0x1a,
-  0xe3, 0x63, 0xc1, 0x28, 0x2d, 0x70, 0x55, 0x39, 0x60, 0x7e, 0x5c, 0x47,
-  0xb7, 0x0c, 0x9e, 0x55, 0xd1, 0x1a, 0x22, 0x62, 0x71, 0x2b, 0x56, 0x70,
-  0xc7, 0x39, 0xd4, 0x7e, 0x2b, 0x46, 0x68, 0x0f, 0xf0, 0x54, 0xf4, 0x1d,
-  0x26, 0x65, 0x70, 0x2a, 0xf0, 0x73, 0xf4, 0x38, 0x2a, 0x00, 0x2d, 0x49,
-  0x91, 0x0e, 0x85, 0x57, 0x79, 0x1f, 0xa4, 0x64, 0xca, 0x2d, 0x08, 0x75,
-  0xe4, 0x3a, 0xd2, 0x03, 0x76, 0x4b, 0xd5, 0x10, 0x20, 0x58, 0x42, 0x21,
-  0xf9, 0x66, 0x0e, 0x2e, 0xb0, 0x77, 0xd4, 0x3c, 0x10, 0x04, 0xe9, 0x4d,
-  0x7d, 0x15, 0x91, 0x5a, 0x04, 0x22, 0xa1, 0x6b, 0x21, 0x33, 0xfd, 0x78,
-  0x20, 0x40, 0xb4, 0x09, 0x27, 0x51, 0xa6, 0x16, 0x31, 0x5e, 0xba, 0x27,
-  0x21, 0x6f, 0xbe, 0x34, 0x5c, 0x7c, 0xc5, 0x45, 0x75, 0x0d, 0xe9, 0x52,
-  0x5c, 0x1a, 0x8d, 0x63, 0xa5, 0x2b, 0x11, 0x73, 0xf9, 0x38, 0x5e, 0x00,
-  0x31, 0x48, 0xdb, 0x11, 0x14, 0x59, 0xca, 0x1e, 0xa1, 0x66, 0x1e, 0x2e,
-  0xc4, 0x77, 0xca, 0x3f, 0x40, 0x07, 0xd2, 0x4c, 0x99, 0x14, 0x7e, 0x5c,
-  0x30, 0x24, 0xe4, 0x6d, 0xf0, 0x35, 0x65, 0x7d, 0x35, 0x45, 0xe6, 0x0a,
-  0xa3, 0x52, 0x7c, 0x1a, 0x23, 0x62, 0xe8, 0x2b, 0x83, 0x73, 0x12, 0x3b,
-  0x4d, 0x03, 0x2a, 0x4b, 0xc5, 0x10, 0xcd, 0x58, 0xa5, 0x20, 0x4f, 0x68,
-  0x75, 0x30, 0x55, 0x78, 0x3d, 0x40, 0xdb, 0x09, 0xb0, 0x51, 0x9c, 0x19,
-  0xe4, 0x61, 0x59, 0x29, 0x47, 0x71, 0x6c, 0x39, 0x67, 0x01, 0x11, 0x49,
-  0x09, 0x11, 0x6d, 0x59, 0x29, 0x21, 0x3c, 0x69, 0x2a, 0x31, 0x30, 0x79,
-  0x74, 0x41, 0x3a, 0x09, 0x36, 0x51, 0x7d, 0x19, 0x28, 0x61, 0x24, 0x29,
-  0x04, 0x71, 0x11, 0x39, 0x78, 0x01, 0x60, 0x49, 0x10, 0x11, 0x5d, 0x59,
-  0xa5, 0x21, 0x8e, 0x69, 0xe3, 0x31, 0xd4, 0x79, 0x33, 0x40, 0x10, 0x08,
-  0x63, 0x50, 0x11, 0x18, 0xe4, 0x60, 0x8c, 0x28, 0xdc, 0x70, 0x29, 0x3b,
-  0x34, 0x03, 0x44, 0x4b, 0x9c, 0x13, 0xe4, 0x5b, 0x2f, 0x22, 0x78, 0x6a,
-  0xfe, 0x32, 0x90, 0x7a, 0x3a, 0x45, 0x7a, 0x0d, 0xa2, 0x55, 0xe9, 0x1d,
-  0x2c, 0x64, 0x08, 0x2c, 0x83, 0x74, 0xca, 0x3c, 0x61, 0x07, 0xb1, 0x4f,
-  0xd8, 0x17, 0x61, 0x5e, 0x80, 0x26, 0xdc, 0x6e, 0x62, 0x39, 0x9e, 0x01,
-  0x74, 0x48, 0x45, 0x10, 0xf1, 0x58, 0x0e, 0x23, 0xb7, 0x6b, 0xcc, 0x33,
-  0x57, 0x7a, 0xe0, 0x42, 0x66, 0x0d, 0xbc, 0x55, 0x1f, 0x1c, 0xb8, 0x64,
-  0x64, 0x2f, 0xbc, 0x77, 0x22, 0x3e, 0xb0, 0x06, 0x74, 0x51, 0xbc, 0x19,
-  0x3e, 0x60, 0xfd, 0x28, 0x25, 0x73, 0xed, 0x3b, 0x1e, 0x02, 0x84, 0x4a,
-  0x66, 0x15, 0xf7, 0x5d, 0x5f, 0x24, 0xda, 0x6c, 0xe4, 0x37, 0x0d, 0x7e,
-  0xf1, 0x46, 0x46, 0x11, 0x27, 0x58, 0x94, 0x20, 0x77, 0x6b, 0xd8, 0x33,
-  0xea, 0x7a, 0x4d, 0x45, 0x90, 0x0d, 0x91, 0x54, 0x7c, 0x1f, 0xc0, 0x67,
-  0x82, 0x2e, 0x68, 0x79, 0x64, 0x40, 0xf4, 0x08, 0xa3, 0x53, 0x35, 0x1a,
-  0x30, 0x65, 0xf4, 0x2d, 0xa2, 0x74, 0x76, 0x3f, 0x2a, 0x06, 0xe8, 0x4e,
-  0x83, 0x19, 0x56, 0x60, 0x34, 0x2b, 0x31, 0x72, 0xdf, 0x3a, 0xcd, 0x05,
-  0xb0, 0x4c, 0x55, 0x17, 0x75, 0x5e, 0x55, 0x29, 0x23, 0x70, 0xd0, 0x38,
-  0xe3, 0x03, 0x89, 0x4a, 0xe8, 0x15, 0x0d, 0x5c, 0x52, 0x27, 0x70, 0x6e,
-  0x60, 0x39, 0x45, 0x00, 0x09, 0x4b, 0x22, 0x12, 0x31, 0x5d, 0x7d, 0x24,
-  0x33, 0x6f, 0x34, 0x36, 0x3a, 0x01, 0x75, 0x48, 0x32, 0x13, 0x3c, 0x5a,
-  0x36, 0x25, 0x28, 0x6c, 0x1c, 0x37, 0x1c, 0x7e, 0x34, 0x49, 0x76, 0x10,
-  0x55, 0x5b, 0x48, 0x22, 0xe4, 0x6d, 0x9c, 0x34, 0xb0, 0x7f, 0xd2, 0x46,
-  0x38, 0x10, 0x1a, 0x5b, 0x67, 0x22, 0x54, 0x6d, 0xaa, 0x34, 0x8a, 0x7f,
-  0x90, 0x46, 0x2a, 0x10, 0x64, 0x5b, 0x40, 0x22, 0x9e, 0x6d, 0xe4, 0x34,
-  0x2a, 0x7e, 0x7a, 0x49, 0xf0, 0x10, 0xe1, 0x5b, 0x3b, 0x25, 0x35, 0x6c,
-  0xa4, 0x37, 0xf5, 0x7e, 0x21, 0x48, 0x2d, 0x13, 0x95, 0x5a, 0xc4, 0x25,
-  0x67, 0x6f, 0xb1, 0x36, 0x9e, 0x01, 0x69, 0x4b, 0xb3, 0x12, 0xd8, 0x5d,
-  0x63, 0x27, 0x81, 0x6e, 0x50, 0x38, 0x50, 0x03, 0xf1, 0x4a, 0x0e, 0x14,
-  0xb0, 0x5f, 0xa1, 0x26, 0x74, 0x70, 0xe4, 0x3b, 0x66, 0x05, 0x8e, 0x4c,
-  0x50, 0x16, 0xbd, 0x61, 0x25, 0x2b, 0xae, 0x72, 0x23, 0x3c, 0xb4, 0x07,
-  0x33, 0x51, 0xb0, 0x18, 0x72, 0x62, 0x84, 0x2d, 0x2b, 0x77, 0xb8, 0x3e,
-  0x50, 0x08, 0x84, 0x53, 0x66, 0x1d, 0xe0, 0x64, 0x10, 0x2e, 0xc4, 0x79,
-  0xaa, 0x43, 0x5d, 0x0d, 0xf1, 0x54, 0x15, 0x1e, 0x30, 0x68, 0x94, 0x33,
-  0x62, 0x7d, 0xd6, 0x44, 0xe8, 0x0e, 0x4d, 0x58, 0xde, 0x23, 0xa4, 0x6d,
-  0x66, 0x37, 0xd7, 0x7e, 0x9f, 0x48, 0x7a, 0x12, 0x64, 0x5c, 0xed, 0x27,
-  0xb1, 0x71, 0x66, 0x3b, 0x27, 0x05, 0xf4, 0x4c, 0xb7, 0x16, 0x78, 0x60,
-  0x6a, 0x2a, 0x89, 0x75, 0x95, 0x3f, 0x44, 0x09, 0x67, 0x53, 0x31, 0x1d,
-  0xb4, 0x64, 0x9a, 0x2e, 0xa1, 0x78, 0x4e, 0x42, 0x64, 0x0c, 0x79, 0x56,
-  0x10, 0x20, 0xd4, 0x6b, 0xe2, 0x35, 0x96, 0x7f, 0xe4, 0x49, 0x5d, 0x13,
-  0x51, 0x5d, 0x76, 0x27, 0x67, 0x71, 0x04, 0x3b, 0x17, 0x05, 0x28, 0x4f,
-  0x66, 0x19, 0x04, 0x63, 0x3f, 0x2d, 0x20, 0x77, 0x74, 0x41, 0x34, 0x0b,
-  0x22, 0x55, 0x38, 0x1f, 0x64, 0x69, 0x24, 0x33, 0x1e, 0x7d, 0x45, 0x47,
-  0x75, 0x11, 0x25, 0x5b, 0x54, 0x25, 0x4c, 0x6f, 0xb6, 0x39, 0x96, 0x03,
-  0xbc, 0x4d, 0x95, 0x17, 0x3a, 0x60, 0x14, 0x2a, 0x62, 0x74, 0x4f, 0x3e,
-  0xab, 0x08, 0x9a, 0x52, 0x90, 0x1c, 0x35, 0x69, 0x75, 0x33, 0x56, 0x7d,
-  0x83, 0x47, 0xec, 0x11, 0x23, 0x5a, 0x78, 0x24, 0xfe, 0x6e, 0x91, 0x38,
-  0x31, 0x05, 0x74, 0x4f, 0xa3, 0x19, 0xe9, 0x63, 0x40, 0x2c, 0x7a, 0x76,
-  0x95, 0x40, 0xd6, 0x0a, 0x60, 0x57, 0xc9, 0x21, 0xf4, 0x6b, 0x0c, 0x34,
-  0xb6, 0x7e, 0xd6, 0x48, 0x30, 0x15, 0x85, 0x5f, 0x35, 0x28, 0x46, 0x72,
-  0xe3, 0x3c, 0x1c, 0x09, 0xa3, 0x53, 0xc8, 0x1d, 0x54, 0x66, 0xdc, 0x30,
-  0x7b, 0x7d, 0x90, 0x47, 0x50, 0x10, 0xac, 0x5a, 0x36, 0x27, 0xb8, 0x71,
-  0x70, 0x3a, 0xbc, 0x04, 0x3a, 0x51, 0xf5, 0x1b, 0x31, 0x64, 0xfd, 0x2e,
-  0x20, 0x7b, 0xac, 0x45, 0x02, 0x0e, 0x8e, 0x58, 0x38, 0x25, 0xa5, 0x6f,
-  0x5e, 0x38, 0xcc, 0x02, 0xb6, 0x4f, 0x0f, 0x18, 0xff, 0x62, 0x42, 0x2f,
-  0x74, 0x78, 0x85, 0x42, 0x71, 0x0f, 0xce, 0x59, 0xb7, 0x22, 0x0c, 0x6f,
-  0xd7, 0x39, 0xa0, 0x02, 0x3a, 0x4f, 0x85, 0x19, 0xd0, 0x62, 0x59, 0x2f,
-  0x2b, 0x78, 0xbd, 0x42, 0xa4, 0x0f, 0x7d, 0x58, 0x31, 0x25, 0xb5, 0x6f,
-  0xa7, 0x38, 0x78, 0x05, 0x37, 0x4e, 0xf9, 0x18, 0xdc, 0x65, 0x05, 0x2e,
-  0x6d, 0x7b, 0x2a, 0x44, 0xc5, 0x0e, 0xcd, 0x5b, 0xb7, 0x24, 0x4d, 0x71,
-  0x7f, 0x3a, 0x01, 0x07, 0x74, 0x50, 0xc6, 0x1a, 0xff, 0x67, 0x90, 0x30,
-  0xa1, 0x7d, 0x0d, 0x46, 0x46, 0x13, 0x60, 0x5c, 0x73, 0x29, 0x00, 0x72,
-  0x04, 0x3f, 0x2c, 0x08, 0x30, 0x55, 0x34, 0x1e, 0x3f, 0x6b, 0x3b, 0x34,
-  0x74, 0x01, 0x22, 0x4a, 0x38, 0x17, 0x38, 0x60, 0x36, 0x2d, 0x28, 0x76,
-  0x50, 0x43, 0x11, 0x0c, 0x7c, 0x59, 0x60, 0x22, 0x10, 0x6f, 0x5d, 0x38,
-  0xa5, 0x05, 0x8e, 0x4e, 0xe3, 0x1b, 0xd4, 0x64, 0x33, 0x30, 0x10, 0x7d,
-  0x30, 0x46, 0x58, 0x13, 0xbc, 0x5c, 0x9d, 0x29, 0xd1, 0x72, 0x2b, 0x3e,
-  0x70, 0x0b, 0x56, 0x54, 0xde, 0x21, 0x89, 0x6a, 0x21, 0x36, 0x7c, 0x03,
-  0xa3, 0x4c, 0xe1, 0x19, 0x50, 0x65, 0x62, 0x2e, 0xb5, 0x7b, 0xee, 0x44,
-  0x30, 0x10, 0x08, 0x5d, 0xa2, 0x26, 0xd0, 0x73, 0x7d, 0x3f, 0xab, 0x08,
-  0xc3, 0x55, 0x95, 0x21, 0x9d, 0x6a, 0xd2, 0x37, 0x65, 0x03, 0xd5, 0x4c,
-  0x27, 0x18, 0x41, 0x65, 0xf1, 0x2e, 0x13, 0x7a, 0xa0, 0x47, 0x8d, 0x10,
-  0x59, 0x5c, 0xeb, 0x29, 0x34, 0x75, 0x84, 0x3e, 0x50, 0x0a, 0xa1, 0x57,
-  0x25, 0x23, 0xaf, 0x6c, 0x37, 0x38, 0xb0, 0x05, 0x74, 0x51, 0xb6, 0x1a,
-  0x31, 0x66, 0xab, 0x33, 0x21, 0x7f, 0xbf, 0x48, 0x1e, 0x14, 0xc5, 0x61,
-  0x63, 0x2d, 0xec, 0x76, 0x44, 0x42, 0xc5, 0x0f, 0xe4, 0x5b, 0x1c, 0x27,
-  0xb0, 0x70, 0x5d, 0x3c, 0x21, 0x08, 0x92, 0x55, 0x75, 0x21, 0x9d, 0x6a,
-  0xb6, 0x36, 0x18, 0x02, 0xd9, 0x4f, 0xab, 0x1b, 0x34, 0x67, 0xd1, 0x30,
-  0x9f, 0x7c, 0x2d, 0x48, 0x30, 0x14, 0xf5, 0x61, 0xb5, 0x2d, 0x35, 0x79,
-  0x3a, 0x45, 0xfa, 0x0e, 0xa2, 0x5a, 0x69, 0x26, 0x2c, 0x72, 0xa1, 0x3f,
-  0xd0, 0x0b, 0x4a, 0x57, 0x62, 0x23, 0x20, 0x6f, 0xc2, 0x38, 0x8a, 0x04,
-  0xb6, 0x50, 0x52, 0x1c, 0x67, 0x68, 0x1b, 0x34, 0x74, 0x00, 0xd7, 0x4d,
-  0xe9, 0x19, 0xdd, 0x65, 0xb4, 0x31, 0x41, 0x7d, 0x51, 0x49, 0x6b, 0x15,
-  0x60, 0x61, 0x45, 0x2d, 0x1c, 0x79, 0x24, 0x45, 0x22, 0x11, 0x38, 0x5d,
-  0x7e, 0x29, 0x75, 0x75, 0x74, 0x41, 0x01, 0x0d, 0x38, 0x59, 0x38, 0x25,
-  0x36, 0x71, 0x28, 0x3d, 0x50, 0x09, 0x0c, 0x55, 0x67, 0x21, 0x25, 0x6d,
-  0x51, 0x39, 0x0d, 0x05, 0xa8, 0x51, 0x9c, 0x1d, 0xe2, 0x69, 0xd2, 0x35,
-  0x31, 0x00, 0x55, 0x4c, 0x63, 0x18, 0x49, 0x64, 0xab, 0x30, 0x83, 0x7c,
-  0xd5, 0x48, 0x65, 0x17, 0x75, 0x63, 0x57, 0x2f, 0x93, 0x7b, 0xe5, 0x47,
-  0x33, 0x12, 0x7c, 0x5e, 0xa9, 0x2a, 0xb5, 0x76, 0x20, 0x45, 0x7a, 0x11,
-  0xf0, 0x5d, 0xe9, 0x29, 0x2c, 0x74, 0x68, 0x40, 0xd0, 0x0c, 0xcb, 0x58,
-  0x7b, 0x27, 0xb7, 0x73, 0xc4, 0x3f, 0x05, 0x0a, 0xe4, 0x56, 0xdc, 0x22,
-  0x73, 0x71, 0x81, 0x3d, 0x3d, 0x08, 0x5b, 0x54, 0xf7, 0x20, 0x5d, 0x6f,
-  0xa5, 0x3b, 0xde, 0x07, 0x10, 0x52, 0xf1, 0x1e, 0x7c, 0x6d, 0x80, 0x39,
-  0x50, 0x04, 0xa9, 0x50, 0x2b, 0x1f, 0xb2, 0x6b, 0x22, 0x36, 0xa2, 0x02,
-  0x35, 0x51, 0xac, 0x1d, 0x70, 0x68, 0xa9, 0x34, 0x2b, 0x03, 0xed, 0x4f,
-  0x04, 0x1a, 0x8d, 0x66, 0x71, 0x35, 0xa5, 0x01, 0x42, 0x4c, 0xd8, 0x18,
-  0xad, 0x67, 0x13, 0x32, 0xf5, 0x7e, 0x51, 0x4d, 0x74, 0x18, 0x96, 0x64,
-  0x7f, 0x33, 0xd0, 0x7f, 0xb4, 0x4a, 0x01, 0x19, 0xd5, 0x65, 0xbd, 0x30,
-  0x3a, 0x7f, 0x85, 0x4b, 0xd0, 0x16, 0x4c, 0x65, 0x64, 0x30, 0xfe, 0x7c,
-  0xa2, 0x4b, 0x70, 0x16, 0x22, 0x65, 0xfc, 0x31, 0xb3, 0x7c, 0x78, 0x4b,
-  0x64, 0x16, 0xe4, 0x62, 0x9e, 0x31, 0x05, 0x7c, 0x60, 0x4b, 0x2d, 0x16,
-  0xd5, 0x62, 0xcd, 0x31, 0xb6, 0x7c, 0x52, 0x4b, 0x73, 0x16, 0x1e, 0x65,
-  0x74, 0x30, 0xc1, 0x7c, 0xff, 0x4b, 0xdd, 0x16, 0xb0, 0x65, 0x45, 0x30,
-  0x55, 0x7f, 0x25, 0x4a, 0x71, 0x19, 0x04, 0x64, 0x03, 0x33, 0x39, 0x7e,
-  0x64, 0x4d, 0x31, 0x18, 0x35, 0x67, 0x34, 0x32, 0x30, 0x01, 0x26, 0x4c,
-  0x70, 0x1b, 0x29, 0x66, 0x2b, 0x35, 0x6d, 0x00, 0x11, 0x4f, 0x0b, 0x1a,
-  0x34, 0x69, 0x64, 0x34, 0x5c, 0x03, 0x4c, 0x4e, 0xb6, 0x1d, 0x90, 0x68,
-  0xf9, 0x37, 0xdb, 0x02, 0x33, 0x50, 0x19, 0x1f, 0x69, 0x6a, 0x1d, 0x39,
-  0xa0, 0x04, 0x8c, 0x53, 0xc2, 0x1e, 0x2e, 0x6c, 0x34, 0x3b, 0x55, 0x06,
-  0x91, 0x55, 0xfe, 0x20, 0x37, 0x6e, 0x7c, 0x3d, 0xb7, 0x08, 0xf0, 0x57,
-  0x23, 0x25, 0x74, 0x70, 0xa9, 0x3f, 0xb3, 0x0a, 0x40, 0x58, 0x68, 0x27,
-  0x91, 0x72, 0xd6, 0x41, 0x60, 0x0f, 0xc0, 0x5a, 0xde, 0x29, 0x02, 0x77,
-  0xb6, 0x42, 0xc9, 0x11, 0x78, 0x5f, 0xf0, 0x2a, 0x06, 0x78, 0x40, 0x47,
-  0xf9, 0x12, 0x13, 0x60, 0xb7, 0x2f, 0x18, 0x7a, 0x69, 0x48, 0xea, 0x17,
-  0x61, 0x65, 0xc5, 0x30, 0x11, 0x7e, 0xbf, 0x4d, 0x21, 0x1b, 0xfd, 0x66,
-  0x39, 0x34, 0xbb, 0x03, 0x74, 0x51, 0xa1, 0x1c, 0x38, 0x6a, 0xb8, 0x39,
-  0x64, 0x07, 0xa2, 0x52, 0x1e, 0x20, 0x86, 0x6f, 0x71, 0x3d, 0xa8, 0x08,
-  0x5f, 0x56, 0xdd, 0x25, 0xb1, 0x73, 0x11, 0x41, 0xf5, 0x0c, 0x5b, 0x5a,
-  0x20, 0x28, 0xd5, 0x77, 0x76, 0x45, 0xd2, 0x10, 0xbd, 0x5e, 0x08, 0x2c,
-  0xc2, 0x7b, 0xe5, 0x49, 0x7b, 0x17, 0xc3, 0x62, 0xd0, 0x30, 0x6c, 0x7e,
-  0x64, 0x4c, 0xf0, 0x1b, 0xb1, 0x69, 0x66, 0x37, 0x27, 0x05, 0xfc, 0x50,
-  0xa6, 0x1e, 0x78, 0x6c, 0x64, 0x3a, 0xff, 0x09, 0x85, 0x57, 0x4c, 0x25,
-  0x7a, 0x73, 0x20, 0x41, 0xd4, 0x0c, 0xcd, 0x5a, 0xa7, 0x28, 0x52, 0x76,
-  0x7d, 0x44, 0x05, 0x12, 0x38, 0x60, 0xd0, 0x2f, 0xe8, 0x7d, 0xd3, 0x4b,
-  0xe4, 0x19, 0x0d, 0x67, 0x64, 0x35, 0x6d, 0x03, 0x71, 0x51, 0x17, 0x1f,
-  0x15, 0x6d, 0x6d, 0x3b, 0x2d, 0x09, 0x2e, 0x57, 0x70, 0x25, 0x34, 0x73,
-  0x74, 0x41, 0x31, 0x0f, 0x3f, 0x5d, 0x32, 0x2b, 0x36, 0x79, 0x6d, 0x47,
-  0x04, 0x15, 0x0a, 0x63, 0x34, 0x31, 0x71, 0x7f, 0x58, 0x4d, 0x48, 0x1b,
-  0xe4, 0x69, 0x8e, 0x37, 0xff, 0x05, 0xc0, 0x53, 0x20, 0x20, 0x1d, 0x6e,
-  0x30, 0x3c, 0x51, 0x0a, 0xa1, 0x58, 0x8c, 0x26, 0xd4, 0x74, 0x2c, 0x45,
-  0x7a, 0x13, 0x42, 0x61, 0xd0, 0x2f, 0xf9, 0x7d, 0x2b, 0x4a, 0x3d, 0x18,
-  0xa4, 0x66, 0xfd, 0x34, 0x31, 0x05, 0x35, 0x53, 0xbf, 0x21, 0xeb, 0x6f,
-  0x21, 0x3c, 0x7f, 0x0a, 0x97, 0x58, 0xd7, 0x26, 0x7b, 0x77, 0xb2, 0x45,
-  0xc4, 0x13, 0x05, 0x60, 0xe4, 0x2e, 0xd2, 0x7c, 0x65, 0x4d, 0x81, 0x1b,
-  0x27, 0x68, 0x5c, 0x36, 0xf4, 0x04, 0x18, 0x55, 0xe4, 0x23, 0xcc, 0x71,
-  0x5e, 0x3e, 0xe1, 0x0c, 0x34, 0x5d, 0x96, 0x2b, 0x04, 0x78, 0xac, 0x46,
-  0x2d, 0x17, 0xaf, 0x65, 0x23, 0x32, 0xf5, 0x00, 0x20, 0x51, 0xba, 0x1f,
-  0x70, 0x6c, 0xa9, 0x3a, 0x2c, 0x0b, 0xa8, 0x59, 0x50, 0x26, 0x8b, 0x74,
-  0x7b, 0x45, 0xf7, 0x13, 0x44, 0x60, 0xc5, 0x2e, 0xe4, 0x7f, 0x0a, 0x4c,
-  0xf8, 0x1a, 0x5c, 0x6b, 0x37, 0x38, 0x9d, 0x06, 0x30, 0x57, 0xd1, 0x25,
-  0xa1, 0x72, 0x0c, 0x43, 0xd4, 0x11, 0xe5, 0x5e, 0x7d, 0x2f, 0xcb, 0x7d,
-  0x84, 0x4a, 0x62, 0x1b, 0x64, 0x68, 0xfc, 0x36, 0xf0, 0x07, 0x79, 0x54,
-  0x35, 0x25, 0xe7, 0x73, 0xb7, 0x40, 0x78, 0x11, 0x36, 0x5e, 0xad, 0x2c,
-  0x98, 0x7d, 0x44, 0x4a, 0x78, 0x1b, 0x29, 0x68, 0x9e, 0x36, 0xe8, 0x07,
-  0xaa, 0x54, 0x52, 0x25, 0x62, 0x72, 0x01, 0x43, 0x3c, 0x10, 0xb0, 0x5e,
-  0xe3, 0x2f, 0x92, 0x7c, 0xb1, 0x4d, 0x59, 0x1a, 0x58, 0x6b, 0x00, 0x38,
-  0x46, 0x09, 0x10, 0x56, 0x19, 0x27, 0x23, 0x74, 0x37, 0x45, 0x78, 0x13,
-  0x09, 0x63, 0x3a, 0x30, 0x21, 0x01, 0x75, 0x4e, 0x23, 0x1f, 0x29, 0x6c,
-  0x25, 0x3d, 0x23, 0x0a, 0x14, 0x5b, 0x45, 0x28, 0x7d, 0x79, 0x6b, 0x46,
-  0x10, 0x17, 0x59, 0x64, 0xac, 0x35, 0x98, 0x02, 0xb0, 0x53, 0xd8, 0x20,
-  0x35, 0x70, 0x06, 0x41, 0x63, 0x0e, 0x54, 0x5f, 0xb2, 0x2c, 0x88, 0x7d,
-  0x90, 0x4a, 0x26, 0x1a, 0x71, 0x6b, 0x4b, 0x38, 0x84, 0x09, 0xff, 0x56,
-  0x25, 0x26, 0x71, 0x77, 0xf0, 0x44, 0xfd, 0x15, 0x35, 0x65, 0x79, 0x32,
-  0xbc, 0x03, 0xbd, 0x50, 0x2b, 0x20, 0x6b, 0x71, 0xd0, 0x3e, 0xd1, 0x0f,
-  0x7c, 0x5f, 0xa0, 0x2c, 0xc3, 0x7d, 0x08, 0x4d, 0xe4, 0x1a, 0xcf, 0x6b,
-  0x65, 0x3b, 0x9c, 0x08, 0x3a, 0x58, 0x46, 0x29, 0xbe, 0x76, 0x5d, 0x46,
-  0xe4, 0x17, 0xf9, 0x64, 0x58, 0x34, 0xe0, 0x05, 0x34, 0x55, 0x92, 0x22,
-  0x11, 0x72, 0xa1, 0x43, 0x28, 0x13, 0xae, 0x60, 0x70, 0x30, 0xb4, 0x01,
-  0x26, 0x51, 0xb0, 0x1e, 0x70, 0x6e, 0xbe, 0x3f, 0x36, 0x0f, 0xb8, 0x5c,
-  0x1d, 0x2c, 0x87, 0x7d, 0x78, 0x4d, 0xec, 0x1a, 0x5e, 0x6a, 0xca, 0x3b,
-  0xe8, 0x0b, 0x5d, 0x5b, 0xf1, 0x28, 0x5b, 0x78, 0x30, 0x48, 0xd5, 0x19,
-  0x66, 0x69, 0xd8, 0x36, 0xa3, 0x06, 0x08, 0x56, 0xc4, 0x27, 0xa4, 0x77,
-  0x60, 0x47, 0xcc, 0x14, 0x9f, 0x64, 0x63, 0x34, 0x64, 0x04, 0xf5, 0x55,
-  0xb1, 0x25, 0x66, 0x75, 0x74, 0x45, 0xf6, 0x12, 0xbc, 0x62, 0x78, 0x32,
-  0x25, 0x02, 0xff, 0x53, 0x9c, 0x23, 0x5c, 0x73, 0x34, 0x43, 0x31, 0x13,
-  0xd1, 0x60, 0x86, 0x30, 0xa1, 0x00, 0x53, 0x50, 0x30, 0x20, 0x1a, 0x70,
-  0x22, 0x40, 0xd0, 0x11, 0xe2, 0x61, 0xd3, 0x31, 0xe4, 0x01, 0x0d, 0x51,
-  0x62, 0x21, 0x6a, 0x71, 0x7b, 0x41, 0x08, 0x11, 0x03, 0x61, 0x6d, 0x31,
-  0x25, 0x01, 0x2f, 0x51, 0x35, 0x21, 0x75, 0x71, 0x35, 0x41, 0x21, 0x11,
-  0x24, 0x61, 0x3c, 0x31, 0x27, 0x01, 0x25, 0x51, 0x15, 0x21, 0x01, 0x71,
-  0x34, 0x41, 0x6c, 0x11, 0x5e, 0x61, 0x0d, 0x31, 0xa5, 0x01, 0x91, 0x51,
-  0xfc, 0x21, 0x95, 0x71, 0x30, 0x40, 0x1c, 0x10, 0x62, 0x60, 0x58, 0x30,
-  0xa7, 0x00, 0x99, 0x50, 0xd9, 0x20, 0x2a, 0x73, 0x7a, 0x43, 0x56, 0x13,
-  0xde, 0x63, 0xad, 0x33, 0x64, 0x02, 0x49, 0x52, 0xb8, 0x22, 0xf0, 0x72,
-  0x26, 0x45, 0x70, 0x15, 0xf0, 0x65, 0xf4, 0x35, 0x37, 0x04, 0x2d, 0x54,
-  0x91, 0x24, 0x85, 0x74, 0x67, 0x47, 0xb1, 0x17, 0xc2, 0x67, 0x0c, 0x36,
-  0xaa, 0x06, 0xda, 0x56, 0x75, 0x29, 0xd5, 0x79, 0x39, 0x48, 0x5a, 0x18,
-  0xfe, 0x68, 0x08, 0x3b, 0xa9, 0x0b, 0xc8, 0x5b, 0x5e, 0x2a, 0xf1, 0x7a,
-  0x34, 0x4d, 0x8c, 0x1d, 0x1e, 0x6c, 0xed, 0x3c, 0x30, 0x0f, 0xb5, 0x5f,
-  0x35, 0x2e, 0xf5, 0x7e, 0x37, 0x51, 0xb0, 0x21, 0x3e, 0x70, 0xa9, 0x40,
-  0x21, 0x13, 0xbf, 0x63, 0x50, 0x32, 0x8a, 0x02, 0x72, 0x55, 0xa5, 0x25,
-  0x44, 0x74, 0xc5, 0x44, 0xa1, 0x17, 0x5d, 0x66, 0xf8, 0x36, 0x54, 0x09,
-  0x38, 0x58, 0x99, 0x28, 0x30, 0x7b, 0xca, 0x4b, 0xad, 0x1a, 0x19, 0x6d,
-  0xd8, 0x3d, 0xe5, 0x0c, 0x77, 0x5f, 0xcc, 0x2f, 0x82, 0x7e, 0x6e, 0x51,
-  0x31, 0x20, 0xf1, 0x70, 0xb1, 0x43, 0x67, 0x12, 0x74, 0x65, 0xe6, 0x35,
-  0xbc, 0x04, 0x72, 0x57, 0x30, 0x26, 0xfe, 0x76, 0xd0, 0x49, 0x44, 0x18,
-  0x7a, 0x6b, 0x21, 0x3a, 0x90, 0x0a, 0x98, 0x5d, 0xaa, 0x2c, 0x48, 0x7f,
-  0x63, 0x4e, 0x00, 0x21, 0x35, 0x70, 0xd9, 0x40, 0xb0, 0x13, 0x8e, 0x62,
-  0xbd, 0x35, 0x40, 0x04, 0x52, 0x57, 0x6a, 0x26, 0x78, 0x79, 0x16, 0x48,
-  0x5e, 0x1b, 0x6d, 0x6a, 0x64, 0x3d, 0x14, 0x0c, 0x24, 0x5f, 0x75, 0x2e,
-  0x26, 0x01, 0x30, 0x50, 0x31, 0x23, 0x39, 0x72, 0x37, 0x45, 0x77, 0x14,
-  0x7a, 0x67, 0x6f, 0x36, 0x4b, 0x09, 0x25, 0x58, 0x1b, 0x2b, 0x0d, 0x7a,
-  0x9b, 0x4d, 0xdd, 0x1c, 0xba, 0x6f, 0x95, 0x3e, 0x0b, 0x10, 0x2b, 0x63,
-  0x22, 0x32, 0x1d, 0x05, 0xef, 0x54, 0xcd, 0x27, 0xef, 0x76, 0x1b, 0x48,
-  0x27, 0x1b, 0x05, 0x6a, 0xdd, 0x3d, 0xad, 0x0c, 0x1b, 0x5e, 0x3d, 0x31,
-  0xed, 0x00, 0xb5, 0x53, 0x67, 0x25, 0x2c, 0x74, 0xe9, 0x47, 0x98, 0x16,
-  0x2a, 0x68, 0x62, 0x3b, 0x82, 0x0a, 0xd1, 0x5d, 0x7c, 0x2f, 0xc0, 0x7e,
-  0xc3, 0x51, 0x02, 0x23, 0xb1, 0x72, 0xc9, 0x45, 0x78, 0x17, 0xf1, 0x66,
-  0x31, 0x38, 0x54, 0x0b, 0xe3, 0x5a, 0x09, 0x2c, 0xc0, 0x7f, 0xda, 0x4e,
-  0x55, 0x20, 0xf6, 0x73, 0x60, 0x45, 0xe0, 0x14, 0x22, 0x66, 0xb8, 0x39,
-  0x2d, 0x0b, 0xb3, 0x5a, 0x23, 0x2c, 0x72, 0x7f, 0x16, 0x51, 0xb0, 0x20,
-  0x33, 0x72, 0xbc, 0x45, 0x31, 0x17, 0xbe, 0x66, 0x15, 0x38, 0xc5, 0x0b,
-  0x7d, 0x5d, 0xf1, 0x2c, 0x10, 0x7e, 0xc5, 0x51, 0xa5, 0x23, 0x0e, 0x75,
-  0xb0, 0x44, 0x57, 0x16, 0x31, 0x68, 0x90, 0x3b, 0x7e, 0x0d, 0x9d, 0x5c,
-  0xb7, 0x2e, 0x02, 0x00, 0x90, 0x53, 0xb2, 0x25, 0x71, 0x77, 0xc9, 0x46,
-  0x9c, 0x18, 0x20, 0x6a, 0x34, 0x3c, 0xef, 0x0f, 0xbf, 0x61, 0x61, 0x33,
-  0x31, 0x05, 0xf6, 0x54, 0xa4, 0x26, 0x78, 0x78, 0x20, 0x4a, 0xa1, 0x1d,
-  0xd0, 0x6f, 0x51, 0x41, 0x7c, 0x13, 0x2c, 0x65, 0xc3, 0x34, 0xcd, 0x06,
-  0xb6, 0x58, 0x52, 0x2a, 0x7f, 0x7c, 0x18, 0x4e, 0x74, 0x20, 0xdd, 0x73,
-  0xf1, 0x45, 0x8f, 0x17, 0xa0, 0x69, 0x41, 0x3b, 0x49, 0x0d, 0x25, 0x5f,
-  0x67, 0x31, 0x0d, 0x03, 0x1f, 0x55, 0x3a, 0x27, 0x37, 0x79, 0x7d, 0x4b,
-  0x23, 0x1d, 0x3c, 0x6f, 0x33, 0x41, 0x3b, 0x13, 0x23, 0x65, 0x7d, 0x37,
-  0x2b, 0x09, 0x2b, 0x5b, 0x50, 0x2d, 0x01, 0x7f, 0x71, 0x51, 0x66, 0x23,
-  0x51, 0x75, 0x54, 0x47, 0xea, 0x19, 0xdd, 0x6b, 0xb0, 0x3d, 0xe1, 0x0f,
-  0x3c, 0x60, 0x10, 0x32, 0x30, 0x04, 0x4a, 0x56, 0xa5, 0x28, 0x81, 0x7a,
-  0xdc, 0x4c, 0x36, 0x21, 0x34, 0x73, 0x44, 0x45, 0x82, 0x17, 0xe8, 0x69,
-  0x64, 0x3a, 0x7e, 0x0c, 0xbf, 0x5e, 0xe3, 0x30, 0x31, 0x05, 0x67, 0x57,
-  0xb5, 0x29, 0xf9, 0x7b, 0x64, 0x4c, 0x64, 0x1e, 0x9e, 0x70, 0x85, 0x42,
-  0x71, 0x17, 0xa9, 0x69, 0xd1, 0x3b, 0x0f, 0x0c, 0xab, 0x5e, 0xcf, 0x30,
-  0x71, 0x05, 0x81, 0x57, 0x31, 0x28, 0x15, 0x7a, 0xfd, 0x4c, 0x08, 0x21,
-  0xb6, 0x73, 0xcc, 0x45, 0x5c, 0x16, 0xf6, 0x68, 0x34, 0x3d, 0x84, 0x0f,
-  0x1e, 0x60, 0xa9, 0x32, 0x64, 0x07, 0xb9, 0x59, 0x35, 0x2a, 0xb6, 0x7c,
-  0x3b, 0x51, 0xa7, 0x23, 0x31, 0x74, 0xa9, 0x46, 0x21, 0x1b, 0xa9, 0x6d,
-  0x50, 0x3e, 0x92, 0x10, 0x7d, 0x65, 0xf1, 0x37, 0x58, 0x08, 0x8d, 0x5a,
-  0xb4, 0x2f, 0x0f, 0x00, 0xf5, 0x52, 0x56, 0x27, 0x3d, 0x78, 0x9a, 0x4a,
-  0x65, 0x1f, 0xce, 0x71, 0xe4, 0x42, 0x00, 0x17, 0xd5, 0x69, 0xb1, 0x3a,
-  0x75, 0x0f, 0xc9, 0x61, 0x83, 0x32, 0x2d, 0x07, 0x25, 0x58, 0xf3, 0x2a,
-  0xb4, 0x7f, 0x35, 0x50, 0x27, 0x25, 0xe1, 0x77, 0xbf, 0x48, 0x73, 0x1d,
-  0x21, 0x6e, 0xfe, 0x40, 0xde, 0x15, 0x20, 0x66, 0x67, 0x3b, 0x2a, 0x0c,
-  0xc5, 0x5e, 0x99, 0x33, 0xac, 0x04, 0x38, 0x59, 0x42, 0x2a, 0x00, 0x7f,
-  0x3d, 0x50, 0xdb, 0x22, 0xe3, 0x77, 0x77, 0x48, 0x9d, 0x1d, 0x42, 0x6e,
-  0x45, 0x43, 0x25, 0x14, 0x67, 0x69, 0x11, 0x3a, 0x11, 0x0f, 0x23, 0x60,
-  0x20, 0x35, 0x7d, 0x06, 0x39, 0x5b, 0x3b, 0x2c, 0x74, 0x01, 0x22, 0x52,
-  0x38, 0x27, 0x3c, 0x78, 0x30, 0x4d, 0x6d, 0x1e, 0x03, 0x73, 0x00, 0x44,
-  0x71, 0x19, 0x68, 0x6a, 0x43, 0x3f, 0x0d, 0x10, 0xb0, 0x65, 0x92, 0x36,
-  0xb0, 0x0b, 0xdd, 0x5c, 0x35, 0x30, 0x03, 0x05, 0x75, 0x56, 0x1d, 0x2b,
-  0xab, 0x7c, 0x83, 0x51, 0xd3, 0x22, 0x20, 0x76, 0x34, 0x4b, 0x47, 0x1c,
-  0x95, 0x71, 0xe8, 0x42, 0x2a, 0x16, 0x3d, 0x6b, 0xb1, 0x3c, 0xb5, 0x11,
-  0x30, 0x65, 0x7c, 0x36, 0xbe, 0x0b, 0xf4, 0x5c, 0x2a, 0x30, 0x6a, 0x05,
-  0xd0, 0x56, 0xcd, 0x2b, 0x75, 0x7f, 0xa9, 0x50, 0xdc, 0x25, 0x56, 0x79,
-  0xe4, 0x4a, 0xdf, 0x1f, 0x62, 0x73, 0x9a, 0x44, 0x3f, 0x18, 0x50, 0x6d,
-  0xfe, 0x3e, 0x5d, 0x12, 0xb0, 0x67, 0xcc, 0x38, 0x52, 0x0c, 0xe9, 0x61,
-  0x71, 0x35, 0x96, 0x06, 0x50, 0x5a, 0xac, 0x2f, 0x2a, 0x03, 0xb9, 0x54,
-  0x70, 0x28, 0xa5, 0x7d, 0x3b, 0x51, 0xa1, 0x22, 0x24, 0x76, 0xb8, 0x4b,
-  0x36, 0x1f, 0xb4, 0x70, 0x50, 0x44, 0x84, 0x19, 0x66, 0x6d, 0xe0, 0x3e,
-  0x10, 0x12, 0xde, 0x67, 0xa7, 0x3b, 0x1c, 0x0f, 0xe4, 0x60, 0x41, 0x34,
-  0x31, 0x08, 0x87, 0x5d, 0x75, 0x31, 0xd9, 0x02, 0xe4, 0x56, 0x08, 0x2a,
-  0xc6, 0x7f, 0xa0, 0x53, 0x66, 0x27, 0xdc, 0x78, 0x87, 0x4c, 0x65, 0x20,
-  0x21, 0x74, 0xef, 0x49, 0xb5, 0x1d, 0x3b, 0x71, 0x74, 0x45, 0xb5, 0x16,
-  0x91, 0x6a, 0x3d, 0x3e, 0x37, 0x12, 0xf9, 0x67, 0x91, 0x3b, 0x4c, 0x0f,
-  0x66, 0x63, 0x26, 0x37, 0xd1, 0x08, 0x9e, 0x5c, 0xa1, 0x30, 0x1d, 0x04,
-  0x78, 0x58, 0x10, 0x2c, 0x26, 0x00, 0xd0, 0x55, 0xb0, 0x29, 0x91, 0x7d,
-  0xa1, 0x51, 0x4c, 0x25, 0x54, 0x79, 0x76, 0x4d, 0x34, 0x21, 0x01, 0x75,
-  0x1f, 0x49, 0x3a, 0x1d, 0x2a, 0x71, 0x73, 0x45, 0x54, 0x19, 0x31, 0x6d,
-  0x3b, 0x41, 0x22, 0x15, 0x3e, 0x69, 0x59, 0x3d, 0x33, 0x11, 0x28, 0x65,
-  0x03, 0x39, 0x11, 0x0d, 0x11, 0x61, 0x57, 0x35, 0x45, 0x09, 0x44, 0x5d,
-  0xaa, 0x31, 0x8e, 0x05, 0xea, 0x59, 0xe1, 0x2d, 0x3c, 0x00, 0x1c, 0x54,
-  0x63, 0x28, 0x1d, 0x7c, 0xb7, 0x50, 0x88, 0x24, 0xd5, 0x78, 0x28, 0x4f,
-  0x67, 0x23, 0x05, 0x77, 0x84, 0x4b, 0xe2, 0x1f, 0x64, 0x72, 0x7f, 0x46,
-  0xb5, 0x1a, 0xb5, 0x6e, 0x35, 0x45, 0x35, 0x19, 0xbb, 0x6d, 0xf4, 0x41,
-  0x30, 0x14, 0x6e, 0x68, 0x98, 0x3c, 0xc0, 0x10, 0x7a, 0x67, 0xfe, 0x3b,
-  0x90, 0x0f, 0x19, 0x62, 0xac, 0x36, 0xd8, 0x0a, 0x62, 0x61, 0x90, 0x35,
-  0x74, 0x08, 0x54, 0x5c, 0xe2, 0x30, 0x18, 0x07, 0xe4, 0x5b, 0xcf, 0x2f,
-  0x42, 0x02, 0xec, 0x56, 0x77, 0x2d, 0x8e, 0x01, 0x50, 0x54, 0xbe, 0x28,
-  0x30, 0x7f, 0xb2, 0x53, 0x26, 0x26, 0xb0, 0x7a, 0x27, 0x51, 0xf5, 0x25,
-  0x31, 0x78, 0xb3, 0x4c, 0x20, 0x23, 0xed, 0x77, 0x03, 0x4a, 0x8d, 0x1e,
-  0x71, 0x75, 0xe9, 0x49, 0x46, 0x1c, 0xc8, 0x70, 0xb7, 0x47, 0x5d, 0x1a,
-  0xf1, 0x6e, 0x59, 0x45, 0x3b, 0x18, 0x9b, 0x6c, 0x77, 0x43, 0x9d, 0x17,
-  0xb0, 0x6a, 0x05, 0x41, 0xd5, 0x15, 0xe5, 0x68, 0x63, 0x3f, 0xc4, 0x13,
-  0x9c, 0x66, 0x61, 0x3d, 0x6a, 0x10, 0xbd, 0x64, 0xf0, 0x3b, 0x50, 0x0e,
-  0x22, 0x65, 0xf0, 0x39, 0xa2, 0x0c, 0x64, 0x63, 0x30, 0x36, 0xe5, 0x0a,
-  0x99, 0x61, 0x4b, 0x34, 0x73, 0x0b, 0x65, 0x5e, 0xd8, 0x32, 0x88, 0x09,
-  0xb6, 0x5c, 0x58, 0x33, 0x30, 0x06, 0x1d, 0x5d, 0x35, 0x30, 0xc6, 0x04,
-  0xb0, 0x5b, 0x9b, 0x2e, 0xa5, 0x05, 0x41, 0x58, 0x5c, 0x2f, 0x60, 0x02,
-  0x7a, 0x59, 0x45, 0x2c, 0x19, 0x03, 0x23, 0x56, 0x30, 0x2d, 0x32, 0x00,
-  0x70, 0x57, 0x31, 0x2a, 0x3d, 0x01, 0x26, 0x54, 0x22, 0x2b, 0x38, 0x7e,
-  0x34, 0x55, 0x2c, 0x28, 0x19, 0x7f, 0x17, 0x52, 0x3a, 0x29, 0x07, 0x7c,
-  0x45, 0x53, 0x5d, 0x26, 0xc1, 0x7d, 0xaf, 0x50, 0xe5, 0x27, 0xdc, 0x7a,
-  0x3a, 0x50, 0x06, 0x27, 0xa3, 0x7a, 0x64, 0x51, 0xab, 0x24, 0x98, 0x7b,
-  0x90, 0x4e, 0x23, 0x24, 0x7d, 0x7b, 0x4b, 0x4e, 0x94, 0x25, 0xad, 0x78,
-  0x3d, 0x4e, 0x72, 0x25, 0xa5, 0x78, 0xe7, 0x4f, 0x27, 0x25, 0x70, 0x78,
-  0xbc, 0x4f, 0xfb, 0x22, 0x64, 0x78, 0x64, 0x4f, 0x9e, 0x22, 0x85, 0x79,
-  0x63, 0x4f, 0xad, 0x22, 0xd1, 0x79, 0x19, 0x4f, 0xe4, 0x22, 0xca, 0x79,
-  0x71, 0x4f, 0x86, 0x22, 0x74, 0x78, 0x5a, 0x4f, 0xfe, 0x22, 0x1e, 0x78,
-  0xa1, 0x4f, 0x8d, 0x22, 0x44, 0x78, 0xed, 0x4f, 0x71, 0x25, 0xc5, 0x78,
-  0x1c, 0x4e, 0xa4, 0x25, 0x32, 0x7b, 0xb4, 0x4e, 0x3e, 0x24, 0xb2, 0x7b,
-  0x74, 0x51, 0xa4, 0x24, 0x25, 0x7a, 0xbc, 0x51, 0x36, 0x27, 0xb9, 0x7a,
-  0x15, 0x50, 0x97, 0x27, 0x67, 0x7d, 0xa5, 0x50, 0x56, 0x26, 0xc2, 0x7d,
-  0xb6, 0x53, 0x5d, 0x29, 0xe4, 0x7c, 0x5d, 0x52, 0x31, 0x28, 0xd5, 0x7f,
-  0x73, 0x55, 0xd2, 0x28, 0xa9, 0x7e, 0x1d, 0x54, 0xdc, 0x2b, 0xa0, 0x01,
-  0x6c, 0x57, 0x8b, 0x2a, 0xd0, 0x00, 0x2d, 0x56, 0x09, 0x2c, 0xfc, 0x03,
-  0xbe, 0x59, 0x6c, 0x2f, 0x74, 0x05, 0xe6, 0x58, 0xbd, 0x2e, 0x7c, 0x04,
-  0x28, 0x5a, 0xe1, 0x31, 0x95, 0x07, 0x57, 0x5d, 0x34, 0x33, 0x37, 0x09,
-  0xdf, 0x5c, 0x82, 0x32, 0xa9, 0x08, 0x4e, 0x5e, 0x30, 0x34, 0x02, 0x0a,
-  0x3c, 0x60, 0xdc, 0x37, 0xf3, 0x0d, 0x95, 0x63, 0xe4, 0x39, 0x42, 0x0f,
-  0x5e, 0x65, 0x66, 0x3b, 0x71, 0x11, 0x45, 0x67, 0x18, 0x3d, 0x2c, 0x13,
-  0x20, 0x69, 0x7d, 0x3f, 0x27, 0x15, 0x34, 0x6b, 0x38, 0x41, 0x39, 0x17,
-  0x23, 0x6d, 0x7d, 0x43, 0x30, 0x19, 0x22, 0x6f, 0x50, 0x45, 0x01, 0x1b,
-  0x7d, 0x71, 0x73, 0x47, 0x59, 0x1d, 0x49, 0x73, 0xa1, 0x49, 0xdd, 0x1f,
-  0xe4, 0x75, 0xdd, 0x4b, 0x31, 0x20, 0x18, 0x76, 0x30, 0x4c, 0x53, 0x22,
-  0xab, 0x78, 0x9a, 0x4e, 0x90, 0x24, 0x29, 0x7d, 0x75, 0x53, 0x5c, 0x29,
-  0xd0, 0x7f, 0xe4, 0x55, 0x2a, 0x2a, 0x3d, 0x00, 0xb4, 0x56, 0xfc, 0x2c,
-  0x27, 0x05, 0x74, 0x5b, 0xa2, 0x31, 0xef, 0x07, 0x25, 0x5c, 0x74, 0x32,
-  0xde, 0x08, 0x85, 0x5e, 0x34, 0x37, 0x91, 0x0d, 0xd8, 0x63, 0x08, 0x38,
-  0xb6, 0x0e, 0xd8, 0x64, 0x30, 0x3d, 0x9c, 0x13, 0x27, 0x68, 0x15, 0x3e,
-  0xf1, 0x14, 0x5d, 0x6d, 0xb7, 0x43, 0xd9, 0x19, 0x51, 0x6e, 0xec, 0x44,
-  0x66, 0x1d, 0x86, 0x73, 0x11, 0x48, 0xbe, 0x1e, 0x21, 0x77, 0xfd, 0x4d,
-  0x25, 0x22, 0xa5, 0x78, 0x74, 0x51, 0xbd, 0x27, 0x35, 0x7c, 0xaf, 0x52,
-  0x21, 0x2b, 0xe3, 0x01, 0x72, 0x56, 0x90, 0x2c, 0x64, 0x05, 0x81, 0x5b,
-  0x55, 0x30, 0xcc, 0x06, 0xb7, 0x5f, 0x09, 0x34, 0x95, 0x0a, 0x67, 0x63,
-  0x21, 0x38, 0x9c, 0x0e, 0x7e, 0x67, 0xce, 0x3d, 0x6d, 0x12, 0x39, 0x6b,
-  0xd8, 0x41, 0xac, 0x16, 0x67, 0x6f, 0x85, 0x45, 0x87, 0x1a, 0x6c, 0x73,
-  0x37, 0x48, 0xbd, 0x1e, 0xbc, 0x77, 0x7a, 0x4c, 0x3a, 0x25, 0xf2, 0x7b,
-  0xf0, 0x50, 0x7c, 0x29, 0x23, 0x7e, 0xe2, 0x54, 0xd0, 0x2d, 0x44, 0x02,
-  0x34, 0x5b, 0x29, 0x30, 0xd1, 0x06, 0x9b, 0x5f, 0xad, 0x34, 0x4e, 0x0d,
-  0x78, 0x62, 0x55, 0x3b, 0x20, 0x10, 0xdd, 0x66, 0xe2, 0x3f, 0x92, 0x14,
-  0xaa, 0x6d, 0x48, 0x42, 0x10, 0x1b, 0x77, 0x70, 0x7b, 0x49, 0x0a, 0x1e,
-  0x1d, 0x77, 0x63, 0x4c, 0x64, 0x25, 0x7d, 0x7a, 0x14, 0x53, 0x27, 0x28,
-  0x3d, 0x01, 0x30, 0x56, 0x34, 0x2f, 0x70, 0x04, 0x31, 0x5d, 0x3d, 0x32,
-  0x50, 0x0b, 0x03, 0x60, 0x7b, 0x39, 0x70, 0x0e, 0x5e, 0x67, 0x59, 0x3c,
-  0xa5, 0x15, 0x94, 0x6a, 0xfe, 0x43, 0xc6, 0x18, 0x74, 0x70, 0x14, 0x49,
-  0x7e, 0x1e, 0x59, 0x77, 0xe4, 0x4c, 0x8e, 0x25, 0xc2, 0x7a, 0x30, 0x52,
-  0x79, 0x2b, 0x47, 0x00, 0x9c, 0x59, 0xe4, 0x2e, 0x2a, 0x06, 0x7a, 0x5f,
-  0xf0, 0x34, 0xe6, 0x0d, 0x20, 0x65, 0x74, 0x3a, 0xa4, 0x13, 0xe8, 0x68,
-  0x21, 0x40, 0x7e, 0x19, 0xd0, 0x6e, 0xc9, 0x47, 0x7d, 0x1f, 0xab, 0x74,
-  0xd5, 0x4d, 0x4d, 0x25, 0xb0, 0x7a, 0xd5, 0x53, 0x75, 0x2b, 0xd5, 0x00,
-  0x23, 0x58, 0x54, 0x31, 0xfc, 0x06, 0x11, 0x5e, 0xb7, 0x37, 0x81, 0x0c,
-  0x10, 0x64, 0xe4, 0x3d, 0x7a, 0x15, 0x81, 0x6a, 0x50, 0x42, 0xb9, 0x1b,
-  0x2c, 0x73, 0xb8, 0x48, 0x70, 0x20, 0xb6, 0x79, 0x35, 0x51, 0xa7, 0x26,
-  0x26, 0x7e, 0xb8, 0x57, 0x20, 0x2f, 0xed, 0x04, 0x03, 0x5c, 0x91, 0x35,
-  0x7b, 0x0d, 0xeb, 0x62, 0x55, 0x3a, 0x8d, 0x13, 0xb0, 0x6b, 0x15, 0x43,
-  0xe2, 0x18, 0x5a, 0x70, 0x3a, 0x48, 0x90, 0x21, 0x30, 0x79, 0xd4, 0x4e,
-  0xaa, 0x26, 0x4d, 0x7e, 0xc4, 0x57, 0xad, 0x2f, 0x71, 0x07, 0x85, 0x5c,
-  0x93, 0x34, 0x68, 0x0c, 0x2a, 0x64, 0xe9, 0x3d, 0xb5, 0x15, 0x67, 0x6d,
-  0x74, 0x45, 0xfa, 0x1a, 0xb6, 0x72, 0x3d, 0x4a, 0x30, 0x22, 0xe5, 0x7b,
-  0x95, 0x53, 0x05, 0x2b, 0x66, 0x03, 0x2a, 0x5b, 0xdf, 0x30, 0x80, 0x08,
-  0xe4, 0x60, 0x54, 0x38, 0x63, 0x10, 0x55, 0x68, 0x32, 0x40, 0xd4, 0x19,
-  0xfc, 0x71, 0x91, 0x49, 0xad, 0x21, 0x43, 0x79, 0x57, 0x51, 0x25, 0x29,
-  0x75, 0x01, 0x15, 0x59, 0x11, 0x31, 0x3f, 0x09, 0x30, 0x61, 0x73, 0x39,
-  0x54, 0x11, 0x31, 0x69, 0x3b, 0x41, 0x22, 0x19, 0x3e, 0x71, 0x49, 0x49,
-  0x17, 0x21, 0x34, 0x79, 0x1e, 0x51, 0x04, 0x29, 0x77, 0x01, 0x6a, 0x59,
-  0x42, 0x31, 0x0d, 0x09, 0x8c, 0x61, 0x98, 0x39, 0xf1, 0x11, 0xd1, 0x69,
-  0x25, 0x40, 0x00, 0x18, 0x71, 0x70, 0x4f, 0x48, 0xb0, 0x20, 0x88, 0x78,
-  0xc2, 0x50, 0x36, 0x2b, 0xeb, 0x03, 0x7c, 0x5b, 0x9f, 0x33, 0xf8, 0x0b,
-  0x64, 0x62, 0x6e, 0x3a, 0xa4, 0x12, 0xf4, 0x6a, 0x3a, 0x45, 0x71, 0x1d,
-  0xf0, 0x75, 0xf4, 0x4d, 0x2a, 0x24, 0x2d, 0x7c, 0x84, 0x54, 0xcd, 0x2c,
-  0x71, 0x07, 0xe5, 0x5f, 0xdc, 0x37, 0x02, 0x0e, 0xa6, 0x66, 0xdf, 0x3e,
-  0x69, 0x19, 0xd5, 0x71, 0x3b, 0x48, 0x53, 0x20, 0xb0, 0x78, 0x0a, 0x53,
-  0xac, 0x2b, 0xcc, 0x03, 0x44, 0x5a, 0xa5, 0x32, 0x75, 0x0d, 0x95, 0x65,
-  0x00, 0x3c, 0xa8, 0x14, 0x25, 0x6f, 0xaf, 0x47, 0x23, 0x1e, 0xf5, 0x76,
-  0x20, 0x51, 0xba, 0x29, 0x70, 0x00, 0xbf, 0x58, 0x21, 0x33, 0xed, 0x0b,
-  0x11, 0x62, 0xc5, 0x3a, 0x66, 0x15, 0xe0, 0x6d, 0x51, 0x44, 0xc1, 0x1c,
-  0xa8, 0x77, 0x04, 0x4e, 0xb0, 0x26, 0x53, 0x01, 0x21, 0x58, 0x9b, 0x30,
-  0x30, 0x0b, 0xcd, 0x63, 0xa8, 0x3a, 0x0c, 0x15, 0xd3, 0x6d, 0xa0, 0x44,
-  0x34, 0x1f, 0xd1, 0x77, 0x9f, 0x4e, 0x2d, 0x29, 0x33, 0x00, 0xf2, 0x58,
-  0xa2, 0x33, 0x7e, 0x0a, 0x75, 0x65, 0xb5, 0x3d, 0xf0, 0x14, 0x4e, 0x6f,
-  0x25, 0x46, 0xe9, 0x1e, 0x9c, 0x79, 0x5c, 0x50, 0x38, 0x2b, 0x65, 0x02,
-  0xc4, 0x5a, 0x85, 0x35, 0xa1, 0x0c, 0x4f, 0x67, 0x75, 0x3e, 0x55, 0x19,
-  0x30, 0x70, 0xda, 0x48, 0xf5, 0x23, 0x8e, 0x7a, 0xaa, 0x55, 0x0a, 0x2c,
-  0x44, 0x07, 0x25, 0x5e, 0x67, 0x39, 0x00, 0x10, 0x15, 0x6b, 0x20, 0x42,
-  0x64, 0x1d, 0x29, 0x74, 0x3f, 0x4f, 0x75, 0x26, 0x36, 0x01, 0x30, 0x58,
-  0x70, 0x33, 0x3c, 0x0a, 0x2a, 0x65, 0x34, 0x3c, 0x1f, 0x17, 0x0b, 0x6e,
-  0x71, 0x49, 0x25, 0x20, 0x51, 0x7b, 0x5f, 0x52, 0xab, 0x2d, 0x88, 0x04,
-  0xfe, 0x5f, 0xd1, 0x36, 0x74, 0x10, 0x14, 0x6b, 0x64, 0x42, 0x1d, 0x1d,
-  0xb0, 0x74, 0x85, 0x4f, 0xd5, 0x26, 0x65, 0x00, 0x79, 0x5b, 0x4a, 0x32,
-  0x9d, 0x0d, 0xe8, 0x64, 0x2a, 0x3e, 0x69, 0x19, 0xfc, 0x70, 0xb5, 0x4b,
-  0x27, 0x25, 0x7a, 0x7c, 0xf0, 0x57, 0xe4, 0x2e, 0x2b, 0x08, 0x78, 0x63,
-  0xd0, 0x3a, 0xc8, 0x15, 0x75, 0x6f, 0xae, 0x46, 0xd5, 0x21, 0x4d, 0x7b,
-  0xa5, 0x52, 0x9d, 0x2d, 0x7e, 0x07, 0x9a, 0x5e, 0x20, 0x38, 0x50, 0x13,
-  0xb0, 0x6a, 0x09, 0x44, 0xab, 0x1f, 0x8d, 0x76, 0x53, 0x50, 0xe4, 0x2b,
-  0x78, 0x05, 0x89, 0x5c, 0x50, 0x36, 0xb9, 0x11, 0x2c, 0x6b, 0xb8, 0x42,
-  0x3d, 0x1c, 0xf5, 0x77, 0x38, 0x51, 0xb4, 0x28, 0x24, 0x02, 0xb8, 0x5d,
-  0x36, 0x37, 0xe3, 0x0e, 0x50, 0x68, 0xc5, 0x43, 0x40, 0x1d, 0xed, 0x74,
-  0x55, 0x4e, 0x8d, 0x29, 0xa6, 0x03, 0x12, 0x5d, 0xff, 0x34, 0x5e, 0x0e,
-  0x27, 0x68, 0x9d, 0x43, 0x75, 0x1d, 0xd1, 0x74, 0xa2, 0x4e, 0x4d, 0x28,
-  0xd8, 0x03, 0xa0, 0x5d, 0x66, 0x37, 0xc0, 0x0e, 0xd0, 0x68, 0x61, 0x42,
-  0x2b, 0x1c, 0xf2, 0x77, 0xbb, 0x51, 0x66, 0x2b, 0x74, 0x05, 0xf9, 0x5c,
-  0xb9, 0x36, 0x76, 0x10, 0x21, 0x6a, 0xad, 0x45, 0x99, 0x1f, 0x51, 0x79,
-  0x34, 0x53, 0x28, 0x2d, 0xd9, 0x04, 0x8a, 0x5e, 0xac, 0x38, 0x49, 0x12,
-  0x30, 0x6c, 0x1d, 0x46, 0x35, 0x20, 0xc3, 0x7b, 0xf5, 0x55, 0xdd, 0x2f,
-  0xb7, 0x09, 0x42, 0x63, 0x5d, 0x3d, 0x60, 0x17, 0x60, 0x71, 0x0d, 0x4b,
-  0x19, 0x25, 0x23, 0x7f, 0x23, 0x59, 0x7d, 0x33, 0x39, 0x0d, 0x3b, 0x67,
-  0x20, 0x41, 0x30, 0x1b, 0x22, 0x75, 0x38, 0x4f, 0x37, 0x29, 0x39, 0x03,
-  0x19, 0x5d, 0x0b, 0x37, 0x73, 0x11, 0x25, 0x6b, 0x59, 0x45, 0x43, 0x1f,
-  0xe4, 0x79, 0x94, 0x53, 0xe4, 0x2d, 0x99, 0x07, 0x74, 0x60, 0x01, 0x3a,
-  0x78, 0x14, 0x52, 0x6e, 0xb1, 0x48, 0x8a, 0x22, 0xd8, 0x7c, 0x6b, 0x59,
-  0x13, 0x33, 0x4a, 0x0d, 0x85, 0x67, 0xf9, 0x41, 0x37, 0x1a, 0x74, 0x74,
-  0xb4, 0x4e, 0xf0, 0x28, 0x40, 0x05, 0x46, 0x5f, 0xa9, 0x39, 0xf3, 0x13,
-  0x25, 0x6c, 0x6e, 0x46, 0x9f, 0x20, 0xd7, 0x7a, 0x34, 0x57, 0x8d, 0x31,
-  0xd5, 0x0b, 0x0c, 0x64, 0xa0, 0x3e, 0xcc, 0x18, 0x65, 0x75, 0x94, 0x4f,
-  0x26, 0x28, 0x41, 0x02, 0xf5, 0x5c, 0x0f, 0x39, 0xb7, 0x13, 0x3c, 0x6d,
-  0x79, 0x46, 0xf1, 0x20, 0x33, 0x7d, 0x96, 0x57, 0x50, 0x30, 0xac, 0x0a,
-  0x64, 0x67, 0xaa, 0x41, 0x31, 0x1a, 0xa7, 0x74, 0x39, 0x51, 0xf9, 0x2b,
-  0x70, 0x04, 0xae, 0x5e, 0x31, 0x3b, 0xa3, 0x15, 0x1e, 0x6e, 0x9c, 0x48,
-  0x34, 0x25, 0xe1, 0x7f, 0x51, 0x58, 0xd4, 0x32, 0xe5, 0x0f, 0x5d, 0x68,
-  0xb0, 0x42, 0x62, 0x1f, 0x3c, 0x78, 0x9c, 0x52, 0x7c, 0x2f, 0xd8, 0x09,
-  0xe4, 0x62, 0x19, 0x3f, 0xd8, 0x19, 0xa0, 0x72, 0x34, 0x4f, 0xc7, 0x29,
-  0x82, 0x02, 0x68, 0x5f, 0x21, 0x38, 0xe7, 0x12, 0xb5, 0x6f, 0x35, 0x48,
-  0x32, 0x25, 0xe7, 0x7f, 0xbf, 0x58, 0x70, 0x35, 0x64, 0x0e, 0xc1, 0x68,
-  0x91, 0x45, 0x4e, 0x1e, 0x71, 0x7b, 0x65, 0x54, 0xf5, 0x2e, 0x9f, 0x0b,
-  0xad, 0x64, 0x58, 0x41, 0x30, 0x1a, 0x1c, 0x77, 0x27, 0x50, 0x95, 0x2a,
-  0xf3, 0x07, 0x98, 0x60, 0xb6, 0x3d, 0x59, 0x16, 0x51, 0x73, 0x6c, 0x4c,
-  0x7a, 0x29, 0x09, 0x02, 0x09, 0x5f, 0x6d, 0x38, 0x36, 0x15, 0x38, 0x6e,
-  0x36, 0x4b, 0x27, 0x24, 0x31, 0x01, 0x26, 0x5a, 0x38, 0x37, 0x34, 0x10,
-  0x2a, 0x6d, 0x2a, 0x46, 0x5c, 0x23, 0x45, 0x7c, 0x6d, 0x59, 0x6a, 0x32,
-  0x45, 0x0f, 0x0d, 0x68, 0xa0, 0x45, 0x92, 0x1e, 0xfe, 0x7b, 0x92, 0x54,
-  0x20, 0x30, 0x55, 0x0d, 0x63, 0x66, 0x58, 0x43, 0xa1, 0x1c, 0xcd, 0x79,
-  0xd1, 0x52, 0x2b, 0x2e, 0x6d, 0x0b, 0x51, 0x64, 0x98, 0x41, 0xe4, 0x1a,
-  0x2a, 0x76, 0x7a, 0x53, 0xf0, 0x2c, 0xfd, 0x09, 0x31, 0x65, 0x67, 0x3e,
-  0xb5, 0x1b, 0xbd, 0x74, 0x30, 0x50, 0x65, 0x2d, 0x91, 0x06, 0xd1, 0x63,
-  0x34, 0x3f, 0xb2, 0x18, 0xd9, 0x75, 0x01, 0x51, 0xa8, 0x2a, 0x9d, 0x07,
-  0x78, 0x63, 0x90, 0x3c, 0x38, 0x18, 0x45, 0x75, 0xb0, 0x4e, 0x04, 0x2a,
-  0xab, 0x07, 0xd8, 0x60, 0x10, 0x3c, 0xf2, 0x19, 0x7d, 0x75, 0x91, 0x4e,
-  0x18, 0x2a, 0xed, 0x07, 0x3d, 0x63, 0xb2, 0x3c, 0x25, 0x18, 0xa7, 0x75,
-  0x74, 0x51, 0xa4, 0x2a, 0x25, 0x06, 0xb8, 0x63, 0x37, 0x3f, 0xb9, 0x18,
-  0x5e, 0x74, 0xe3, 0x51, 0x7d, 0x2d, 0xeb, 0x06, 0x43, 0x62, 0xc4, 0x3f,
-  0xa0, 0x1b, 0x18, 0x77, 0x95, 0x50, 0x77, 0x2c, 0x31, 0x08, 0x94, 0x65,
-  0x73, 0x41, 0xd5, 0x1a, 0x6e, 0x76, 0x39, 0x52, 0xd8, 0x2f, 0xac, 0x0b,
-  0x67, 0x67, 0x85, 0x40, 0x99, 0x1c, 0x7e, 0x78, 0x64, 0x54, 0xfc, 0x31,
-  0xf0, 0x0d, 0x66, 0x69, 0x35, 0x45, 0xfb, 0x1e, 0xb4, 0x7a, 0x64, 0x56,
-  0x64, 0x32, 0xef, 0x0f, 0x95, 0x6b, 0x44, 0x47, 0x77, 0x23, 0x2d, 0x7f,
-  0x90, 0x58, 0x84, 0x34, 0xaa, 0x10, 0x1d, 0x6c, 0x71, 0x48, 0x55, 0x24,
-  0x37, 0x00, 0xda, 0x5d, 0xe6, 0x39, 0x98, 0x15, 0xe4, 0x71, 0x42, 0x4d,
-  0x5e, 0x29, 0x25, 0x05, 0x67, 0x61, 0x0a, 0x3d, 0x1d, 0x19, 0x28, 0x75,
-  0x64, 0x51, 0x29, 0x2d, 0x22, 0x09, 0x3a, 0x65, 0x24, 0x41, 0x3c, 0x1d,
-  0x33, 0x79, 0x3c, 0x55, 0x28, 0x31, 0x6d, 0x0d, 0x19, 0x69, 0x16, 0x45,
-  0x78, 0x21, 0x64, 0x7d, 0x5e, 0x59, 0x49, 0x35, 0xea, 0x11, 0xdd, 0x6d,
-  0xb0, 0x49, 0xfc, 0x25, 0x20, 0x00, 0x55, 0x5c, 0x79, 0x38, 0x4e, 0x14,
-  0xe4, 0x70, 0x9f, 0x4c, 0xd1, 0x28, 0x2c, 0x07, 0x7a, 0x63, 0x4c, 0x3f,
-  0x9e, 0x1b, 0xea, 0x77, 0x6a, 0x52, 0x3d, 0x2e, 0xf0, 0x0a, 0xc1, 0x66,
-  0x3c, 0x45, 0x70, 0x21, 0xf0, 0x7d, 0xf2, 0x59, 0x27, 0x34, 0x68, 0x10,
-  0x91, 0x6c, 0xcb, 0x48, 0x34, 0x27, 0xac, 0x03, 0xc3, 0x5f, 0x4d, 0x3a,
-  0xb0, 0x16, 0xd2, 0x72, 0x30, 0x51, 0x8c, 0x2d, 0x3b, 0x08, 0x40, 0x64,
-  0xe2, 0x40, 0x5d, 0x1f, 0xb7, 0x7b, 0xc2, 0x57, 0x45, 0x32, 0xf1, 0x0e,
-  0x7c, 0x6d, 0xc9, 0x49, 0x50, 0x24, 0xac, 0x00, 0x2a, 0x5f, 0xb9, 0x3b,
-  0x70, 0x16, 0xbd, 0x72, 0x31, 0x51, 0xb4, 0x2d, 0x26, 0x08, 0xa4, 0x64,
-  0x64, 0x43, 0xab, 0x1f, 0x1f, 0x7a, 0x89, 0x56, 0x7d, 0x35, 0xe4, 0x11,
-  0x57, 0x6c, 0xc8, 0x48, 0xe4, 0x27, 0x14, 0x02, 0xe3, 0x5e, 0x15, 0x3d,
-  0x20, 0x18, 0x9a, 0x74, 0x30, 0x53, 0xc4, 0x2f, 0xab, 0x0a, 0x18, 0x69,
-  0xc2, 0x45, 0xe5, 0x20, 0x7a, 0x7f, 0xca, 0x5b, 0x82, 0x36, 0x79, 0x15,
-  0x2c, 0x70, 0xa6, 0x4c, 0xf0, 0x2b, 0x61, 0x06, 0x3c, 0x65, 0xf0, 0x41,
-  0xf0, 0x1c, 0x7f, 0x7b, 0x21, 0x56, 0xec, 0x32, 0x93, 0x11, 0x4d, 0x6c,
-  0x34, 0x4b, 0x20, 0x26, 0xc8, 0x02, 0x99, 0x61, 0xa1, 0x3c, 0x53, 0x1b,
-  0x74, 0x76, 0x06, 0x55, 0x74, 0x30, 0xc2, 0x0c, 0xf5, 0x6b, 0x8e, 0x46,
-  0xb0, 0x25, 0x0d, 0x00, 0x51, 0x5f, 0x6b, 0x3a, 0x70, 0x19, 0x45, 0x74,
-  0x15, 0x53, 0x2c, 0x2e, 0x37, 0x0d, 0x29, 0x68, 0x7e, 0x47, 0x51, 0x22,
-  0x23, 0x01, 0x30, 0x5c, 0x23, 0x3b, 0x29, 0x16, 0x40, 0x75, 0x28, 0x50,
-  0x11, 0x2f, 0x16, 0x0a, 0x60, 0x69, 0x00, 0x44, 0x5e, 0x23, 0x42, 0x7e,
-  0xb6, 0x5d, 0x89, 0x38, 0xf8, 0x17, 0xb0, 0x72, 0x16, 0x50, 0x10, 0x2f,
-  0x71, 0x0a, 0x5e, 0x69, 0xac, 0x44, 0xeb, 0x22, 0xe4, 0x7e, 0x2d, 0x5c,
-  0x7d, 0x3b, 0x56, 0x16, 0xd0, 0x75, 0xe4, 0x50, 0x37, 0x2e, 0x3d, 0x0d,
-  0xb1, 0x68, 0xb5, 0x47, 0x27, 0x25, 0x74, 0x00, 0xbe, 0x5f, 0xf9, 0x3a,
-  0x3d, 0x18, 0x2d, 0x77, 0x92, 0x52, 0xc0, 0x31, 0x75, 0x0f, 0xa6, 0x6a,
-  0xd8, 0x49, 0x4d, 0x27, 0xad, 0x02, 0xd3, 0x61, 0x30, 0x3f, 0x94, 0x1a,
-  0x74, 0x78, 0x56, 0x57, 0xff, 0x32, 0x0b, 0x10, 0xa1, 0x6f, 0x8d, 0x4a,
-  0x5f, 0x28, 0xeb, 0x07, 0x34, 0x65, 0x96, 0x40, 0x1f, 0x1e, 0xa0, 0x7d,
-  0x21, 0x5b, 0xfd, 0x36, 0x24, 0x14, 0xa7, 0x73, 0x3b, 0x51, 0xa5, 0x2c,
-  0x39, 0x0a, 0xbe, 0x69, 0x25, 0x47, 0xa1, 0x22, 0x50, 0x00, 0x8c, 0x5f,
-  0x67, 0x3d, 0xe9, 0x18, 0x51, 0x76, 0xc3, 0x55, 0xa0, 0x33, 0x53, 0x11,
-  0xb0, 0x6c, 0x15, 0x4a, 0x1d, 0x28, 0x81, 0x07, 0x30, 0x65, 0xd4, 0x40,
-  0xb7, 0x1e, 0x4d, 0x7c, 0xc2, 0x5b, 0xa4, 0x39, 0x7d, 0x17, 0xcb, 0x72,
-  0x99, 0x50, 0x63, 0x2e, 0x23, 0x0c, 0xb3, 0x6b, 0xf0, 0x49, 0x35, 0x27,
-  0x00, 0x05, 0xfa, 0x60, 0xf0, 0x3e, 0x64, 0x1c, 0x2b, 0x7a, 0xf8, 0x59,
-  0x82, 0x37, 0x05, 0x15, 0x63, 0x73, 0x20, 0x51, 0xc3, 0x2c, 0x99, 0x0a,
-  0xe4, 0x68, 0x54, 0x46, 0x63, 0x24, 0x55, 0x02, 0x35, 0x60, 0xdb, 0x3f,
-  0xb0, 0x1d, 0x98, 0x7b, 0xa9, 0x59, 0x4f, 0x37, 0x51, 0x15, 0x6b, 0x73,
-  0x7f, 0x51, 0x08, 0x2f, 0x15, 0x0d, 0x23, 0x6b, 0x30, 0x49, 0x7d, 0x27,
-  0x3f, 0x05, 0x33, 0x63, 0x74, 0x41, 0x21, 0x1f, 0x38, 0x7d, 0x38, 0x5b,
-  0x64, 0x39, 0x2e, 0x17, 0x1f, 0x75, 0x13, 0x53, 0x71, 0x31, 0x25, 0x0f,
-  0x47, 0x6d, 0x45, 0x4b, 0xad, 0x29, 0x9e, 0x07, 0xf8, 0x65, 0x95, 0x43,
-  0x38, 0x20, 0x1a, 0x7e, 0x7f, 0x5c, 0x56, 0x3a, 0xb7, 0x18, 0xcd, 0x76,
-  0xc4, 0x54, 0x2a, 0x35, 0x7b, 0x13, 0x05, 0x71, 0x83, 0x4f, 0xf9, 0x2d,
-  0x21, 0x0a, 0x78, 0x68, 0xa0, 0x46, 0xb5, 0x24, 0x20, 0x05, 0x7a, 0x63,
-  0xf0, 0x41, 0xfe, 0x1f, 0x28, 0x7c, 0x64, 0x5a, 0x9d, 0x38, 0xc7, 0x16,
-  0x3a, 0x77, 0xe5, 0x55, 0x90, 0x33, 0x39, 0x10, 0xac, 0x6e, 0xd8, 0x4c,
-  0x30, 0x2d, 0x97, 0x0b, 0x31, 0x68, 0x54, 0x46, 0xf3, 0x24, 0x15, 0x05,
-  0xe4, 0x63, 0xc8, 0x41, 0x48, 0x1e, 0xf1, 0x7c, 0x71, 0x5d, 0x8b, 0x3b,
-  0x14, 0x18, 0xbe, 0x76, 0x64, 0x57, 0xa9, 0x35, 0x3f, 0x12, 0xf5, 0x70,
-  0x20, 0x51, 0xbd, 0x2f, 0x35, 0x0c, 0xfd, 0x6a, 0x21, 0x4b, 0xac, 0x29,
-  0x03, 0x06, 0x91, 0x64, 0x38, 0x45, 0xa5, 0x23, 0x51, 0x00, 0xc3, 0x5e,
-  0xa0, 0x3f, 0x5d, 0x1c, 0xe4, 0x7a, 0x5d, 0x5b, 0x31, 0x38, 0x87, 0x16,
-  0x75, 0x77, 0x9d, 0x55, 0xad, 0x32, 0x1e, 0x13, 0x90, 0x71, 0xa1, 0x4e,
-  0x71, 0x2f, 0xcb, 0x0d, 0x83, 0x6a, 0x68, 0x4b, 0x64, 0x28, 0xfb, 0x06,
-  0xbf, 0x67, 0x79, 0x44, 0x3d, 0x25, 0xf4, 0x03, 0xb7, 0x60, 0x78, 0x41,
-  0x64, 0x1e, 0xf9, 0x7c, 0x9f, 0x5d, 0x05, 0x3a, 0x60, 0x1b, 0x2d, 0x78,
-  0xd5, 0x56, 0xcd, 0x37, 0xaa, 0x14, 0x52, 0x75, 0x62, 0x52, 0x01, 0x33,
-  0x3c, 0x10, 0x9b, 0x6e, 0xb0, 0x4f, 0xdd, 0x2c, 0x90, 0x0d, 0x45, 0x6a,
-  0x55, 0x4b, 0x25, 0x28, 0x7b, 0x09, 0x06, 0x66, 0x15, 0x47, 0x2c, 0x24,
-  0x2a, 0x05, 0x7d, 0x62, 0x24, 0x43, 0x3a, 0x20, 0x74, 0x01, 0x21, 0x5e,
-  0x38, 0x3f, 0x38, 0x1c, 0x64, 0x7d, 0x3e, 0x5a, 0x1f, 0x3b, 0x10, 0x18,
-  0x60, 0x79, 0x6d, 0x56, 0x10, 0x37, 0x5e, 0x14, 0xa1, 0x75, 0x98, 0x52,
-  0xfd, 0x33, 0xc6, 0x10, 0x74, 0x70, 0x00, 0x51, 0x7e, 0x2e, 0x54, 0x0f,
-  0xaa, 0x6c, 0x9b, 0x4d, 0xd9, 0x2a, 0x31, 0x0a, 0x7d, 0x6b, 0x4b, 0x48,
-  0x97, 0x29, 0xa3, 0x06, 0x40, 0x66, 0x78, 0x47, 0xb1, 0x24, 0xe6, 0x05,
-  0x20, 0x65, 0x10, 0x42, 0xbe, 0x23, 0xf2, 0x00, 0x36, 0x60, 0x79, 0x41,
-  0x98, 0x1e, 0xa0, 0x7f, 0x56, 0x5f, 0xa0, 0x3c, 0xd1, 0x1d, 0x0e, 0x7d,
-  0xac, 0x5a, 0x4f, 0x3b, 0x44, 0x1b, 0x9d, 0x78, 0x3d, 0x58, 0x46, 0x39,
-  0xb0, 0x16, 0x14, 0x76, 0xb7, 0x57, 0x8d, 0x34, 0x51, 0x14, 0xa5, 0x75,
-  0x67, 0x55, 0x84, 0x32, 0x1e, 0x12, 0xa9, 0x73, 0x3d, 0x53, 0xfd, 0x30,
-  0x32, 0x10, 0xb0, 0x71, 0x35, 0x51, 0xb6, 0x2e, 0x38, 0x0e, 0xfd, 0x6f,
-  0x2d, 0x4f, 0xa3, 0x2c, 0x50, 0x0c, 0x84, 0x6d, 0x34, 0x4d, 0xe6, 0x2a,
-  0x5f, 0x0a, 0xdb, 0x6b, 0xa1, 0x4b, 0x5d, 0x2b, 0xff, 0x08, 0x5b, 0x68,
-  0x74, 0x48, 0x86, 0x29, 0x7f, 0x09, 0xd0, 0x66, 0xa1, 0x46, 0x4d, 0x26,
-  0xc4, 0x07, 0xb7, 0x67, 0x7b, 0x47, 0xd5, 0x24, 0x99, 0x04, 0x6e, 0x64,
-  0x25, 0x44, 0xf1, 0x25, 0xf0, 0x05, 0x7c, 0x65, 0x27, 0x45, 0xf9, 0x22,
-  0xb1, 0x02, 0x73, 0x62, 0x20, 0x42, 0xa3, 0x23, 0xd0, 0x03, 0x05, 0x63,
-  0x5d, 0x43, 0x31, 0x23, 0x90, 0x00, 0x84, 0x60, 0xb7, 0x40, 0x1d, 0x20,
-  0x62, 0x00, 0x14, 0x60, 0x3d, 0x40, 0xdb, 0x21, 0xf9, 0x01, 0x93, 0x61,
-  0xa3, 0x41, 0x03, 0x21, 0x10, 0x01, 0x25, 0x61, 0x40, 0x41, 0x0d, 0x21,
-  0x15, 0x01, 0x6d, 0x61, 0x37, 0x41, 0x29, 0x21, 0x35, 0x01, 0x30, 0x61,
-  0x24, 0x41, 0x75, 0x21, 0x33, 0x01, 0x32, 0x61, 0x32, 0x41, 0x28, 0x21,
-  0x50, 0x01, 0x00, 0x61, 0x79, 0x41, 0x67, 0x21, 0x51, 0x01, 0x43, 0x61,
-  0xaf, 0x41, 0x90, 0x21, 0xf5, 0x01, 0xdb, 0x61, 0x20, 0x40, 0x55, 0x20,
-  0x64, 0x00, 0x52, 0x60, 0xe4, 0x40, 0x94, 0x20, 0xdf, 0x00, 0x30, 0x63,
-  0x66, 0x43, 0x05, 0x23, 0x95, 0x03, 0xec, 0x63, 0x37, 0x42, 0x69, 0x22,
-  0xf0, 0x02, 0xf7, 0x62, 0x38, 0x45, 0x7a, 0x25, 0xb3, 0x05, 0xf6, 0x65,
-  0x37, 0x44, 0x2d, 0x24, 0x89, 0x04, 0xca, 0x64, 0x61, 0x47, 0xb7, 0x27,
-  0x90, 0x07, 0x1d, 0x66, 0xa5, 0x46, 0xc9, 0x26, 0x78, 0x09, 0xd9, 0x69,
-  0x74, 0x48, 0x54, 0x28, 0xfe, 0x08, 0x19, 0x6b, 0xe4, 0x4b, 0xd9, 0x2b,
-  0x58, 0x0a, 0xe0, 0x6a, 0x34, 0x4d, 0x8a, 0x2d, 0x13, 0x0c, 0xa8, 0x6c,
-  0x25, 0x4f, 0xb3, 0x2f, 0x70, 0x0e, 0xa2, 0x6e, 0x35, 0x51, 0xa1, 0x31,
-  0x35, 0x10, 0xaf, 0x70, 0x37, 0x53, 0xed, 0x33, 0x18, 0x12, 0x80, 0x72,
-  0x66, 0x55, 0xe0, 0x35, 0x10, 0x14, 0xc1, 0x74, 0xab, 0x57, 0x12, 0x36,
-  0xfb, 0x16, 0x15, 0x79, 0x21, 0x58, 0x9b, 0x38, 0x63, 0x1b, 0xdc, 0x7b,
-  0xa2, 0x5a, 0x08, 0x3d, 0x9e, 0x1d, 0xe5, 0x7c, 0x34, 0x5f, 0xf1, 0x3f,
-  0x98, 0x1e, 0x68, 0x01, 0x64, 0x60, 0xff, 0x40, 0xb5, 0x23, 0x74, 0x02,
-  0x37, 0x65, 0xfd, 0x45, 0xf0, 0x24, 0x78, 0x07, 0x3c, 0x66, 0xf9, 0x46,
-  0x95, 0x29, 0x4b, 0x08, 0x70, 0x6b, 0x36, 0x4a, 0x90, 0x2a, 0x99, 0x0d,
-  0xab, 0x6c, 0x1d, 0x4f, 0x64, 0x2e, 0x1d, 0x11, 0x31, 0x70, 0x95, 0x50,
-  0xe7, 0x33, 0x98, 0x12, 0xb7, 0x75, 0x59, 0x54, 0x1c, 0x37, 0x25, 0x16,
-  0x75, 0x79, 0x0b, 0x58, 0x14, 0x3b, 0x6d, 0x1a, 0x30, 0x7d, 0x35, 0x5c,
-  0x35, 0x3f, 0x27, 0x1e, 0x31, 0x01, 0x75, 0x60, 0x39, 0x43, 0x2e, 0x22,
-  0x64, 0x05, 0x29, 0x64, 0x15, 0x47, 0x0b, 0x26, 0x67, 0x09, 0x60, 0x68,
-  0x10, 0x4b, 0x4b, 0x2a, 0xab, 0x0d, 0x91, 0x6c, 0xf9, 0x4f, 0xd4, 0x2e,
-  0x33, 0x10, 0x10, 0x73, 0x30, 0x52, 0x49, 0x35, 0xab, 0x14, 0xcd, 0x77,
-  0xc4, 0x56, 0x2d, 0x38, 0x71, 0x1b, 0x05, 0x7a, 0x9e, 0x5d, 0xe2, 0x3c,
-  0x36, 0x1e, 0x69, 0x01, 0xb8, 0x60, 0xbb, 0x43, 0x50, 0x25, 0x62, 0x04,
-  0xb5, 0x67, 0xee, 0x46, 0x30, 0x28, 0x08, 0x0b, 0x9e, 0x6a, 0xca, 0x4d,
-  0x66, 0x2f, 0xb1, 0x0e, 0xd8, 0x71, 0x62, 0x53, 0x90, 0x32, 0xcf, 0x15,
-  0x7f, 0x77, 0x85, 0x56, 0x3d, 0x38, 0x56, 0x1b, 0xf1, 0x7a, 0x11, 0x5c,
-  0xe4, 0x3f, 0xe4, 0x1e, 0x43, 0x00, 0xe9, 0x63, 0x75, 0x45, 0x8b, 0x24,
-  0x14, 0x06, 0x0b, 0x69, 0x10, 0x4b, 0xb5, 0x2a, 0x35, 0x0c, 0xf5, 0x6f,
-  0x38, 0x51, 0xb4, 0x30, 0x22, 0x12, 0xba, 0x75, 0x21, 0x57, 0xed, 0x36,
-  0x04, 0x18, 0x97, 0x7b, 0x71, 0x5d, 0xe0, 0x3c, 0x43, 0x1e, 0x8d, 0x01,
-  0xac, 0x63, 0x18, 0x45, 0xe2, 0x24, 0x50, 0x06, 0x74, 0x68, 0x86, 0x4b,
-  0x75, 0x2d, 0xd8, 0x0c, 0xa9, 0x6e, 0x4d, 0x50, 0xc4, 0x33, 0xaa, 0x15,
-  0x34, 0x77, 0xc7, 0x56, 0x95, 0x38, 0x2d, 0x1a, 0x34, 0x7c, 0xef, 0x5f,
-  0xbf, 0x41, 0x61, 0x23, 0x31, 0x05, 0xf6, 0x64, 0xa4, 0x46, 0x74, 0x28,
-  0x2a, 0x0a, 0xea, 0x6d, 0xd0, 0x4f, 0x5c, 0x31, 0x7b, 0x13, 0x30, 0x75,
-  0x90, 0x54, 0x8b, 0x36, 0xb6, 0x18, 0x52, 0x7a, 0x7d, 0x5c, 0x55, 0x3e,
-  0x20, 0x20, 0xdd, 0x03, 0xf5, 0x65, 0xdd, 0x47, 0xb6, 0x29, 0x4c, 0x0b,
-  0x59, 0x6d, 0x6b, 0x4f, 0x3a, 0x31, 0x45, 0x13, 0x50, 0x75, 0x0c, 0x57,
-  0x37, 0x39, 0x7d, 0x1b, 0x29, 0x7d, 0x3a, 0x5f, 0x21, 0x41, 0x75, 0x23,
-  0x20, 0x05, 0x28, 0x67, 0x37, 0x49, 0x25, 0x2b, 0x50, 0x0d, 0x11, 0x6f,
-  0x7c, 0x51, 0x77, 0x33, 0x5f, 0x15, 0x58, 0x77, 0xa3, 0x59, 0x95, 0x3b,
-  0xb0, 0x1d, 0xc1, 0x7f, 0x3c, 0x60, 0x10, 0x42, 0x30, 0x24, 0x48, 0x06,
-  0xaa, 0x68, 0x89, 0x4a, 0xd5, 0x2c, 0x37, 0x11, 0x73, 0x73, 0x57, 0x55,
-  0x9f, 0x37, 0xfa, 0x19, 0x30, 0x7a, 0x75, 0x5c, 0xfc, 0x3e, 0xb5, 0x20,
-  0x2d, 0x05, 0x7a, 0x67, 0xa5, 0x49, 0xbd, 0x2b, 0x27, 0x0c, 0x6c, 0x6e,
-  0x9e, 0x50, 0x85, 0x32, 0x7c, 0x17, 0xa0, 0x79, 0xd1, 0x5b, 0x1f, 0x3c,
-  0xe4, 0x1e, 0xdf, 0x00, 0x79, 0x65, 0x87, 0x47, 0x30, 0x28, 0x46, 0x0a,
-  0xb0, 0x6c, 0x1e, 0x51, 0xac, 0x33, 0xc4, 0x15, 0x42, 0x76, 0xf5, 0x58,
-  0x7d, 0x3d, 0x8b, 0x1f, 0x17, 0x00, 0xed, 0x62, 0x2b, 0x47, 0xab, 0x29,
-  0x35, 0x0a, 0xa7, 0x6c, 0x3c, 0x51, 0xb0, 0x33, 0x31, 0x14, 0xb9, 0x76,
-  0x6a, 0x5b, 0xed, 0x3d, 0x50, 0x1e, 0xb1, 0x00, 0x7c, 0x65, 0xe0, 0x47,
-  0x42, 0x28, 0xc8, 0x0a, 0xe4, 0x6f, 0x14, 0x50, 0xe3, 0x32, 0x15, 0x17,
-  0x35, 0x78, 0xd5, 0x5a, 0x63, 0x3f, 0xc9, 0x21, 0xa1, 0x02, 0x08, 0x67,
-  0xc0, 0x49, 0xe5, 0x2a, 0x66, 0x0f, 0xca, 0x71, 0x93, 0x52, 0x66, 0x37,
-  0x64, 0x18, 0xfb, 0x7a, 0xb1, 0x5f, 0x76, 0x40, 0x31, 0x25, 0xb5, 0x07,
-  0xa4, 0x68, 0x72, 0x4d, 0x64, 0x2e, 0xf4, 0x10, 0x9f, 0x75, 0x50, 0x56,
-  0x66, 0x3b, 0x65, 0x1c, 0xc7, 0x7e, 0x88, 0x63, 0xb7, 0x44, 0x49, 0x29,
-  0x30, 0x0a, 0x17, 0x6f, 0x38, 0x50, 0xda, 0x32, 0xf3, 0x17, 0x96, 0x78,
-  0xad, 0x5d, 0x43, 0x3e, 0x57, 0x23, 0x25, 0x04, 0x6d, 0x69, 0x0a, 0x4a,
-  0x05, 0x2f, 0x3f, 0x10, 0x64, 0x75, 0x2d, 0x56, 0x31, 0x3b, 0x21, 0x1c,
-  0x3c, 0x01, 0x7b, 0x62, 0x55, 0x47, 0x33, 0x28, 0x2b, 0x0d, 0x3f, 0x6e,
-  0x04, 0x53, 0x0d, 0x34, 0x11, 0x19, 0x76, 0x7a, 0x5f, 0x5f, 0x58, 0x40,
-  0xb0, 0x25, 0x95, 0x06, 0x94, 0x6b, 0xd0, 0x4c, 0x35, 0x30, 0x06, 0x15,
-  0x64, 0x76, 0x32, 0x5b, 0x90, 0x3c, 0x9f, 0x21, 0xdf, 0x02, 0x35, 0x66,
-  0x7d, 0x4b, 0x46, 0x2c, 0x91, 0x11, 0xe1, 0x72, 0x64, 0x56, 0x54, 0x3b,
-  0xa3, 0x1c, 0xf9, 0x01, 0x35, 0x65, 0x7b, 0x46, 0xb4, 0x2b, 0xe7, 0x0c,
-  0x10, 0x70, 0x65, 0x55, 0x95, 0x36, 0x85, 0x1b, 0x71, 0x7f, 0xa4, 0x60,
-  0xc3, 0x45, 0x19, 0x29, 0xe4, 0x0a, 0xd8, 0x6f, 0x7d, 0x53, 0x97, 0x34,
-  0x35, 0x18, 0x5b, 0x7d, 0xfb, 0x5e, 0x10, 0x42, 0xa1, 0x27, 0xc3, 0x08,
-  0x44, 0x6c, 0xa5, 0x51, 0x7b, 0x35, 0x83, 0x16, 0x50, 0x7a, 0xb9, 0x5f,
-  0x2c, 0x43, 0xb8, 0x24, 0x70, 0x08, 0xb6, 0x6d, 0x3b, 0x51, 0xa3, 0x32,
-  0x35, 0x16, 0xfd, 0x7b, 0x30, 0x5f, 0xa2, 0x40, 0x07, 0x24, 0x80, 0x09,
-  0x66, 0x6d, 0xf6, 0x4e, 0x10, 0x32, 0xc2, 0x17, 0xb2, 0x7b, 0x18, 0x5f,
-  0xe2, 0x40, 0x15, 0x24, 0x2d, 0x08, 0x9a, 0x6d, 0x65, 0x51, 0x93, 0x32,
-  0xe4, 0x16, 0x4d, 0x7a, 0xf9, 0x5f, 0xb1, 0x43, 0x34, 0x27, 0xd5, 0x08,
-  0x82, 0x6c, 0x62, 0x50, 0x20, 0x34, 0xe8, 0x19, 0xb3, 0x7d, 0x70, 0x61,
-  0x27, 0x45, 0xb5, 0x26, 0xb1, 0x0a, 0x3d, 0x6e, 0x37, 0x52, 0xe0, 0x37,
-  0x91, 0x1b, 0x49, 0x7f, 0x78, 0x63, 0x65, 0x47, 0xc7, 0x28, 0x8c, 0x0c,
-  0xb0, 0x70, 0x58, 0x54, 0x62, 0x38, 0x13, 0x1c, 0x35, 0x00, 0xd9, 0x65,
-  0xfc, 0x49, 0xdd, 0x2d, 0xac, 0x11, 0x48, 0x75, 0x42, 0x59, 0x60, 0x3d,
-  0x34, 0x21, 0x12, 0x05, 0x18, 0x69, 0x24, 0x4d, 0x27, 0x31, 0x35, 0x15,
-  0x70, 0x79, 0x36, 0x5d, 0x35, 0x41, 0x26, 0x25, 0x33, 0x09, 0x3c, 0x6d,
-  0x20, 0x51, 0x28, 0x35, 0x03, 0x19, 0x45, 0x7d, 0x71, 0x61, 0x7d, 0x45,
-  0x53, 0x29, 0x44, 0x0d, 0xb0, 0x71, 0x98, 0x55, 0xf4, 0x39, 0xd9, 0x1d,
-  0x2d, 0x00, 0x55, 0x64, 0x79, 0x48, 0x53, 0x2c, 0xb0, 0x10, 0x82, 0x74,
-  0x90, 0x58, 0x24, 0x3f, 0x34, 0x23, 0x55, 0x07, 0x9f, 0x6b, 0xe2, 0x4f,
-  0x28, 0x32, 0x33, 0x16, 0xd5, 0x7a, 0xfb, 0x5e, 0x3b, 0x45, 0x67, 0x29,
-  0xa4, 0x0d, 0xf5, 0x71, 0x41, 0x54, 0x7e, 0x38, 0x9f, 0x1c, 0xd0, 0x00,
-  0x60, 0x67, 0xad, 0x4b, 0xb4, 0x2f, 0x1a, 0x12, 0xa1, 0x76, 0xce, 0x5a,
-  0x64, 0x41, 0xfa, 0x25, 0x00, 0x08, 0x47, 0x6c, 0xff, 0x50, 0x0d, 0x37,
-  0xad, 0x1b, 0xce, 0x7f, 0x51, 0x62, 0xe9, 0x46, 0x34, 0x2d, 0xac, 0x11,
-  0x03, 0x74, 0xa1, 0x58, 0x25, 0x3f, 0xb3, 0x23, 0x34, 0x06, 0x33, 0x6a,
-  0x00, 0x51, 0xbd, 0x35, 0x35, 0x18, 0xfd, 0x7c, 0x21, 0x63, 0xa0, 0x47,
-  0x12, 0x2a, 0x84, 0x0e, 0x7a, 0x75, 0xee, 0x59, 0x5d, 0x3c, 0xc8, 0x20,
-  0xaa, 0x07, 0x09, 0x6a, 0xb0, 0x4e, 0x5a, 0x35, 0x32, 0x18, 0xd5, 0x7c,
-  0x64, 0x63, 0xd5, 0x47, 0xa1, 0x2a, 0x4d, 0x11, 0xd3, 0x75, 0xaa, 0x58,
-  0x62, 0x3f, 0xc0, 0x23, 0xd0, 0x06, 0x6e, 0x6d, 0x2b, 0x50, 0xf0, 0x34,
-  0xb5, 0x1b, 0x35, 0x7e, 0x20, 0x65, 0xfa, 0x49, 0xb5, 0x2c, 0x7a, 0x13,
-  0x2c, 0x76, 0xe8, 0x5a, 0x82, 0x41, 0x05, 0x24, 0x7c, 0x0b, 0x20, 0x6e,
-  0xc2, 0x52, 0x88, 0x39, 0xe4, 0x1c, 0x49, 0x03, 0x7f, 0x66, 0x55, 0x4d,
-  0x2d, 0x30, 0xda, 0x14, 0xe5, 0x7b, 0x8f, 0x5e, 0xe4, 0x45, 0x48, 0x28,
-  0x51, 0x0f, 0x76, 0x72, 0x60, 0x59, 0x45, 0x3c, 0x11, 0x23, 0x23, 0x06,
-  0x20, 0x6d, 0x7d, 0x50, 0x27, 0x37, 0x30, 0x1a, 0x27, 0x01, 0x21, 0x64,
-  0x7e, 0x4b, 0x7d, 0x2e, 0x64, 0x15, 0x0f, 0x78, 0x15, 0x5f, 0x11, 0x42,
-  0x63, 0x29, 0x60, 0x0c, 0x55, 0x73, 0x43, 0x56, 0xe4, 0x3d, 0x89, 0x20,
-  0xf8, 0x07, 0xd0, 0x6a, 0x27, 0x50, 0x10, 0x37, 0x30, 0x1a, 0x49, 0x01,
-  0xa5, 0x64, 0x81, 0x4b, 0xdc, 0x2e, 0x65, 0x14, 0x66, 0x7b, 0x4a, 0x5e,
-  0x93, 0x45, 0xe6, 0x28, 0x64, 0x0e, 0x7b, 0x75, 0xb1, 0x58, 0xf6, 0x3f,
-  0x31, 0x25, 0x66, 0x08, 0xfc, 0x6f, 0xbd, 0x52, 0x30, 0x38, 0x65, 0x1f,
-  0x95, 0x02, 0xd7, 0x69, 0x71, 0x4f, 0xe5, 0x32, 0xd9, 0x19, 0x1e, 0x7f,
-  0xe4, 0x62, 0xdc, 0x49, 0x30, 0x2f, 0x9b, 0x12, 0x35, 0x78, 0x47, 0x5f,
-  0xe2, 0x42, 0x12, 0x28, 0xb3, 0x0f, 0x81, 0x72, 0x10, 0x58, 0xea, 0x3f,
-  0x62, 0x25, 0x80, 0x08, 0x02, 0x6e, 0xaa, 0x55, 0x36, 0x3b, 0xb2, 0x1e,
-  0x27, 0x04, 0xbb, 0x6b, 0x74, 0x51, 0xa5, 0x34, 0x31, 0x1a, 0xa9, 0x01,
-  0x2c, 0x67, 0xed, 0x4a, 0x1c, 0x30, 0x80, 0x17, 0x75, 0x7d, 0xe1, 0x60,
-  0x59, 0x46, 0xc3, 0x2d, 0xa3, 0x13, 0x5d, 0x79, 0xfe, 0x5c, 0x5a, 0x42,
-  0x26, 0x28, 0x81, 0x0f, 0x78, 0x75, 0x93, 0x58, 0xe4, 0x3e, 0x4d, 0x24,
-  0xe9, 0x0b, 0xaa, 0x71, 0x61, 0x57, 0x85, 0x3a, 0x98, 0x20, 0x68, 0x06,
-  0x25, 0x6c, 0xef, 0x53, 0xf0, 0x39, 0x62, 0x1f, 0x35, 0x05, 0xe3, 0x68,
-  0xb5, 0x4e, 0x6e, 0x34, 0x64, 0x1a, 0xe1, 0x01, 0x91, 0x67, 0x55, 0x4d,
-  0x64, 0x33, 0x2c, 0x19, 0xde, 0x7c, 0x8a, 0x62, 0xe4, 0x48, 0x48, 0x2e,
-  0x60, 0x14, 0x55, 0x7a, 0x3b, 0x60, 0xdb, 0x47, 0xb0, 0x2d, 0x9c, 0x13,
-  0xe4, 0x79, 0x4f, 0x5f, 0x55, 0x45, 0x64, 0x2b, 0x77, 0x11, 0x0d, 0x77,
-  0x50, 0x5d, 0x39, 0x43, 0x2c, 0x29, 0x2f, 0x0f, 0x3f, 0x75, 0x20, 0x5b,
-  0x33, 0x41, 0x3d, 0x27, 0x70, 0x0d, 0x29, 0x73, 0x2c, 0x59, 0x28, 0x3f,
-  0x50, 0x25, 0x01, 0x0b, 0x71, 0x71, 0x6b, 0x57, 0x43, 0x3d, 0x48, 0x23,
-  0xe4, 0x09, 0x8b, 0x6f, 0xf5, 0x55, 0xd2, 0x3b, 0x31, 0x20, 0x01, 0x06,
-  0x71, 0x6c, 0x49, 0x52, 0xad, 0x38, 0x82, 0x1e, 0xde, 0x04, 0x65, 0x6d,
-  0x60, 0x53, 0x4a, 0x39, 0xd0, 0x1f, 0xf4, 0x05, 0x2b, 0x6a, 0x68, 0x50,
-  0xa2, 0x36, 0xb5, 0x1c, 0x27, 0x05, 0x7a, 0x6b, 0xa5, 0x51, 0xe9, 0x37,
-  0x2c, 0x1c, 0x23, 0x02, 0xf5, 0x68, 0xcb, 0x4e, 0x7b, 0x37, 0xb7, 0x1d,
-  0xc4, 0x03, 0x05, 0x68, 0xc1, 0x4e, 0xce, 0x34, 0x7f, 0x1d, 0x80, 0x03,
-  0x20, 0x68, 0x5d, 0x4e, 0x9f, 0x34, 0x29, 0x1d, 0xb6, 0x03, 0xc2, 0x69,
-  0x40, 0x4e, 0xec, 0x34, 0x77, 0x1d, 0x84, 0x03, 0x1c, 0x68, 0xed, 0x4e,
-  0x0d, 0x37, 0xae, 0x1d, 0x3c, 0x02, 0xb4, 0x68, 0x3a, 0x51, 0xb1, 0x37,
-  0x4d, 0x1d, 0x84, 0x02, 0x2b, 0x6b, 0xb8, 0x51, 0x50, 0x36, 0x84, 0x1c,
-  0x66, 0x05, 0xe0, 0x6b, 0x10, 0x50, 0xc2, 0x36, 0xaa, 0x1f, 0x5d, 0x04,
-  0xf1, 0x6a, 0x15, 0x53, 0x3a, 0x38, 0x94, 0x1e, 0x62, 0x07, 0xcf, 0x6d,
-  0xab, 0x52, 0x1a, 0x3b, 0x90, 0x21, 0xb5, 0x06, 0x75, 0x6f, 0xd1, 0x55,
-  0x98, 0x3a, 0x2d, 0x23, 0x26, 0x08, 0xf8, 0x6e, 0xa4, 0x57, 0x62, 0x3c,
-  0x31, 0x25, 0xf0, 0x0b, 0xbe, 0x70, 0x3d, 0x59, 0x30, 0x3e, 0xfa, 0x24,
-  0x9f, 0x0d, 0x05, 0x72, 0x67, 0x5b, 0x31, 0x40, 0xd5, 0x26, 0x88, 0x0f,
-  0xb4, 0x74, 0x1d, 0x5d, 0x62, 0x42, 0x1a, 0x2b, 0x37, 0x10, 0xde, 0x76,
-  0xb0, 0x5f, 0x9b, 0x44, 0xa5, 0x2d, 0x4e, 0x12, 0x55, 0x7b, 0x76, 0x60,
-  0x34, 0x49, 0x12, 0x2e, 0x18, 0x17, 0x24, 0x7c, 0x27, 0x65, 0x35, 0x4a,
-  0x70, 0x33, 0x39, 0x18, 0x3b, 0x01, 0x3a, 0x66, 0x3b, 0x4f, 0x7d, 0x34,
-  0x28, 0x1d, 0x24, 0x02, 0x1b, 0x6b, 0x00, 0x50, 0x34, 0x39, 0x71, 0x1e,
-  0x58, 0x07, 0x48, 0x6c, 0xbd, 0x55, 0xdd, 0x3a, 0xf8, 0x23, 0xd4, 0x08,
-  0x22, 0x70, 0x10, 0x59, 0x30, 0x3e, 0x5f, 0x27, 0xa1, 0x0c, 0x88, 0x75,
-  0xde, 0x5a, 0x65, 0x42, 0x7c, 0x2b, 0x40, 0x10, 0x82, 0x79, 0xe8, 0x5e,
-  0x64, 0x46, 0x7b, 0x2f, 0xbf, 0x14, 0xe7, 0x7d, 0x74, 0x65, 0x61, 0x4a,
-  0xb8, 0x33, 0xf2, 0x18, 0x31, 0x00, 0x7e, 0x69, 0x91, 0x4e, 0xcb, 0x37,
-  0x70, 0x1f, 0xb6, 0x04, 0x90, 0x6d, 0x02, 0x55, 0xa2, 0x3a, 0x9d, 0x23,
-  0x69, 0x0b, 0x90, 0x70, 0x35, 0x58, 0x47, 0x41, 0xe3, 0x26, 0x53, 0x0e,
-  0xe4, 0x77, 0x8d, 0x5c, 0x62, 0x44, 0xe4, 0x2d, 0x7d, 0x15, 0x8b, 0x7a,
-  0x50, 0x62, 0xb9, 0x4b, 0x36, 0x33, 0xb4, 0x18, 0x33, 0x00, 0xbe, 0x69,
-  0x38, 0x51, 0xb0, 0x36, 0x23, 0x1e, 0xfd, 0x07, 0x20, 0x6f, 0xa2, 0x54,
-  0x07, 0x3c, 0x8b, 0x25, 0x34, 0x0d, 0xf1, 0x72, 0x58, 0x5a, 0xdf, 0x43,
-  0xab, 0x2b, 0x08, 0x13, 0xf7, 0x78, 0x5d, 0x60, 0x74, 0x48, 0x81, 0x31,
-  0x78, 0x19, 0xd8, 0x7e, 0xe4, 0x66, 0x1b, 0x4e, 0xd5, 0x37, 0xa2, 0x1f,
-  0x71, 0x07, 0xd1, 0x6c, 0x91, 0x54, 0x79, 0x3c, 0x2d, 0x24, 0xf2, 0x0d,
-  0xbe, 0x75, 0x35, 0x5d, 0x35, 0x45, 0xfb, 0x2a, 0xb4, 0x12, 0x3d, 0x7a,
-  0x29, 0x62, 0xe2, 0x4b, 0x83, 0x33, 0x56, 0x1b, 0x38, 0x03, 0x65, 0x6b,
-  0xd1, 0x50, 0x83, 0x38, 0xa0, 0x20, 0x1d, 0x08, 0x64, 0x70, 0x1d, 0x58,
-  0x26, 0x40, 0xda, 0x29, 0xe5, 0x11, 0x9a, 0x79, 0xac, 0x61, 0x0d, 0x49,
-  0x44, 0x31, 0x6d, 0x19, 0x71, 0x01, 0x45, 0x69, 0x1c, 0x51, 0x28, 0x39,
-  0x25, 0x21, 0x2b, 0x09, 0x35, 0x71, 0x26, 0x59, 0x74, 0x41, 0x2c, 0x29,
-  0x3f, 0x11, 0x28, 0x79, 0x64, 0x61, 0x2e, 0x49, 0x11, 0x31, 0x0b, 0x19,
-  0x34, 0x01, 0x6a, 0x69, 0x53, 0x51, 0x4e, 0x39, 0xa5, 0x21, 0x8e, 0x09,
-  0xf9, 0x71, 0xda, 0x59, 0x3a, 0x40, 0x14, 0x28, 0x7c, 0x10, 0x51, 0x78,
-  0xbd, 0x60, 0xcd, 0x48, 0xc3, 0x30, 0x20, 0x1b, 0x71, 0x03, 0x05, 0x6b,
-  0x91, 0x53, 0xad, 0x3b, 0x37, 0x22, 0x71, 0x0a, 0xb9, 0x72, 0xe3, 0x5a,
-  0x31, 0x45, 0x67, 0x2d, 0xf0, 0x15, 0xf2, 0x7d, 0x22, 0x64, 0x2d, 0x4c,
-  0x9c, 0x34, 0xcc, 0x1c, 0x73, 0x07, 0xad, 0x6f, 0xc4, 0x57, 0x4d, 0x3e,
-  0xac, 0x26, 0xc8, 0x0e, 0x7e, 0x79, 0x91, 0x61, 0x26, 0x48, 0x50, 0x30,
-  0xf4, 0x18, 0x0e, 0x03, 0xe4, 0x6b, 0xc2, 0x53, 0x56, 0x3a, 0xa5, 0x22,
-  0x72, 0x0d, 0x80, 0x75, 0x15, 0x5c, 0xb9, 0x44, 0x64, 0x2f, 0xbc, 0x17,
-  0x32, 0x7e, 0xba, 0x66, 0x22, 0x51, 0xb0, 0x39, 0x70, 0x20, 0xa4, 0x08,
-  0x2b, 0x73, 0xb8, 0x5b, 0x50, 0x42, 0x92, 0x2a, 0x7c, 0x15, 0xe0, 0x7d,
-  0x42, 0x64, 0xc8, 0x4c, 0xe4, 0x37, 0x09, 0x1e, 0xf8, 0x06, 0x50, 0x71,
-  0x74, 0x58, 0x87, 0x40, 0x7f, 0x2b, 0xde, 0x13, 0xaf, 0x7a, 0x4d, 0x65,
-  0xc7, 0x4d, 0xa4, 0x34, 0x78, 0x1f, 0xc9, 0x07, 0x83, 0x6e, 0x2d, 0x59,
-  0x21, 0x40, 0xf3, 0x28, 0xb4, 0x13, 0x3b, 0x7a, 0x51, 0x65, 0xfb, 0x4d,
-  0xbf, 0x34, 0x6f, 0x1f, 0x30, 0x06, 0xe5, 0x6e, 0xf5, 0x59, 0x56, 0x40,
-  0x7b, 0x2b, 0x30, 0x12, 0xc4, 0x7a, 0x85, 0x65, 0xcb, 0x4c, 0x69, 0x37,
-  0x62, 0x1e, 0x1a, 0x09, 0x24, 0x70, 0xdc, 0x58, 0xf3, 0x43, 0x9c, 0x2a,
-  0xa8, 0x15, 0x0d, 0x7c, 0x79, 0x67, 0x76, 0x4e, 0x78, 0x39, 0x04, 0x20,
-  0x1e, 0x0b, 0x29, 0x72, 0xb1, 0x5d, 0x09, 0x44, 0x38, 0x2f, 0x30, 0x16,
-  0x74, 0x01, 0x3b, 0x68, 0x31, 0x53, 0x2f, 0x3a, 0x36, 0x25, 0x22, 0x0c,
-  0x07, 0x77, 0x45, 0x5e, 0x64, 0x49, 0x64, 0x30, 0x44, 0x1b, 0x45, 0x02,
-  0xe4, 0x6d, 0x8e, 0x54, 0xfc, 0x3f, 0xda, 0x26, 0x24, 0x10, 0x10, 0x7b,
-  0x63, 0x62, 0x1d, 0x4d, 0xa0, 0x34, 0x82, 0x1f, 0xc7, 0x06, 0x2b, 0x70,
-  0x63, 0x5b, 0x44, 0x42, 0x82, 0x2d, 0xe9, 0x14, 0x64, 0x7e, 0x69, 0x69,
-  0xbf, 0x50, 0xb5, 0x3b, 0x20, 0x25, 0x7d, 0x0c, 0xb5, 0x77, 0xbd, 0x5e,
-  0x2a, 0x48, 0x62, 0x33, 0x82, 0x1a, 0xd1, 0x05, 0x7c, 0x6f, 0xe5, 0x56,
-  0xd1, 0x41, 0x03, 0x2b, 0xa0, 0x12, 0x9d, 0x7d, 0x7c, 0x67, 0x90, 0x4e,
-  0x35, 0x38, 0x51, 0x23, 0xe3, 0x0a, 0x5d, 0x74, 0xb0, 0x5f, 0xc2, 0x46,
-  0x10, 0x30, 0xf1, 0x1b, 0x7c, 0x05, 0x80, 0x6c, 0x50, 0x56, 0xa0, 0x41,
-  0x2b, 0x2b, 0xa8, 0x12, 0x24, 0x7c, 0xbd, 0x67, 0x74, 0x51, 0xba, 0x38,
-  0x36, 0x22, 0xfd, 0x0d, 0x25, 0x77, 0xed, 0x5e, 0x03, 0x48, 0x88, 0x33,
-  0x75, 0x1d, 0xe9, 0x04, 0x5c, 0x6e, 0x8d, 0x59, 0xa7, 0x43, 0x1c, 0x2d,
-  0xe6, 0x14, 0x50, 0x7e, 0x7a, 0x68, 0xd5, 0x53, 0x30, 0x3d, 0xfc, 0x24,
-  0xe4, 0x0e, 0x1e, 0x78, 0xd9, 0x63, 0xa2, 0x4d, 0x7a, 0x37, 0x85, 0x1e,
-  0x9e, 0x08, 0x68, 0x72, 0x25, 0x5c, 0xef, 0x47, 0xb2, 0x31, 0x6c, 0x1b,
-  0x74, 0x05, 0xe7, 0x6c, 0xb5, 0x56, 0x7c, 0x40, 0x20, 0x2a, 0xfe, 0x15,
-  0xd0, 0x7f, 0x07, 0x69, 0x40, 0x53, 0x37, 0x3d, 0xd5, 0x24, 0x8c, 0x0e,
-  0xb7, 0x78, 0x48, 0x62, 0x62, 0x4c, 0x10, 0x36, 0x74, 0x20, 0xe3, 0x0b,
-  0xf1, 0x75, 0x88, 0x5f, 0xa8, 0x49, 0x59, 0x33, 0x10, 0x1d, 0x44, 0x07,
-  0x77, 0x71, 0x06, 0x5b, 0x15, 0x45, 0x3e, 0x2f, 0x37, 0x19, 0x7f, 0x03,
-  0x7c, 0x6d, 0x75, 0x57, 0x36, 0x41, 0x20, 0x2b, 0x24, 0x15, 0x7d, 0x7f,
-  0x20, 0x69, 0x24, 0x53, 0x16, 0x3d, 0x03, 0x27, 0x71, 0x11, 0x77, 0x7b,
-  0x55, 0x65, 0x43, 0x4f, 0xb0, 0x39, 0xdd, 0x23, 0xf8, 0x0d, 0xd4, 0x77,
-  0x3a, 0x60, 0x11, 0x4a, 0x67, 0x34, 0x4f, 0x1e, 0xad, 0x08, 0x99, 0x72,
-  0xd9, 0x5c, 0x2b, 0x49, 0x73, 0x33, 0x05, 0x1d, 0x98, 0x07, 0xec, 0x71,
-  0x37, 0x5a, 0x3d, 0x44, 0xb3, 0x2e, 0xe7, 0x18, 0x3b, 0x05, 0x66, 0x6f,
-  0xa3, 0x59, 0xf8, 0x43, 0x20, 0x2c, 0x2d, 0x16, 0x84, 0x00, 0xcd, 0x6a,
-  0x7d, 0x57, 0xb6, 0x41, 0x90, 0x2b, 0x02, 0x14, 0xb1, 0x7e, 0xc9, 0x68,
-  0x30, 0x55, 0x94, 0x3f, 0x3a, 0x28, 0x51, 0x12, 0xb0, 0x7c, 0x0a, 0x69,
-  0xb6, 0x53, 0xc4, 0x3d, 0x44, 0x26, 0xf1, 0x10, 0x71, 0x7d, 0x8b, 0x67,
-  0x50, 0x50, 0xef, 0x3a, 0x08, 0x27, 0xbc, 0x11, 0x39, 0x7a, 0xa7, 0x64,
-  0x74, 0x51, 0xba, 0x3b, 0x36, 0x24, 0xfd, 0x0e, 0x0c, 0x7b, 0xa2, 0x65,
-  0x02, 0x4e, 0x97, 0x38, 0x7d, 0x25, 0xe7, 0x0f, 0x5c, 0x78, 0xc8, 0x62,
-  0xe4, 0x4f, 0x30, 0x38, 0xff, 0x22, 0x5b, 0x0f, 0x27, 0x78, 0x81, 0x62,
-  0x75, 0x4f, 0xcf, 0x39, 0xe5, 0x22, 0x4d, 0x0f, 0x90, 0x79, 0x84, 0x62,
-  0x78, 0x4f, 0xc9, 0x39, 0xd0, 0x22, 0x63, 0x0f, 0x2b, 0x78, 0xf3, 0x62,
-  0xfd, 0x4f, 0x65, 0x38, 0x3d, 0x25, 0xe7, 0x0f, 0xb1, 0x78, 0x69, 0x65,
-  0x21, 0x4e, 0xfe, 0x38, 0xd0, 0x25, 0x4e, 0x0e, 0x71, 0x7b, 0x20, 0x64,
-  0xc0, 0x4e, 0xcd, 0x3b, 0xab, 0x24, 0x48, 0x11, 0x64, 0x7a, 0x54, 0x67,
-  0x76, 0x50, 0x9b, 0x3a, 0x95, 0x27, 0x93, 0x10, 0xab, 0x7d, 0x5f, 0x66,
-  0x44, 0x53, 0x6d, 0x3c, 0x11, 0x29, 0x16, 0x12, 0x1f, 0x7f, 0x38, 0x68,
-  0x30, 0x55, 0x35, 0x3e, 0x5d, 0x2b, 0x01, 0x14, 0x26, 0x01, 0x3a, 0x6a,
-  0x20, 0x57, 0x34, 0x40, 0x27, 0x2d, 0x2c, 0x16, 0x1c, 0x03, 0x45, 0x6c,
-  0x57, 0x59, 0x64, 0x42, 0x46, 0x2f, 0x48, 0x18, 0x18, 0x05, 0xa4, 0x6e,
-  0xff, 0x5b, 0xc0, 0x44, 0x74, 0x30, 0x06, 0x1d, 0x64, 0x06, 0x5c, 0x73,
-  0xaa, 0x5c, 0x89, 0x49, 0x90, 0x32, 0x24, 0x1e, 0x60, 0x0b, 0x05, 0x74,
-  0x84, 0x61, 0xe5, 0x4a, 0x21, 0x36, 0x3d, 0x23, 0xb5, 0x0c, 0xfb, 0x79,
-  0x20, 0x65, 0x67, 0x4e, 0xb1, 0x3b, 0xf3, 0x24, 0x27, 0x10, 0x68, 0x7d,
-  0xd0, 0x66, 0xd1, 0x53, 0x7b, 0x3f, 0xe5, 0x28, 0xd1, 0x15, 0x4d, 0x01,
-  0xaa, 0x6a, 0xdc, 0x57, 0x64, 0x43, 0x80, 0x2c, 0x26, 0x18, 0x54, 0x05,
-  0xfc, 0x6e, 0x5d, 0x5a, 0xa7, 0x47, 0xcc, 0x30, 0x46, 0x1c, 0xe0, 0x09,
-  0x34, 0x75, 0x92, 0x5e, 0x18, 0x4a, 0xa4, 0x37, 0x27, 0x23, 0xb5, 0x0c,
-  0x70, 0x78, 0xb9, 0x65, 0x3b, 0x51, 0xba, 0x3a, 0x3b, 0x26, 0xae, 0x13,
-  0x64, 0x7f, 0xa1, 0x68, 0x19, 0x54, 0x8e, 0x41, 0x71, 0x2d, 0xa5, 0x16,
-  0x59, 0x02, 0xd9, 0x6f, 0xe4, 0x5b, 0x15, 0x47, 0xf1, 0x30, 0x46, 0x1c,
-  0x3a, 0x08, 0xd2, 0x75, 0x64, 0x61, 0x9d, 0x4a, 0xa6, 0x36, 0x08, 0x22,
-  0xd5, 0x0f, 0xab, 0x7b, 0x34, 0x67, 0xd3, 0x50, 0x99, 0x3c, 0x7e, 0x28,
-  0x2d, 0x14, 0xe9, 0x01, 0xb5, 0x6d, 0x71, 0x59, 0x74, 0x45, 0xfc, 0x2e,
-  0xbe, 0x1a, 0x3d, 0x06, 0x35, 0x72, 0xf8, 0x5f, 0x99, 0x4b, 0x51, 0x37,
-  0x71, 0x23, 0x65, 0x0f, 0xc3, 0x78, 0x82, 0x64, 0xa9, 0x50, 0x58, 0x3c,
-  0x30, 0x28, 0x01, 0x14, 0x3d, 0x00, 0xd8, 0x6d, 0xf5, 0x59, 0xd3, 0x45,
-  0xe4, 0x31, 0x0d, 0x1d, 0x7c, 0x09, 0x6c, 0x75, 0x73, 0x61, 0x0d, 0x4d,
-  0x04, 0x39, 0x6d, 0x25, 0x34, 0x11, 0x32, 0x7d, 0x25, 0x69, 0x27, 0x55,
-  0x27, 0x41, 0x75, 0x2d, 0x39, 0x19, 0x33, 0x05, 0x64, 0x71, 0x39, 0x5d,
-  0x18, 0x49, 0x17, 0x35, 0x7b, 0x21, 0x70, 0x0d, 0x57, 0x79, 0x45, 0x65,
-  0xe4, 0x51, 0x89, 0x3d, 0xf8, 0x29, 0xd0, 0x15, 0x74, 0x00, 0x1a, 0x6c,
-  0x60, 0x58, 0x58, 0x44, 0xaa, 0x30, 0x84, 0x1c, 0xde, 0x08, 0x22, 0x77,
-  0x34, 0x63, 0x51, 0x4f, 0x9f, 0x3b, 0xad, 0x27, 0x30, 0x12, 0x75, 0x7e,
-  0xb5, 0x6a, 0xb5, 0x56, 0x27, 0x45, 0x7a, 0x31, 0xa5, 0x1d, 0xe9, 0x09,
-  0x2c, 0x74, 0x21, 0x60, 0xd0, 0x4c, 0xd2, 0x38, 0x7c, 0x27, 0xac, 0x13,
-  0xdc, 0x7f, 0x08, 0x6a, 0xe4, 0x56, 0xdb, 0x42, 0x79, 0x31, 0x87, 0x1d,
-  0x31, 0x08, 0x53, 0x74, 0xfc, 0x60, 0x14, 0x4f, 0xa1, 0x3b, 0xde, 0x27,
-  0x10, 0x12, 0xe9, 0x7e, 0x7d, 0x6d, 0x82, 0x59, 0x18, 0x44, 0xb9, 0x30,
-  0x64, 0x1f, 0xa9, 0x0b, 0x38, 0x76, 0xb0, 0x62, 0x74, 0x51, 0xa5, 0x3d,
-  0x31, 0x28, 0xa9, 0x14, 0x2c, 0x03, 0xed, 0x6f, 0x16, 0x5a, 0x90, 0x46,
-  0x66, 0x35, 0xf1, 0x21, 0x58, 0x0c, 0xc8, 0x78, 0xb6, 0x67, 0x5d, 0x52,
-  0xf9, 0x3e, 0x5b, 0x2d, 0x20, 0x18, 0x9a, 0x04, 0x30, 0x73, 0xc9, 0x5f,
-  0xac, 0x4a, 0x08, 0x39, 0x90, 0x25, 0xa6, 0x10, 0x75, 0x7f, 0xd3, 0x6b,
-  0x95, 0x56, 0x2d, 0x45, 0x30, 0x30, 0xf2, 0x1c, 0xf0, 0x0b, 0x61, 0x76,
-  0x3c, 0x65, 0xf0, 0x51, 0xf0, 0x3c, 0x73, 0x2b, 0x2b, 0x16, 0xff, 0x02,
-  0x84, 0x71, 0x4d, 0x5c, 0x3a, 0x4b, 0x40, 0x36, 0xde, 0x22, 0x82, 0x11,
-  0xb6, 0x7c, 0x49, 0x6b, 0x78, 0x56, 0x70, 0x45, 0x27, 0x30, 0xda, 0x1c,
-  0xe5, 0x0b, 0x89, 0x76, 0xac, 0x65, 0x20, 0x50, 0x64, 0x3f, 0x77, 0x2a,
-  0x7b, 0x19, 0x15, 0x04, 0x19, 0x73, 0x2e, 0x5e, 0x25, 0x4d, 0x31, 0x38,
-  0x70, 0x27, 0x16, 0x12, 0x35, 0x01, 0x23, 0x6c, 0x35, 0x5b, 0x27, 0x46,
-  0x02, 0x35, 0x24, 0x20, 0x02, 0x0f, 0x00, 0x7a, 0x72, 0x69, 0x69, 0x54,
-  0x59, 0x43, 0x48, 0x2e, 0xb7, 0x1d, 0xdd, 0x08, 0xe3, 0x77, 0xd9, 0x62,
-  0x3b, 0x50, 0x02, 0x3f, 0x7c, 0x2a, 0x44, 0x19, 0xe4, 0x04, 0x89, 0x73,
-  0xc2, 0x5e, 0x2c, 0x4c, 0x72, 0x3b, 0x51, 0x26, 0xd0, 0x15, 0xec, 0x00,
-  0x36, 0x6e, 0x72, 0x5d, 0xa5, 0x48, 0xfb, 0x37, 0x30, 0x25, 0x35, 0x10,
-  0xa9, 0x7f, 0xf2, 0x6a, 0x31, 0x58, 0x2d, 0x47, 0x91, 0x32, 0xcb, 0x21,
-  0x70, 0x0f, 0xe5, 0x7a, 0xdc, 0x69, 0x04, 0x57, 0xa3, 0x42, 0xd5, 0x31,
-  0x64, 0x1f, 0xd5, 0x0a, 0x20, 0x78, 0x5d, 0x67, 0xf5, 0x52, 0x5d, 0x40,
-  0xb0, 0x2f, 0xd8, 0x1a, 0x5e, 0x08, 0xeb, 0x77, 0x71, 0x65, 0x89, 0x50,
-  0x5c, 0x3e, 0xed, 0x2d, 0x33, 0x1b, 0xb5, 0x06, 0x39, 0x74, 0xb6, 0x63,
-  0x3c, 0x51, 0xf5, 0x3c, 0x23, 0x2a, 0xb8, 0x19, 0x21, 0x07, 0xa0, 0x72,
-  0x03, 0x60, 0xc5, 0x4f, 0x60, 0x3d, 0xea, 0x28, 0x10, 0x16, 0xca, 0x05,
-  0xa1, 0x73, 0x09, 0x61, 0xb0, 0x4c, 0x57, 0x3a, 0x26, 0x28, 0x9c, 0x17,
-  0x77, 0x05, 0xd5, 0x70, 0xb0, 0x5e, 0x08, 0x4c, 0xc2, 0x3b, 0xe5, 0x29,
-  0x60, 0x17, 0xca, 0x02, 0xd0, 0x70, 0x79, 0x5e, 0x2c, 0x4c, 0xf8, 0x3b,
-  0xf0, 0x29, 0x66, 0x17, 0x3b, 0x05, 0xe0, 0x70, 0xa4, 0x5e, 0x75, 0x4c,
-  0x68, 0x3a, 0xad, 0x29, 0x92, 0x17, 0x50, 0x05, 0x60, 0x73, 0x65, 0x61,
-  0xd4, 0x4c, 0x84, 0x3a, 0xa9, 0x28, 0x50, 0x16, 0x75, 0x04, 0x07, 0x72,
-  0x74, 0x60, 0xc1, 0x4f, 0xff, 0x3d, 0xdd, 0x2b, 0xb0, 0x19, 0x45, 0x07,
-  0x55, 0x75, 0x25, 0x63, 0x7a, 0x51, 0x0a, 0x3f, 0x02, 0x2d, 0x39, 0x1b,
-  0x2c, 0x09, 0x73, 0x77, 0x55, 0x65, 0x3b, 0x53, 0x3b, 0x41, 0x27, 0x2f,
-  0x24, 0x1d, 0x35, 0x0b, 0x41, 0x79, 0x3e, 0x67, 0x1f, 0x55, 0x10, 0x43,
-  0x60, 0x31, 0x6d, 0x1f, 0x3d, 0x0d, 0x79, 0x7b, 0xb6, 0x69, 0x92, 0x57,
-  0xe0, 0x45, 0xdc, 0x33, 0x37, 0x20, 0x14, 0x0e, 0x7c, 0x7c, 0x1d, 0x6a,
-  0x87, 0x58, 0x8c, 0x46, 0xc6, 0x34, 0x20, 0x25, 0x56, 0x12, 0x71, 0x01,
-  0x98, 0x6f, 0xe8, 0x5d, 0x64, 0x4a, 0x7e, 0x38, 0xb1, 0x26, 0xe3, 0x14,
-  0x31, 0x05, 0x35, 0x73, 0xb9, 0x61, 0xee, 0x4f, 0x64, 0x3c, 0x6c, 0x2a,
-  0xd0, 0x18, 0xc9, 0x06, 0x7d, 0x77, 0xb1, 0x65, 0xc4, 0x53, 0x01, 0x40,
-  0xa1, 0x2e, 0x9d, 0x1c, 0x67, 0x0d, 0x9c, 0x7b, 0x30, 0x68, 0x50, 0x56,
-  0xe2, 0x44, 0x5d, 0x35, 0xac, 0x23, 0xc8, 0x11, 0x42, 0x7e, 0xe0, 0x6c,
-  0x3a, 0x5d, 0xc5, 0x4b, 0x50, 0x38, 0x94, 0x26, 0x2b, 0x17, 0xa8, 0x05,
-  0x70, 0x72, 0xb3, 0x60, 0x3d, 0x51, 0xbb, 0x3f, 0x34, 0x2c, 0xfd, 0x1a,
-  0x30, 0x0b, 0xa5, 0x79, 0x15, 0x66, 0xc5, 0x54, 0x77, 0x45, 0xea, 0x33,
-  0x52, 0x20, 0xda, 0x0e, 0xa1, 0x7f, 0x1f, 0x6c, 0xbd, 0x5a, 0x50, 0x4b,
-  0x3a, 0x38, 0x96, 0x26, 0x62, 0x17, 0xc8, 0x05, 0xb7, 0x72, 0x19, 0x63,
-  0xd5, 0x51, 0xa1, 0x3e, 0x34, 0x2f, 0xd7, 0x1d, 0x95, 0x0a, 0x60, 0x7b,
-  0x25, 0x68, 0xf4, 0x56, 0xbe, 0x47, 0x66, 0x34, 0x74, 0x25, 0xfa, 0x13,
-  0xb6, 0x00, 0x3d, 0x71, 0x25, 0x5e, 0xad, 0x4c, 0x83, 0x3d, 0x48, 0x2a,
-  0x75, 0x1b, 0x29, 0x08, 0xdc, 0x76, 0xcd, 0x67, 0xa7, 0x54, 0x5c, 0x45,
-  0x7d, 0x32, 0x05, 0x23, 0x78, 0x10, 0x95, 0x7e, 0xf1, 0x6f, 0x93, 0x5c,
-  0xa0, 0x4d, 0x0d, 0x3a, 0x51, 0x2b, 0x69, 0x18, 0x60, 0x09, 0x0d, 0x76,
-  0x1f, 0x67, 0x38, 0x54, 0x23, 0x45, 0x35, 0x32, 0x70, 0x23, 0x2c, 0x10,
-  0x3b, 0x01, 0x20, 0x6e, 0x70, 0x5f, 0x39, 0x4c, 0x2b, 0x3d, 0x23, 0x2a,
-  0x57, 0x1b, 0x11, 0x08, 0x34, 0x79, 0x76, 0x66, 0x45, 0x57, 0x5e, 0x44,
-  0xb4, 0x35, 0x98, 0x22, 0xf3, 0x13, 0xc1, 0x00, 0x74, 0x70, 0x01, 0x61,
-  0x78, 0x4e, 0x58, 0x3f, 0xe4, 0x2c, 0x8f, 0x1d, 0xc2, 0x0a, 0x2a, 0x7a,
-  0x7f, 0x6b, 0x40, 0x58, 0x9e, 0x49, 0xad, 0x36, 0x34, 0x26, 0x74, 0x17,
-  0xb5, 0x04, 0xf6, 0x75, 0x31, 0x65, 0x66, 0x52, 0xf0, 0x43, 0xf2, 0x30,
-  0x22, 0x20, 0x2d, 0x11, 0x84, 0x7e, 0xc4, 0x6f, 0x76, 0x5f, 0xa9, 0x4c,
-  0xd5, 0x3d, 0x1e, 0x2d, 0xe4, 0x1a, 0xdc, 0x0b, 0x7e, 0x7b, 0x91, 0x68,
-  0x74, 0x58, 0x56, 0x49, 0xf8, 0x36, 0x1c, 0x26, 0xad, 0x17, 0xdf, 0x04,
-  0x43, 0x74, 0xa5, 0x65, 0x63, 0x55, 0x8c, 0x42, 0x1c, 0x32, 0xa1, 0x23,
-  0x64, 0x13, 0xad, 0x00, 0x22, 0x70, 0xba, 0x61, 0x22, 0x51, 0xb0, 0x3e,
-  0x70, 0x2e, 0xa8, 0x1f, 0x37, 0x0f, 0xa8, 0x7c, 0x16, 0x6c, 0x90, 0x5d,
-  0x78, 0x4d, 0xa5, 0x3a, 0x44, 0x2a, 0xc2, 0x1b, 0xe4, 0x0b, 0x04, 0x7b,
-  0xff, 0x68, 0x40, 0x58, 0x26, 0x48, 0xd5, 0x39, 0x61, 0x29, 0xc8, 0x16,
-  0xa1, 0x06, 0x1e, 0x76, 0xc4, 0x67, 0xe9, 0x57, 0x34, 0x47, 0xd1, 0x34,
-  0x98, 0x24, 0x68, 0x14, 0x64, 0x04, 0xfb, 0x75, 0xb9, 0x65, 0x67, 0x55,
-  0x31, 0x45, 0xf3, 0x32, 0xbc, 0x22, 0x74, 0x12, 0x21, 0x02, 0xfe, 0x73,
-  0xd0, 0x63, 0x56, 0x53, 0x71, 0x43, 0x20, 0x33, 0xdd, 0x20, 0xcd, 0x10,
-  0xb0, 0x00, 0x52, 0x70, 0x30, 0x60, 0x19, 0x50, 0x3d, 0x40, 0xde, 0x31,
-  0xf5, 0x21, 0xdd, 0x11, 0xb1, 0x01, 0x5e, 0x71, 0x59, 0x61, 0x6b, 0x51,
-  0x73, 0x41, 0x45, 0x31, 0x04, 0x21, 0x25, 0x11, 0x21, 0x01, 0x7d, 0x71,
-  0x34, 0x61, 0x30, 0x51, 0x36, 0x41, 0x27, 0x31, 0x39, 0x21, 0x2e, 0x11,
-  0x64, 0x01, 0x2c, 0x71, 0x03, 0x61, 0x45, 0x51, 0x75, 0x41, 0x25, 0x31,
-  0x43, 0x21, 0x45, 0x11, 0xa1, 0x01, 0x91, 0x71, 0xe4, 0x61, 0xd0, 0x51,
-  0x26, 0x40, 0x5b, 0x30, 0x30, 0x20, 0x1d, 0x10, 0x85, 0x00, 0xcd, 0x70,
-  0xc0, 0x60, 0x24, 0x53, 0x67, 0x43, 0x56, 0x33, 0x91, 0x23, 0xea, 0x13,
-  0x21, 0x02, 0x6a, 0x72, 0xb1, 0x62, 0xec, 0x52, 0x74, 0x45, 0x79, 0x35,
-  0xb5, 0x25, 0xfc, 0x15, 0x20, 0x04, 0x7e, 0x74, 0xd0, 0x64, 0xcb, 0x54,
-  0x7b, 0x47, 0xb7, 0x37, 0xc4, 0x27, 0x05, 0x16, 0xe4, 0x06, 0xdc, 0x76,
-  0x7e, 0x69, 0x91, 0x59, 0x74, 0x48, 0x46, 0x38, 0xff, 0x28, 0x08, 0x1b,
-  0xb0, 0x0b, 0xc5, 0x7b, 0x1c, 0x6a, 0xa5, 0x5a, 0x75, 0x4d, 0x8b, 0x3d,
-  0x14, 0x2c, 0xed, 0x1c, 0x30, 0x0f, 0xb5, 0x7f, 0x35, 0x6e, 0xa7, 0x5e,
-  0x31, 0x51, 0xf5, 0x41, 0x39, 0x30, 0xae, 0x20, 0x64, 0x13, 0xac, 0x03,
-  0x1e, 0x72, 0xc5, 0x62, 0x75, 0x55, 0xe9, 0x45, 0x53, 0x34, 0xc2, 0x24,
-  0xb2, 0x17, 0x18, 0x06, 0xb0, 0x76, 0x41, 0x69, 0x3b, 0x58, 0xd5, 0x48,
-  0x64, 0x3b, 0xd5, 0x2b, 0xa1, 0x1a, 0x4d, 0x0d, 0xd5, 0x7d, 0xa4, 0x6c,
-  0x67, 0x5f, 0xd1, 0x4f, 0xde, 0x3e, 0x08, 0x31, 0x2a, 0x20, 0xf2, 0x10,
-  0xa2, 0x03, 0x61, 0x72, 0x3c, 0x65, 0x90, 0x55, 0xa3, 0x44, 0x72, 0x37,
-  0x31, 0x26, 0xf9, 0x16, 0x98, 0x09, 0x21, 0x78, 0x71, 0x6b, 0x24, 0x5a,
-  0xc3, 0x4a, 0x99, 0x3d, 0xd0, 0x2c, 0x69, 0x1f, 0x62, 0x0e, 0x1a, 0x01,
-  0x24, 0x70, 0xdc, 0x60, 0xf3, 0x53, 0x9c, 0x42, 0xa8, 0x35, 0x0d, 0x24,
-  0x73, 0x17, 0x64, 0x06, 0x62, 0x79, 0x00, 0x68, 0x50, 0x5b, 0x0c, 0x4a,
-  0x28, 0x3d, 0x3e, 0x2c, 0x3f, 0x1f, 0x23, 0x0e, 0x31, 0x01, 0xf6, 0x70,
-  0x11, 0x63, 0x29, 0x52, 0x64, 0x45, 0x39, 0x34, 0x18, 0x27, 0x00, 0x16,
-  0x34, 0x09, 0x67, 0x78, 0x51, 0x6b, 0x4e, 0x5a, 0xaf, 0x4d, 0xdd, 0x3c,
-  0xff, 0x2f, 0xd3, 0x1e, 0x74, 0x10, 0x01, 0x03, 0x78, 0x72, 0x54, 0x65,
-  0xb7, 0x54, 0xcd, 0x47, 0xd1, 0x36, 0x29, 0x28, 0x77, 0x1b, 0x4a, 0x0a,
-  0x86, 0x7d, 0xe8, 0x6c, 0x68, 0x5e, 0x3d, 0x51, 0xa4, 0x40, 0xfd, 0x33,
-  0x31, 0x25, 0x67, 0x14, 0xb5, 0x07, 0xbd, 0x76, 0x2d, 0x68, 0x7e, 0x5b,
-  0xd0, 0x4a, 0xc4, 0x3d, 0x34, 0x2f, 0xb6, 0x1e, 0xdd, 0x11, 0x0c, 0x03,
-  0xa8, 0x72, 0xd1, 0x65, 0x30, 0x57, 0x81, 0x46, 0x35, 0x38, 0x57, 0x2b,
-  0xfc, 0x1a, 0x18, 0x0c, 0xe8, 0x7f, 0x8d, 0x6e, 0x51, 0x60, 0xa5, 0x53,
-  0x77, 0x45, 0x8d, 0x34, 0x11, 0x26, 0xa4, 0x19, 0x36, 0x0b, 0xf1, 0x7a,
-  0x70, 0x6c, 0xb4, 0x5f, 0x3a, 0x51, 0xb1, 0x40, 0x70, 0x32, 0xbc, 0x25,
-  0x64, 0x17, 0xaf, 0x06, 0x02, 0x78, 0x8a, 0x6b, 0x7f, 0x5d, 0xe0, 0x4c,
-  0x5e, 0x3e, 0x8d, 0x31, 0xa8, 0x23, 0x1c, 0x15, 0xfe, 0x04, 0x41, 0x76,
-  0x31, 0x68, 0x87, 0x5b, 0x7e, 0x4d, 0x93, 0x3c, 0xe4, 0x2e, 0x4d, 0x20,
-  0xf9, 0x13, 0xb1, 0x05, 0x34, 0x77, 0xc9, 0x66, 0x9f, 0x58, 0x62, 0x4a,
-  0x2f, 0x3c, 0xee, 0x2f, 0xf0, 0x21, 0x79, 0x13, 0x3d, 0x05, 0xfe, 0x74,
-  0xb5, 0x66, 0x3d, 0x58, 0x30, 0x4a, 0xe5, 0x3d, 0x99, 0x2f, 0x56, 0x21,
-  0x34, 0x13, 0x36, 0x05, 0xc0, 0x74, 0x8c, 0x66, 0xa7, 0x58, 0x58, 0x4a,
-  0x30, 0x3c, 0x02, 0x2e, 0x35, 0x20, 0xc6, 0x13, 0xb0, 0x05, 0x88, 0x77,
-  0xb7, 0x69, 0x48, 0x5b, 0x54, 0x4d, 0x25, 0x3f, 0x79, 0x31, 0x10, 0x23,
-  0x13, 0x15, 0x25, 0x07, 0x64, 0x79, 0x30, 0x6b, 0x3f, 0x5d, 0x27, 0x4f,
-  0x31, 0x41, 0x75, 0x33, 0x22, 0x25, 0x38, 0x17, 0x27, 0x09, 0x28, 0x7b,
-  0x1e, 0x6d, 0x11, 0x5f, 0x78, 0x51, 0x7c, 0x43, 0x10, 0x35, 0x59, 0x27,
-  0xac, 0x19, 0x9c, 0x0b, 0xfe, 0x7d, 0x95, 0x6f, 0x20, 0x60, 0x1d, 0x52,
-  0x75, 0x44, 0x1d, 0x36, 0xa7, 0x28, 0x8c, 0x1a, 0xdd, 0x0c, 0x35, 0x01,
-  0x34, 0x73, 0x51, 0x65, 0x9f, 0x57, 0xad, 0x49, 0x30, 0x3a, 0x75, 0x2c,
-  0xb5, 0x1e, 0xb5, 0x10, 0x23, 0x05, 0x70, 0x77, 0xa3, 0x69, 0xe9, 0x5b,
-  0x6a, 0x4c, 0x09, 0x3e, 0x87, 0x30, 0xc0, 0x22, 0x67, 0x17, 0xb1, 0x09,
-  0xbd, 0x7b, 0x39, 0x6c, 0xb6, 0x5e, 0xd2, 0x50, 0x60, 0x45, 0x9c, 0x37,
-  0x37, 0x28, 0x54, 0x1a, 0xfc, 0x0c, 0x5d, 0x01, 0x87, 0x73, 0xcc, 0x65,
-  0x46, 0x56, 0xe0, 0x48, 0x7c, 0x3d, 0xb1, 0x2f, 0x18, 0x20, 0xa4, 0x12,
-  0x37, 0x07, 0xfd, 0x79, 0x24, 0x6a, 0xa0, 0x5c, 0x3a, 0x51, 0xbb, 0x43,
-  0x35, 0x34, 0xb1, 0x26, 0x64, 0x1b, 0xbe, 0x0d, 0x1c, 0x7e, 0x8a, 0x70,
-  0x64, 0x65, 0xe0, 0x57, 0x43, 0x48, 0x8d, 0x3a, 0xa0, 0x2f, 0x18, 0x20,
-  0xf5, 0x12, 0x45, 0x07, 0x31, 0x78, 0x87, 0x6a, 0x30, 0x5f, 0xc8, 0x51,
-  0xaa, 0x42, 0x09, 0x37, 0xd5, 0x29, 0xb7, 0x1a, 0x73, 0x0f, 0xd7, 0x01,
-  0x9f, 0x72, 0x78, 0x67, 0x2a, 0x58, 0xf9, 0x4a, 0xf0, 0x3f, 0x61, 0x30,
-  0x3b, 0x25, 0xb5, 0x17, 0xa4, 0x08, 0x75, 0x7d, 0x21, 0x6e, 0xad, 0x60,
-  0x9e, 0x55, 0x4a, 0x46, 0x66, 0x3b, 0x31, 0x2c, 0xd8, 0x1e, 0xc1, 0x13,
-  0xe4, 0x04, 0x5f, 0x79, 0x65, 0x6a, 0x01, 0x5f, 0x74, 0x50, 0xc1, 0x42,
-  0xf8, 0x37, 0x98, 0x28, 0xe4, 0x1d, 0x4b, 0x0e, 0x59, 0x03, 0x77, 0x74,
-  0x71, 0x69, 0x03, 0x5a, 0x1c, 0x4f, 0x24, 0x40, 0x21, 0x35, 0x2e, 0x26,
-  0x70, 0x1b, 0x34, 0x0c, 0x26, 0x01, 0x30, 0x72, 0x70, 0x67, 0x3c, 0x58,
-  0x28, 0x4d, 0x21, 0x3e, 0x50, 0x33, 0x04, 0x24, 0x66, 0x19, 0x6a, 0x0a,
-  0x45, 0x7f, 0x43, 0x70, 0xa0, 0x65, 0xdd, 0x56, 0xe4, 0x4b, 0xda, 0x3c,
-  0x74, 0x30, 0x19, 0x25, 0x79, 0x16, 0x5a, 0x0b, 0xac, 0x7c, 0x99, 0x71,
-  0x90, 0x62, 0x3c, 0x56, 0x7b, 0x4b, 0x50, 0x3c, 0x82, 0x31, 0xad, 0x22,
-  0x34, 0x16, 0x7c, 0x0b, 0xa4, 0x7c, 0xfd, 0x71, 0x7a, 0x65, 0x10, 0x56,
-  0xbe, 0x4b, 0xf2, 0x3c, 0x36, 0x30, 0x79, 0x25, 0x98, 0x16, 0xa0, 0x0b,
-  0x67, 0x7f, 0xaa, 0x70, 0xc5, 0x65, 0x19, 0x59, 0xac, 0x4a, 0xb7, 0x3f,
-  0x46, 0x33, 0x94, 0x24, 0x21, 0x18, 0x59, 0x0d, 0xe4, 0x7e, 0x5d, 0x72,
-  0x88, 0x67, 0xc2, 0x58, 0x53, 0x4c, 0xee, 0x41, 0x94, 0x35, 0xbc, 0x26,
-  0x1f, 0x1a, 0xb8, 0x0f, 0x64, 0x03, 0xbc, 0x74, 0x22, 0x68, 0xb0, 0x5d,
-  0x74, 0x51, 0xbc, 0x42, 0x3e, 0x36, 0xfd, 0x2b, 0x25, 0x1f, 0xed, 0x10,
-  0x17, 0x04, 0x97, 0x79, 0x7d, 0x6d, 0xe1, 0x5e, 0x10, 0x52, 0xc2, 0x47,
-  0xa2, 0x3b, 0x5d, 0x2f, 0xe2, 0x20, 0x5a, 0x14, 0x3b, 0x08, 0x98, 0x7d,
-  0x63, 0x71, 0x9d, 0x62, 0xb0, 0x56, 0x05, 0x4a, 0xd1, 0x3f, 0xb1, 0x33,
-  0x34, 0x27, 0xc6, 0x18, 0x9f, 0x0c, 0x63, 0x00, 0x30, 0x74, 0xef, 0x69,
-  0xbf, 0x5d, 0x79, 0x51, 0x74, 0x45, 0xe1, 0x36, 0xb8, 0x2a, 0x78, 0x1e,
-  0x64, 0x12, 0xe9, 0x07, 0x9f, 0x7b, 0x4a, 0x6f, 0x66, 0x63, 0x65, 0x57,
-  0xc4, 0x48, 0x82, 0x3c, 0xe4, 0x30, 0x49, 0x24, 0x78, 0x18, 0x10, 0x0c,
-  0x74, 0x00, 0xc3, 0x75, 0xf1, 0x69, 0x88, 0x5d, 0xa8, 0x51, 0x59, 0x45,
-  0x1e, 0x39, 0x0f, 0x2d, 0x1e, 0x21, 0x31, 0x15, 0x18, 0x09, 0x28, 0x7d,
-  0x64, 0x71, 0x3b, 0x65, 0x3c, 0x59, 0x3a, 0x4d, 0x3b, 0x41, 0x27, 0x35,
-  0x70, 0x29, 0x32, 0x1d, 0x22, 0x11, 0x6d, 0x05, 0x04, 0x79, 0x0d, 0x6d,
-  0x7d, 0x61, 0x76, 0x55, 0x10, 0x49, 0x5f, 0x3d, 0xab, 0x31, 0x92, 0x25,
-  0xfd, 0x19, 0x95, 0x0d, 0x3d, 0x00, 0x06, 0x74, 0x30, 0x68, 0x5c, 0x5c,
-  0xe4, 0x50, 0x81, 0x44, 0xd1, 0x38, 0x37, 0x2f, 0x73, 0x23, 0x40, 0x17,
-  0xd0, 0x0b, 0xe0, 0x7f, 0x2b, 0x72, 0x6e, 0x66, 0xb1, 0x5a, 0xfc, 0x4e,
-  0x37, 0x45, 0x35, 0x39, 0xb4, 0x2d, 0xf8, 0x21, 0x34, 0x14, 0x64, 0x08,
-  0x93, 0x7c, 0xd1, 0x70, 0x7d, 0x67, 0xab, 0x5b, 0xd7, 0x4f, 0x4d, 0x42,
-  0xa5, 0x36, 0x9d, 0x2a, 0x37, 0x21, 0xdf, 0x15, 0x73, 0x08, 0x15, 0x7c,
-  0xe3, 0x70, 0x04, 0x67, 0xa9, 0x5b, 0xcf, 0x4f, 0x5f, 0x42, 0xe9, 0x36,
-  0x3a, 0x2d, 0xe1, 0x21, 0x15, 0x14, 0xac, 0x08, 0x37, 0x7f, 0xa9, 0x73,
-  0x55, 0x66, 0xa6, 0x5a, 0x3b, 0x51, 0xa0, 0x45, 0x24, 0x38, 0xb5, 0x2c,
-  0x4e, 0x23, 0x9b, 0x17, 0x11, 0x0a, 0x90, 0x7e, 0x78, 0x75, 0xf1, 0x69,
-  0x10, 0x5c, 0xe1, 0x50, 0xab, 0x47, 0x1e, 0x3a, 0xfb, 0x2e, 0xb7, 0x25,
-  0x0d, 0x18, 0x9a, 0x0c, 0x65, 0x03, 0x9d, 0x77, 0xa5, 0x6a, 0x1f, 0x61,
-  0xd5, 0x55, 0xe5, 0x48, 0x7d, 0x3f, 0xcb, 0x33, 0xd0, 0x26, 0x6c, 0x1d,
-  0x64, 0x10, 0xfa, 0x04, 0xa2, 0x7b, 0x7c, 0x6e, 0x30, 0x65, 0xb5, 0x59,
-  0xbf, 0x4c, 0x7b, 0x43, 0x64, 0x36, 0xff, 0x2a, 0x9f, 0x21, 0x4a, 0x14,
-  0x79, 0x0b, 0x36, 0x7e, 0x90, 0x72, 0x99, 0x69, 0xac, 0x5c, 0x5c, 0x53,
-  0x64, 0x46, 0x55, 0x3d, 0x37, 0x30, 0xda, 0x24, 0xfe, 0x1b, 0x89, 0x0e,
-  0xb6, 0x05, 0x42, 0x78, 0x5c, 0x6f, 0x25, 0x62, 0x60, 0x59, 0x0d, 0x4c,
-  0x15, 0x43, 0x6d, 0x36, 0x20, 0x2d, 0x32, 0x20, 0x3f, 0x17, 0x27, 0x0a,
-  0x74, 0x01, 0x21, 0x74, 0x3f, 0x6b, 0x7d, 0x5e, 0x30, 0x55, 0x25, 0x48,
-  0x15, 0x3f, 0x45, 0x32, 0x62, 0x29, 0x64, 0x1c, 0x45, 0x13, 0x41, 0x06,
-  0xb0, 0x7d, 0xd3, 0x70, 0x9a, 0x67, 0xbf, 0x5a, 0x00, 0x50, 0x1d, 0x47,
-  0x75, 0x3a, 0x1d, 0x31, 0xa2, 0x24, 0x81, 0x1b, 0xdf, 0x0e, 0x2a, 0x04,
-  0x66, 0x7b, 0x05, 0x6e, 0x9f, 0x65, 0xeb, 0x58, 0x64, 0x4e, 0x69, 0x45,
-  0xb8, 0x38, 0xfc, 0x2f, 0x27, 0x25, 0x35, 0x18, 0xa2, 0x0f, 0xf2, 0x02,
-  0x2b, 0x78, 0x60, 0x6f, 0xd0, 0x62, 0xcc, 0x59, 0x67, 0x4f, 0xe5, 0x42,
-  0xd1, 0x39, 0x4d, 0x2f, 0xa8, 0x22, 0xdc, 0x19, 0x62, 0x0f, 0x92, 0x02,
-  0x31, 0x78, 0x15, 0x6f, 0xfd, 0x62, 0x12, 0x58, 0xb7, 0x4f, 0xcc, 0x42,
-  0x59, 0x38, 0xe6, 0x2f, 0x34, 0x25, 0x81, 0x18, 0x15, 0x0e, 0xbd, 0x05,
-  0x2d, 0x7b, 0xbe, 0x6e, 0x24, 0x64, 0xbc, 0x5b, 0x3a, 0x51, 0xb2, 0x44,
-  0x70, 0x3a, 0xa9, 0x31, 0x2c, 0x27, 0xa8, 0x1a, 0x50, 0x10, 0x8b, 0x07,
-  0x61, 0x7d, 0xe8, 0x70, 0x52, 0x66, 0xc8, 0x5d, 0xb6, 0x53, 0x5d, 0x49,
-  0xb7, 0x3c, 0x0d, 0x32, 0x73, 0x28, 0xdb, 0x1f, 0x14, 0x15, 0xd8, 0x08,
-  0xa5, 0x7e, 0x1e, 0x74, 0xc4, 0x6b, 0xc0, 0x61, 0x67, 0x57, 0xca, 0x4a,
-  0x85, 0x40, 0x79, 0x36, 0x2c, 0x2c, 0x99, 0x23, 0xa7, 0x19, 0x70, 0x0f,
-  0x27, 0x05, 0xe1, 0x78, 0xda, 0x6e, 0x4b, 0x64, 0x25, 0x5a, 0xf8, 0x51,
-  0x9c, 0x47, 0x51, 0x3d, 0x34, 0x33, 0x09, 0x29, 0xdf, 0x1c, 0x8e, 0x12,
-  0xaf, 0x08, 0xbd, 0x7e, 0x49, 0x74, 0x1a, 0x6a, 0x21, 0x60, 0x95, 0x57,
-  0xf1, 0x4d, 0x8f, 0x43, 0xa1, 0x39, 0x0d, 0x2f, 0x59, 0x25, 0x6b, 0x1b,
-  0x34, 0x11, 0x04, 0x07, 0x50, 0x7d, 0x2a, 0x73, 0x36, 0x69, 0x34, 0x5f,
-  0x34, 0x55, 0x75, 0x4b, 0x3b, 0x41, 0x33, 0x37, 0x70, 0x2d, 0x2f, 0x23,
-  0x2b, 0x19, 0x22, 0x0f, 0x1d, 0x05, 0x16, 0x7b, 0x34, 0x71, 0x71, 0x67,
-  0x58, 0x5d, 0x4c, 0x53, 0xb0, 0x49, 0xdd, 0x3f, 0xf3, 0x35, 0xda, 0x2b,
-  0x3a, 0x20, 0x01, 0x16, 0x62, 0x0c, 0x52, 0x02, 0xa8, 0x78, 0xcd, 0x6e,
-  0xc4, 0x64, 0x2d, 0x5d, 0x71, 0x53, 0x05, 0x49, 0x94, 0x3f, 0xe2, 0x35,
-  0x2b, 0x2a, 0x6f, 0x20, 0xf0, 0x16, 0xe1, 0x0c, 0x3b, 0x05, 0x35, 0x7b,
-  0xa4, 0x71, 0xf5, 0x67, 0x21, 0x5c, 0x2d, 0x52, 0x86, 0x48, 0xc4, 0x3e,
-  0x61, 0x37, 0xa9, 0x2d, 0xc4, 0x23, 0x43, 0x18, 0xce, 0x0e, 0xb7, 0x04,
-  0x44, 0x7d, 0x9d, 0x73, 0x31, 0x68, 0x15, 0x5e, 0xf6, 0x54, 0x11, 0x4d,
-  0xab, 0x43, 0xc2, 0x39, 0x42, 0x2e, 0xa5, 0x24, 0x7b, 0x1d, 0x83, 0x13,
-  0x50, 0x08, 0xb9, 0x7e, 0x2c, 0x77, 0xb4, 0x6d, 0x23, 0x62, 0xf5, 0x58,
-  0x26, 0x51, 0xba, 0x47, 0x3f, 0x3c, 0xb0, 0x32, 0x64, 0x2b, 0xa4, 0x21,
-  0x03, 0x16, 0xc5, 0x0c, 0x75, 0x05, 0xa5, 0x7b, 0x5c, 0x70, 0xcc, 0x66,
-  0xb6, 0x5f, 0x1a, 0x54, 0xf5, 0x4a, 0x15, 0x43, 0x39, 0x38, 0x9a, 0x2e,
-  0x63, 0x27, 0xdc, 0x1d, 0xad, 0x12, 0x0e, 0x0b, 0x90, 0x01, 0xa1, 0x76,
-  0x71, 0x6f, 0xd5, 0x65, 0x99, 0x5a, 0x6e, 0x53, 0x30, 0x48, 0xf4, 0x3e,
-  0xbe, 0x37, 0x72, 0x2c, 0x74, 0x25, 0xf4, 0x1b, 0xf0, 0x10, 0x3a, 0x09,
-  0x69, 0x7e, 0xaa, 0x74, 0xd0, 0x6d, 0x56, 0x62, 0x6d, 0x5b, 0x28, 0x50,
-  0xd2, 0x46, 0x82, 0x3f, 0xa8, 0x34, 0x13, 0x2d, 0x14, 0x22, 0x10, 0x1b,
-  0x35, 0x10, 0xc6, 0x06, 0xe4, 0x7f, 0xf8, 0x74, 0xb7, 0x6d, 0x42, 0x62,
-  0x45, 0x5b, 0x71, 0x50, 0x7c, 0x49, 0x61, 0x3e, 0x07, 0x37, 0x28, 0x2c,
-  0x37, 0x25, 0x29, 0x1a, 0x5a, 0x13, 0x03, 0x08, 0x35, 0x01, 0x20, 0x76,
-  0x3c, 0x6f, 0x29, 0x64, 0x64, 0x5d, 0x09, 0x52, 0x1f, 0x4b, 0x0a, 0x40,
-  0x66, 0x39, 0xf3, 0x2e, 0x69, 0x27, 0x42, 0x1c, 0xb1, 0x15, 0xdd, 0x0a,
-  0xe3, 0x03, 0xc1, 0x78, 0x35, 0x70, 0x1b, 0x69, 0x74, 0x5e, 0x1d, 0x57,
-  0xa6, 0x4c, 0x88, 0x45, 0xd6, 0x3a, 0x2a, 0x32, 0x66, 0x2b, 0x40, 0x20,
-  0xd0, 0x19, 0xf9, 0x0e, 0x2c, 0x06, 0x78, 0x7f, 0xf0, 0x74, 0xf1, 0x6d,
-  0x3b, 0x65, 0x7a, 0x5a, 0xa2, 0x53, 0xbd, 0x48, 0x30, 0x40, 0x62, 0x39,
-  0xd0, 0x2e, 0xd1, 0x27, 0x7c, 0x1f, 0xa0, 0x14, 0x90, 0x0d, 0x1b, 0x05,
-  0xa5, 0x7a, 0xc8, 0x73, 0x7c, 0x6b, 0x81, 0x60, 0x6f, 0x58, 0x15, 0x51,
-  0xf9, 0x46, 0x09, 0x3e, 0xe4, 0x37, 0xc5, 0x2c, 0x51, 0x24, 0xf6, 0x1d,
-  0x34, 0x15, 0x84, 0x0a, 0x50, 0x02, 0xa1, 0x7b, 0x25, 0x73, 0xaf, 0x68,
-  0x37, 0x60, 0xb0, 0x59, 0x74, 0x51, 0xf2, 0x46, 0x63, 0x3e, 0xed, 0x37,
-  0x63, 0x2f, 0xed, 0x24, 0x13, 0x1c, 0x84, 0x15, 0x66, 0x0d, 0xf3, 0x02,
-  0x55, 0x7a, 0xc9, 0x73, 0xe4, 0x6b, 0x14, 0x63, 0xfe, 0x58, 0x41, 0x50,
-  0x3b, 0x48, 0xd5, 0x41, 0x79, 0x39, 0xc9, 0x2e, 0xea, 0x26, 0x4d, 0x1e,
-  0x90, 0x17, 0x84, 0x0f, 0x72, 0x07, 0xc3, 0x7c, 0x99, 0x74, 0x75, 0x6c,
-  0x21, 0x64, 0xf9, 0x5d, 0xf0, 0x55, 0x61, 0x4d, 0x3b, 0x45, 0xb5, 0x3a,
-  0xa4, 0x32, 0x75, 0x2a, 0x21, 0x22, 0xad, 0x1b, 0x87, 0x13, 0x44, 0x0b,
-  0x78, 0x03, 0x29, 0x7b, 0x90, 0x70, 0x83, 0x68, 0xa1, 0x60, 0x5c, 0x58,
-  0x62, 0x50, 0x55, 0x48, 0x20, 0x40, 0xdd, 0x39, 0xf5, 0x31, 0xdd, 0x29,
-  0xa0, 0x21, 0x42, 0x19, 0x5f, 0x11, 0x77, 0x09, 0x38, 0x01, 0x45, 0x79,
-  0x04, 0x71, 0x25, 0x69, 0x21, 0x61, 0x2f, 0x59, 0x35, 0x51, 0x75, 0x49,
-  0x3d, 0x41, 0x26, 0x39, 0x70, 0x31, 0x3c, 0x29, 0x64, 0x21, 0x3f, 0x19,
-  0x05, 0x11, 0x0b, 0x09, 0x7a, 0x01, 0x6c, 0x79, 0x5e, 0x71, 0x4a, 0x69,
-  0xe4, 0x61, 0x95, 0x59, 0xff, 0x51, 0xc0, 0x49, 0x26, 0x40, 0x12, 0x38,
-  0x7c, 0x30, 0x5c, 0x28, 0xb7, 0x20, 0x9e, 0x18, 0x90, 0x10, 0x32, 0x0b,
-  0x7c, 0x03, 0x4c, 0x7b, 0x93, 0x73, 0xe5, 0x6b, 0x64, 0x62, 0x73, 0x5a,
-  0xb5, 0x52, 0xe3, 0x4a, 0x31, 0x45, 0x67, 0x3d, 0xf0, 0x35, 0xee, 0x2d,
-  0x21, 0x24, 0x68, 0x1c, 0x9d, 0x14, 0xd6, 0x0c, 0x34, 0x07, 0xb1, 0x7f,
-  0xdf, 0x77, 0x4d, 0x6e, 0xb6, 0x66, 0xc8, 0x5e, 0x7e, 0x59, 0xd5, 0x51,
-  0x3b, 0x48, 0x40, 0x40, 0xe4, 0x38, 0x5d, 0x33, 0xab, 0x2b, 0xcb, 0x23,
-  0x10, 0x1a, 0xf6, 0x12, 0x75, 0x0d, 0x8b, 0x05, 0x14, 0x7c, 0xe3, 0x74,
-  0x4e, 0x6f, 0xd7, 0x67, 0x04, 0x5e, 0xbd, 0x56, 0x31, 0x51, 0xf5, 0x49,
-  0x36, 0x40, 0xb1, 0x38, 0x2b, 0x33, 0xa2, 0x2b, 0x02, 0x22, 0xc5, 0x1a,
-  0x7b, 0x15, 0xe3, 0x0d, 0x10, 0x04, 0xd9, 0x7c, 0xac, 0x77, 0x14, 0x6e,
-  0xe3, 0x66, 0x15, 0x61, 0x26, 0x58, 0x9a, 0x50, 0x7f, 0x4b, 0xd0, 0x43,
-  0xe4, 0x3a, 0x04, 0x35, 0xc3, 0x2d, 0xe5, 0x24, 0x75, 0x1f, 0x85, 0x17,
-  0x9c, 0x0e, 0x6c, 0x09, 0x36, 0x00, 0xfa, 0x78, 0xb5, 0x73, 0x35, 0x6a,
-  0x39, 0x65, 0xfa, 0x5d, 0xa3, 0x54, 0x7c, 0x4f, 0x2d, 0x46, 0xee, 0x3e,
-  0xd0, 0x39, 0x41, 0x30, 0x71, 0x2b, 0x35, 0x22, 0xd9, 0x1a, 0x8e, 0x15,
-  0xb0, 0x0c, 0x54, 0x07, 0x7e, 0x7e, 0x12, 0x79, 0x74, 0x70, 0xc1, 0x68,
-  0xf8, 0x63, 0x98, 0x5a, 0xe4, 0x55, 0x43, 0x4c, 0x45, 0x47, 0x68, 0x3e,
-  0x76, 0x39, 0x00, 0x30, 0x02, 0x2b, 0x6d, 0x22, 0x63, 0x1d, 0x6c, 0x14,
-  0x77, 0x0f, 0x7b, 0x06, 0x51, 0x01, 0x26, 0x78, 0x3f, 0x73, 0x28, 0x6a,
-  0x30, 0x65, 0x25, 0x5c, 0x74, 0x57, 0x12, 0x4e, 0x71, 0x49, 0x76, 0x40,
-  0x44, 0x3b, 0x28, 0x32, 0xb2, 0x2d, 0x9c, 0x24, 0xe5, 0x1f, 0xd9, 0x16,
-  0x20, 0x10, 0x7f, 0x0b, 0x46, 0x02, 0x5c, 0x7d, 0xb1, 0x74, 0x81, 0x6f,
-  0xc4, 0x66, 0x65, 0x60, 0x58, 0x5b, 0x4a, 0x52, 0x93, 0x4d, 0xe6, 0x44,
-  0xc6, 0x3e, 0x44, 0x39, 0xbf, 0x30, 0xe0, 0x2b, 0x74, 0x25, 0x74, 0x1c,
-  0xa2, 0x17, 0xf8, 0x0e, 0x64, 0x08, 0x64, 0x03, 0x9e, 0x7a, 0x85, 0x75,
-  0x75, 0x6f, 0xe5, 0x66, 0xd7, 0x61, 0x1f, 0x5b, 0xad, 0x52, 0xd9, 0x4d,
-  0x30, 0x47, 0x9a, 0x3e, 0x32, 0x38, 0x15, 0x33, 0xe2, 0x2a, 0x12, 0x24,
-  0xab, 0x1f, 0xc0, 0x16, 0x43, 0x10, 0xa5, 0x0b, 0x60, 0x05, 0x8d, 0x7c,
-  0x11, 0x76, 0xb9, 0x71, 0x64, 0x6b, 0xbe, 0x62, 0x3f, 0x5c, 0xbb, 0x57,
-  0x20, 0x51, 0xa7, 0x48, 0x3f, 0x42, 0xb1, 0x3d, 0x64, 0x37, 0xb9, 0x2e,
-  0x18, 0x28, 0x80, 0x23, 0x34, 0x1d, 0xe1, 0x14, 0x5f, 0x0e, 0xc2, 0x09,
-  0xb6, 0x03, 0x5d, 0x7d, 0xe4, 0x74, 0x5a, 0x6e, 0x74, 0x68, 0x81, 0x63,
-  0x78, 0x5d, 0xd8, 0x54, 0xe4, 0x4e, 0x1b, 0x48, 0xd1, 0x43, 0xb0, 0x3d,
-  0x78, 0x37, 0xd1, 0x2e, 0xde, 0x28, 0x07, 0x22, 0x4e, 0x1c, 0xc9, 0x17,
-  0xb8, 0x11, 0x70, 0x0b, 0x74, 0x05, 0xf3, 0x7c, 0xbc, 0x76, 0x72, 0x70,
-  0x2b, 0x6a, 0xff, 0x65, 0xd0, 0x5f, 0x4a, 0x59, 0x72, 0x53, 0x65, 0x4d,
-  0xc4, 0x44, 0x85, 0x3e, 0xad, 0x38, 0x4e, 0x32, 0x30, 0x2c, 0x07, 0x26,
-  0x3b, 0x20, 0xda, 0x1b, 0xfd, 0x15, 0xdd, 0x0f, 0xad, 0x09, 0x5e, 0x03,
-  0x10, 0x7d, 0x64, 0x77, 0x34, 0x71, 0x09, 0x6b, 0x11, 0x65, 0x3f, 0x5f,
-  0x23, 0x59, 0x38, 0x53, 0x70, 0x4d, 0x38, 0x47, 0x3b, 0x41, 0x26, 0x3b,
-  0x31, 0x35, 0x34, 0x2f, 0x27, 0x29, 0x6d, 0x23, 0x14, 0x1d, 0x00, 0x17,
-  0x64, 0x11, 0x6c, 0x0b, 0x53, 0x05, 0x59, 0x7f, 0xad, 0x79, 0x93, 0x73,
-  0xf7, 0x6d, 0x95, 0x67, 0x20, 0x60, 0x1d, 0x5a, 0x75, 0x54, 0x1d, 0x4e,
-  0xaa, 0x48, 0x98, 0x42, 0xdd, 0x3c, 0x27, 0x39, 0x71, 0x33, 0x57, 0x2d,
-  0xd0, 0x27, 0xaa, 0x21, 0x70, 0x1a, 0x3a, 0x14, 0xfe, 0x0e, 0x90, 0x08,
-  0x3a, 0x05, 0x7a, 0x7f, 0xa2, 0x79, 0xe9, 0x73, 0x2c, 0x6c, 0x09, 0x66,
-  0x95, 0x60, 0xc4, 0x5a, 0x67, 0x57, 0xb1, 0x51, 0xb5, 0x4b, 0x1e, 0x44,
-  0xab, 0x3e, 0xc8, 0x38, 0x64, 0x35, 0x9d, 0x2f, 0x5e, 0x28, 0x63, 0x22,
-  0xf1, 0x1c, 0x08, 0x19, 0xa8, 0x13, 0xd9, 0x0d, 0x10, 0x06, 0xc9, 0x00,
-  0x7b, 0x7d, 0x86, 0x77, 0x1b, 0x70, 0x4d, 0x6a, 0x1d, 0x67, 0xb2, 0x61,
-  0x25, 0x5a, 0xf5, 0x54, 0x35, 0x51, 0xa7, 0x4b, 0x35, 0x44, 0xfd, 0x3e,
-  0x2d, 0x3b, 0xa3, 0x35, 0x50, 0x2e, 0x84, 0x28, 0x34, 0x25, 0xe2, 0x1f,
-  0x42, 0x18, 0xc4, 0x12, 0xa0, 0x0f, 0x5d, 0x08, 0xff, 0x02, 0x53, 0x7f,
-  0x74, 0x78, 0x87, 0x72, 0x7f, 0x6f, 0xd2, 0x69, 0xa9, 0x62, 0x1e, 0x5f,
-  0x90, 0x59, 0xb1, 0x52, 0x7c, 0x4f, 0xc4, 0x49, 0x84, 0x42, 0x2d, 0x3f,
-  0x27, 0x38, 0xf2, 0x32, 0xbe, 0x2f, 0x61, 0x28, 0x26, 0x25, 0xfa, 0x1f,
-  0xbc, 0x18, 0x3d, 0x15, 0x30, 0x0e, 0xe5, 0x08, 0x95, 0x05, 0x05, 0x7e,
-  0x70, 0x7b, 0x2a, 0x74, 0xdf, 0x6e, 0x9f, 0x6b, 0xe4, 0x64, 0x49, 0x61,
-  0x7f, 0x5a, 0x55, 0x57, 0x20, 0x50, 0xdd, 0x4a, 0xf5, 0x47, 0xdd, 0x40,
-  0xb2, 0x3d, 0x4c, 0x36, 0x45, 0x33, 0x69, 0x2c, 0x60, 0x29, 0x4b, 0x22,
-  0x7a, 0x1f, 0x47, 0x18, 0x10, 0x15, 0x35, 0x0e, 0x35, 0x0b, 0x75, 0x04,
-  0x32, 0x01, 0x39, 0x7a, 0x3f, 0x77, 0x32, 0x70, 0x36, 0x6d, 0x6d, 0x66,
-  0x1f, 0x63, 0x03, 0x5c, 0x34, 0x59, 0x71, 0x52, 0x58, 0x4f, 0x44, 0x48,
-  0xb7, 0x45, 0xdd, 0x3e, 0xe2, 0x3b, 0xda, 0x34, 0x3b, 0x30, 0x18, 0x2d,
-  0x30, 0x26, 0x54, 0x23, 0xb7, 0x1c, 0xcd, 0x19, 0xd1, 0x12, 0x65, 0x0e,
-  0x78, 0x0b, 0x44, 0x04, 0x82, 0x01, 0xea, 0x7a, 0x21, 0x76, 0x3d, 0x73,
-  0xbd, 0x6c, 0xfa, 0x69, 0x27, 0x65, 0x74, 0x5e, 0xb9, 0x5b, 0xfe, 0x54,
-  0x64, 0x50, 0x69, 0x4d, 0x95, 0x46, 0xd5, 0x43, 0x7d, 0x3f, 0xa6, 0x38,
-  0xc4, 0x35, 0x04, 0x31, 0xaa, 0x2a, 0xda, 0x27, 0x30, 0x23, 0x94, 0x1c,
-  0x74, 0x18, 0x12, 0x15, 0xba, 0x0e, 0x5a, 0x0a, 0xe4, 0x07, 0xde, 0x00,
-  0x49, 0x7c, 0xe8, 0x79, 0x76, 0x75, 0x8a, 0x6e, 0x1c, 0x6a, 0xe3, 0x67,
-  0x41, 0x63, 0xb3, 0x5c, 0x3f, 0x58, 0xa7, 0x55, 0x20, 0x51, 0xbd, 0x4a,
-  0x54, 0x46, 0xb8, 0x43, 0x25, 0x3f, 0xbe, 0x38, 0x04, 0x34, 0xe0, 0x31,
-  0x67, 0x2d, 0xea, 0x26, 0x45, 0x22, 0xd9, 0x1f, 0xac, 0x1b, 0x79, 0x17,
-  0xe7, 0x10, 0x50, 0x0c, 0x27, 0x08, 0x81, 0x05, 0x1a, 0x01, 0xeb, 0x7a,
-  0xa5, 0x76, 0x18, 0x72, 0xdc, 0x6f, 0xb1, 0x6b, 0x34, 0x67, 0xe9, 0x60,
-  0x9f, 0x5c, 0x6e, 0x58, 0x2f, 0x54, 0x1e, 0x51, 0x89, 0x4d, 0x7a, 0x49,
-  0x21, 0x45, 0xb5, 0x3e, 0xb1, 0x3a, 0x6f, 0x36, 0x21, 0x32, 0xad, 0x2f,
-  0x99, 0x2b, 0x4b, 0x27, 0x34, 0x23, 0x24, 0x1f, 0x90, 0x18, 0x8a, 0x14,
-  0xb6, 0x10, 0x54, 0x0c, 0x74, 0x08, 0x55, 0x04, 0x3b, 0x00, 0xd3, 0x7d,
-  0xb0, 0x79, 0x8f, 0x75, 0xab, 0x71, 0x42, 0x6d, 0x5d, 0x69, 0x76, 0x65,
-  0x34, 0x61, 0x11, 0x5d, 0x18, 0x59, 0x2c, 0x55, 0x30, 0x51, 0x7d, 0x4d,
-  0x33, 0x49, 0x3a, 0x45, 0x3a, 0x41, 0x21, 0x3d, 0x22, 0x39, 0x32, 0x35,
-  0x28, 0x31, 0x6d, 0x2d, 0x04, 0x29, 0x0d, 0x25, 0x71, 0x21, 0x25, 0x1d,
-  0x54, 0x19, 0x42, 0x15, 0xab, 0x11, 0x8f, 0x0d, 0xb0, 0x09, 0xc1, 0x05,
-  0x3b, 0x00, 0x55, 0x7c, 0x64, 0x78, 0x55, 0x74, 0xa1, 0x70, 0xcd, 0x6c,
-  0xc6, 0x68, 0x24, 0x67, 0x61, 0x63, 0x49, 0x5f, 0x84, 0x5b, 0xa3, 0x57,
-  0x4e, 0x52, 0x17, 0x4e, 0x84, 0x4a, 0xfd, 0x46, 0x31, 0x45, 0x35, 0x41,
-  0xb6, 0x3d, 0xf1, 0x39, 0x2b, 0x34, 0x62, 0x30, 0x82, 0x2c, 0x85, 0x28,
-  0x7b, 0x27, 0xa3, 0x23, 0x90, 0x1f, 0x19, 0x1a, 0xac, 0x16, 0xd4, 0x12,
-  0x63, 0x11, 0xd5, 0x0d, 0x26, 0x08, 0x5a, 0x04, 0xff, 0x00, 0x10, 0x7f,
-  0xe4, 0x7b, 0xc4, 0x77, 0x43, 0x72, 0xa5, 0x6e, 0x75, 0x6d, 0xc5, 0x69,
-  0x1c, 0x64, 0xac, 0x60, 0x36, 0x5f, 0xba, 0x5b, 0x35, 0x56, 0xf5, 0x52,
-  0x39, 0x51, 0xba, 0x4d, 0x23, 0x48, 0xbc, 0x44, 0x2d, 0x43, 0xae, 0x3f,
-  0x50, 0x3a, 0x81, 0x36, 0x71, 0x35, 0xf5, 0x31, 0x59, 0x2c, 0xce, 0x28,
-  0xb0, 0x27, 0x14, 0x22, 0xfe, 0x1e, 0x52, 0x1d, 0x74, 0x18, 0x81, 0x14,
-  0x78, 0x13, 0xd8, 0x0f, 0xe4, 0x0a, 0x03, 0x09, 0xc5, 0x05, 0xa8, 0x00,
-  0x76, 0x7f, 0xc0, 0x7b, 0x82, 0x76, 0x2d, 0x75, 0x63, 0x70, 0xac, 0x6c,
-  0xe1, 0x6b, 0x32, 0x66, 0x7a, 0x65, 0x90, 0x61, 0xbe, 0x5c, 0x72, 0x5b,
-  0x36, 0x56, 0xf9, 0x52, 0x98, 0x51, 0x21, 0x4c, 0x71, 0x4b, 0x24, 0x46,
-  0xc3, 0x42, 0x99, 0x41, 0xc1, 0x3c, 0x4e, 0x3b, 0x7f, 0x36, 0x00, 0x35,
-  0x20, 0x30, 0xdd, 0x2c, 0x94, 0x2b, 0x8a, 0x26, 0xa1, 0x25, 0x5e, 0x20,
-  0x44, 0x1f, 0x0f, 0x1a, 0x42, 0x19, 0x04, 0x14, 0x05, 0x13, 0x21, 0x0e,
-  0x30, 0x0d, 0x7d, 0x08, 0x1c, 0x07, 0x3a, 0x02, 0x37, 0x01, 0x3e, 0x7c,
-  0xd0, 0x7b, 0x04, 0x76, 0x2b, 0x75, 0x38, 0x70, 0x50, 0x6f, 0x04, 0x6a,
-  0x66, 0x69, 0x60, 0x64, 0x10, 0x63, 0x44, 0x5e, 0xaa, 0x5d, 0xdd, 0x58,
-  0xf1, 0x57, 0x95, 0x52, 0x33, 0x50, 0x07, 0x4f, 0x79, 0x4a, 0x59, 0x49,
-  0xe4, 0x44, 0x82, 0x43, 0xd6, 0x3e, 0x65, 0x3c, 0x66, 0x3b, 0x4a, 0x36,
-  0x9f, 0x35, 0xe0, 0x30, 0x37, 0x2e, 0x3d, 0x2d, 0xa4, 0x28, 0xfd, 0x27,
-  0x35, 0x25, 0x61, 0x20, 0xf0, 0x1f, 0xfe, 0x1a, 0x2b, 0x18, 0x63, 0x17,
-  0x84, 0x12, 0xd7, 0x11, 0x7b, 0x0f, 0xa9, 0x0a, 0x90, 0x09, 0x19, 0x07,
-  0xac, 0x02, 0xd8, 0x01, 0x30, 0x7f, 0x91, 0x7a, 0x3b, 0x78, 0x5a, 0x77,
-  0xe2, 0x72, 0x5d, 0x70, 0xb0, 0x6f, 0xc2, 0x6a, 0x10, 0x68, 0xf1, 0x67,
-  0x7c, 0x65, 0x80, 0x60, 0x50, 0x5e, 0xbb, 0x5d, 0x25, 0x5b, 0xa8, 0x56,
-  0x3c, 0x54, 0xa1, 0x53, 0x7a, 0x51, 0xdf, 0x4c, 0x5a, 0x4a, 0x89, 0x49,
-  0x2c, 0x47, 0xa8, 0x42, 0x50, 0x40, 0x83, 0x3f, 0x78, 0x3d, 0xea, 0x38,
-  0x5f, 0x36, 0xdf, 0x35, 0xe4, 0x33, 0x12, 0x31, 0xf6, 0x2c, 0x15, 0x2a,
-  0x20, 0x28, 0x9d, 0x27, 0x79, 0x25, 0xce, 0x20, 0xe4, 0x1e, 0x1f, 0x1c,
-  0xdf, 0x1b, 0xaa, 0x19, 0x79, 0x17, 0x85, 0x12, 0x99, 0x10, 0x7e, 0x0e,
-  0x64, 0x0c, 0xfc, 0x0b, 0xf0, 0x09, 0x79, 0x07, 0x35, 0x05, 0xe7, 0x00,
-  0xb7, 0x7e, 0x78, 0x7c, 0x64, 0x7a, 0xe0, 0x79, 0x9f, 0x77, 0x56, 0x75,
-  0x75, 0x73, 0x2c, 0x71, 0xd3, 0x6c, 0xcd, 0x6a, 0xa0, 0x68, 0x58, 0x66,
-  0x60, 0x64, 0x1c, 0x62, 0x37, 0x60, 0xc1, 0x5f, 0xf9, 0x5d, 0x93, 0x5b,
-  0xa3, 0x59, 0x0d, 0x57, 0x51, 0x55, 0x25, 0x53, 0x33, 0x51, 0x4f, 0x4f,
-  0x57, 0x4d, 0x6d, 0x4b, 0x37, 0x49, 0x24, 0x47, 0x3d, 0x45, 0x37, 0x43,
-  0x3b, 0x41, 0x39, 0x3f, 0x7e, 0x3d, 0x58, 0x3b, 0x2a, 0x39, 0x22, 0x37,
-  0x02, 0x35, 0x11, 0x33, 0x7c, 0x31, 0x00, 0x2f, 0x43, 0x2d, 0x42, 0x2b,
-  0xb1, 0x29, 0x89, 0x27, 0xf8, 0x25, 0xb1, 0x23, 0x23, 0x20, 0x10, 0x1e,
-  0x63, 0x1c, 0x49, 0x1a, 0xce, 0x18, 0xbb, 0x16, 0xd1, 0x14, 0x30, 0x15,
-  0x78, 0x13, 0x51, 0x11, 0xd0, 0x0f, 0xc1, 0x0d, 0x2b, 0x0a, 0x7e, 0x08,
-  0xbb, 0x06, 0x15, 0x04, 0x0d, 0x05, 0x7a, 0x03, 0xa5, 0x01, 0xbd, 0x7f,
-  0x25, 0x7c, 0x7f, 0x7a, 0x95, 0x78, 0x85, 0x76, 0x7d, 0x77, 0xab, 0x75,
-  0x90, 0x73, 0x0c, 0x70, 0xe4, 0x6e, 0xda, 0x6c, 0x62, 0x6d, 0x9c, 0x6b,
-  0x30, 0x68, 0x15, 0x66, 0xff, 0x64, 0x1b, 0x65, 0xe4, 0x63, 0xdf, 0x61,
-  0x5f, 0x5e, 0xea, 0x5c, 0x79, 0x5d, 0x96, 0x5b, 0x50, 0x58, 0xb9, 0x56,
-  0x2c, 0x57, 0xbc, 0x55, 0x24, 0x52, 0xf5, 0x50, 0x37, 0x51, 0xba, 0x4f,
-  0x3e, 0x4c, 0xa9, 0x4a, 0x36, 0x4b, 0xa2, 0x49, 0x1c, 0x46, 0xc5, 0x44,
-  0x60, 0x45, 0xed, 0x43, 0x55, 0x40, 0x8d, 0x3e, 0xa0, 0x3f, 0x12, 0x3c,
-  0xff, 0x3a, 0x47, 0x3b, 0x74, 0x38, 0x81, 0x36, 0x7f, 0x37, 0x9d, 0x35,
-  0xb0, 0x32, 0x05, 0x33, 0xd5, 0x31, 0xe5, 0x2e, 0x62, 0x2f, 0xc4, 0x2d,
-  0x85, 0x2a, 0x61, 0x2b, 0x30, 0x28, 0xb3, 0x26, 0xda, 0x27, 0x1f, 0x24,
-  0x00, 0x25, 0xfd, 0x23, 0xb5, 0x20, 0x3d, 0x21, 0x22, 0x1e, 0xe1, 0x1c,
-  0x9f, 0x1d, 0x4a, 0x1a, 0x66, 0x1b, 0x65, 0x18, 0xdf, 0x16, 0x8b, 0x17,
-  0xe4, 0x14, 0x49, 0x15, 0x78, 0x12, 0x1c, 0x13, 0x27, 0x10, 0x95, 0x0e,
-  0xe2, 0x0f, 0x92, 0x0c, 0xab, 0x0d, 0x40, 0x0a, 0x10, 0x0b, 0x6c, 0x08,
-  0x67, 0x09, 0x45, 0x06, 0x11, 0x07, 0x6d, 0x04, 0x28, 0x05, 0x3c, 0x02,
-  0x22, 0x03, 0x32, 0x00, 0x31, 0x01, 0x75, 0x7e, 0x3d, 0x7f, 0x32, 0x7c,
-  0x37, 0x7d, 0x2c, 0x7a, 0x19, 0x7b, 0x06, 0x78, 0x34, 0x79, 0x61, 0x76,
-  0x55, 0x77, 0x5d, 0x74, 0xad, 0x75, 0x9e, 0x72, 0xe4, 0x73, 0xdc, 0x70,
-  0x3a, 0x70, 0x12, 0x71, 0x30, 0x6e, 0x5c, 0x6f, 0xe4, 0x6c, 0xca, 0x6d,
-  0x9b, 0x6a, 0x62, 0x6a, 0x34, 0x6b, 0x56, 0x68, 0x89, 0x69, 0xe0, 0x66,
-  0x26, 0x66, 0x72, 0x67, 0xbc, 0x64, 0xbb, 0x65, 0x51, 0x65, 0x7b, 0x62,
-  0xbf, 0x63, 0xef, 0x60, 0x30, 0x60, 0x65, 0x61, 0xf4, 0x5e, 0xc0, 0x5f,
-  0x75, 0x5f, 0xb6, 0x5c, 0xc4, 0x5d, 0x68, 0x5d, 0xb7, 0x5a, 0xd2, 0x5b,
-  0x65, 0x5b, 0x81, 0x58, 0x3c, 0x58, 0x3f, 0x59, 0xc6, 0x56, 0x1c, 0x56,
-  0xb1, 0x57, 0xc1, 0x54, 0x44, 0x54, 0xa5, 0x55, 0x58, 0x55, 0x8a, 0x52,
-  0x13, 0x52, 0xa6, 0x53, 0xc6, 0x53, 0x84, 0x50, 0x3f, 0x50, 0xa0, 0x51,
-  0x74, 0x51, 0xb4, 0x4e, 0x22, 0x4e, 0xb8, 0x4f, 0x64, 0x4f, 0xa4, 0x4c,
-  0x1e, 0x4c, 0xc5, 0x4d, 0x75, 0x4d, 0xa5, 0x4a, 0x57, 0x4a, 0xdf, 0x4b,
-  0xad, 0x4b, 0x19, 0x4b, 0xb0, 0x48, 0x5a, 0x48, 0x32, 0x48, 0xd5, 0x49,
-  0x62, 0x49, 0xd2, 0x46, 0xab, 0x46, 0x00, 0x46, 0xc3, 0x47, 0xe5, 0x47,
-  0x60, 0x47, 0xcd, 0x44, 0x91, 0x44, 0x79, 0x44, 0x64, 0x44, 0xfe, 0x45,
-  0xbf, 0x45, 0x7b, 0x45, 0x20, 0x45, 0xe7, 0x42, 0xbf, 0x42, 0x71, 0x42,
-  0x64, 0x42, 0xf9, 0x43, 0x98, 0x43, 0x40, 0x43, 0x34, 0x43, 0x21, 0x43,
-  0xdf, 0x40, 0x82, 0x40, 0xb6, 0x40, 0x1d, 0x40, 0x64, 0x40, 0x1a, 0x40,
-  0x74, 0x40, 0xc1, 0x41, 0xf8, 0x41, 0x98, 0x41, 0xe4, 0x41, 0x5b, 0x41,
-  0x51, 0x41, 0x70, 0x41, 0x78, 0x41, 0x11, 0x41, 0x5e, 0x41, 0x47, 0x41,
-  0x4e, 0x41, 0x09, 0x41, 0x38, 0x41, 0x30, 0x41, 0x74, 0x41, 0x33, 0x41,
-  0x3c, 0x41, 0x32, 0x41, 0x2b, 0x41, 0x3f, 0x41, 0x50, 0x41, 0x0a, 0x41,
-  0x72, 0x41, 0x25, 0x41, 0x44, 0x41, 0x45, 0x41, 0xad, 0x41, 0x8e, 0x41,
-  0xb0, 0x41, 0xc7, 0x41, 0x3b, 0x40, 0x1a, 0x40, 0x7d, 0x40, 0x1d, 0x40,
-  0xad, 0x40, 0x9e, 0x40, 0x90, 0x40, 0x24, 0x43, 0x34, 0x43, 0x49, 0x43,
-  0x91, 0x43, 0xff, 0x43, 0x23, 0x42, 0x78, 0x42, 0xf0, 0x42, 0xf8, 0x42,
-  0x3b, 0x45, 0x66, 0x45, 0xb1, 0x45, 0xf4, 0x45, 0x27, 0x44, 0x2d, 0x44,
-  0x94, 0x44, 0xc0, 0x44, 0x64, 0x47, 0xac, 0x47, 0xd3, 0x47, 0x19, 0x46,
-  0xad, 0x46, 0xd3, 0x46, 0x77, 0x49, 0xd5, 0x49, 0x20, 0x48, 0x5d, 0x48,
-  0xf5, 0x48, 0x5d, 0x4b, 0xaa, 0x4b, 0xd8, 0x4b, 0x5d, 0x4a, 0xe7, 0x4a,
-  0x71, 0x4d, 0x97, 0x4d, 0x50, 0x4c, 0xea, 0x4c, 0x70, 0x4f, 0xfa, 0x4f,
-  0x7e, 0x4e, 0xd0, 0x4e, 0x3a, 0x51, 0xba, 0x51, 0x22, 0x50, 0xa9, 0x50,
-  0x2c, 0x53, 0xc9, 0x53, 0x15, 0x52, 0x84, 0x52, 0x67, 0x55, 0xf1, 0x55,
-  0x35, 0x54, 0xde, 0x54, 0xab, 0x57, 0x08, 0x56, 0xe4, 0x56, 0x5d, 0x59,
-  0x50, 0x58, 0x82, 0x58, 0x75, 0x5b, 0xce, 0x5b, 0xb0, 0x5a, 0x67, 0x5d,
-  0xe6, 0x5d, 0xa4, 0x5c, 0x61, 0x5f, 0xc9, 0x5f, 0x84, 0x5e, 0x2d, 0x61,
-  0x08, 0x60, 0xf2, 0x60, 0xb3, 0x63, 0x7e, 0x62, 0xd4, 0x65, 0xcc, 0x65,
-  0xbf, 0x64, 0x68, 0x67, 0x64, 0x66, 0xec, 0x66, 0x82, 0x69, 0x40, 0x68,
-  0x34, 0x6b, 0x2c, 0x6a, 0xde, 0x6a, 0xcd, 0x6d, 0xa5, 0x6c, 0x1d, 0x6f,
-  0x77, 0x6e, 0x07, 0x71, 0x3d, 0x70, 0xd1, 0x70, 0xb0, 0x73, 0x92, 0x72,
-  0xa2, 0x75, 0x0d, 0x74, 0x42, 0x77, 0x6a, 0x76, 0x7b, 0x79, 0x08, 0x78,
-  0x03, 0x7b, 0x6d, 0x7a, 0x30, 0x7d, 0x35, 0x7c, 0x31, 0x7f, 0x21, 0x7e,
-  0x74, 0x01, 0x36, 0x00, 0x3f, 0x03, 0x33, 0x02, 0x30, 0x05, 0x3f, 0x04,
-  0x1f, 0x07, 0x09, 0x06, 0x34, 0x09, 0x71, 0x08, 0x58, 0x0b, 0x48, 0x0a,
-  0xe4, 0x0d, 0x99, 0x0c, 0xff, 0x0f, 0xda, 0x0e, 0x26, 0x10, 0x55, 0x13,
-  0x64, 0x12, 0x52, 0x15, 0xe4, 0x14, 0x99, 0x17, 0xd8, 0x16, 0x20, 0x18,
-  0x34, 0x1b, 0x53, 0x1a, 0x91, 0x1d, 0xf8, 0x1c, 0x28, 0x1e, 0x69, 0x21,
-  0xfe, 0x20, 0x9f, 0x23, 0x5e, 0x25, 0x41, 0x24, 0xb8, 0x27, 0xf8, 0x26,
-  0x64, 0x28, 0x6b, 0x2b, 0x9c, 0x2a, 0xca, 0x2d, 0x7b, 0x2f, 0xb7, 0x2e,
-  0x90, 0x31, 0x02, 0x33, 0xa2, 0x32, 0x9d, 0x35, 0x64, 0x37, 0x9d, 0x36,
-  0x3d, 0x38, 0x46, 0x3b, 0xb0, 0x3a, 0x0f, 0x3c, 0xab, 0x3f, 0xc2, 0x3e,
-  0x5d, 0x40, 0xa5, 0x43, 0x7d, 0x45, 0x96, 0x44, 0x50, 0x46, 0xac, 0x49,
-  0x64, 0x4b, 0xb1, 0x4a, 0x31, 0x4c, 0xa7, 0x4f, 0x33, 0x51, 0xb0, 0x50,
-  0x70, 0x52, 0xb0, 0x55, 0x2b, 0x57, 0xbe, 0x56, 0x11, 0x58, 0x8c, 0x5b,
-  0x77, 0x5d, 0xa5, 0x5c, 0x54, 0x5e, 0xc8, 0x61, 0xb4, 0x63, 0x14, 0x65,
-  0xf3, 0x64, 0x41, 0x66, 0x3d, 0x68, 0x9b, 0x6b, 0x77, 0x6d, 0x9d, 0x6c,
-  0xa5, 0x6e, 0x4d, 0x70, 0x97, 0x73, 0xe8, 0x75, 0x33, 0x77, 0x85, 0x76,
-  0x83, 0x78, 0x74, 0x7a, 0x29, 0x7c, 0xff, 0x7f, 0xbf, 0x01, 0x79, 0x03,
-  0x7a, 0x05, 0x90, 0x04, 0xbe, 0x06, 0x72, 0x08, 0x36, 0x0a, 0xf9, 0x0d,
-  0x98, 0x0f, 0x21, 0x11, 0x71, 0x13, 0x24, 0x15, 0xc3, 0x14, 0x99, 0x16,
-  0xc1, 0x18, 0x4e, 0x1a, 0x7f, 0x1c, 0x00, 0x1e, 0x20, 0x20, 0xdd, 0x23,
-  0x94, 0x25, 0x8a, 0x27, 0xa1, 0x29, 0x5e, 0x2b, 0x44, 0x2d, 0x0f, 0x2f,
-  0x42, 0x31, 0x04, 0x33, 0x05, 0x35, 0x21, 0x37, 0x30, 0x39, 0x7d, 0x3b,
-  0x1c, 0x3d, 0x3a, 0x3f, 0x37, 0x41, 0x3e, 0x43, 0xd3, 0x45, 0x04, 0x47,
-  0x2b, 0x49, 0x38, 0x4b, 0x50, 0x4d, 0x04, 0x4f, 0x66, 0x51, 0x60, 0x53,
-  0x10, 0x55, 0x44, 0x57, 0xaa, 0x59, 0xdd, 0x5b, 0xf1, 0x5d, 0x95, 0x5f,
-  0x33, 0x60, 0x07, 0x62, 0x79, 0x64, 0x59, 0x66, 0xe4, 0x68, 0x82, 0x6a,
-  0xd6, 0x6c, 0x65, 0x71, 0x66, 0x73, 0x4a, 0x75, 0x9f, 0x77, 0xe0, 0x79,
-  0x37, 0x7a, 0x3d, 0x7c, 0xa4, 0x7e, 0xfd, 0x00, 0x35, 0x05, 0x61, 0x07,
-  0xf0, 0x09, 0xfe, 0x0b, 0x2b, 0x0c, 0x63, 0x0e, 0x84, 0x10, 0xd7, 0x12,
-  0x7b, 0x17, 0xa9, 0x19, 0x90, 0x1b, 0x19, 0x1c, 0xac, 0x1e, 0xd8, 0x20,
-  0x30, 0x25, 0x91, 0x27, 0x3b, 0x28, 0x5a, 0x2a, 0xe2, 0x2c, 0x5d, 0x31,
-  0xb0, 0x33, 0xc2, 0x35, 0x10, 0x36, 0xf1, 0x38, 0x7c, 0x3d, 0x80, 0x3f,
-  0x50, 0x40, 0xbb, 0x42, 0x25, 0x47, 0xa8, 0x49, 0x3c, 0x4a, 0xa1, 0x4c,
-  0x7a, 0x51, 0xdf, 0x53, 0x5a, 0x54, 0x89, 0x56, 0x2c, 0x5b, 0xa8, 0x5d,
-  0x50, 0x5e, 0x83, 0x60, 0x78, 0x65, 0xea, 0x67, 0x5f, 0x68, 0xdf, 0x6a,
-  0xe4, 0x6f, 0x12, 0x70, 0xf6, 0x72, 0x15, 0x77, 0x20, 0x78, 0x9d, 0x7a,
-  0x79, 0x7f, 0xce, 0x01, 0xe4, 0x02, 0x1f, 0x07, 0xdf, 0x09, 0xaa, 0x0a,
-  0x79, 0x0f, 0x85, 0x11, 0x99, 0x12, 0x7e, 0x17, 0x64, 0x18, 0xfc, 0x1a,
-  0xf0, 0x1f, 0x79, 0x20, 0x35, 0x25, 0xe7, 0x27, 0xb7, 0x28, 0x78, 0x2d,
-  0x64, 0x2e, 0xe0, 0x30, 0x9f, 0x35, 0x56, 0x36, 0x75, 0x3b, 0x2c, 0x3c,
-  0xd3, 0x3e, 0xcd, 0x43, 0xa0, 0x44, 0x58, 0x49, 0x60, 0x4a, 0x1c, 0x4f,
-  0x37, 0x50, 0xc1, 0x52, 0xf9, 0x57, 0x93, 0x58, 0xa3, 0x5d, 0x0d, 0x5e,
-  0x44, 0x63, 0x6d, 0x64, 0x71, 0x69, 0x45, 0x6a, 0x1e, 0x6f, 0x38, 0x70,
-  0x29, 0x75, 0x3f, 0x76, 0x35, 0x7b, 0x27, 0x7c, 0x74, 0x01, 0x72, 0x02,
-  0x61, 0x07, 0x65, 0x08, 0x63, 0x0d, 0x63, 0x0e, 0x75, 0x13, 0x0b, 0x14,
-  0x7b, 0x19, 0x77, 0x1a, 0x44, 0x1f, 0x45, 0x20, 0xc1, 0x25, 0x8e, 0x26,
-  0xff, 0x2b, 0xc0, 0x2c, 0x20, 0x30, 0x1d, 0x35, 0x14, 0x36, 0x4a, 0x3b,
-  0xa1, 0x3c, 0x9e, 0x41, 0xc4, 0x42, 0x54, 0x46, 0x42, 0x4b, 0x44, 0x4c,
-  0x85, 0x51, 0xe1, 0x52, 0x30, 0x56, 0x3d, 0x5b, 0x91, 0x5c, 0xfb, 0x61,
-  0x20, 0x65, 0x70, 0x66, 0xb3, 0x6b, 0xf5, 0x6c, 0x25, 0x70, 0x60, 0x75,
-  0x92, 0x76, 0xc0, 0x7b, 0x66, 0x7f, 0x55, 0x00, 0xe9, 0x05, 0x02, 0x09,
-  0xb1, 0x0a, 0x9d, 0x0f, 0x71, 0x13, 0x87, 0x14, 0x31, 0x18, 0x15, 0x1d,
-  0xf9, 0x1e, 0x13, 0x22, 0xe4, 0x27, 0xd9, 0x28, 0x58, 0x2c, 0xe0, 0x31,
-  0x34, 0x35, 0x84, 0x36, 0x1e, 0x3a, 0xb9, 0x3f, 0x21, 0x43, 0xbe, 0x44,
-  0x38, 0x48, 0xb4, 0x4d, 0x39, 0x51, 0xb7, 0x52, 0x35, 0x56, 0xaf, 0x5b,
-  0x64, 0x5f, 0xb9, 0x60, 0x1f, 0x64, 0xc5, 0x69, 0x75, 0x6d, 0xa5, 0x6e,
-  0x57, 0x72, 0xdf, 0x77, 0xad, 0x7b, 0x19, 0x7f, 0xb0, 0x00, 0x5a, 0x04,
-  0x32, 0x08, 0xd5, 0x0d, 0x62, 0x11, 0xd2, 0x12, 0xab, 0x16, 0x00, 0x1a,
-  0xc3, 0x1f, 0xe5, 0x23, 0x60, 0x27, 0xcd, 0x28, 0x91, 0x2c, 0x79, 0x30,
-  0x64, 0x34, 0xfe, 0x39, 0xbf, 0x3d, 0x7b, 0x41, 0x20, 0x45, 0xe7, 0x46,
-  0xbf, 0x4a, 0x71, 0x4e, 0x64, 0x52, 0xf9, 0x57, 0x98, 0x5b, 0x40, 0x5f,
-  0x34, 0x63, 0x21, 0x67, 0xdf, 0x68, 0x82, 0x6c, 0xb6, 0x70, 0x1d, 0x74,
-  0x64, 0x78, 0x1a, 0x7c, 0x74, 0x00, 0xc1, 0x05, 0xf8, 0x09, 0x98, 0x0d,
-  0xe4, 0x11, 0x5b, 0x15, 0x51, 0x19, 0x70, 0x1d, 0x78, 0x21, 0x11, 0x25,
-  0x5e, 0x29, 0x6d, 0x2d, 0x64, 0x31, 0x04, 0x35, 0x3f, 0x39, 0x20, 0x3d,
-  0x74, 0x41, 0x3b, 0x45, 0x3f, 0x49, 0x29, 0x4d, 0x2d, 0x51, 0x2e, 0x55,
-  0x15, 0x59, 0x45, 0x5d, 0x60, 0x61, 0x6d, 0x65, 0x55, 0x69, 0x0d, 0x6d,
-  0xaa, 0x71, 0x88, 0x75, 0xfd, 0x79, 0xd7, 0x7d, 0x31, 0x00, 0x07, 0x04,
-  0x30, 0x08, 0x1a, 0x0c, 0xf6, 0x10, 0xdf, 0x14, 0x97, 0x18, 0x65, 0x1f,
-  0x7d, 0x23, 0x56, 0x27, 0xd0, 0x2b, 0xee, 0x2f, 0x25, 0x32, 0x6f, 0x36,
-  0xa6, 0x3a, 0xf0, 0x3e, 0x30, 0x45, 0x35, 0x49, 0xb9, 0x4d, 0xf3, 0x51,
-  0x30, 0x54, 0x62, 0x58, 0xd0, 0x5c, 0xd1, 0x60, 0x7c, 0x67, 0xa0, 0x6b,
-  0x90, 0x6f, 0x02, 0x72, 0xb6, 0x76, 0xdf, 0x7a, 0x37, 0x01, 0x86, 0x05,
-  0x74, 0x08, 0x45, 0x0c, 0xf5, 0x10, 0x19, 0x17, 0xa1, 0x1b, 0xde, 0x1f,
-  0x44, 0x22, 0xe4, 0x26, 0x78, 0x2d, 0xcb, 0x31, 0x75, 0x34, 0xa3, 0x38,
-  0x2b, 0x3f, 0xaf, 0x43, 0x24, 0x46, 0xbd, 0x4a, 0x50, 0x51, 0xb0, 0x55,
-  0x31, 0x58, 0xae, 0x5c, 0x30, 0x63, 0xc8, 0x67, 0x03, 0x6a, 0x8a, 0x6e,
-  0x61, 0x75, 0xf1, 0x79, 0x58, 0x7c, 0xa7, 0x00, 0x92, 0x07, 0x1c, 0x0a,
-  0xe5, 0x0e, 0x59, 0x15, 0x20, 0x18, 0xd5, 0x1c, 0x5c, 0x23, 0xd2, 0x27,
-  0xa7, 0x2a, 0x06, 0x31, 0x30, 0x35, 0x9c, 0x38, 0x7b, 0x3f, 0xd0, 0x43,
-  0xd0, 0x46, 0x6c, 0x4d, 0x36, 0x50, 0xf8, 0x54, 0xf0, 0x5b, 0x7c, 0x5e,
-  0x3a, 0x65, 0xb5, 0x69, 0xb1, 0x6c, 0x3d, 0x73, 0x23, 0x76, 0xff, 0x7a,
-  0x99, 0x01, 0x41, 0x04, 0x34, 0x0b, 0x2a, 0x0e, 0xd6, 0x12, 0xcd, 0x19,
-  0xb6, 0x1c, 0x52, 0x23, 0x7f, 0x26, 0x18, 0x2d, 0x27, 0x30, 0x95, 0x34,
-  0xe4, 0x3b, 0x95, 0x3e, 0xa5, 0x45, 0x59, 0x48, 0x10, 0x4f, 0x66, 0x52,
-  0x7b, 0x59, 0x0b, 0x5c, 0x04, 0x63, 0x3f, 0x66, 0x2b, 0x6d, 0x31, 0x70,
-  0x70, 0x77, 0x21, 0x7a, 0x3c, 0x01, 0x30, 0x04, 0x70, 0x0b, 0x39, 0x0e,
-  0x2b, 0x15, 0x22, 0x18, 0x02, 0x1f, 0x45, 0x22, 0x60, 0x29, 0x6a, 0x2c,
-  0x10, 0x33, 0x59, 0x36, 0xac, 0x3d, 0x98, 0x40, 0xb0, 0x47, 0xc3, 0x4a,
-  0x35, 0x50, 0x00, 0x57, 0x7c, 0x5a, 0x49, 0x61, 0xea, 0x64, 0xe7, 0x6b,
-  0xba, 0x6e, 0x11, 0x74, 0x7c, 0x7b, 0x40, 0x7e, 0xd0, 0x05, 0xeb, 0x08,
-  0x28, 0x0e, 0x72, 0x15, 0xbf, 0x18, 0xe7, 0x1f, 0x74, 0x25, 0x7a, 0x28,
-  0xb6, 0x2f, 0xbd, 0x32, 0x30, 0x38, 0x65, 0x3f, 0x99, 0x42, 0xd6, 0x49,
-  0x34, 0x4f, 0xb7, 0x52, 0xdf, 0x59, 0x02, 0x5f, 0xa9, 0x62, 0x9d, 0x69,
-  0x79, 0x6f, 0x86, 0x72, 0x74, 0x78, 0x54, 0x7f, 0xb0, 0x02, 0x11, 0x08,
-  0xa5, 0x0f, 0xdf, 0x12, 0x57, 0x18, 0xe0, 0x1f, 0x34, 0x25, 0x88, 0x28,
-  0x1f, 0x2e, 0xbe, 0x35, 0x25, 0x3b, 0xb4, 0x3e, 0x33, 0x44, 0xf5, 0x4b,
-  0x30, 0x51, 0xb0, 0x54, 0x20, 0x5a, 0xb4, 0x61, 0x27, 0x67, 0xb9, 0x6a,
-  0x19, 0x70, 0x8b, 0x77, 0x73, 0x7d, 0xa5, 0x00, 0x51, 0x06, 0x8d, 0x0d,
-  0xe3, 0x13, 0x50, 0x19, 0xb7, 0x1c, 0x15, 0x22, 0x27, 0x28, 0x8c, 0x2f,
-  0x7d, 0x35, 0xdf, 0x38, 0xab, 0x3e, 0x01, 0x44, 0x9e, 0x4b, 0xc0, 0x51,
-  0x7a, 0x57, 0xca, 0x5a, 0x82, 0x60, 0x79, 0x66, 0x2c, 0x6c, 0x99, 0x73,
-  0xb5, 0x79, 0x74, 0x7f, 0x27, 0x05, 0xe1, 0x08, 0xd4, 0x0e, 0x6a, 0x14,
-  0x21, 0x1a, 0xfe, 0x21, 0x84, 0x27, 0x2f, 0x2d, 0x42, 0x33, 0x24, 0x39,
-  0xc5, 0x3c, 0x81, 0x42, 0xb0, 0x48, 0x1d, 0x4e, 0x5c, 0x54, 0x1a, 0x5a,
-  0x37, 0x60, 0xde, 0x67, 0x12, 0x6d, 0xa4, 0x73, 0xab, 0x79, 0x58, 0x7f,
-  0x10, 0x05, 0x64, 0x0b, 0x66, 0x11, 0x00, 0x17, 0x50, 0x1d, 0x24, 0x23,
-  0x2a, 0x29, 0x7d, 0x2f, 0x31, 0x35, 0x75, 0x3b, 0x33, 0x41, 0x27, 0x47,
-  0x39, 0x4d, 0x39, 0x53, 0x64, 0x59, 0x22, 0x5f, 0x16, 0x65, 0x45, 0x6b,
-  0x66, 0x71, 0x6a, 0x77, 0x5f, 0x7d, 0x40, 0x03, 0xb7, 0x09, 0xdd, 0x0f,
-  0xe4, 0x15, 0xdd, 0x1b, 0x35, 0x20, 0x01, 0x26, 0x30, 0x2c, 0x5e, 0x32,
-  0xab, 0x38, 0x83, 0x3e, 0xc4, 0x44, 0x37, 0x4d, 0x7b, 0x53, 0x49, 0x59,
-  0xd0, 0x5f, 0xf9, 0x65, 0x2c, 0x6a, 0x78, 0x70, 0xf0, 0x76, 0xf1, 0x7c,
-  0x3b, 0x05, 0x7a, 0x0b, 0xa2, 0x11, 0xbd, 0x17, 0x30, 0x1c, 0x62, 0x22,
-  0xd0, 0x28, 0xd1, 0x2e, 0x7c, 0x37, 0xa0, 0x3d, 0x90, 0x43, 0x1b, 0x48,
-  0xa5, 0x4e, 0xc8, 0x54, 0x7c, 0x5d, 0x81, 0x63, 0x7a, 0x68, 0x3f, 0x6e,
-  0x9a, 0x74, 0x29, 0x7d, 0xac, 0x03, 0xc8, 0x09, 0x10, 0x0e, 0xe3, 0x14,
-  0x78, 0x1d, 0x8a, 0x23, 0x1f, 0x28, 0xbf, 0x2e, 0x64, 0x37, 0xb2, 0x3d,
-  0x36, 0x42, 0xf5, 0x48, 0x20, 0x51, 0xbd, 0x57, 0x39, 0x5c, 0xae, 0x62,
-  0x64, 0x6b, 0xbf, 0x71, 0x1f, 0x76, 0x8a, 0x7c, 0x79, 0x05, 0xa5, 0x0b,
-  0x59, 0x10, 0xde, 0x16, 0xe4, 0x1f, 0x1c, 0x24, 0xb0, 0x2a, 0x59, 0x33,
-  0x35, 0x38, 0x87, 0x3e, 0x77, 0x47, 0xd8, 0x4d, 0xe4, 0x52, 0x00, 0x5b,
-  0xdf, 0x61, 0xb6, 0x66, 0x75, 0x6f, 0xcc, 0x75, 0x93, 0x7a, 0x2d, 0x03,
-  0x20, 0x08, 0xf8, 0x0e, 0xa0, 0x17, 0x7c, 0x1c, 0x37, 0x25, 0xe1, 0x2b,
-  0xb9, 0x30, 0x73, 0x39, 0x23, 0x3e, 0xad, 0x44, 0x84, 0x4d, 0x4d, 0x52,
-  0x71, 0x5b, 0x65, 0x60, 0xde, 0x66, 0x98, 0x6f, 0xa9, 0x74, 0x5f, 0x7d,
-  0x75, 0x02, 0x07, 0x0b, 0x74, 0x10, 0x92, 0x16, 0xa9, 0x1f, 0xda, 0x24,
-  0xea, 0x2d, 0x28, 0x32, 0x5e, 0x3b, 0x6a, 0x40, 0x66, 0x49, 0x11, 0x4e,
-  0x18, 0x57, 0x49, 0x5c, 0x21, 0x65, 0x3c, 0x6a, 0x23, 0x73, 0x21, 0x78,
-  0x50, 0x01, 0x22, 0x06, 0x35, 0x0f, 0x2e, 0x14, 0x30, 0x1d, 0x47, 0x22,
-  0x26, 0x2b, 0x04, 0x30, 0x61, 0x39, 0x69, 0x3e, 0x44, 0x47, 0x0d, 0x4c,
-  0x88, 0x55, 0x92, 0x5a, 0xf3, 0x63, 0xde, 0x68, 0xd4, 0x70, 0x2c, 0x79,
-  0x7f, 0x7e, 0x48, 0x07, 0xe4, 0x0c, 0x8c, 0x15, 0xc2, 0x1a, 0x20, 0x22,
-  0x34, 0x2b, 0x4c, 0x30, 0x9e, 0x39, 0xad, 0x3e, 0x25, 0x46, 0x3d, 0x4f,
-  0xb7, 0x54, 0xe7, 0x5d, 0x3d, 0x65, 0x71, 0x6a, 0xf0, 0x73, 0xf2, 0x78,
-  0x22, 0x00, 0x2d, 0x09, 0x82, 0x0e, 0xca, 0x17, 0x7b, 0x1f, 0xa8, 0x24,
-  0xc3, 0x2d, 0x4d, 0x35, 0xb0, 0x3a, 0xd5, 0x43, 0x71, 0x4b, 0x81, 0x50,
-  0x74, 0x58, 0x56, 0x61, 0xff, 0x66, 0x13, 0x6e, 0xb0, 0x77, 0xdf, 0x7c,
-  0x5f, 0x04, 0xe9, 0x0d, 0x34, 0x15, 0x91, 0x1a, 0x18, 0x22, 0xa8, 0x2b,
-  0x64, 0x33, 0xb9, 0x38, 0x3f, 0x40, 0xba, 0x49, 0x26, 0x51, 0xf5, 0x56,
-  0x24, 0x5e, 0xb2, 0x67, 0x64, 0x6f, 0xb9, 0x74, 0x18, 0x7c, 0x80, 0x05,
-  0x34, 0x0d, 0xf3, 0x12, 0x51, 0x1a, 0xd8, 0x23, 0xa8, 0x2b, 0x09, 0x33,
-  0xbe, 0x38, 0x3f, 0x40, 0x5e, 0x48, 0xa1, 0x51, 0x78, 0x59, 0xd8, 0x5e,
-  0xe4, 0x66, 0x0b, 0x6e, 0xdc, 0x77, 0xaa, 0x7f, 0x7b, 0x07, 0xd7, 0x0c,
-  0xd0, 0x14, 0x62, 0x1c, 0x22, 0x24, 0xbd, 0x2d, 0xa4, 0x35, 0x7d, 0x3d,
-  0x3d, 0x45, 0xe6, 0x4a, 0xf0, 0x52, 0x6f, 0x5a, 0x2b, 0x62, 0xe2, 0x6b,
-  0x9d, 0x73, 0x05, 0x7b, 0x7d, 0x03, 0x36, 0x0b, 0x90, 0x10, 0x8c, 0x18,
-  0xe4, 0x20, 0x51, 0x28, 0x71, 0x30, 0x07, 0x38, 0x33, 0x40, 0xd0, 0x49,
-  0xb0, 0x51, 0x90, 0x59, 0xab, 0x61, 0x5e, 0x69, 0x51, 0x71, 0x6c, 0x79,
-  0x77, 0x01, 0x45, 0x09, 0x14, 0x11, 0x28, 0x19, 0x34, 0x21, 0x34, 0x29,
-  0x33, 0x31, 0x21, 0x39, 0x3d, 0x41, 0x3b, 0x49, 0x37, 0x51, 0x7d, 0x59,
-  0x25, 0x61, 0x6d, 0x69, 0x57, 0x71, 0x4f, 0x79, 0x33, 0x01, 0x25, 0x09,
-  0x43, 0x11, 0x54, 0x19, 0xa9, 0x21, 0x9f, 0x29, 0xff, 0x31, 0xd9, 0x39,
-  0x7a, 0x40, 0x70, 0x48, 0x7e, 0x50, 0x52, 0x58, 0xb6, 0x60, 0x99, 0x68,
-  0xd8, 0x70, 0x41, 0x7b, 0x63, 0x03, 0x40, 0x0b, 0x83, 0x13, 0xf9, 0x1b,
-  0x41, 0x22, 0x4b, 0x2a, 0xb1, 0x32, 0xe0, 0x3a, 0x38, 0x45, 0x61, 0x4d,
-  0x04, 0x55, 0xc9, 0x5d, 0x2c, 0x64, 0x64, 0x6c, 0x83, 0x74, 0x85, 0x7c,
-  0x62, 0x07, 0xa4, 0x0f, 0xc5, 0x17, 0x01, 0x1e, 0xb0, 0x26, 0x9d, 0x2e,
-  0x73, 0x39, 0x9a, 0x41, 0x3a, 0x48, 0x41, 0x50, 0xf1, 0x58, 0x14, 0x63,
-  0xaa, 0x6b, 0xde, 0x73, 0x10, 0x7a, 0xec, 0x02, 0x7a, 0x0d, 0x86, 0x15,
-  0x02, 0x1c, 0xa8, 0x24, 0x20, 0x2f, 0xb4, 0x37, 0x32, 0x3e, 0xb9, 0x46,
-  0x31, 0x51, 0xf5, 0x59, 0x22, 0x60, 0xb4, 0x68, 0x27, 0x73, 0xa5, 0x7b,
-  0x15, 0x02, 0x96, 0x0a, 0x35, 0x15, 0xa5, 0x1d, 0x10, 0x24, 0xfd, 0x2c,
-  0xad, 0x37, 0x11, 0x3e, 0xf5, 0x46, 0x46, 0x51, 0x74, 0x58, 0x9a, 0x60,
-  0x76, 0x6b, 0x9d, 0x73, 0xa3, 0x7a, 0x02, 0x05, 0xdc, 0x0d, 0xa1, 0x14,
-  0x34, 0x1f, 0xc4, 0x27, 0x9e, 0x2e, 0x69, 0x39, 0x64, 0x40, 0xed, 0x48,
-  0xbc, 0x53, 0x74, 0x5a, 0x20, 0x65, 0xfc, 0x6d, 0xbe, 0x74, 0x68, 0x7f,
-  0x29, 0x06, 0xad, 0x0e, 0x93, 0x19, 0x4a, 0x20, 0x7d, 0x2b, 0x2b, 0x32,
-  0xc3, 0x3a, 0xcd, 0x45, 0xb7, 0x4c, 0x48, 0x57, 0x62, 0x5e, 0x07, 0x69,
-  0x3b, 0x70, 0xc0, 0x78, 0xfe, 0x03, 0x99, 0x0a, 0xe4, 0x15, 0x54, 0x1c,
-  0x5f, 0x27, 0x70, 0x2e, 0x38, 0x39, 0x45, 0x40, 0x11, 0x4b, 0x23, 0x52,
-  0x20, 0x5d, 0x7d, 0x64, 0x24, 0x6f, 0x3d, 0x76, 0x31, 0x01, 0x75, 0x08,
-  0x27, 0x13, 0x3c, 0x1a, 0x28, 0x25, 0x21, 0x2c, 0x03, 0x37, 0x45, 0x3e,
-  0x75, 0x49, 0x77, 0x50, 0x55, 0x5b, 0x0d, 0x62, 0xa5, 0x6d, 0x99, 0x74,
-  0xff, 0x7f, 0xc7, 0x06, 0x3a, 0x10, 0x10, 0x1b, 0x74, 0x22, 0x1d, 0x2d,
-  0xb3, 0x34, 0x84, 0x3f, 0xc4, 0x46, 0x2d, 0x50, 0x34, 0x5b, 0x51, 0x62,
-  0x9f, 0x6d, 0xfd, 0x74, 0x25, 0x7e, 0x67, 0x09, 0xb5, 0x10, 0xe6, 0x1b,
-  0x78, 0x25, 0x35, 0x2c, 0xa2, 0x37, 0xe8, 0x3e, 0x26, 0x48, 0x64, 0x53,
-  0x95, 0x5a, 0xd6, 0x65, 0x38, 0x6f, 0xe5, 0x76, 0xc3, 0x01, 0x0c, 0x0b,
-  0xb4, 0x12, 0xcd, 0x1d, 0x78, 0x27, 0x9c, 0x2e, 0x26, 0x38, 0x50, 0x43,
-  0xe3, 0x4a, 0x51, 0x54, 0xe4, 0x5f, 0xc8, 0x66, 0x5d, 0x70, 0xe0, 0x7b,
-  0x66, 0x05, 0x84, 0x0c, 0x1c, 0x16, 0xa9, 0x21, 0x37, 0x2b, 0xf1, 0x32,
-  0x70, 0x3c, 0xba, 0x47, 0x24, 0x51, 0xb4, 0x58, 0x3c, 0x62, 0xae, 0x6d,
-  0x68, 0x77, 0xed, 0x7e, 0x14, 0x08, 0x8c, 0x13, 0x78, 0x1d, 0xec, 0x24,
-  0x44, 0x2e, 0xc5, 0x39, 0xad, 0x43, 0x08, 0x4d, 0xfd, 0x54, 0x15, 0x5e,
-  0x37, 0x68, 0x87, 0x73, 0x69, 0x7d, 0xce, 0x04, 0xb0, 0x0e, 0x0c, 0x18,
-  0xdc, 0x23, 0xb6, 0x2d, 0x38, 0x37, 0x85, 0x3e, 0x95, 0x48, 0x61, 0x52,
-  0x21, 0x5c, 0xef, 0x67, 0xb9, 0x71, 0x60, 0x7b, 0x39, 0x05, 0xb8, 0x0c,
-  0xe1, 0x16, 0x2c, 0x20, 0x71, 0x2a, 0xa1, 0x35, 0xd0, 0x3f, 0x44, 0x49,
-  0x7a, 0x53, 0x21, 0x5d, 0x90, 0x64, 0x98, 0x6e, 0xaa, 0x78, 0x52, 0x02,
-  0x72, 0x0c, 0x01, 0x16, 0x35, 0x20, 0xdc, 0x2b, 0xfe, 0x35, 0x94, 0x3f,
-  0xb1, 0x49, 0x40, 0x53, 0x1e, 0x5d, 0x00, 0x67, 0x78, 0x71, 0x00, 0x7b,
-  0x11, 0x05, 0x3b, 0x0f, 0x21, 0x19, 0x42, 0x23, 0x16, 0x2d, 0x20, 0x37,
-  0x39, 0x41, 0x37, 0x4b, 0x3c, 0x55, 0x34, 0x5f, 0x2a, 0x69, 0x2a, 0x73,
-  0x50, 0x7d, 0x04, 0x07, 0x66, 0x11, 0x6a, 0x1b, 0x45, 0x25, 0x43, 0x2f,
-  0xa0, 0x39, 0xdd, 0x43, 0xf9, 0x4d, 0xdb, 0x57, 0x74, 0x60, 0x01, 0x6a,
-  0x78, 0x74, 0x58, 0x7e, 0xe4, 0x08, 0x89, 0x12, 0xd1, 0x1c, 0x37, 0x29,
-  0x7f, 0x33, 0x4b, 0x3d, 0x95, 0x47, 0xfe, 0x51, 0x37, 0x5a, 0x7e, 0x64,
-  0x87, 0x6e, 0xfc, 0x78, 0x20, 0x05, 0x7d, 0x0f, 0xbf, 0x19, 0xe8, 0x23,
-  0x30, 0x2c, 0x2d, 0x36, 0x91, 0x40, 0x85, 0x4a, 0x67, 0x57, 0xaa, 0x61,
-  0xc5, 0x6b, 0x1f, 0x74, 0xa7, 0x7e, 0xd8, 0x08, 0x30, 0x15, 0x9a, 0x1f,
-  0x32, 0x28, 0x15, 0x32, 0xfc, 0x3c, 0x14, 0x49, 0xa3, 0x53, 0xc5, 0x5d,
-  0x44, 0x66, 0xa9, 0x70, 0x34, 0x7d, 0x9c, 0x07, 0x1f, 0x10, 0xb8, 0x1a,
-  0x64, 0x27, 0xb5, 0x31, 0x31, 0x3a, 0xa3, 0x44, 0x31, 0x51, 0xf5, 0x5b,
-  0x32, 0x64, 0xb8, 0x6e, 0x27, 0x7b, 0xa2, 0x05, 0x1d, 0x0e, 0x80, 0x18,
-  0x34, 0x25, 0xed, 0x2f, 0x5f, 0x38, 0xdd, 0x42, 0xa1, 0x4f, 0x11, 0x58,
-  0xf5, 0x62, 0x46, 0x6f, 0x27, 0x78, 0x99, 0x02, 0x69, 0x0f, 0x9d, 0x19,
-  0xa8, 0x22, 0x02, 0x2f, 0xc3, 0x39, 0xb1, 0x42, 0x34, 0x4f, 0xc4, 0x59,
-  0x9e, 0x62, 0x69, 0x6f, 0x64, 0x78, 0xfc, 0x02, 0xa2, 0x0f, 0x70, 0x18,
-  0x74, 0x25, 0xf3, 0x2f, 0xa5, 0x38, 0x70, 0x45, 0x26, 0x4e, 0xe1, 0x58,
-  0x99, 0x65, 0x4b, 0x6e, 0x73, 0x7b, 0x65, 0x04, 0xd1, 0x0e, 0x9f, 0x1b,
-  0xab, 0x24, 0x48, 0x31, 0x7e, 0x3a, 0x11, 0x47, 0x74, 0x50, 0xdc, 0x5a,
-  0xfe, 0x67, 0xdd, 0x70, 0xb0, 0x7d, 0x45, 0x06, 0x55, 0x13, 0x25, 0x1c,
-  0x70, 0x29, 0x04, 0x32, 0x02, 0x3f, 0x26, 0x48, 0x2a, 0x55, 0x38, 0x5e,
-  0x23, 0x6b, 0x26, 0x74, 0x7a, 0x01, 0x52, 0x0a, 0x36, 0x17, 0x32, 0x20,
-  0x36, 0x2d, 0x3a, 0x36, 0x11, 0x43, 0x17, 0x4c, 0x70, 0x59, 0x01, 0x62,
-  0x52, 0x6f, 0x4c, 0x78, 0xa7, 0x05, 0x96, 0x0e, 0x8f, 0x1b, 0xf3, 0x24,
-  0x21, 0x30, 0x18, 0x3d, 0x72, 0x46, 0x51, 0x53, 0xad, 0x5c, 0x83, 0x69,
-  0xd7, 0x72, 0x65, 0x7e, 0x75, 0x0b, 0x57, 0x14, 0x9f, 0x21, 0xf8, 0x2a,
-  0x2a, 0x36, 0x79, 0x43, 0xf0, 0x4c, 0xfc, 0x59, 0x3a, 0x65, 0x35, 0x6e,
-  0xa4, 0x7b, 0xf5, 0x04, 0x21, 0x10, 0x2d, 0x1d, 0x94, 0x26, 0xc4, 0x33,
-  0x66, 0x3f, 0xae, 0x48, 0xde, 0x55, 0x08, 0x61, 0xb7, 0x6a, 0xce, 0x77,
-  0x4e, 0x03, 0xac, 0x0c, 0x3b, 0x18, 0x40, 0x25, 0xb0, 0x2e, 0x1e, 0x3a,
-  0xa5, 0x47, 0xc3, 0x50, 0x17, 0x5c, 0xf1, 0x69, 0x34, 0x75, 0x96, 0x7e,
-  0x15, 0x0a, 0xa8, 0x17, 0x29, 0x23, 0xfd, 0x2c, 0x24, 0x38, 0xba, 0x45,
-  0x74, 0x51, 0xb3, 0x5a, 0x39, 0x66, 0xb3, 0x73, 0x20, 0x7f, 0xed, 0x08,
-  0x09, 0x14, 0x8a, 0x21, 0x61, 0x2d, 0xf7, 0x36, 0x10, 0x42, 0xda, 0x4f,
-  0xa5, 0x5b, 0x04, 0x67, 0xbe, 0x70, 0x15, 0x7c, 0x74, 0x08, 0xbd, 0x15,
-  0x7f, 0x21, 0xca, 0x2a, 0xa1, 0x36, 0x1b, 0x42, 0xd5, 0x4f, 0xb7, 0x5b,
-  0x38, 0x67, 0x85, 0x70, 0x89, 0x7c, 0x62, 0x08, 0x31, 0x14, 0xbd, 0x21,
-  0xb4, 0x2d, 0x7a, 0x39, 0x74, 0x45, 0xe1, 0x4e, 0xb8, 0x5a, 0x74, 0x66,
-  0x2a, 0x72, 0xe6, 0x7f, 0xd0, 0x0b, 0x5c, 0x17, 0x7b, 0x23, 0x30, 0x2f,
-  0x90, 0x38, 0x85, 0x44, 0xa1, 0x50, 0x5c, 0x5c, 0x62, 0x68, 0x55, 0x74,
-  0x38, 0x00, 0xda, 0x0d, 0xe7, 0x19, 0xdd, 0x25, 0xa3, 0x31, 0x5f, 0x3d,
-  0x5f, 0x49, 0x72, 0x55, 0x78, 0x61, 0x0c, 0x6d, 0x1e, 0x79, 0x2a, 0x05,
-  0x64, 0x11, 0x34, 0x1d, 0x3e, 0x29, 0x75, 0x35, 0x20, 0x41, 0x3d, 0x4d,
-  0x35, 0x59, 0x7d, 0x65, 0x20, 0x71, 0x24, 0x7d, 0x03, 0x09, 0x11, 0x15,
-  0x75, 0x21, 0x6b, 0x2d, 0x53, 0x39, 0x48, 0x45, 0xea, 0x51, 0xfe, 0x5d,
-  0xe2, 0x69, 0xc0, 0x75, 0x3a, 0x00, 0x7e, 0x0c, 0x79, 0x18, 0x53, 0x24,
-  0xb2, 0x30, 0x88, 0x3c, 0xc3, 0x48, 0x31, 0x57, 0x7d, 0x63, 0x42, 0x6f,
-  0x91, 0x7b, 0xf9, 0x07, 0x21, 0x12, 0x0c, 0x1e, 0x80, 0x2a, 0xf4, 0x36,
-  0x3a, 0x45, 0x7c, 0x51, 0xb3, 0x5d, 0xf6, 0x69, 0x21, 0x74, 0x69, 0x00,
-  0xd0, 0x0c, 0xc4, 0x18, 0x7a, 0x27, 0xa1, 0x33, 0x90, 0x3f, 0x01, 0x4a,
-  0xab, 0x56, 0xce, 0x62, 0x64, 0x71, 0xbc, 0x7d, 0x00, 0x08, 0x5d, 0x14,
-  0xf5, 0x20, 0x5d, 0x2f, 0xa3, 0x3b, 0xdf, 0x47, 0x5f, 0x52, 0xf2, 0x5e,
-  0x78, 0x6d, 0x8c, 0x79, 0x1e, 0x04, 0xaa, 0x10, 0x64, 0x1f, 0xb4, 0x2b,
-  0x23, 0x36, 0xf5, 0x42, 0x33, 0x51, 0xb0, 0x5d, 0x24, 0x68, 0xa9, 0x74,
-  0x2d, 0x03, 0xa3, 0x0f, 0x17, 0x1a, 0xc5, 0x26, 0x78, 0x35, 0xea, 0x41,
-  0x45, 0x4c, 0xc9, 0x58, 0xa1, 0x67, 0x0f, 0x72, 0xbe, 0x7e, 0x15, 0x0d,
-  0x74, 0x18, 0xb1, 0x24, 0x79, 0x33, 0xd9, 0x3f, 0xe4, 0x4a, 0x24, 0x59,
-  0x90, 0x65, 0xa8, 0x70, 0x71, 0x7f, 0xcb, 0x0b, 0x84, 0x16, 0x64, 0x25,
-  0x2b, 0x30, 0xf3, 0x3c, 0xf0, 0x4b, 0x61, 0x56, 0x3c, 0x65, 0xf0, 0x71,
-  0xa2, 0x7c, 0x78, 0x0b, 0x64, 0x16, 0xec, 0x22, 0x82, 0x31, 0x40, 0x3c,
-  0x34, 0x4b, 0x02, 0x56, 0xc2, 0x62, 0x98, 0x71, 0xa1, 0x7c, 0x4e, 0x0b,
-  0x30, 0x16, 0x11, 0x25, 0x3b, 0x30, 0xc2, 0x3c, 0xfe, 0x4b, 0xdd, 0x56,
-  0xac, 0x65, 0x48, 0x70, 0x42, 0x7f, 0x60, 0x0a, 0x2b, 0x19, 0x66, 0x24,
-  0x02, 0x33, 0x38, 0x3e, 0x2a, 0x4d, 0x59, 0x58, 0x27, 0x67, 0x34, 0x72,
-  0x3d, 0x01, 0x21, 0x0c, 0x54, 0x1b, 0x35, 0x26, 0x2d, 0x35, 0x29, 0x40,
-  0x15, 0x4f, 0x60, 0x5a, 0x71, 0x69, 0x64, 0x74, 0x44, 0x03, 0x48, 0x0e,
-  0xaa, 0x1d, 0xfd, 0x28, 0x96, 0x37, 0xc1, 0x42, 0x35, 0x50, 0x17, 0x5f,
-  0x7c, 0x6a, 0x58, 0x79, 0xb0, 0x04, 0x65, 0x13, 0xe4, 0x1e, 0x2d, 0x2c,
-  0x71, 0x3b, 0x05, 0x46, 0x84, 0x55, 0xec, 0x60, 0x26, 0x6e, 0x71, 0x7d,
-  0xb5, 0x08, 0xe1, 0x17, 0x74, 0x25, 0x66, 0x30, 0xb5, 0x3f, 0xf8, 0x4a,
-  0x29, 0x58, 0x7e, 0x67, 0xd0, 0x72, 0xc4, 0x01, 0x64, 0x0f, 0xb5, 0x1a,
-  0xc2, 0x29, 0x02, 0x37, 0xb4, 0x42, 0xcf, 0x51, 0x79, 0x5f, 0x94, 0x6a,
-  0x20, 0x78, 0x50, 0x07, 0xb0, 0x12, 0x1b, 0x20, 0xab, 0x2f, 0xdf, 0x3a,
-  0x10, 0x48, 0xf0, 0x57, 0x67, 0x65, 0x80, 0x70, 0x50, 0x7e, 0xac, 0x0d,
-  0x37, 0x1b, 0xfd, 0x26, 0x31, 0x34, 0xf5, 0x43, 0x23, 0x51, 0xa7, 0x5c,
-  0x39, 0x6a, 0xa9, 0x79, 0x2d, 0x07, 0xa3, 0x12, 0x17, 0x20, 0xc5, 0x2f,
-  0x67, 0x3d, 0xf0, 0x48, 0x42, 0x56, 0xcb, 0x65, 0xa5, 0x73, 0x1e, 0x01,
-  0xf5, 0x0c, 0x15, 0x1a, 0x36, 0x28, 0x80, 0x37, 0x64, 0x45, 0x9d, 0x50,
-  0xad, 0x5e, 0x1e, 0x6c, 0x90, 0x7b, 0xb0, 0x09, 0x7a, 0x17, 0xc3, 0x22,
-  0x9f, 0x30, 0x7f, 0x3e, 0x30, 0x4c, 0xe8, 0x5b, 0xbe, 0x69, 0x74, 0x77,
-  0x20, 0x05, 0xf0, 0x10, 0xbc, 0x1e, 0x64, 0x2c, 0x64, 0x3a, 0xef, 0x49,
-  0x9c, 0x57, 0x44, 0x65, 0x7a, 0x73, 0x2e, 0x01, 0x9e, 0x0c, 0xcd, 0x1a,
-  0xe4, 0x28, 0x6d, 0x36, 0x75, 0x44, 0x07, 0x52, 0x3c, 0x60, 0xd4, 0x6f,
-  0xe0, 0x7d, 0x8e, 0x0b, 0xe4, 0x19, 0x54, 0x27, 0x5f, 0x35, 0x70, 0x43,
-  0x34, 0x51, 0x16, 0x5f, 0x18, 0x6d, 0x22, 0x7b, 0x31, 0x09, 0x31, 0x17,
-  0x34, 0x25, 0x75, 0x33, 0x01, 0x41, 0x06, 0x4f, 0x15, 0x5d, 0x7d, 0x6b,
-  0x2d, 0x79, 0x39, 0x07, 0x50, 0x15, 0x04, 0x23, 0x67, 0x31, 0x25, 0x3f,
-  0x51, 0x4d, 0x0d, 0x5b, 0xb3, 0x69, 0x8f, 0x77, 0xf9, 0x05, 0xc1, 0x13,
-  0x3d, 0x20, 0x1b, 0x2e, 0x77, 0x3c, 0x1d, 0x4a, 0xb7, 0x58, 0x98, 0x66,
-  0xc2, 0x74, 0x23, 0x05, 0x75, 0x13, 0x46, 0x21, 0x95, 0x2f, 0xa3, 0x3d,
-  0x6a, 0x4a, 0x33, 0x58, 0xdd, 0x66, 0xf0, 0x74, 0x39, 0x05, 0x65, 0x13,
-  0xa4, 0x21, 0xe4, 0x2f, 0x64, 0x3c, 0x61, 0x4a, 0x91, 0x58, 0xcb, 0x66,
-  0x60, 0x77, 0xa0, 0x05, 0xc2, 0x13, 0x03, 0x20, 0xbf, 0x2e, 0xe9, 0x3c,
-  0x78, 0x4d, 0x90, 0x5b, 0x74, 0x68, 0x59, 0x76, 0xf1, 0x04, 0x13, 0x15,
-  0xb0, 0x23, 0xc8, 0x31, 0x42, 0x3e, 0xeb, 0x4c, 0x34, 0x5d, 0x96, 0x6b,
-  0x15, 0x78, 0xa8, 0x06, 0x29, 0x17, 0xae, 0x25, 0x70, 0x32, 0xa1, 0x40,
-  0x3b, 0x51, 0xf5, 0x5f, 0x38, 0x6c, 0xbc, 0x7a, 0x32, 0x0b, 0xa8, 0x19,
-  0x50, 0x26, 0x94, 0x34, 0x61, 0x45, 0xec, 0x53, 0x44, 0x60, 0xc8, 0x6e,
-  0xe4, 0x7f, 0x1c, 0x0c, 0xb0, 0x1a, 0x57, 0x2b, 0x3d, 0x38, 0x81, 0x46,
-  0x30, 0x57, 0xd2, 0x65, 0xa2, 0x72, 0x4d, 0x03, 0xc7, 0x11, 0xa0, 0x1e,
-  0x75, 0x2f, 0xd7, 0x3d, 0xd0, 0x4a, 0x6f, 0x5b, 0x31, 0x68, 0xe9, 0x76,
-  0xf0, 0x07, 0x74, 0x14, 0x24, 0x25, 0xe5, 0x33, 0xb5, 0x40, 0x7c, 0x51,
-  0x36, 0x5e, 0xfe, 0x6c, 0xd0, 0x7d, 0x4a, 0x0a, 0x60, 0x1b, 0x2d, 0x28,
-  0xd5, 0x36, 0x9f, 0x47, 0xb3, 0x54, 0x54, 0x65, 0x63, 0x72, 0x10, 0x03,
-  0x74, 0x10, 0xd3, 0x1e, 0xe5, 0x2f, 0x93, 0x3c, 0xa7, 0x4d, 0x59, 0x5a,
-  0x59, 0x6b, 0x6a, 0x78, 0x7a, 0x09, 0x04, 0x16, 0x1c, 0x27, 0x63, 0x34,
-  0x64, 0x45, 0x7d, 0x52, 0x19, 0x63, 0x21, 0x70, 0x74, 0x01, 0x3c, 0x0e,
-  0x23, 0x1f, 0x71, 0x2c, 0x64, 0x3d, 0x25, 0x4a, 0x1f, 0x5b, 0x12, 0x68,
-  0x71, 0x79, 0x73, 0x06, 0x55, 0x17, 0x5f, 0x24, 0xe8, 0x35, 0xdd, 0x42,
-  0xe3, 0x53, 0xd4, 0x60, 0x30, 0x70, 0x55, 0x01, 0x64, 0x0e, 0x55, 0x1f,
-  0xa5, 0x2c, 0x99, 0x3d, 0x90, 0x4a, 0x2c, 0x5a, 0x60, 0x6b, 0x05, 0x78,
-  0x99, 0x09, 0xfe, 0x16, 0x64, 0x26, 0x72, 0x37, 0xa5, 0x44, 0xe1, 0x55,
-  0x74, 0x65, 0x7a, 0x72, 0xb6, 0x03, 0xbd, 0x10, 0x2b, 0x20, 0x64, 0x31,
-  0x9c, 0x3e, 0x8b, 0x4f, 0x13, 0x5f, 0xa9, 0x6c, 0xd1, 0x7d, 0x03, 0x0d,
-  0xb0, 0x1a, 0xd8, 0x2b, 0x62, 0x3b, 0x9b, 0x48, 0x27, 0x58, 0x61, 0x69,
-  0xf8, 0x76, 0x18, 0x06, 0xe4, 0x17, 0xc1, 0x24, 0x51, 0x34, 0xeb, 0x45,
-  0x60, 0x55, 0x80, 0x62, 0x02, 0x72, 0xa3, 0x03, 0x64, 0x13, 0xae, 0x20,
-  0x35, 0x30, 0xb0, 0x41, 0x39, 0x51, 0xa6, 0x5e, 0x70, 0x6e, 0xa9, 0x7f,
-  0x2b, 0x0f, 0xed, 0x1c, 0x18, 0x2c, 0x84, 0x3d, 0x62, 0x4d, 0xe0, 0x5a,
-  0x10, 0x6a, 0xdc, 0x7b, 0xb1, 0x0b, 0x14, 0x1b, 0xe4, 0x28, 0x50, 0x38,
-  0x74, 0x48, 0x94, 0x59, 0x30, 0x69, 0xdf, 0x76, 0xad, 0x06, 0x19, 0x16,
-  0x90, 0x27, 0xaa, 0x37, 0x72, 0x47, 0x85, 0x54, 0x87, 0x64, 0x68, 0x74,
-  0x25, 0x04, 0xef, 0x15, 0xf0, 0x25, 0x77, 0x35, 0x21, 0x45, 0xe1, 0x52,
-  0xf0, 0x62, 0x7c, 0x72, 0x34, 0x02, 0xfd, 0x13, 0x95, 0x23, 0x44, 0x33,
-  0x66, 0x43, 0x36, 0x53, 0x90, 0x60, 0x82, 0x70, 0xb0, 0x00, 0x55, 0x10,
-  0x75, 0x20, 0x07, 0x30, 0x23, 0x40, 0xdc, 0x51, 0xe3, 0x61, 0x98, 0x71,
-  0xe4, 0x01, 0x4b, 0x11, 0x45, 0x21, 0x6b, 0x31, 0x77, 0x41, 0x11, 0x51,
-  0x19, 0x61, 0x22, 0x71, 0x2a, 0x01, 0x3c, 0x11, 0x3c, 0x21, 0x7b, 0x31,
-  0x74, 0x41, 0x75, 0x51, 0x19, 0x61, 0x29, 0x71, 0x64, 0x01, 0x24, 0x11,
-  0x03, 0x21, 0x45, 0x31, 0x7b, 0x41, 0x63, 0x51, 0x56, 0x61, 0x0d, 0x71,
-  0xa6, 0x01, 0x88, 0x11, 0xe4, 0x21, 0x95, 0x31, 0x3c, 0x40, 0x14, 0x50,
-  0x60, 0x60, 0x4d, 0x70, 0xad, 0x00, 0x81, 0x10, 0xc9, 0x20, 0x65, 0x33,
-  0x72, 0x43, 0x50, 0x53, 0x9c, 0x63, 0xe1, 0x73, 0x64, 0x02, 0x72, 0x12,
-  0xb6, 0x22, 0xb5, 0x32, 0x3b, 0x45, 0x7c, 0x55, 0xbc, 0x65, 0xb3, 0x75,
-  0x4f, 0x04, 0x61, 0x14, 0x99, 0x24, 0xd1, 0x34, 0x34, 0x47, 0xa9, 0x57,
-  0xd1, 0x67, 0x03, 0x76, 0xb0, 0x06, 0xd8, 0x16, 0x62, 0x29, 0x9b, 0x39,
-  0x03, 0x48, 0x61, 0x58, 0xf8, 0x68, 0x18, 0x7b, 0xe4, 0x0b, 0xc1, 0x1b,
-  0x51, 0x2a, 0xeb, 0x3a, 0x60, 0x4d, 0x80, 0x5d, 0x02, 0x6c, 0xa3, 0x7c,
-  0x64, 0x0f, 0xae, 0x1f, 0x35, 0x2e, 0xb0, 0x3e, 0x39, 0x51, 0xa6, 0x61,
-  0x70, 0x70, 0xa9, 0x00, 0x2b, 0x13, 0xed, 0x23, 0x18, 0x32, 0x84, 0x42,
-  0x62, 0x55, 0xe0, 0x65, 0x10, 0x74, 0xdc, 0x04, 0xb1, 0x17, 0x14, 0x26,
-  0xe4, 0x36, 0x50, 0x49, 0x74, 0x58, 0x94, 0x68, 0x30, 0x7b, 0xdf, 0x0b,
-  0xad, 0x1a, 0x19, 0x2d, 0x90, 0x3d, 0xaa, 0x4c, 0x72, 0x5f, 0x85, 0x6f,
-  0x87, 0x7e, 0x68, 0x11, 0x25, 0x20, 0xef, 0x30, 0xfe, 0x43, 0x35, 0x52,
-  0x74, 0x65, 0xdc, 0x75, 0xa4, 0x04, 0x3d, 0x17, 0x2d, 0x26, 0xfe, 0x36,
-  0xd0, 0x49, 0x49, 0x58, 0x7d, 0x6b, 0x31, 0x7a, 0x90, 0x0a, 0x8c, 0x1d,
-  0xaa, 0x2c, 0x59, 0x3f, 0x30, 0x4e, 0x05, 0x61, 0x26, 0x70, 0xda, 0x00,
-  0xf4, 0x13, 0x88, 0x22, 0xa7, 0x35, 0x44, 0x44, 0x5e, 0x57, 0x62, 0x66,
-  0x34, 0x79, 0x04, 0x08, 0x50, 0x1b, 0x2f, 0x2a, 0x36, 0x3d, 0x34, 0x4c,
-  0x37, 0x5f, 0x3d, 0x6e, 0x20, 0x01, 0x75, 0x10, 0x3c, 0x23, 0x34, 0x32,
-  0x23, 0x45, 0x25, 0x54, 0x04, 0x67, 0x4b, 0x76, 0x17, 0x09, 0x66, 0x18,
-  0x51, 0x2b, 0x43, 0x3a, 0xe9, 0x4d, 0xa9, 0x5c, 0xf8, 0x6f, 0xdc, 0x7e,
-  0x27, 0x10, 0x55, 0x23, 0x73, 0x32, 0x5c, 0x45, 0xaa, 0x54, 0xcd, 0x67,
-  0xd9, 0x76, 0x36, 0x08, 0x34, 0x1b, 0x43, 0x2a, 0x85, 0x3d, 0xe1, 0x4c,
-  0x28, 0x5e, 0x3d, 0x71, 0xbf, 0x00, 0xf3, 0x13, 0x74, 0x25, 0x7d, 0x34,
-  0xb9, 0x47, 0xfa, 0x56, 0x2c, 0x68, 0x20, 0x7b, 0x81, 0x0a, 0xd0, 0x1d,
-  0x75, 0x2f, 0xa9, 0x3e, 0xd9, 0x51, 0x19, 0x63, 0xbd, 0x72, 0x9d, 0x05,
-  0x7c, 0x17, 0x94, 0x26, 0x3a, 0x38, 0x41, 0x4b, 0xf5, 0x5a, 0x0f, 0x6c,
-  0xaa, 0x7f, 0x8d, 0x0e, 0x5f, 0x20, 0xec, 0x33, 0x78, 0x45, 0xcb, 0x54,
-  0x78, 0x66, 0xbf, 0x79, 0x21, 0x0b, 0xb9, 0x1a, 0x70, 0x2c, 0xb6, 0x3f,
-  0x3b, 0x51, 0xbc, 0x60, 0x3e, 0x72, 0xe2, 0x05, 0x10, 0x17, 0xa5, 0x26,
-  0x19, 0x38, 0x96, 0x4b, 0x34, 0x5d, 0xe6, 0x6c, 0x5f, 0x7e, 0xc4, 0x11,
-  0xaa, 0x23, 0x5d, 0x35, 0xf9, 0x44, 0x46, 0x56, 0x74, 0x68, 0x98, 0x7b,
-  0x71, 0x0d, 0xd9, 0x1c, 0xa1, 0x2e, 0x4d, 0x40, 0xdf, 0x53, 0xa3, 0x65,
-  0x34, 0x77, 0xc4, 0x06, 0xd0, 0x18, 0x7f, 0x2a, 0x21, 0x3c, 0xf9, 0x4f,
-  0xf0, 0x61, 0x78, 0x73, 0x31, 0x05, 0xe1, 0x14, 0xb1, 0x26, 0x71, 0x38,
-  0x6a, 0x4a, 0xad, 0x5d, 0xd0, 0x6f, 0x6c, 0x01, 0x60, 0x13, 0x65, 0x25,
-  0xd8, 0x34, 0x8c, 0x46, 0xb7, 0x58, 0x1d, 0x6a, 0x64, 0x7c, 0x02, 0x0e,
-  0x3b, 0x20, 0x95, 0x33, 0xf4, 0x45, 0x92, 0x57, 0xb0, 0x69, 0x5e, 0x7b,
-  0x10, 0x0d, 0x6a, 0x1f, 0x7a, 0x31, 0x45, 0x43, 0x1f, 0x55, 0x23, 0x67,
-  0x21, 0x79, 0x7d, 0x0b, 0x23, 0x1d, 0x3c, 0x2f, 0x30, 0x41, 0x30, 0x53,
-  0x7e, 0x65, 0x50, 0x77, 0x27, 0x09, 0x22, 0x1b, 0x02, 0x2d, 0x17, 0x3f,
-  0x7b, 0x51, 0x61, 0x63, 0x55, 0x75, 0x49, 0x07, 0xe4, 0x19, 0x9e, 0x2b,
-  0xff, 0x3d, 0xdc, 0x4f, 0x3a, 0x60, 0x4a, 0x72, 0x44, 0x04, 0x55, 0x16,
-  0xad, 0x28, 0x9e, 0x3a, 0x90, 0x4c, 0x26, 0x61, 0x7b, 0x73, 0x4c, 0x05,
-  0x9e, 0x17, 0xad, 0x29, 0x2d, 0x3a, 0x6e, 0x4c, 0xf0, 0x5e, 0xe6, 0x70,
-  0x3b, 0x05, 0x78, 0x17, 0xb5, 0x29, 0xea, 0x3b, 0x2c, 0x4c, 0x6c, 0x5e,
-  0x84, 0x70, 0x85, 0x02, 0x77, 0x17, 0xaa, 0x29, 0xc2, 0x3b, 0x1f, 0x4c,
-  0xab, 0x5e, 0xd9, 0x70, 0x75, 0x05, 0x91, 0x17, 0x7a, 0x28, 0x15, 0x3a,
-  0xb0, 0x4c, 0x34, 0x61, 0xb0, 0x73, 0x8d, 0x05, 0x58, 0x16, 0xe4, 0x28,
-  0x67, 0x3d, 0xc5, 0x4f, 0x11, 0x60, 0xed, 0x72, 0x30, 0x07, 0xaf, 0x19,
-  0x39, 0x2a, 0xb4, 0x3c, 0x3a, 0x51, 0xb2, 0x63, 0x3c, 0x74, 0xb8, 0x06,
-  0x64, 0x1b, 0xa2, 0x2d, 0x1e, 0x3e, 0xc5, 0x50, 0x7b, 0x65, 0xeb, 0x77,
-  0x55, 0x08, 0x8d, 0x1a, 0xb7, 0x2f, 0x14, 0x40, 0xf4, 0x52, 0x50, 0x67,
-  0x7a, 0x78, 0xff, 0x0a, 0x63, 0x1f, 0xd5, 0x31, 0xad, 0x42, 0x03, 0x57,
-  0xc9, 0x69, 0xe5, 0x7a, 0x77, 0x0f, 0xca, 0x21, 0x99, 0x32, 0x63, 0x47,
-  0x03, 0x58, 0xc9, 0x6a, 0xb8, 0x7f, 0x7c, 0x10, 0x27, 0x25, 0xb5, 0x37,
-  0xb3, 0x48, 0x72, 0x5d, 0x2d, 0x6e, 0xe3, 0x00, 0xd0, 0x15, 0x4c, 0x26,
-  0x67, 0x3b, 0x65, 0x4c, 0xc3, 0x5e, 0x82, 0x73, 0xa9, 0x04, 0x58, 0x19,
-  0x78, 0x2a, 0x1a, 0x3f, 0x23, 0x50, 0x95, 0x62, 0xe3, 0x77, 0x89, 0x08,
-  0xad, 0x1d, 0x41, 0x2e, 0x5c, 0x43, 0x25, 0x54, 0x65, 0x69, 0x10, 0x7a,
-  0x19, 0x0f, 0x39, 0x20, 0x21, 0x35, 0x7d, 0x46, 0x23, 0x5b, 0x3d, 0x6c,
-  0x3d, 0x01, 0x3b, 0x12, 0x29, 0x27, 0x73, 0x38, 0x64, 0x4d, 0x6d, 0x5e,
-  0x39, 0x73, 0x11, 0x04, 0x34, 0x19, 0x6d, 0x2a, 0x51, 0x3f, 0x5e, 0x50,
-  0xe4, 0x65, 0x9c, 0x76, 0xb0, 0x0b, 0xc5, 0x1c, 0x31, 0x30, 0x1b, 0x45,
-  0x64, 0x56, 0x5c, 0x6b, 0xa3, 0x7c, 0x82, 0x11, 0xde, 0x22, 0x65, 0x36,
-  0x7b, 0x4b, 0x4b, 0x5c, 0xd0, 0x71, 0xe2, 0x02, 0x2a, 0x16, 0x78, 0x2b,
-  0xf0, 0x3c, 0xe6, 0x51, 0x3d, 0x65, 0x71, 0x76, 0xb5, 0x0b, 0xb3, 0x1c,
-  0x48, 0x30, 0x6e, 0x45, 0x9f, 0x56, 0xcb, 0x6b, 0x77, 0x7f, 0xa4, 0x10,
-  0xc6, 0x25, 0x08, 0x39, 0xe4, 0x4a, 0xde, 0x5f, 0x7f, 0x73, 0x9c, 0x04,
-  0x3a, 0x18, 0x62, 0x2d, 0xc4, 0x3e, 0x15, 0x52, 0xad, 0x67, 0xde, 0x78,
-  0x10, 0x0c, 0xe6, 0x21, 0x7b, 0x35, 0x8c, 0x46, 0x1e, 0x5a, 0xed, 0x6f,
-  0x2d, 0x03, 0xae, 0x14, 0x70, 0x28, 0xa6, 0x3d, 0x38, 0x51, 0xbc, 0x62,
-  0x37, 0x76, 0xb5, 0x0b, 0x30, 0x1f, 0xa1, 0x30, 0x09, 0x44, 0xc5, 0x59,
-  0x66, 0x6d, 0xea, 0x7e, 0x45, 0x12, 0xc3, 0x27, 0xa0, 0x3b, 0x18, 0x4f,
-  0xf4, 0x60, 0x19, 0x74, 0x74, 0x08, 0x94, 0x1d, 0x7c, 0x31, 0xd0, 0x42,
-  0xab, 0x56, 0x1e, 0x6a, 0xc4, 0x7f, 0xe5, 0x13, 0x78, 0x27, 0xcc, 0x38,
-  0x9b, 0x4c, 0x68, 0x60, 0x64, 0x74, 0xfc, 0x09, 0xf0, 0x1d, 0x61, 0x31,
-  0x3d, 0x45, 0xfb, 0x56, 0xa9, 0x6a, 0x3d, 0x7e, 0x26, 0x12, 0xe2, 0x27,
-  0x87, 0x3b, 0x49, 0x4f, 0x3a, 0x63, 0x65, 0x77, 0x90, 0x08, 0xa4, 0x1c,
-  0xb0, 0x30, 0x1d, 0x44, 0x78, 0x58, 0x14, 0x6c, 0x27, 0x00, 0x95, 0x15,
-  0xe3, 0x29, 0x98, 0x3d, 0xb2, 0x51, 0x48, 0x65, 0x5e, 0x79, 0x25, 0x0d,
-  0x70, 0x21, 0x0a, 0x35, 0x04, 0x49, 0x3e, 0x5d, 0x64, 0x71, 0x32, 0x05,
-  0x3e, 0x19, 0x75, 0x2d, 0x3b, 0x41, 0x3b, 0x55, 0x35, 0x69, 0x7d, 0x7d,
-  0x37, 0x11, 0x24, 0x25, 0x14, 0x39, 0x00, 0x4d, 0x3a, 0x61, 0x0c, 0x75,
-  0x52, 0x09, 0x41, 0x1d, 0xb1, 0x31, 0x98, 0x45, 0xb0, 0x59, 0xd6, 0x6d,
-  0x3b, 0x00, 0x1c, 0x14, 0x7e, 0x28, 0x7c, 0x3c, 0x90, 0x50, 0x85, 0x64,
-  0xd9, 0x78, 0x36, 0x0f, 0x34, 0x23, 0x46, 0x37, 0x9f, 0x4b, 0xe4, 0x5f,
-  0x2a, 0x72, 0x3d, 0x06, 0xb9, 0x1a, 0xe6, 0x2e, 0x74, 0x45, 0x78, 0x59,
-  0xb1, 0x6d, 0xf9, 0x01, 0x21, 0x14, 0x2d, 0x28, 0x9f, 0x3c, 0xc3, 0x50,
-  0x34, 0x67, 0xa4, 0x7b, 0x90, 0x0f, 0x0f, 0x22, 0xa8, 0x36, 0xc8, 0x4a,
-  0x75, 0x61, 0xd5, 0x75, 0x39, 0x08, 0x50, 0x1c, 0xe4, 0x30, 0x1c, 0x47,
-  0xa8, 0x5b, 0x83, 0x6f, 0x10, 0x02, 0xa5, 0x16, 0x5d, 0x2d, 0x91, 0x41,
-  0x50, 0x54, 0xa5, 0x68, 0x25, 0x7f, 0xae, 0x13, 0x70, 0x26, 0xbb, 0x3a,
-  0x3d, 0x51, 0xbb, 0x65, 0x35, 0x78, 0xfd, 0x0c, 0x20, 0x23, 0xa2, 0x37,
-  0x04, 0x4a, 0x96, 0x5e, 0x34, 0x75, 0xea, 0x09, 0x5e, 0x1c, 0x8d, 0x30,
-  0xab, 0x47, 0x13, 0x5a, 0xf5, 0x6e, 0x15, 0x05, 0x27, 0x18, 0x9c, 0x2c,
-  0x74, 0x43, 0xd8, 0x57, 0xea, 0x6a, 0x67, 0x01, 0xc4, 0x15, 0xa0, 0x28,
-  0x78, 0x3f, 0xc0, 0x53, 0x80, 0x66, 0x62, 0x7d, 0x36, 0x10, 0xe9, 0x24,
-  0xb5, 0x3b, 0x67, 0x4e, 0x1c, 0x65, 0xc1, 0x79, 0xb8, 0x0c, 0x74, 0x23,
-  0x37, 0x36, 0xad, 0x4a, 0x83, 0x61, 0x48, 0x74, 0x75, 0x0b, 0x29, 0x1e,
-  0xdc, 0x32, 0xcd, 0x49, 0xa0, 0x5c, 0x58, 0x73, 0x66, 0x06, 0x1c, 0x1d,
-  0x37, 0x30, 0xd0, 0x44, 0xb0, 0x5b, 0x95, 0x6e, 0xa5, 0x05, 0x5e, 0x18,
-  0x10, 0x2f, 0x64, 0x42, 0x34, 0x59, 0x07, 0x6c, 0x05, 0x03, 0x39, 0x16,
-  0x30, 0x2d, 0x32, 0x40, 0x3e, 0x57, 0x75, 0x6a, 0x3b, 0x01, 0x3b, 0x14,
-  0x70, 0x2b, 0x34, 0x3e, 0x30, 0x55, 0x6d, 0x68, 0x11, 0x7f, 0x0b, 0x12,
-  0x70, 0x29, 0x25, 0x3c, 0x42, 0x53, 0x48, 0x66, 0xa5, 0x7d, 0x99, 0x10,
-  0xe3, 0x27, 0x95, 0x3a, 0x76, 0x50, 0x01, 0x67, 0x75, 0x7a, 0x51, 0x11,
-  0xa1, 0x24, 0x9d, 0x3b, 0xdf, 0x4e, 0x37, 0x64, 0x60, 0x7b, 0x40, 0x0e,
-  0x82, 0x25, 0xaf, 0x38, 0x64, 0x4e, 0x72, 0x65, 0xbe, 0x78, 0xb5, 0x0f,
-  0x20, 0x25, 0x7d, 0x38, 0xb5, 0x4f, 0xbd, 0x62, 0x37, 0x78, 0x64, 0x0f,
-  0x94, 0x22, 0xc0, 0x39, 0x3a, 0x4f, 0xc8, 0x62, 0xd2, 0x79, 0x18, 0x0f,
-  0xb7, 0x22, 0xd4, 0x39, 0x7e, 0x4f, 0x90, 0x62, 0x27, 0x78, 0x46, 0x0f,
-  0xb0, 0x22, 0x1e, 0x38, 0xa5, 0x4f, 0xdf, 0x62, 0x54, 0x78, 0xc5, 0x0f,
-  0x40, 0x25, 0x8d, 0x38, 0x19, 0x4e, 0xbe, 0x65, 0x64, 0x7b, 0xbf, 0x0e,
-  0x25, 0x24, 0xa6, 0x3b, 0x3d, 0x51, 0xbb, 0x64, 0x35, 0x7a, 0xae, 0x11,
-  0x37, 0x27, 0xed, 0x3a, 0x13, 0x50, 0x84, 0x67, 0x66, 0x7d, 0xe1, 0x10,
-  0x10, 0x26, 0xc5, 0x3d, 0xa5, 0x53, 0x0e, 0x69, 0xb0, 0x7c, 0x17, 0x12,
-  0x27, 0x28, 0x8c, 0x3f, 0x7e, 0x55, 0xdc, 0x68, 0xa7, 0x7e, 0x02, 0x14,
-  0xc2, 0x2b, 0xeb, 0x41, 0x77, 0x57, 0xca, 0x6a, 0x9d, 0x00, 0x2f, 0x16,
-  0x64, 0x2c, 0xed, 0x43, 0xa2, 0x59, 0x7c, 0x6f, 0x3a, 0x05, 0xe1, 0x18,
-  0xb5, 0x2e, 0x79, 0x44, 0x64, 0x5a, 0xe4, 0x71, 0x9e, 0x07, 0x05, 0x1d,
-  0x66, 0x33, 0x20, 0x49, 0xd4, 0x5c, 0xcd, 0x72, 0xab, 0x08, 0x53, 0x1e,
-  0x30, 0x34, 0x1a, 0x4a, 0x3a, 0x60, 0xd0, 0x77, 0xb0, 0x0d, 0x8e, 0x23,
-  0xad, 0x39, 0x49, 0x4f, 0x55, 0x65, 0x2b, 0x7b, 0x17, 0x11, 0x0a, 0x27,
-  0x02, 0x3d, 0x2f, 0x53, 0x79, 0x69, 0x09, 0x7f, 0x38, 0x15, 0x3c, 0x2b,
-  0x27, 0x41, 0x75, 0x57, 0x39, 0x6d, 0x2e, 0x03, 0x64, 0x19, 0x2c, 0x2f,
-  0x50, 0x45, 0x06, 0x5b, 0x78, 0x71, 0x60, 0x07, 0x51, 0x1d, 0x5f, 0x33,
-  0xe4, 0x49, 0x9a, 0x5f, 0xfc, 0x75, 0xd4, 0x0b, 0x27, 0x20, 0x06, 0x36,
-  0x30, 0x4c, 0x4e, 0x62, 0xb4, 0x78, 0x85, 0x0e, 0xd5, 0x24, 0x37, 0x3d,
-  0x71, 0x53, 0x05, 0x69, 0x91, 0x7f, 0xef, 0x15, 0x2b, 0x2a, 0x68, 0x40,
-  0xa4, 0x56, 0xb5, 0x6c, 0x20, 0x05, 0x7d, 0x1b, 0xb5, 0x31, 0xbd, 0x47,
-  0x37, 0x5c, 0x64, 0x72, 0x8a, 0x08, 0xc0, 0x1e, 0x34, 0x37, 0xaa, 0x4d,
-  0xd6, 0x63, 0x4d, 0x78, 0xa5, 0x0e, 0x9d, 0x24, 0x64, 0x3d, 0x90, 0x53,
-  0x3a, 0x68, 0x5b, 0x7e, 0xf9, 0x14, 0x0e, 0x2d, 0xe4, 0x43, 0xcf, 0x59,
-  0x51, 0x6e, 0xe9, 0x04, 0x78, 0x1d, 0xcb, 0x33, 0x76, 0x48, 0xa0, 0x5e,
-  0x2d, 0x77, 0xaf, 0x0d, 0x22, 0x22, 0xba, 0x38, 0x26, 0x51, 0xa3, 0x67,
-  0x04, 0x7c, 0xb5, 0x12, 0x2d, 0x2b, 0xbe, 0x41, 0x50, 0x56, 0x8c, 0x6c,
-  0x67, 0x05, 0xa5, 0x1b, 0x51, 0x30, 0x8d, 0x46, 0xb6, 0x5f, 0x1c, 0x74,
-  0xe4, 0x0a, 0x5d, 0x23, 0x31, 0x38, 0x87, 0x4e, 0x30, 0x67, 0xd0, 0x7d,
-  0xb1, 0x12, 0x03, 0x2b, 0xd4, 0x41, 0xa4, 0x56, 0x7a, 0x6f, 0xc0, 0x05,
-  0xd0, 0x1a, 0x65, 0x33, 0x25, 0x48, 0xf3, 0x5e, 0xb4, 0x77, 0x38, 0x0c,
-  0x3c, 0x25, 0xf0, 0x3b, 0xbc, 0x50, 0x79, 0x69, 0x64, 0x7e, 0xe0, 0x14,
-  0x99, 0x2d, 0x57, 0x42, 0x66, 0x5b, 0x2a, 0x70, 0xc2, 0x06, 0xcd, 0x1f,
-  0xa2, 0x34, 0x4f, 0x4d, 0x7f, 0x62, 0x18, 0x7b, 0x74, 0x10, 0xc1, 0x26,
-  0xf8, 0x3f, 0x98, 0x54, 0xe4, 0x6d, 0x42, 0x02, 0x44, 0x1b, 0x6d, 0x30,
-  0x71, 0x49, 0x17, 0x5e, 0x07, 0x77, 0x24, 0x0c, 0x37, 0x25, 0x38, 0x3a,
-  0x70, 0x53, 0x38, 0x68, 0x35, 0x01, 0x32, 0x16, 0x3e, 0x2f, 0x34, 0x44,
-  0x22, 0x5d, 0x24, 0x72, 0x13, 0x0b, 0x00, 0x20, 0x7a, 0x39, 0x71, 0x4e,
-  0x10, 0x67, 0x5b, 0x7c, 0xa5, 0x15, 0x88, 0x2a, 0xfc, 0x43, 0xc1, 0x58,
-  0x74, 0x70, 0x07, 0x09, 0x7f, 0x1e, 0x52, 0x37, 0xa9, 0x4c, 0xc3, 0x65,
-  0x90, 0x7a, 0x65, 0x12, 0x43, 0x2b, 0x4d, 0x40, 0x91, 0x59, 0xf9, 0x6e,
-  0x64, 0x06, 0x48, 0x1f, 0x83, 0x34, 0xd0, 0x4d, 0x74, 0x65, 0x76, 0x7a,
-  0xbf, 0x13, 0xe8, 0x28, 0x28, 0x40, 0x69, 0x59, 0xd0, 0x6e, 0xcc, 0x07,
-  0x60, 0x1f, 0xe5, 0x34, 0xc0, 0x4d, 0x02, 0x65, 0xb7, 0x7a, 0xce, 0x13,
-  0x79, 0x2b, 0x97, 0x40, 0x38, 0x58, 0x4c, 0x71, 0xb0, 0x06, 0x15, 0x1e,
-  0xa5, 0x37, 0xdb, 0x4c, 0x55, 0x64, 0xba, 0x7d, 0x18, 0x15, 0x96, 0x2a,
-  0x04, 0x42, 0xbf, 0x5b, 0x25, 0x73, 0xb3, 0x08, 0x37, 0x20, 0xb0, 0x39,
-  0x74, 0x51, 0xb7, 0x66, 0x3f, 0x7e, 0xb2, 0x17, 0x2f, 0x2f, 0x4a, 0x4e,
-  0x24, 0x5c, 0x8d, 0x75, 0x71, 0x0d, 0xa5, 0x22, 0x53, 0x3a, 0xc2, 0x53,
-  0xb2, 0x6b, 0x18, 0x03, 0xe2, 0x18, 0x15, 0x30, 0x3b, 0x48, 0x93, 0x61,
-  0x30, 0x79, 0xc9, 0x0e, 0xac, 0x26, 0x04, 0x3e, 0xc3, 0x57, 0xe5, 0x6f,
-  0x76, 0x07, 0xca, 0x1c, 0x9f, 0x34, 0x66, 0x4c, 0x64, 0x64, 0xee, 0x7d,
-  0xa5, 0x15, 0x77, 0x2d, 0x20, 0x45, 0xf9, 0x5a, 0xa9, 0x72, 0x3d, 0x0a,
-  0x37, 0x22, 0xfa, 0x3b, 0x99, 0x53, 0x57, 0x6b, 0x78, 0x03, 0x36, 0x1b,
-  0x90, 0x30, 0x9a, 0x48, 0xad, 0x60, 0x49, 0x78, 0x78, 0x10, 0x55, 0x28,
-  0x37, 0x40, 0xda, 0x59, 0xfc, 0x71, 0x92, 0x09, 0xb6, 0x21, 0x5e, 0x39,
-  0x1e, 0x51, 0x25, 0x69, 0x34, 0x01, 0x2c, 0x19, 0x04, 0x31, 0x6d, 0x49,
-  0x2d, 0x61, 0x2e, 0x79, 0x70, 0x11, 0x21, 0x29, 0x3d, 0x41, 0x21, 0x59,
-  0x3c, 0x71, 0x38, 0x09, 0x20, 0x21, 0x6d, 0x39, 0x52, 0x51, 0x24, 0x69,
-  0x34, 0x01, 0x47, 0x19, 0x42, 0x31, 0x44, 0x49, 0xa1, 0x61, 0x9b, 0x79,
-  0xb0, 0x11, 0xfc, 0x29, 0x3a, 0x40, 0x01, 0x58, 0x62, 0x70, 0x52, 0x08,
-  0xa0, 0x20, 0x98, 0x38, 0xd3, 0x50, 0x31, 0x6b, 0x7d, 0x03, 0x4a, 0x1b,
-  0x9e, 0x33, 0xad, 0x4b, 0x30, 0x62, 0x72, 0x7a, 0xf0, 0x12, 0xdc, 0x2a,
-  0x3a, 0x45, 0x61, 0x5d, 0xb5, 0x75, 0xef, 0x0d, 0x20, 0x24, 0x64, 0x3c,
-  0x9d, 0x54, 0xc0, 0x6c, 0x7a, 0x07, 0xb6, 0x1f, 0xd9, 0x37, 0x02, 0x4e,
-  0xaa, 0x66, 0xdc, 0x7e, 0x7c, 0x19, 0xd5, 0x31, 0x04, 0x48, 0x5d, 0x60,
-  0xe9, 0x78, 0x0e, 0x13, 0xad, 0x2b, 0xce, 0x43, 0x43, 0x5a, 0xa7, 0x72,
-  0x3a, 0x0d, 0xc5, 0x25, 0x50, 0x3c, 0x84, 0x54, 0x30, 0x6f, 0xfd, 0x07,
-  0x22, 0x1e, 0xb0, 0x36, 0x35, 0x51, 0xb1, 0x69, 0x23, 0x00, 0xe7, 0x18,
-  0x4e, 0x33, 0xc7, 0x4b, 0x22, 0x62, 0x80, 0x7a, 0x77, 0x15, 0xe0, 0x2d,
-  0x5e, 0x44, 0xd9, 0x5c, 0xe4, 0x77, 0x1c, 0x0e, 0xf4, 0x26, 0x43, 0x41,
-  0x35, 0x58, 0x9b, 0x70, 0x73, 0x0b, 0xd8, 0x23, 0xb7, 0x3a, 0x4d, 0x55,
-  0xd9, 0x6d, 0xab, 0x04, 0x34, 0x1f, 0xcc, 0x37, 0x9e, 0x4e, 0x79, 0x69,
-  0x21, 0x00, 0xef, 0x18, 0xb4, 0x33, 0x7c, 0x4a, 0x39, 0x65, 0xf0, 0x7d,
-  0xbe, 0x14, 0x6e, 0x2f, 0x2d, 0x46, 0xe2, 0x5e, 0x9e, 0x79, 0x44, 0x10,
-  0x78, 0x2b, 0x65, 0x42, 0xc0, 0x5a, 0x85, 0x75, 0xbd, 0x0c, 0x4e, 0x27,
-  0x79, 0x3e, 0x16, 0x59, 0x27, 0x70, 0x95, 0x08, 0xf8, 0x23, 0x9c, 0x3a,
-  0xb2, 0x55, 0x48, 0x6c, 0x10, 0x07, 0x75, 0x1e, 0x66, 0x39, 0x0a, 0x50,
-  0x14, 0x6b, 0x38, 0x02, 0x27, 0x1d, 0x38, 0x34, 0x34, 0x4f, 0x75, 0x66,
-  0x32, 0x01, 0x34, 0x18, 0x23, 0x33, 0x3e, 0x4a, 0x2d, 0x65, 0x23, 0x7c,
-  0x11, 0x17, 0x11, 0x2e, 0x7d, 0x49, 0x6b, 0x60, 0x57, 0x7b, 0x27, 0x12,
-  0xb4, 0x2d, 0x8f, 0x44, 0xf5, 0x5f, 0xd1, 0x76, 0x3d, 0x10, 0x16, 0x2b,
-  0x64, 0x42, 0x54, 0x5d, 0xab, 0x74, 0x83, 0x0f, 0xc3, 0x26, 0x65, 0x40,
-  0x75, 0x5b, 0x47, 0x72, 0x9f, 0x0d, 0xf8, 0x24, 0x30, 0x3e, 0x3d, 0x59,
-  0xa4, 0x70, 0xfd, 0x0b, 0x31, 0x25, 0x35, 0x3c, 0xb6, 0x57, 0xe8, 0x6e,
-  0x2a, 0x08, 0x69, 0x23, 0x91, 0x3a, 0xc8, 0x55, 0x71, 0x6f, 0xab, 0x06,
-  0xc4, 0x21, 0x0c, 0x3b, 0xa8, 0x52, 0xce, 0x6d, 0x30, 0x07, 0x9a, 0x1e,
-  0x32, 0x38, 0x15, 0x53, 0xff, 0x6a, 0x08, 0x04, 0xb6, 0x1f, 0x8d, 0x36,
-  0x45, 0x50, 0xeb, 0x6b, 0x7d, 0x05, 0x93, 0x1c, 0x15, 0x36, 0xbf, 0x51,
-  0x37, 0x6b, 0xb8, 0x02, 0x71, 0x1c, 0xf5, 0x37, 0x74, 0x51, 0x93, 0x68,
-  0x3f, 0x02, 0xaf, 0x1d, 0x64, 0x37, 0xa8, 0x4e, 0x08, 0x68, 0x84, 0x03,
-  0x79, 0x1d, 0xf5, 0x34, 0x5c, 0x4e, 0xc8, 0x69, 0xe8, 0x03, 0x77, 0x1d,
-  0xf9, 0x34, 0x5b, 0x4e, 0x20, 0x68, 0x90, 0x03, 0x62, 0x1d, 0xd9, 0x34,
-  0xad, 0x4e, 0x00, 0x68, 0xd5, 0x03, 0xab, 0x1d, 0x67, 0x37, 0xcc, 0x4e,
-  0x9f, 0x68, 0x63, 0x02, 0x25, 0x1c, 0xf1, 0x37, 0xf0, 0x51, 0x65, 0x6b,
-  0x3c, 0x05, 0xec, 0x1c, 0xa3, 0x36, 0x74, 0x50, 0x27, 0x6a, 0xfe, 0x05,
-  0xd0, 0x1f, 0x56, 0x39, 0x71, 0x53, 0x20, 0x6d, 0xdd, 0x04, 0x9e, 0x1e,
-  0xe4, 0x38, 0x49, 0x52, 0x7f, 0x6c, 0x55, 0x06, 0x24, 0x20, 0xc7, 0x3b,
-  0xf5, 0x55, 0x99, 0x6f, 0xad, 0x09, 0x4e, 0x23, 0x44, 0x3d, 0x25, 0x57,
-  0x60, 0x71, 0x0d, 0x0b, 0x11, 0x25, 0x39, 0x3f, 0x64, 0x59, 0x29, 0x73,
-  0x38, 0x0d, 0x30, 0x27, 0x74, 0x41, 0x20, 0x5b, 0x3e, 0x75, 0x34, 0x0f,
-  0x32, 0x29, 0x28, 0x43, 0x02, 0x5d, 0x16, 0x77, 0x71, 0x11, 0x25, 0x2b,
-  0x59, 0x45, 0x5e, 0x5f, 0xe8, 0x79, 0xdd, 0x13, 0xf1, 0x2d, 0xc1, 0x47,
-  0x74, 0x60, 0x1c, 0x7a, 0x64, 0x14, 0x4e, 0x2e, 0xe4, 0x48, 0x9f, 0x62,
-  0xdf, 0x7c, 0x2a, 0x19, 0x60, 0x33, 0x09, 0x4d, 0xd0, 0x67, 0xec, 0x01,
-  0x4e, 0x1a, 0x6d, 0x34, 0xa5, 0x4e, 0xe7, 0x68, 0x31, 0x05, 0x79, 0x1f,
-  0xa9, 0x39, 0xbd, 0x53, 0x29, 0x6c, 0x6c, 0x06, 0x84, 0x20, 0xcd, 0x3a,
-  0x71, 0x57, 0xa8, 0x71, 0xd1, 0x0b, 0x19, 0x24, 0xad, 0x3e, 0xde, 0x58,
-  0x71, 0x75, 0x99, 0x0f, 0x74, 0x28, 0x56, 0x42, 0xff, 0x5c, 0x13, 0x79,
-  0xb7, 0x13, 0xd9, 0x2d, 0x42, 0x46, 0xf0, 0x60, 0x77, 0x7d, 0x91, 0x17,
-  0x5c, 0x30, 0xed, 0x4a, 0x25, 0x67, 0xb3, 0x01, 0x34, 0x1a, 0xf5, 0x34,
-  0x20, 0x51, 0xbd, 0x6b, 0x31, 0x04, 0xa9, 0x1e, 0x64, 0x3b, 0xac, 0x55,
-  0x1c, 0x6e, 0x89, 0x08, 0x34, 0x25, 0xe0, 0x3f, 0x46, 0x58, 0xc8, 0x72,
-  0xaa, 0x0f, 0x09, 0x28, 0xe3, 0x42, 0x15, 0x5f, 0x35, 0x78, 0x87, 0x12,
-  0x75, 0x2f, 0x9d, 0x49, 0xa7, 0x62, 0x0c, 0x7f, 0xc5, 0x19, 0xb6, 0x32,
-  0x71, 0x4f, 0xc1, 0x69, 0xd0, 0x02, 0x6f, 0x1f, 0x3d, 0x38, 0xbd, 0x52,
-  0xa4, 0x6f, 0x7d, 0x08, 0x31, 0x25, 0x9f, 0x3f, 0xb9, 0x58, 0x73, 0x75,
-  0x30, 0x0e, 0xe8, 0x28, 0x82, 0x45, 0x44, 0x5e, 0x77, 0x7b, 0x31, 0x14,
-  0xd9, 0x2e, 0x82, 0x4b, 0xaa, 0x64, 0x4e, 0x01, 0x30, 0x1a, 0x17, 0x37,
-  0x31, 0x50, 0xc1, 0x6a, 0xe7, 0x07, 0x98, 0x20, 0xa1, 0x3d, 0x43, 0x56,
-  0x10, 0x73, 0x60, 0x0c, 0x7d, 0x29, 0x02, 0x42, 0x18, 0x5f, 0x39, 0x78,
-  0x64, 0x15, 0x2d, 0x2e, 0x3f, 0x4b, 0x36, 0x64, 0x3f, 0x01, 0x30, 0x1a,
-  0x24, 0x37, 0x2e, 0x50, 0x64, 0x6d, 0x22, 0x06, 0x16, 0x23, 0x45, 0x3c,
-  0x71, 0x59, 0x6b, 0x72, 0x55, 0x0f, 0x5f, 0x28, 0xa3, 0x45, 0x84, 0x5e,
-  0xb0, 0x7b, 0xd6, 0x14, 0x35, 0x30, 0x19, 0x4d, 0x7c, 0x66, 0x58, 0x03,
-  0xa0, 0x1c, 0xcd, 0x39, 0x92, 0x52, 0x37, 0x6e, 0x71, 0x0b, 0x42, 0x24,
-  0x99, 0x41, 0xfe, 0x5a, 0x30, 0x76, 0x78, 0x13, 0xa2, 0x2c, 0xe6, 0x49,
-  0x76, 0x65, 0x3b, 0x7e, 0xda, 0x1b, 0xdb, 0x34, 0x31, 0x50, 0x7f, 0x6d,
-  0x84, 0x06, 0xcd, 0x23, 0x71, 0x3f, 0xb7, 0x58, 0xdd, 0x75, 0x02, 0x11,
-  0xb6, 0x2a, 0xd8, 0x47, 0x3c, 0x63, 0xd5, 0x7c, 0x3d, 0x18, 0x41, 0x35,
-  0xb0, 0x4e, 0x0e, 0x6a, 0xa1, 0x07, 0xc8, 0x20, 0x5d, 0x3c, 0xf6, 0x59,
-  0x34, 0x75, 0x91, 0x0e, 0x18, 0x2a, 0xac, 0x47, 0x30, 0x63, 0xfd, 0x7c,
-  0x27, 0x18, 0xbd, 0x35, 0x3d, 0x51, 0xb9, 0x6a, 0x35, 0x06, 0xfd, 0x23,
-  0x30, 0x3f, 0xa5, 0x58, 0x15, 0x74, 0xc5, 0x11, 0x78, 0x2d, 0xea, 0x46,
-  0x47, 0x62, 0xc8, 0x7f, 0xb6, 0x1b, 0x5d, 0x37, 0xe2, 0x50, 0x50, 0x6c,
-  0x33, 0x08, 0x9c, 0x25, 0x63, 0x41, 0xc9, 0x5a, 0xa1, 0x76, 0x1f, 0x12,
-  0xc3, 0x2f, 0xe5, 0x4b, 0x64, 0x67, 0xd7, 0x00, 0x99, 0x1c, 0x60, 0x38,
-  0x25, 0x54, 0xef, 0x71, 0xb9, 0x0d, 0x79, 0x29, 0x2d, 0x45, 0xb5, 0x5e,
-  0xb3, 0x7a, 0x72, 0x16, 0x2a, 0x32, 0xf9, 0x4f, 0x82, 0x6b, 0x4a, 0x07,
-  0x78, 0x23, 0x65, 0x3f, 0xdd, 0x58, 0x98, 0x74, 0xaa, 0x10, 0x59, 0x2c,
-  0x71, 0x48, 0x1b, 0x64, 0x31, 0x00, 0xbf, 0x1d, 0xe4, 0x39, 0x95, 0x55,
-  0xad, 0x71, 0x43, 0x0d, 0x57, 0x29, 0x76, 0x45, 0x34, 0x61, 0x09, 0x7d,
-  0x19, 0x19, 0x26, 0x35, 0x21, 0x51, 0x7d, 0x6d, 0x23, 0x09, 0x3a, 0x25,
-  0x21, 0x41, 0x3b, 0x5d, 0x34, 0x79, 0x7d, 0x15, 0x25, 0x31, 0x23, 0x4d,
-  0x14, 0x69, 0x45, 0x05, 0x78, 0x21, 0x6c, 0x3d, 0x57, 0x59, 0x45, 0x75,
-  0xb0, 0x11, 0xd1, 0x2d, 0xb0, 0x49, 0xc1, 0x65, 0x3c, 0x00, 0x10, 0x1c,
-  0x30, 0x38, 0x55, 0x54, 0xad, 0x70, 0x8a, 0x0c, 0xd8, 0x28, 0x20, 0x47,
-  0x67, 0x63, 0x51, 0x7f, 0xd0, 0x1b, 0xff, 0x37, 0x21, 0x52, 0x7a, 0x6e,
-  0xb9, 0x0a, 0xe6, 0x26, 0x20, 0x45, 0x70, 0x61, 0xa2, 0x7d, 0xbd, 0x19,
-  0x6c, 0x34, 0x79, 0x50, 0x98, 0x6c, 0xc0, 0x08, 0x34, 0x27, 0xb6, 0x43,
-  0xdf, 0x5f, 0x40, 0x7a, 0xa7, 0x16, 0xdc, 0x32, 0x7c, 0x51, 0x99, 0x6d,
-  0x31, 0x08, 0x51, 0x24, 0xb0, 0x40, 0x5f, 0x5f, 0xa1, 0x7b, 0xc4, 0x17,
-  0x57, 0x32, 0xed, 0x4e, 0x60, 0x6d, 0x8d, 0x09, 0x7a, 0x24, 0xbf, 0x40,
-  0x21, 0x5f, 0xba, 0x7b, 0x39, 0x16, 0xa6, 0x32, 0x20, 0x51, 0xb0, 0x6d,
-  0x22, 0x08, 0xff, 0x24, 0x6d, 0x43, 0xed, 0x5f, 0x19, 0x7a, 0x96, 0x16,
-  0x34, 0x35, 0xf0, 0x51, 0x43, 0x6c, 0xc8, 0x08, 0xa0, 0x27, 0x5d, 0x42,
-  0xe4, 0x5e, 0x5a, 0x7d, 0x74, 0x18, 0x96, 0x34, 0x7f, 0x53, 0xd3, 0x6f,
-  0xb0, 0x0a, 0x1f, 0x29, 0xdf, 0x45, 0xa9, 0x60, 0x34, 0x7f, 0xcc, 0x1b,
-  0x9e, 0x36, 0x79, 0x55, 0x21, 0x70, 0xef, 0x0c, 0xb4, 0x2b, 0x7c, 0x46,
-  0x39, 0x65, 0xf0, 0x01, 0xbe, 0x1c, 0x6e, 0x3b, 0x2d, 0x56, 0xe2, 0x72,
-  0x9e, 0x11, 0x44, 0x2c, 0x78, 0x4b, 0x65, 0x66, 0xd5, 0x02, 0x9b, 0x21,
-  0xa1, 0x3c, 0x53, 0x5b, 0x64, 0x76, 0x06, 0x15, 0x74, 0x30, 0xc6, 0x4c,
-  0xe5, 0x6b, 0x9e, 0x06, 0xac, 0x25, 0x0d, 0x40, 0x51, 0x5f, 0x76, 0x7a,
-  0x34, 0x19, 0x11, 0x34, 0x15, 0x53, 0x21, 0x6e, 0x21, 0x0d, 0x2d, 0x28,
-  0x3f, 0x47, 0x27, 0x62, 0x20, 0x01, 0x34, 0x1c, 0x24, 0x3b, 0x34, 0x56,
-  0x2b, 0x75, 0x23, 0x10, 0x5e, 0x2f, 0x6f, 0x4a, 0x1e, 0x69, 0x44, 0x04,
-  0x10, 0x23, 0x45, 0x3e, 0xbd, 0x5d, 0x8d, 0x78, 0xff, 0x17, 0xc1, 0x32,
-  0x3c, 0x50, 0x10, 0x6f, 0x64, 0x0a, 0x54, 0x29, 0xa7, 0x44, 0x8c, 0x63,
-  0xdc, 0x7e, 0x65, 0x1c, 0x67, 0x3b, 0x50, 0x56, 0x93, 0x75, 0xe5, 0x10,
-  0x64, 0x2e, 0x69, 0x4d, 0xb5, 0x68, 0xf9, 0x07, 0x31, 0x25, 0x65, 0x40,
-  0xbf, 0x5f, 0xef, 0x7a, 0x30, 0x18, 0x6c, 0x37, 0x84, 0x52, 0xcc, 0x71,
-  0x7b, 0x0f, 0xab, 0x2a, 0x90, 0x49, 0x09, 0x67, 0xa1, 0x02, 0xcb, 0x21,
-  0x79, 0x3f, 0x96, 0x5a, 0x31, 0x78, 0x15, 0x17, 0xe7, 0x32, 0x12, 0x50,
-  0xb1, 0x6f, 0xc1, 0x0a, 0x54, 0x28, 0xa5, 0x47, 0x7a, 0x65, 0x80, 0x00,
-  0x15, 0x1e, 0xa9, 0x3d, 0x64, 0x5b, 0xa9, 0x76, 0x3f, 0x14, 0xf5, 0x33,
-  0x3c, 0x51, 0xb4, 0x6c, 0x26, 0x0a, 0xb8, 0x29, 0x64, 0x47, 0xa5, 0x62,
-  0x11, 0x00, 0x93, 0x1f, 0x71, 0x3d, 0xa5, 0x58, 0x55, 0x76, 0xd5, 0x15,
-  0xa5, 0x33, 0x1e, 0x51, 0xe4, 0x6c, 0x59, 0x0a, 0x2d, 0x28, 0xd5, 0x47,
-  0x64, 0x65, 0xca, 0x00, 0xab, 0x1e, 0x67, 0x3c, 0xd4, 0x5b, 0xa0, 0x79,
-  0x67, 0x17, 0xd1, 0x32, 0x99, 0x50, 0x63, 0x6e, 0x25, 0x0c, 0xe9, 0x2b,
-  0xb9, 0x49, 0x7a, 0x67, 0x3a, 0x05, 0xe6, 0x20, 0xfe, 0x3e, 0x3d, 0x5c,
-  0x64, 0x7a, 0xc2, 0x19, 0x9e, 0x37, 0x40, 0x55, 0x34, 0x73, 0x21, 0x11,
-  0xd5, 0x2c, 0x9e, 0x4a, 0xb0, 0x68, 0x54, 0x06, 0x7e, 0x24, 0x14, 0x42,
-  0x20, 0x60, 0xdc, 0x7f, 0xff, 0x1d, 0x93, 0x3b, 0xe4, 0x59, 0x5a, 0x77,
-  0x5f, 0x15, 0x70, 0x33, 0x78, 0x51, 0x01, 0x6f, 0x50, 0x0d, 0x2f, 0x2b,
-  0x21, 0x49, 0x7d, 0x67, 0x25, 0x05, 0x26, 0x23, 0x31, 0x41, 0x31, 0x5f,
-  0x70, 0x7d, 0x2a, 0x1b, 0x2c, 0x39, 0x28, 0x57, 0x1e, 0x75, 0x45, 0x13,
-  0x60, 0x31, 0x6d, 0x4f, 0x55, 0x6d, 0x0d, 0x0b, 0xa1, 0x29, 0x94, 0x47,
-  0xf7, 0x65, 0xdd, 0x03, 0x20, 0x20, 0x1d, 0x3e, 0x30, 0x5c, 0x4f, 0x7a,
-  0xa1, 0x18, 0x8a, 0x36, 0xd9, 0x54, 0x36, 0x75, 0x60, 0x13, 0x40, 0x31,
-  0x82, 0x4f, 0xad, 0x6d, 0x2d, 0x0a, 0x6e, 0x28, 0xf0, 0x46, 0xf4, 0x64,
-  0x20, 0x05, 0x35, 0x23, 0xb9, 0x41, 0xe9, 0x5f, 0x37, 0x7c, 0x07, 0x1a,
-  0x9d, 0x38, 0xcc, 0x56, 0x7a, 0x77, 0xac, 0x15, 0xdd, 0x33, 0x18, 0x50,
-  0xa9, 0x6e, 0x9d, 0x0c, 0x75, 0x2d, 0x9b, 0x4b, 0x31, 0x68, 0x47, 0x06,
-  0xf7, 0x24, 0x04, 0x45, 0xe4, 0x63, 0xc1, 0x01, 0x55, 0x1e, 0xf3, 0x3c,
-  0x71, 0x5d, 0x89, 0x7b, 0x50, 0x18, 0xe0, 0x36, 0x64, 0x57, 0xa9, 0x75,
-  0x38, 0x12, 0xbc, 0x30, 0x27, 0x51, 0xf5, 0x6f, 0x27, 0x0c, 0xb2, 0x2a,
-  0x31, 0x4b, 0xa1, 0x69, 0x14, 0x06, 0xc5, 0x24, 0x76, 0x45, 0xe0, 0x63,
-  0x10, 0x00, 0xd9, 0x1e, 0xac, 0x3f, 0x18, 0x5c, 0xb0, 0x7a, 0x51, 0x1b,
-  0x31, 0x38, 0x93, 0x56, 0x71, 0x77, 0xc8, 0x15, 0xa8, 0x32, 0x19, 0x53,
-  0x90, 0x71, 0xaa, 0x0e, 0x64, 0x2f, 0xc0, 0x4d, 0x82, 0x6a, 0x6c, 0x0b,
-  0x30, 0x28, 0xf4, 0x46, 0xbf, 0x67, 0x7b, 0x04, 0x74, 0x25, 0xf4, 0x43,
-  0xa3, 0x60, 0x6e, 0x01, 0x31, 0x1e, 0xe0, 0x3c, 0x99, 0x5d, 0x4b, 0x7a,
-  0x73, 0x1b, 0x65, 0x38, 0xc4, 0x56, 0x85, 0x77, 0xa1, 0x14, 0x1d, 0x35,
-  0x65, 0x52, 0x06, 0x73, 0x31, 0x10, 0xc7, 0x2e, 0x9a, 0x4f, 0x95, 0x6c,
-  0xa5, 0x0d, 0x5e, 0x2a, 0x10, 0x4b, 0x6b, 0x68, 0x7b, 0x09, 0x45, 0x26,
-  0x07, 0x47, 0x2c, 0x64, 0x3d, 0x05, 0x7d, 0x22, 0x24, 0x43, 0x3a, 0x60,
-  0x74, 0x01, 0x36, 0x1e, 0x3f, 0x3f, 0x33, 0x5c, 0x30, 0x7d, 0x3f, 0x1a,
-  0x1f, 0x3b, 0x09, 0x58, 0x34, 0x79, 0x71, 0x16, 0x58, 0x37, 0x48, 0x54,
-  0xe4, 0x75, 0x98, 0x12, 0xf9, 0x33, 0xd2, 0x50, 0x3c, 0x70, 0x01, 0x11,
-  0x78, 0x2e, 0x1d, 0x4f, 0xb6, 0x6c, 0x88, 0x0d, 0xd7, 0x2a, 0x2c, 0x4a,
-  0x67, 0x6b, 0x51, 0x08, 0x95, 0x29, 0xff, 0x46, 0x6a, 0x66, 0x3d, 0x07,
-  0xf0, 0x24, 0xdc, 0x45, 0x3a, 0x65, 0x35, 0x02, 0xa4, 0x23, 0xf5, 0x40,
-  0x2d, 0x60, 0x7e, 0x01, 0xd0, 0x1e, 0xd6, 0x3f, 0x7d, 0x5f, 0xb1, 0x7c,
-  0xc5, 0x1d, 0x0c, 0x3d, 0xb0, 0x5a, 0xd4, 0x7b, 0x7f, 0x1b, 0x9b, 0x38,
-  0x78, 0x58, 0x15, 0x79, 0xe4, 0x16, 0x15, 0x36, 0xa1, 0x57, 0x8d, 0x74,
-  0x44, 0x14, 0xe0, 0x35, 0x78, 0x55, 0x80, 0x72, 0x00, 0x12, 0xa2, 0x33,
-  0x36, 0x53, 0xa9, 0x70, 0x35, 0x10, 0xa7, 0x31, 0x5e, 0x51, 0xa6, 0x6e,
-  0x38, 0x0e, 0xb2, 0x2f, 0x31, 0x4f, 0xa1, 0x6c, 0x14, 0x0c, 0xc5, 0x2d,
-  0x67, 0x4d, 0xe0, 0x6a, 0x5e, 0x0a, 0xc9, 0x2b, 0xe4, 0x4b, 0x09, 0x6b,
-  0xf8, 0x08, 0x50, 0x28, 0x74, 0x48, 0x80, 0x69, 0x63, 0x09, 0xd8, 0x26,
-  0xb6, 0x46, 0x4d, 0x66, 0xc4, 0x07, 0xaa, 0x27, 0x34, 0x47, 0xc4, 0x64,
-  0xd0, 0x04, 0x7d, 0x24, 0x36, 0x44, 0xf8, 0x65, 0xb3, 0x05, 0x7a, 0x25,
-  0x3a, 0x45, 0xf3, 0x62, 0xb9, 0x02, 0x7a, 0x22, 0x31, 0x42, 0xff, 0x63,
-  0x95, 0x03, 0x41, 0x23, 0x34, 0x43, 0x36, 0x63, 0xd1, 0x00, 0x8b, 0x20,
-  0xa1, 0x40, 0x1d, 0x60, 0x7c, 0x00, 0x1a, 0x20, 0x37, 0x40, 0xd4, 0x61,
-  0xe4, 0x01, 0x94, 0x21, 0xab, 0x41, 0x43, 0x61, 0x10, 0x01, 0x64, 0x21,
-  0x67, 0x41, 0x45, 0x61, 0x11, 0x01, 0x6d, 0x21, 0x20, 0x41, 0x38, 0x61,
-  0x36, 0x01, 0x34, 0x21, 0x21, 0x41, 0x39, 0x61, 0x24, 0x01, 0x73, 0x21,
-  0x4e, 0x41, 0x47, 0x61, 0x24, 0x01, 0x0d, 0x21, 0x71, 0x41, 0x25, 0x61,
-  0x43, 0x01, 0x48, 0x21, 0xa7, 0x41, 0x92, 0x61, 0xfe, 0x01, 0xd1, 0x21,
-  0x74, 0x40, 0x11, 0x60, 0x75, 0x00, 0x4e, 0x20, 0xb0, 0x40, 0x84, 0x60,
-  0xde, 0x00, 0x24, 0x23, 0x60, 0x43, 0x4c, 0x63, 0x9f, 0x03, 0xe3, 0x23,
-  0x68, 0x42, 0x3d, 0x62, 0xb8, 0x02, 0xfa, 0x22, 0x23, 0x45, 0x70, 0x65,
-  0xa6, 0x05, 0xf8, 0x25, 0x36, 0x44, 0x21, 0x64, 0xd0, 0x04, 0xcc, 0x24,
-  0x67, 0x47, 0xe5, 0x67, 0xc0, 0x07, 0x1f, 0x26, 0xa1, 0x46, 0xd9, 0x66,
-  0x79, 0x09, 0x96, 0x29, 0x20, 0x48, 0x50, 0x68, 0xf4, 0x08, 0x5d, 0x2b,
-  0xb0, 0x4b, 0xc2, 0x6b, 0x10, 0x0a, 0xf7, 0x2a, 0x71, 0x4d, 0x94, 0x6d,
-  0x05, 0x0c, 0xa4, 0x2c, 0x36, 0x4f, 0xb8, 0x6f, 0x70, 0x0e, 0xb4, 0x2e,
-  0x74, 0x51, 0xa3, 0x71, 0x35, 0x10, 0xaf, 0x30, 0x3d, 0x53, 0xed, 0x73,
-  0x03, 0x12, 0x95, 0x32, 0x71, 0x55, 0xe6, 0x75, 0x59, 0x14, 0xcb, 0x34,
-  0xad, 0x57, 0x1e, 0x76, 0x9a, 0x16, 0x50, 0x39, 0x3a, 0x58, 0x90, 0x78,
-  0x62, 0x1b, 0xda, 0x3b, 0xbd, 0x5a, 0x4d, 0x7d, 0xdc, 0x1d, 0xa0, 0x3c,
-  0x62, 0x5f, 0xc0, 0x7f, 0x9c, 0x1e, 0x2d, 0x41, 0x2d, 0x60, 0xf3, 0x00,
-  0xf0, 0x23, 0x61, 0x42, 0x3c, 0x65, 0xf0, 0x05, 0xf0, 0x24, 0x78, 0x47,
-  0x2d, 0x66, 0xea, 0x06, 0x98, 0x29, 0x51, 0x48, 0x7c, 0x6b, 0x65, 0x0a,
-  0xc2, 0x2a, 0x88, 0x4d, 0xa3, 0x6c, 0x54, 0x0f, 0x63, 0x2e, 0x01, 0x51,
-  0x31, 0x70, 0xc7, 0x10, 0xbe, 0x33, 0xdd, 0x52, 0xe4, 0x75, 0x79, 0x14,
-  0x58, 0x37, 0x60, 0x56, 0x34, 0x79, 0x11, 0x18, 0x15, 0x3b, 0x21, 0x5a,
-  0x21, 0x7d, 0x2d, 0x1c, 0x3f, 0x3f, 0x27, 0x5e, 0x20, 0x01, 0x30, 0x20,
-  0x22, 0x43, 0x7d, 0x62, 0x29, 0x05, 0x38, 0x24, 0x03, 0x47, 0x11, 0x66,
-  0x34, 0x09, 0x71, 0x28, 0x51, 0x4b, 0x46, 0x6a, 0xa1, 0x0d, 0xdd, 0x2c,
-  0xf7, 0x4f, 0xc7, 0x6e, 0x31, 0x10, 0x14, 0x33, 0x64, 0x52, 0x1d, 0x75,
-  0xa7, 0x14, 0x8c, 0x37, 0xc2, 0x56, 0x20, 0x78, 0x34, 0x1b, 0x51, 0x3a,
-  0x9f, 0x5d, 0x87, 0x7c, 0x27, 0x1e, 0x72, 0x41, 0xbe, 0x60, 0xf3, 0x03,
-  0x3d, 0x25, 0x67, 0x44, 0xbd, 0x67, 0xbd, 0x06, 0x30, 0x28, 0x65, 0x4b,
-  0x91, 0x6a, 0xd1, 0x0d, 0x34, 0x2f, 0xb1, 0x4e, 0xd8, 0x71, 0x04, 0x13,
-  0xb7, 0x32, 0x9d, 0x55, 0x75, 0x77, 0x9b, 0x16, 0x31, 0x38, 0x47, 0x5b,
-  0xf7, 0x7a, 0x04, 0x1c, 0xe4, 0x3f, 0xc1, 0x5e, 0x55, 0x00, 0xf3, 0x23,
-  0x71, 0x45, 0x89, 0x64, 0x50, 0x06, 0xa4, 0x29, 0x37, 0x4b, 0xfd, 0x6a,
-  0x35, 0x0c, 0xad, 0x2f, 0x35, 0x51, 0xb6, 0x70, 0x24, 0x12, 0xb1, 0x35,
-  0x3d, 0x57, 0xed, 0x76, 0x13, 0x18, 0x8a, 0x3b, 0x66, 0x5d, 0xf7, 0x7c,
-  0x55, 0x1e, 0xce, 0x41, 0xb0, 0x63, 0x5d, 0x05, 0xf2, 0x24, 0x50, 0x46,
-  0x32, 0x68, 0x9a, 0x0b, 0x62, 0x2d, 0xd8, 0x4c, 0xe4, 0x6e, 0x19, 0x10,
-  0xd5, 0x33, 0xa9, 0x55, 0x71, 0x77, 0xd5, 0x16, 0x9f, 0x38, 0x7f, 0x5a,
-  0x30, 0x7c, 0xf4, 0x1f, 0xbe, 0x41, 0x72, 0x63, 0x74, 0x05, 0xfc, 0x24,
-  0xa4, 0x46, 0x6e, 0x68, 0x64, 0x0a, 0xf8, 0x2d, 0x83, 0x4f, 0x40, 0x71,
-  0x66, 0x13, 0x64, 0x35, 0xba, 0x54, 0xa4, 0x76, 0xa2, 0x18, 0x1d, 0x3a,
-  0x79, 0x5c, 0x01, 0x7e, 0x74, 0x20, 0xdc, 0x43, 0xe3, 0x65, 0xdd, 0x07,
-  0xa1, 0x29, 0x5b, 0x4b, 0x55, 0x6d, 0x6b, 0x0f, 0x34, 0x31, 0x16, 0x53,
-  0x1c, 0x75, 0x24, 0x17, 0x23, 0x39, 0x35, 0x5b, 0x24, 0x7d, 0x39, 0x1f,
-  0x2d, 0x41, 0x75, 0x63, 0x3f, 0x05, 0x3b, 0x27, 0x22, 0x49, 0x61, 0x6b,
-  0x50, 0x0d, 0x11, 0x2f, 0x7c, 0x51, 0x60, 0x73, 0x10, 0x15, 0x58, 0x37,
-  0xb7, 0x59, 0x98, 0x7b, 0xe2, 0x1d, 0x95, 0x3f, 0x23, 0x60, 0x1a, 0x02,
-  0x65, 0x24, 0x51, 0x46, 0xa0, 0x68, 0xcd, 0x0a, 0x98, 0x2c, 0x35, 0x51,
-  0x66, 0x73, 0x4a, 0x15, 0x92, 0x37, 0xec, 0x59, 0x26, 0x7a, 0x71, 0x1c,
-  0xa9, 0x3e, 0xbc, 0x60, 0x74, 0x05, 0x74, 0x27, 0xa2, 0x49, 0xef, 0x6b,
-  0x2d, 0x0c, 0x7b, 0x2e, 0x95, 0x50, 0x85, 0x72, 0x75, 0x17, 0xb1, 0x39,
-  0x90, 0x5b, 0x19, 0x7c, 0xac, 0x1e, 0xd8, 0x40, 0x30, 0x65, 0x96, 0x07,
-  0x3b, 0x28, 0x47, 0x4a, 0xe2, 0x6c, 0x18, 0x11, 0xa7, 0x33, 0xd9, 0x55,
-  0x3a, 0x76, 0xe9, 0x18, 0x7b, 0x3d, 0x86, 0x5f, 0x11, 0x00, 0xb9, 0x22,
-  0x2d, 0x47, 0xb2, 0x69, 0x3e, 0x0a, 0xf9, 0x2c, 0x74, 0x51, 0xb7, 0x73,
-  0x25, 0x14, 0xa9, 0x36, 0x64, 0x5b, 0xba, 0x7d, 0x1f, 0x1e, 0x90, 0x40,
-  0x78, 0x65, 0xe1, 0x07, 0x10, 0x28, 0xcf, 0x4a, 0xb6, 0x6f, 0x14, 0x10,
-  0xf5, 0x32, 0x53, 0x57, 0x38, 0x78, 0x8c, 0x1a, 0x30, 0x3f, 0xd8, 0x61,
-  0xbc, 0x02, 0x1d, 0x27, 0xd5, 0x49, 0xb7, 0x6a, 0x7d, 0x0f, 0xc0, 0x31,
-  0x9e, 0x52, 0x6e, 0x77, 0x21, 0x18, 0xbd, 0x3a, 0xb1, 0x5f, 0x7b, 0x00,
-  0x3b, 0x25, 0xf8, 0x47, 0xb1, 0x68, 0x71, 0x0d, 0x2d, 0x2e, 0xe8, 0x50,
-  0x83, 0x75, 0x05, 0x16, 0x7d, 0x3b, 0x2b, 0x5c, 0x90, 0x7e, 0x99, 0x23,
-  0xac, 0x44, 0x58, 0x69, 0x30, 0x0a, 0x13, 0x2f, 0x35, 0x50, 0xd7, 0x72,
-  0xe2, 0x17, 0x94, 0x38, 0xa7, 0x5d, 0x0d, 0x7e, 0x5f, 0x23, 0x63, 0x44,
-  0x34, 0x69, 0x17, 0x0a, 0x15, 0x2f, 0x2c, 0x50, 0x28, 0x75, 0x34, 0x16,
-  0x24, 0x3b, 0x2c, 0x5c, 0x5e, 0x01, 0x3c, 0x22, 0x24, 0x47, 0x2e, 0x68,
-  0x21, 0x0d, 0x21, 0x2e, 0x16, 0x53, 0x45, 0x74, 0x39, 0x19, 0x25, 0x3a,
-  0x44, 0x5f, 0x45, 0x00, 0xad, 0x25, 0x8e, 0x46, 0xb0, 0x6b, 0xdc, 0x0c,
-  0x27, 0x30, 0x59, 0x55, 0x30, 0x76, 0x52, 0x1b, 0xa2, 0x3c, 0xcd, 0x61,
-  0xd3, 0x02, 0x2a, 0x26, 0x61, 0x4b, 0x57, 0x6c, 0x83, 0x11, 0xe8, 0x32,
-  0x68, 0x56, 0x3d, 0x7b, 0xbe, 0x1c, 0xfa, 0x41, 0x20, 0x65, 0x35, 0x06,
-  0xa2, 0x2b, 0xf8, 0x4c, 0x27, 0x70, 0x62, 0x15, 0x9d, 0x36, 0xc8, 0x5b,
-  0x71, 0x7f, 0xab, 0x20, 0xd4, 0x45, 0x08, 0x69, 0xa0, 0x0a, 0x93, 0x2f,
-  0x30, 0x53, 0xd5, 0x74, 0x15, 0x18, 0x5b, 0x3d, 0xe9, 0x5e, 0x5d, 0x02,
-  0xb0, 0x27, 0xc8, 0x48, 0x5c, 0x6c, 0xe0, 0x11, 0x64, 0x35, 0x8a, 0x56,
-  0x02, 0x7a, 0xb9, 0x1f, 0x21, 0x43, 0xaf, 0x64, 0x70, 0x08, 0xa2, 0x2d,
-  0x3b, 0x51, 0xa0, 0x72, 0x3c, 0x16, 0xb9, 0x3b, 0x64, 0x5f, 0xa3, 0x00,
-  0x15, 0x24, 0x80, 0x49, 0x70, 0x6d, 0xa5, 0x0e, 0x44, 0x32, 0xc2, 0x57,
-  0xe4, 0x7b, 0x09, 0x1f, 0xf5, 0x40, 0x46, 0x64, 0x20, 0x08, 0xff, 0x2d,
-  0x64, 0x51, 0xd5, 0x72, 0xa1, 0x16, 0x4d, 0x3a, 0xd5, 0x5f, 0xab, 0x03,
-  0x71, 0x27, 0xd7, 0x48, 0x97, 0x6c, 0x74, 0x10, 0x64, 0x34, 0xf1, 0x59,
-  0xb5, 0x7d, 0x63, 0x21, 0x31, 0x45, 0xf9, 0x66, 0xf0, 0x0a, 0x74, 0x2e,
-  0x2a, 0x52, 0xad, 0x77, 0x84, 0x1b, 0x4d, 0x3f, 0x71, 0x63, 0x65, 0x07,
-  0xd5, 0x28, 0x84, 0x4c, 0xa3, 0x70, 0x55, 0x14, 0x64, 0x38, 0x1d, 0x5c,
-  0x74, 0x00, 0xc7, 0x25, 0xf5, 0x49, 0x9a, 0x6d, 0xad, 0x11, 0x5e, 0x35,
-  0x44, 0x59, 0x60, 0x7d, 0x66, 0x21, 0x45, 0x45, 0x11, 0x69, 0x23, 0x0d,
-  0x20, 0x31, 0x7d, 0x55, 0x31, 0x79, 0x37, 0x1d, 0x3b, 0x41, 0x27, 0x65,
-  0x24, 0x09, 0x7d, 0x2d, 0x30, 0x51, 0x28, 0x75, 0x1c, 0x19, 0x00, 0x3d,
-  0x64, 0x61, 0x6a, 0x05, 0x42, 0x29, 0x59, 0x4d, 0xa5, 0x71, 0x89, 0x15,
-  0xf9, 0x39, 0xda, 0x5d, 0x3a, 0x00, 0x55, 0x24, 0x79, 0x48, 0x5b, 0x6c,
-  0xe4, 0x10, 0x84, 0x34, 0xc4, 0x58, 0x65, 0x7f, 0x7d, 0x23, 0x56, 0x47,
-  0xd0, 0x6b, 0xe3, 0x0f, 0x2b, 0x32, 0x69, 0x56, 0xda, 0x7a, 0xf0, 0x1e,
-  0x2c, 0x45, 0x74, 0x69, 0xb3, 0x0d, 0xe9, 0x31, 0x28, 0x54, 0x74, 0x78,
-  0xd0, 0x1c, 0xc6, 0x40, 0x7b, 0x67, 0xb7, 0x0b, 0xc2, 0x2f, 0x08, 0x52,
-  0xa7, 0x76, 0xc9, 0x1a, 0x3e, 0x41, 0xff, 0x65, 0x5e, 0x08, 0x61, 0x2c,
-  0xf8, 0x50, 0x14, 0x77, 0xb7, 0x1b, 0x8d, 0x3f, 0x42, 0x62, 0xe0, 0x06,
-  0x65, 0x2d, 0x90, 0x51, 0x19, 0x74, 0xbf, 0x18, 0x21, 0x3f, 0xb9, 0x63,
-  0x70, 0x06, 0xa5, 0x2a, 0x26, 0x51, 0xb0, 0x75, 0x33, 0x18, 0xb4, 0x3c,
-  0x37, 0x63, 0xa4, 0x07, 0x1f, 0x2a, 0x8b, 0x4e, 0x34, 0x75, 0xec, 0x19,
-  0x5d, 0x3c, 0xdd, 0x60, 0xa8, 0x07, 0x14, 0x2a, 0xf5, 0x4e, 0x46, 0x75,
-  0x74, 0x18, 0x81, 0x3c, 0x78, 0x63, 0xdc, 0x07, 0xb0, 0x2a, 0x4d, 0x51,
-  0xc4, 0x75, 0xad, 0x18, 0x71, 0x3f, 0x85, 0x63, 0x93, 0x06, 0x62, 0x2d,
-  0x2a, 0x50, 0xfb, 0x74, 0xb9, 0x1b, 0x67, 0x3e, 0x39, 0x65, 0xf4, 0x09,
-  0xa4, 0x2c, 0x74, 0x53, 0x2b, 0x76, 0xe3, 0x1a, 0xd0, 0x41, 0x48, 0x64,
-  0x71, 0x0b, 0x26, 0x2e, 0xd8, 0x52, 0x8c, 0x79, 0xaa, 0x1c, 0x54, 0x43,
-  0x63, 0x66, 0x18, 0x0d, 0x74, 0x30, 0xc2, 0x54, 0xff, 0x7b, 0x88, 0x1e,
-  0xa8, 0x45, 0x49, 0x68, 0x10, 0x0f, 0x67, 0x32, 0x71, 0x59, 0x45, 0x7c,
-  0x06, 0x23, 0x28, 0x46, 0x36, 0x6d, 0x24, 0x10, 0x5a, 0x37, 0x36, 0x5a,
-  0x3b, 0x01, 0x38, 0x24, 0x20, 0x4b, 0x28, 0x6e, 0x30, 0x15, 0x2c, 0x38,
-  0x04, 0x5f, 0x0c, 0x02, 0x7b, 0x29, 0x6b, 0x4c, 0x51, 0x73, 0x41, 0x16,
-  0xa8, 0x3d, 0x84, 0x60, 0xb0, 0x07, 0xd0, 0x2a, 0x2c, 0x50, 0x05, 0x77,
-  0x75, 0x1a, 0x53, 0x41, 0xb7, 0x64, 0x84, 0x0b, 0xc6, 0x2e, 0x20, 0x54,
-  0x3a, 0x7b, 0x05, 0x1e, 0xd0, 0x45, 0xda, 0x68, 0x2c, 0x0e, 0x74, 0x35,
-  0xbc, 0x58, 0xf0, 0x7f, 0x74, 0x25, 0x61, 0x48, 0xb8, 0x6f, 0xf4, 0x12,
-  0x37, 0x38, 0x2d, 0x5f, 0x87, 0x02, 0xca, 0x29, 0x61, 0x4f, 0xa9, 0x72,
-  0xd4, 0x19, 0x4d, 0x3f, 0xa8, 0x62, 0xd4, 0x09, 0x7b, 0x2f, 0x90, 0x52,
-  0x38, 0x78, 0x4c, 0x1f, 0xb0, 0x42, 0x13, 0x68, 0xab, 0x0f, 0xd9, 0x32,
-  0x10, 0x58, 0xe7, 0x7f, 0x71, 0x25, 0xc5, 0x48, 0x11, 0x6e, 0xa3, 0x15,
-  0x64, 0x3b, 0xb4, 0x5e, 0x23, 0x04, 0xa6, 0x2b, 0x21, 0x51, 0xb0, 0x74,
-  0x70, 0x1a, 0xbb, 0x41, 0x2b, 0x67, 0xbf, 0x0a, 0x50, 0x30, 0x89, 0x57,
-  0x75, 0x7d, 0xf7, 0x20, 0x57, 0x46, 0xc8, 0x6d, 0xe9, 0x13, 0x77, 0x39,
-  0xe3, 0x5c, 0x56, 0x02, 0x35, 0x28, 0x99, 0x4f, 0x75, 0x75, 0x9d, 0x18,
-  0xb0, 0x3e, 0x08, 0x64, 0xdc, 0x0b, 0xa0, 0x31, 0x64, 0x57, 0xca, 0x7a,
-  0x82, 0x20, 0x79, 0x46, 0x21, 0x6c, 0xef, 0x13, 0xa3, 0x39, 0x39, 0x5f,
-  0x74, 0x05, 0xf4, 0x28, 0xf0, 0x4e, 0x75, 0x74, 0x3d, 0x1a, 0xfd, 0x41,
-  0x9f, 0x67, 0x51, 0x0d, 0x7c, 0x33, 0x20, 0x59, 0xc4, 0x7c, 0x84, 0x22,
-  0xa7, 0x48, 0x5c, 0x6e, 0x7c, 0x14, 0x55, 0x3a, 0x3c, 0x60, 0xd4, 0x07,
-  0xfe, 0x2d, 0x99, 0x53, 0xe9, 0x79, 0x45, 0x1f, 0x55, 0x45, 0x69, 0x6b,
-  0x70, 0x11, 0x45, 0x37, 0x04, 0x5d, 0x28, 0x03, 0x28, 0x29, 0x38, 0x4f,
-  0x20, 0x75, 0x3a, 0x1b, 0x26, 0x41, 0x21, 0x67, 0x35, 0x0d, 0x2f, 0x33,
-  0x64, 0x59, 0x3a, 0x7f, 0x1f, 0x25, 0x10, 0x4b, 0x78, 0x71, 0x61, 0x17,
-  0x10, 0x3d, 0x59, 0x63, 0xa5, 0x09, 0x96, 0x2f, 0xf5, 0x55, 0x95, 0x7b,
-  0x36, 0x20, 0x1c, 0x46, 0x7c, 0x6c, 0x51, 0x12, 0xad, 0x38, 0x82, 0x5e,
-  0xde, 0x04, 0x36, 0x2d, 0x34, 0x53, 0x4a, 0x79, 0x96, 0x1f, 0x87, 0x45,
-  0x3d, 0x6a, 0x78, 0x10, 0xb1, 0x36, 0xe7, 0x5c, 0x27, 0x05, 0x35, 0x2b,
-  0xa4, 0x51, 0xf2, 0x77, 0x64, 0x1c, 0x6e, 0x42, 0x9f, 0x68, 0xc8, 0x0e,
-  0x64, 0x37, 0xb0, 0x5d, 0xc4, 0x03, 0x08, 0x28, 0xe4, 0x4e, 0xc9, 0x74,
-  0x78, 0x1d, 0x90, 0x43, 0x74, 0x68, 0x47, 0x0e, 0xf5, 0x34, 0x0e, 0x5d,
-  0xb1, 0x03, 0xc1, 0x29, 0x44, 0x4e, 0xa5, 0x74, 0x75, 0x1d, 0x8b, 0x43,
-  0x14, 0x68, 0xed, 0x0e, 0x27, 0x37, 0xb2, 0x5d, 0x3e, 0x02, 0xb3, 0x28,
-  0x3d, 0x51, 0xa7, 0x77, 0x3d, 0x1c, 0xfd, 0x42, 0x30, 0x6b, 0xa5, 0x11,
-  0x11, 0x36, 0x91, 0x5c, 0x34, 0x05, 0xf1, 0x2b, 0x58, 0x50, 0xc8, 0x76,
-  0xe4, 0x1f, 0x18, 0x44, 0xf9, 0x6a, 0x52, 0x13, 0x3c, 0x38, 0x81, 0x5e,
-  0x78, 0x07, 0x9d, 0x2d, 0xb6, 0x52, 0x08, 0x7b, 0xd7, 0x21, 0xac, 0x46,
-  0x67, 0x6f, 0xd1, 0x15, 0x95, 0x3a, 0x7f, 0x63, 0x64, 0x08, 0xf4, 0x2e,
-  0xa3, 0x57, 0x35, 0x7c, 0x37, 0x25, 0xfa, 0x4b, 0xa2, 0x70, 0x6f, 0x19,
-  0x21, 0x3e, 0xee, 0x64, 0x84, 0x0d, 0x0b, 0x32, 0x1e, 0x5b, 0x4f, 0x00,
-  0xf9, 0x26, 0x8b, 0x4f, 0xe4, 0x74, 0x44, 0x1d, 0x7f, 0x42, 0x00, 0x6b,
-  0x74, 0x10, 0xd3, 0x36, 0xf9, 0x5f, 0x93, 0x04, 0xa0, 0x2d, 0x0d, 0x52,
-  0x49, 0x7b, 0x6a, 0x20, 0x61, 0x49, 0x17, 0x6e, 0x03, 0x17, 0x28, 0x3c,
-  0x28, 0x65, 0x3b, 0x0a, 0x70, 0x33, 0x21, 0x58, 0x26, 0x01, 0x34, 0x26,
-  0x20, 0x4f, 0x2d, 0x74, 0x21, 0x1d, 0x29, 0x42, 0x50, 0x6b, 0x0c, 0x10,
-  0x7a, 0x39, 0x25, 0x5e, 0x51, 0x07, 0x43, 0x2c, 0xe4, 0x55, 0x9c, 0x7a,
-  0xfc, 0x23, 0xc1, 0x48, 0x31, 0x70, 0x07, 0x19, 0x7e, 0x3e, 0x5c, 0x67,
-  0xb0, 0x0c, 0x88, 0x35, 0x90, 0x5a, 0x21, 0x02, 0x7d, 0x2b, 0x48, 0x50,
-  0x95, 0x79, 0xe3, 0x1e, 0x37, 0x46, 0x74, 0x6f, 0xbf, 0x14, 0xfb, 0x3d,
-  0x74, 0x65, 0x62, 0x0a, 0xb9, 0x33, 0xe9, 0x58, 0x2c, 0x00, 0x2d, 0x29,
-  0x9e, 0x4e, 0xca, 0x77, 0x60, 0x1f, 0xad, 0x44, 0xd9, 0x6d, 0x03, 0x15,
-  0xa3, 0x3a, 0x9d, 0x63, 0x72, 0x0b, 0x80, 0x30, 0x20, 0x58, 0x15, 0x01,
-  0xf1, 0x26, 0x77, 0x4e, 0xac, 0x77, 0xcc, 0x1c, 0x5e, 0x44, 0xe1, 0x6d,
-  0x39, 0x15, 0x8d, 0x3a, 0x15, 0x62, 0xa1, 0x0b, 0x20, 0x33, 0xfd, 0x58,
-  0x24, 0x00, 0xb0, 0x29, 0x38, 0x51, 0xb0, 0x76, 0x20, 0x1e, 0xb2, 0x47,
-  0x36, 0x6f, 0xb9, 0x14, 0x15, 0x3c, 0x97, 0x65, 0x38, 0x0d, 0xa5, 0x32,
-  0x49, 0x5a, 0xc2, 0x03, 0xb1, 0x2b, 0x5d, 0x53, 0xe7, 0x78, 0x5c, 0x20,
-  0x38, 0x48, 0x99, 0x71, 0x30, 0x19, 0xd3, 0x3e, 0xa1, 0x66, 0x08, 0x0e,
-  0xd4, 0x37, 0xe5, 0x5f, 0x60, 0x07, 0xca, 0x2c, 0xd0, 0x54, 0x68, 0x7c,
-  0x3c, 0x24, 0xe9, 0x4d, 0xa2, 0x75, 0x74, 0x1d, 0x37, 0x45, 0xe1, 0x6a,
-  0xf0, 0x12, 0x69, 0x3a, 0x2c, 0x62, 0xe8, 0x0b, 0xd0, 0x33, 0x46, 0x5b,
-  0x7b, 0x03, 0x2b, 0x2b, 0xd6, 0x50, 0x84, 0x78, 0xb6, 0x20, 0x50, 0x48,
-  0x71, 0x70, 0x01, 0x18, 0x3d, 0x40, 0xda, 0x69, 0xfe, 0x11, 0xdd, 0x39,
-  0xa5, 0x61, 0x41, 0x09, 0x57, 0x31, 0x6a, 0x59, 0x66, 0x01, 0x0c, 0x29,
-  0x04, 0x51, 0x25, 0x79, 0x29, 0x21, 0x71, 0x49, 0x5a, 0x71, 0x27, 0x19,
-  0x31, 0x41, 0x3c, 0x69, 0x3d, 0x11, 0x2d, 0x39, 0x28, 0x61, 0x28, 0x09,
-  0x1d, 0x31, 0x00, 0x59, 0x7a, 0x01, 0x71, 0x29, 0x10, 0x51, 0x44, 0x79,
-  0xb0, 0x21, 0xdd, 0x49, 0xff, 0x71, 0xdb, 0x19, 0x74, 0x40, 0x18, 0x68,
-  0x7f, 0x10, 0x4f, 0x38, 0xa1, 0x60, 0xcd, 0x08, 0xc0, 0x30, 0x2a, 0x5b,
-  0x63, 0x03, 0x40, 0x2b, 0x82, 0x53, 0xeb, 0x7b, 0x31, 0x22, 0x71, 0x4a,
-  0xf0, 0x72, 0xfd, 0x1a, 0x35, 0x45, 0x67, 0x6d, 0xb4, 0x15, 0xea, 0x3d,
-  0x25, 0x64, 0x7f, 0x0c, 0x95, 0x34, 0x89, 0x5c, 0x34, 0x07, 0xa4, 0x2f,
-  0xde, 0x57, 0x09, 0x7e, 0xe4, 0x26, 0xd2, 0x4e, 0x60, 0x79, 0x81, 0x21,
-  0x3d, 0x48, 0x58, 0x70, 0xf9, 0x18, 0x07, 0x43, 0xa1, 0x6b, 0x8d, 0x13,
-  0x59, 0x3a, 0xf1, 0x62, 0x3a, 0x0d, 0xc5, 0x35, 0x50, 0x5c, 0x99, 0x04,
-  0x2c, 0x2f, 0xb4, 0x57, 0x23, 0x7e, 0xf5, 0x26, 0x27, 0x51, 0xbd, 0x79,
-  0x3f, 0x20, 0xa8, 0x48, 0x28, 0x73, 0xa9, 0x1b, 0x5c, 0x42, 0xc5, 0x6a,
-  0x75, 0x15, 0xf1, 0x3d, 0x10, 0x64, 0xd9, 0x0c, 0xac, 0x37, 0x18, 0x5e,
-  0x9a, 0x06, 0x43, 0x31, 0x31, 0x58, 0x87, 0x00, 0x69, 0x2b, 0x9d, 0x53,
-  0xa8, 0x7a, 0x08, 0x25, 0xd1, 0x4d, 0xb6, 0x74, 0x60, 0x1f, 0x89, 0x47,
-  0xd0, 0x6e, 0x6c, 0x19, 0x28, 0x40, 0xf1, 0x68, 0xbf, 0x13, 0x62, 0x3a,
-  0x74, 0x65, 0xec, 0x0d, 0xbf, 0x34, 0x68, 0x5f, 0x64, 0x06, 0xf9, 0x2e,
-  0x9f, 0x59, 0x05, 0x00, 0x70, 0x2b, 0x20, 0x52, 0xc4, 0x7a, 0x88, 0x25,
-  0xb6, 0x4c, 0x50, 0x77, 0x79, 0x1e, 0x1b, 0x49, 0x31, 0x70, 0x95, 0x18,
-  0xe4, 0x43, 0x95, 0x6a, 0xa1, 0x15, 0x0d, 0x3c, 0x46, 0x67, 0x64, 0x0e,
-  0x78, 0x39, 0x10, 0x60, 0x15, 0x0b, 0x6d, 0x32, 0x2b, 0x5d, 0x3b, 0x04,
-  0x70, 0x2f, 0x21, 0x56, 0x3c, 0x01, 0x30, 0x28, 0x70, 0x53, 0x38, 0x7a,
-  0x2d, 0x25, 0x2a, 0x4c, 0x18, 0x77, 0x11, 0x1e, 0x7c, 0x49, 0x25, 0x70,
-  0x42, 0x1b, 0x48, 0x42, 0xa3, 0x6d, 0x94, 0x14, 0xe3, 0x3f, 0xc1, 0x66,
-  0x31, 0x10, 0x07, 0x3b, 0x30, 0x62, 0x4a, 0x0d, 0xac, 0x34, 0x84, 0x5f,
-  0xd3, 0x06, 0x2d, 0x30, 0x34, 0x5b, 0x52, 0x02, 0x9f, 0x2d, 0xf8, 0x54,
-  0x28, 0x7e, 0x79, 0x29, 0xda, 0x50, 0xfd, 0x7b, 0x35, 0x25, 0x63, 0x4c,
-  0xb5, 0x77, 0xbd, 0x1e, 0x26, 0x48, 0x68, 0x73, 0x95, 0x1a, 0xcb, 0x45,
-  0x34, 0x6f, 0xa4, 0x16, 0xd3, 0x41, 0x0e, 0x6b, 0xa1, 0x12, 0xcd, 0x3d,
-  0x64, 0x67, 0x90, 0x0e, 0x30, 0x38, 0x15, 0x63, 0xf2, 0x0a, 0x04, 0x34,
-  0xe4, 0x5f, 0xd9, 0x06, 0x58, 0x30, 0xe0, 0x5b, 0x34, 0x05, 0x91, 0x2c,
-  0x15, 0x56, 0xa1, 0x01, 0x21, 0x2b, 0xad, 0x52, 0x3f, 0x7c, 0xa7, 0x27,
-  0x20, 0x51, 0xb0, 0x78, 0x22, 0x22, 0xfa, 0x4d, 0x37, 0x77, 0xed, 0x1e,
-  0x13, 0x48, 0x8a, 0x73, 0x7a, 0x1d, 0xe3, 0x44, 0x59, 0x6e, 0xdf, 0x19,
-  0xa9, 0x43, 0x1c, 0x6d, 0xe4, 0x14, 0x5c, 0x3e, 0x3b, 0x68, 0x9b, 0x13,
-  0x30, 0x3d, 0xd0, 0x64, 0xa1, 0x0e, 0x0e, 0x38, 0xd8, 0x63, 0xa4, 0x0d,
-  0x7a, 0x37, 0xcc, 0x5e, 0x83, 0x08, 0x60, 0x32, 0x6a, 0x5c, 0x97, 0x07,
-  0xda, 0x31, 0x41, 0x5b, 0x3c, 0x05, 0xf0, 0x2c, 0xbe, 0x56, 0x31, 0x00,
-  0x64, 0x2a, 0xfe, 0x55, 0x95, 0x7f, 0x51, 0x29, 0x34, 0x53, 0x31, 0x7d,
-  0xd8, 0x24, 0x88, 0x4e, 0xe4, 0x78, 0x58, 0x22, 0x79, 0x4c, 0x12, 0x76,
-  0x3c, 0x20, 0xc1, 0x4b, 0xf8, 0x75, 0xdd, 0x1f, 0xb6, 0x49, 0x48, 0x73,
-  0x57, 0x1d, 0x6c, 0x47, 0x67, 0x71, 0x11, 0x1b, 0x15, 0x45, 0x3f, 0x6f,
-  0x64, 0x19, 0x29, 0x43, 0x3f, 0x6d, 0x75, 0x17, 0x20, 0x41, 0x3d, 0x6b,
-  0x39, 0x15, 0x2e, 0x3f, 0x64, 0x69, 0x3b, 0x13, 0x11, 0x3d, 0x09, 0x67,
-  0x61, 0x11, 0x60, 0x3b, 0x1c, 0x65, 0x0d, 0x0f, 0xa5, 0x39, 0x9e, 0x63,
-  0xe4, 0x0d, 0xdc, 0x37, 0x22, 0x60, 0x14, 0x0a, 0x64, 0x34, 0x58, 0x5e,
-  0xe4, 0x08, 0x99, 0x32, 0xd8, 0x5c, 0x20, 0x09, 0x34, 0x33, 0x51, 0x5d,
-  0x95, 0x07, 0xe1, 0x31, 0x21, 0x5a, 0x6d, 0x04, 0xbf, 0x2e, 0xe7, 0x58,
-  0x20, 0x05, 0x70, 0x2f, 0xa2, 0x59, 0xb1, 0x03, 0x64, 0x2c, 0x6c, 0x56,
-  0x9e, 0x00, 0xc1, 0x2a, 0x1e, 0x57, 0xa7, 0x01, 0xc9, 0x2b, 0x1d, 0x54,
-  0xa5, 0x7e, 0xce, 0x28, 0x63, 0x55, 0xd5, 0x7f, 0x20, 0x28, 0x5d, 0x52,
-  0xf5, 0x7c, 0x5d, 0x29, 0xa7, 0x53, 0xc2, 0x7d, 0x5e, 0x26, 0xe3, 0x50,
-  0x7d, 0x7d, 0x97, 0x27, 0x1d, 0x50, 0xac, 0x7a, 0x30, 0x27, 0xb4, 0x51,
-  0x3f, 0x7a, 0xbb, 0x24, 0x74, 0x51, 0xb8, 0x7b, 0x35, 0x24, 0xbe, 0x4e,
-  0x2c, 0x7b, 0xac, 0x25, 0x1e, 0x4e, 0x8c, 0x78, 0x67, 0x25, 0xe8, 0x4f,
-  0x1e, 0x78, 0x8d, 0x22, 0xe4, 0x4f, 0x34, 0x78, 0xf6, 0x22, 0x15, 0x4f,
-  0x20, 0x78, 0x9d, 0x22, 0x75, 0x4f, 0x9d, 0x79, 0xa1, 0x22, 0x04, 0x4f,
-  0xd7, 0x79, 0xad, 0x22, 0x60, 0x4f, 0xcd, 0x79, 0xd0, 0x22, 0x7f, 0x4f,
-  0x21, 0x78, 0xfa, 0x22, 0xb9, 0x4f, 0x66, 0x78, 0x20, 0x25, 0xf0, 0x4f,
-  0xa2, 0x78, 0x3d, 0x25, 0x2d, 0x4e, 0xfe, 0x78, 0xd0, 0x25, 0x56, 0x4e,
-  0x71, 0x7b, 0x31, 0x24, 0x90, 0x4e, 0x8e, 0x7b, 0xab, 0x24, 0x4f, 0x51,
-  0x62, 0x7a, 0x10, 0x27, 0x37, 0x50, 0xc1, 0x7a, 0xfc, 0x27, 0x84, 0x50,
-  0xe8, 0x7d, 0x0d, 0x26, 0x5e, 0x53, 0x6a, 0x7c, 0x1e, 0x29, 0x04, 0x52,
-  0x1e, 0x7f, 0x22, 0x28, 0x29, 0x55, 0x3c, 0x7e, 0x3c, 0x2b, 0x3c, 0x54,
-  0x31, 0x01, 0x26, 0x2a, 0x70, 0x57, 0x2e, 0x00, 0x2c, 0x2d, 0x22, 0x56,
-  0x05, 0x03, 0x09, 0x2c, 0x70, 0x59, 0x25, 0x02, 0x52, 0x2f, 0x48, 0x58,
-  0xe4, 0x05, 0x98, 0x2e, 0xe8, 0x5b, 0xc5, 0x04, 0x31, 0x30, 0x07, 0x5d,
-  0x79, 0x06, 0x58, 0x33, 0xaa, 0x5c, 0x8e, 0x09, 0xd5, 0x32, 0x21, 0x5e,
-  0x38, 0x0b, 0x05, 0x34, 0x92, 0x61, 0xf8, 0x0a, 0x30, 0x36, 0x3d, 0x63,
-  0xb2, 0x0c, 0xf0, 0x39, 0x23, 0x65, 0x74, 0x0e, 0xa2, 0x3b, 0xf8, 0x64,
-  0x64, 0x10, 0x20, 0x3d, 0xd0, 0x66, 0xcc, 0x13, 0x72, 0x3f, 0xe5, 0x68,
-  0xd9, 0x15, 0x19, 0x41, 0xe4, 0x6a, 0xd4, 0x17, 0x63, 0x43, 0xd5, 0x6c,
-  0x27, 0x18, 0x50, 0x45, 0xe4, 0x6e, 0x5d, 0x1a, 0xad, 0x47, 0xc3, 0x70,
-  0x53, 0x1c, 0xea, 0x49, 0x66, 0x75, 0x97, 0x1e, 0x15, 0x4a, 0xae, 0x77,
-  0x30, 0x23, 0xb1, 0x4c, 0x29, 0x78, 0xf9, 0x25, 0x74, 0x51, 0xa1, 0x7a,
-  0x38, 0x26, 0xb8, 0x53, 0x4e, 0x7f, 0xa3, 0x28, 0x1f, 0x54, 0x92, 0x01,
-  0x39, 0x2d, 0xe7, 0x56, 0x49, 0x02, 0xdd, 0x2f, 0xa5, 0x5b, 0x0e, 0x07,
-  0xe3, 0x30, 0x50, 0x5c, 0x30, 0x08, 0xd5, 0x35, 0x73, 0x61, 0xd2, 0x0a,
-  0xaa, 0x36, 0x0b, 0x62, 0xd9, 0x0f, 0xb7, 0x3b, 0x79, 0x67, 0xc4, 0x10,
-  0x84, 0x3c, 0x64, 0x68, 0x2b, 0x14, 0xf3, 0x41, 0xf0, 0x6d, 0x78, 0x19,
-  0x31, 0x45, 0xf6, 0x6e, 0xb8, 0x1a, 0x7c, 0x46, 0x2a, 0x72, 0xe4, 0x1f,
-  0x83, 0x4b, 0x48, 0x77, 0x34, 0x23, 0x32, 0x4f, 0xd9, 0x78, 0x81, 0x24,
-  0xa8, 0x50, 0x1d, 0x7c, 0x7e, 0x28, 0x1a, 0x54, 0x20, 0x00, 0x95, 0x2d,
-  0xe0, 0x59, 0x8f, 0x05, 0xab, 0x31, 0x59, 0x5d, 0x55, 0x09, 0x66, 0x35,
-  0x60, 0x61, 0x45, 0x0d, 0x09, 0x39, 0x22, 0x65, 0x31, 0x11, 0x7c, 0x3d,
-  0x5a, 0x69, 0x5f, 0x15, 0x1b, 0x41, 0x33, 0x6d, 0x70, 0x19, 0x3e, 0x45,
-  0x2b, 0x71, 0x38, 0x1d, 0x02, 0x49, 0x16, 0x75, 0x71, 0x21, 0x29, 0x4d,
-  0x10, 0x79, 0x5e, 0x25, 0xad, 0x51, 0x93, 0x7d, 0xf3, 0x29, 0xd0, 0x55,
-  0x74, 0x00, 0x01, 0x2c, 0x75, 0x58, 0x51, 0x04, 0xa1, 0x30, 0x9d, 0x5c,
-  0xdf, 0x08, 0x37, 0x37, 0x60, 0x63, 0x44, 0x0f, 0x84, 0x3b, 0xe4, 0x67,
-  0x2b, 0x12, 0x73, 0x3e, 0xf0, 0x6a, 0xfc, 0x16, 0x27, 0x45, 0x35, 0x71,
-  0xb9, 0x1d, 0xf0, 0x49, 0x34, 0x74, 0x62, 0x20, 0x83, 0x4c, 0xd6, 0x78,
-  0x7d, 0x27, 0xa7, 0x53, 0xdc, 0x7f, 0x08, 0x2a, 0xe8, 0x56, 0x9d, 0x02,
-  0x64, 0x31, 0x9d, 0x5d, 0x3d, 0x08, 0x46, 0x34, 0xb0, 0x60, 0x14, 0x0f,
-  0xb7, 0x3b, 0x8d, 0x67, 0x51, 0x12, 0xe9, 0x3e, 0x78, 0x6d, 0xc5, 0x19,
-  0x04, 0x44, 0xa2, 0x70, 0x30, 0x1f, 0xbc, 0x4b, 0x3c, 0x76, 0xb9, 0x22,
-  0x2d, 0x51, 0xf5, 0x7d, 0x22, 0x28, 0xb4, 0x54, 0x20, 0x03, 0xa4, 0x2f,
-  0x13, 0x5a, 0x90, 0x06, 0x78, 0x35, 0xea, 0x61, 0x45, 0x0c, 0xde, 0x38,
-  0xea, 0x67, 0x7a, 0x12, 0xfa, 0x3e, 0x5a, 0x6d, 0x21, 0x18, 0x87, 0x44,
-  0x7e, 0x73, 0xdc, 0x1f, 0xa8, 0x4a, 0xd9, 0x77, 0xf6, 0x25, 0xac, 0x50,
-  0x66, 0x7f, 0xc0, 0x2b, 0x96, 0x56, 0x61, 0x05, 0x2d, 0x30, 0xf8, 0x5c,
-  0xa3, 0x0b, 0x35, 0x36, 0x23, 0x65, 0xf0, 0x11, 0xa2, 0x3c, 0x78, 0x6b,
-  0x64, 0x16, 0xf8, 0x42, 0x83, 0x71, 0x4c, 0x1c, 0x7a, 0x4b, 0x22, 0x76,
-  0x90, 0x22, 0x99, 0x51, 0xac, 0x7c, 0x54, 0x2b, 0x63, 0x56, 0x55, 0x05,
-  0x30, 0x30, 0xc0, 0x5c, 0xe3, 0x0b, 0x89, 0x36, 0xbd, 0x65, 0x0d, 0x10,
-  0x5f, 0x3f, 0x69, 0x6a, 0x70, 0x19, 0x45, 0x44, 0x1a, 0x73, 0x22, 0x1e,
-  0x31, 0x4d, 0x2f, 0x78, 0x3e, 0x27, 0x34, 0x52, 0x38, 0x01, 0x75, 0x2c,
-  0x31, 0x5b, 0x2e, 0x06, 0x64, 0x35, 0x2c, 0x60, 0x50, 0x0f, 0x17, 0x3a,
-  0x71, 0x69, 0x76, 0x14, 0x44, 0x43, 0x44, 0x6e, 0xaa, 0x1d, 0x9a, 0x48,
-  0xb0, 0x77, 0xc6, 0x22, 0x24, 0x50, 0x1a, 0x7f, 0x64, 0x2a, 0x1d, 0x59,
-  0xb1, 0x04, 0x83, 0x33, 0xc4, 0x5e, 0x2c, 0x0c, 0x78, 0x3b, 0x05, 0x66,
-  0x89, 0x15, 0xe2, 0x40, 0x31, 0x6e, 0x3d, 0x1d, 0xa3, 0x48, 0xf6, 0x77,
-  0x35, 0x25, 0x67, 0x50, 0xb5, 0x7f, 0xf9, 0x2a, 0x64, 0x58, 0x79, 0x07,
-  0x98, 0x32, 0xc0, 0x61, 0x79, 0x0f, 0xe5, 0x3a, 0xdf, 0x69, 0x0b, 0x17,
-  0xa2, 0x42, 0x93, 0x71, 0x30, 0x1f, 0xd5, 0x4a, 0x1d, 0x78, 0x41, 0x27,
-  0xb0, 0x52, 0x0f, 0x00, 0xa1, 0x2f, 0xcc, 0x5a, 0x54, 0x08, 0xf6, 0x37,
-  0x2e, 0x65, 0xef, 0x10, 0x7a, 0x3e, 0x89, 0x6d, 0x25, 0x1b, 0xa4, 0x46,
-  0x70, 0x74, 0xe4, 0x23, 0x6e, 0x51, 0xf5, 0x7c, 0x07, 0x2a, 0xb8, 0x59,
-  0x64, 0x07, 0xa5, 0x32, 0x11, 0x60, 0x93, 0x0f, 0x71, 0x3d, 0xa5, 0x68,
-  0x42, 0x16, 0xc8, 0x45, 0xa5, 0x73, 0x1e, 0x21, 0xf8, 0x4c, 0x50, 0x7a,
-  0x30, 0x28, 0xd5, 0x57, 0x67, 0x05, 0xd5, 0x30, 0xa5, 0x5e, 0x19, 0x0c,
-  0x90, 0x3b, 0xb6, 0x69, 0x71, 0x17, 0xc0, 0x42, 0x9d, 0x70, 0x7e, 0x1e,
-  0x64, 0x4c, 0xe9, 0x7b, 0xbf, 0x29, 0x35, 0x57, 0x36, 0x05, 0xf0, 0x30,
-  0xf0, 0x5e, 0x69, 0x0c, 0x2c, 0x3a, 0xe8, 0x69, 0xd0, 0x17, 0x43, 0x45,
-  0x7d, 0x73, 0x2b, 0x21, 0xd1, 0x4c, 0x81, 0x7a, 0xe4, 0x28, 0x54, 0x56,
-  0x7e, 0x04, 0x55, 0x32, 0x35, 0x60, 0x95, 0x0f, 0xe3, 0x3d, 0x98, 0x6b,
-  0xb6, 0x19, 0x44, 0x47, 0x55, 0x75, 0x76, 0x23, 0x34, 0x51, 0x0a, 0x7f,
-  0x16, 0x2d, 0x6d, 0x5b, 0x34, 0x09, 0x28, 0x37, 0x2a, 0x65, 0x2f, 0x13,
-  0x38, 0x41, 0x30, 0x6f, 0x23, 0x1d, 0x7d, 0x4b, 0x23, 0x79, 0x38, 0x27,
-  0x11, 0x55, 0x17, 0x03, 0x70, 0x31, 0x6c, 0x5f, 0x5e, 0x0d, 0x4a, 0x3b,
-  0xe4, 0x69, 0x9c, 0x17, 0xfe, 0x45, 0x95, 0x73, 0x35, 0x20, 0x1b, 0x4e,
-  0x73, 0x7c, 0x54, 0x2a, 0xa1, 0x58, 0x83, 0x06, 0xc4, 0x34, 0x65, 0x65,
-  0x60, 0x13, 0x57, 0x41, 0x95, 0x6f, 0xec, 0x1d, 0x37, 0x4a, 0x68, 0x78,
-  0xa2, 0x26, 0xf0, 0x54, 0x7a, 0x05, 0x35, 0x33, 0xf0, 0x61, 0xd4, 0x0f,
-  0x64, 0x3c, 0x7e, 0x6a, 0x85, 0x18, 0xd6, 0x46, 0x64, 0x77, 0xa0, 0x25,
-  0xd3, 0x53, 0x19, 0x00, 0xe4, 0x2e, 0xd0, 0x5c, 0x7f, 0x0d, 0x86, 0x3b,
-  0x20, 0x68, 0x15, 0x16, 0xf1, 0x44, 0x19, 0x75, 0xb2, 0x23, 0xc8, 0x51,
-  0x5e, 0x7e, 0xf1, 0x2c, 0x61, 0x5d, 0x97, 0x0b, 0x15, 0x38, 0xbf, 0x66,
-  0x37, 0x17, 0xfd, 0x45, 0x37, 0x72, 0xbc, 0x20, 0x22, 0x51, 0xb0, 0x7f,
-  0x70, 0x2c, 0xa8, 0x5a, 0x34, 0x0b, 0xed, 0x39, 0x1c, 0x66, 0x8a, 0x14,
-  0x7a, 0x45, 0xe2, 0x73, 0x10, 0x20, 0xcf, 0x4e, 0xa1, 0x7f, 0x1b, 0x2c,
-  0xff, 0x5a, 0x47, 0x0b, 0x31, 0x38, 0xd5, 0x66, 0x64, 0x17, 0xd5, 0x45,
-  0xad, 0x72, 0x1e, 0x23, 0x90, 0x51, 0xb5, 0x7e, 0x7b, 0x2f, 0xcc, 0x5d,
-  0x9e, 0x0a, 0x79, 0x3b, 0x68, 0x68, 0xbd, 0x16, 0xb2, 0x47, 0x60, 0x74,
-  0x20, 0x25, 0xb5, 0x53, 0xa7, 0x00, 0x78, 0x31, 0x63, 0x5e, 0xff, 0x0c,
-  0x95, 0x3d, 0x05, 0x6a, 0x67, 0x1b, 0x2a, 0x48, 0x90, 0x76, 0x8e, 0x27,
-  0xa8, 0x54, 0x52, 0x05, 0x63, 0x32, 0x10, 0x63, 0x75, 0x10, 0x95, 0x3e,
-  0xb0, 0x6f, 0xaa, 0x1c, 0xa1, 0x4d, 0x0d, 0x7a, 0x5d, 0x2b, 0x70, 0x58,
-  0x67, 0x09, 0x11, 0x36, 0x50, 0x67, 0x3d, 0x14, 0x36, 0x45, 0x38, 0x72,
-  0x23, 0x23, 0x26, 0x50, 0x74, 0x01, 0x3a, 0x2e, 0x3e, 0x5f, 0x7c, 0x0c,
-  0x4e, 0x3d, 0x47, 0x6a, 0x34, 0x1b, 0x04, 0x48, 0x6d, 0x79, 0x25, 0x26,
-  0x01, 0x57, 0x17, 0x04, 0xe4, 0x35, 0xad, 0x62, 0xbe, 0x13, 0xe6, 0x40,
-  0x7a, 0x70, 0x4f, 0x21, 0x30, 0x4e, 0x74, 0x7f, 0xb0, 0x2c, 0xca, 0x5d,
-  0xc3, 0x0a, 0x65, 0x3a, 0x75, 0x6b, 0x05, 0x18, 0x97, 0x49, 0xe2, 0x76,
-  0x2b, 0x26, 0x79, 0x57, 0xf0, 0x04, 0xe1, 0x35, 0x3c, 0x65, 0x7c, 0x12,
-  0xbe, 0x43, 0xfa, 0x70, 0x64, 0x20, 0x79, 0x51, 0x98, 0x7e, 0xc0, 0x2f,
-  0x34, 0x5f, 0xac, 0x0c, 0xc3, 0x3d, 0x01, 0x6d, 0xa5, 0x1a, 0xd3, 0x4b,
-  0x74, 0x7b, 0xd5, 0x28, 0x3d, 0x58, 0x46, 0x09, 0xb0, 0x36, 0x09, 0x66,
-  0xb6, 0x17, 0xc2, 0x44, 0x40, 0x74, 0xec, 0x25, 0x77, 0x55, 0x84, 0x02,
-  0x1c, 0x32, 0xe3, 0x63, 0x64, 0x13, 0xfd, 0x40, 0x07, 0x70, 0xb0, 0x21,
-  0x74, 0x51, 0xa6, 0x7e, 0x38, 0x2e, 0xb2, 0x5f, 0x31, 0x0f, 0xa1, 0x3c,
-  0x14, 0x6c, 0xc5, 0x1d, 0x7c, 0x4d, 0xe4, 0x7a, 0x46, 0x2a, 0xc8, 0x5b,
-  0xe4, 0x0b, 0x1b, 0x3b, 0xff, 0x68, 0x5a, 0x18, 0x30, 0x48, 0xd5, 0x79,
-  0x76, 0x29, 0xd2, 0x56, 0xb6, 0x06, 0x4d, 0x36, 0xc7, 0x67, 0xa0, 0x17,
-  0x71, 0x47, 0xce, 0x74, 0x83, 0x24, 0x2c, 0x54, 0x4e, 0x04, 0x97, 0x35,
-  0x94, 0x65, 0x74, 0x15, 0x2d, 0x45, 0xb5, 0x72, 0xe2, 0x22, 0x27, 0x52,
-  0x64, 0x02, 0xd9, 0x33, 0x98, 0x63, 0x40, 0x13, 0x34, 0x43, 0x33, 0x73,
-  0xd1, 0x20, 0x98, 0x50, 0xa8, 0x00, 0x49, 0x30, 0x30, 0x60, 0x14, 0x10,
-  0x24, 0x40, 0xc5, 0x71, 0xf5, 0x21, 0x9c, 0x51, 0xb6, 0x01, 0x5e, 0x31,
-  0x10, 0x61, 0x71, 0x11, 0x7b, 0x41, 0x45, 0x71, 0x12, 0x21, 0x28, 0x51,
-  0x64, 0x01, 0x2e, 0x31, 0x35, 0x61, 0x34, 0x11, 0x38, 0x41, 0x30, 0x71,
-  0x34, 0x21, 0x7d, 0x51, 0x26, 0x01, 0x34, 0x31, 0x50, 0x61, 0x04, 0x11,
-  0x34, 0x41, 0x68, 0x71, 0x49, 0x21, 0x5e, 0x51, 0xb0, 0x01, 0x98, 0x31,
-  0xe2, 0x61, 0xdc, 0x11, 0x3b, 0x40, 0x00, 0x70, 0x63, 0x20, 0x1d, 0x50,
-  0xa2, 0x00, 0x82, 0x30, 0xc2, 0x60, 0x26, 0x13, 0x71, 0x43, 0x05, 0x73,
-  0xdd, 0x23, 0xad, 0x53, 0x30, 0x02, 0x75, 0x32, 0xb5, 0x62, 0xb5, 0x12,
-  0x30, 0x45, 0x7a, 0x75, 0xbf, 0x25, 0xef, 0x55, 0x64, 0x04, 0x7a, 0x34,
-  0x9f, 0x64, 0xcb, 0x14, 0x33, 0x47, 0xb1, 0x77, 0x90, 0x27, 0x0f, 0x56,
-  0xb1, 0x06, 0xd9, 0x36, 0x77, 0x69, 0x90, 0x19, 0x74, 0x48, 0x54, 0x78,
-  0xfe, 0x28, 0x5d, 0x5b, 0xad, 0x0b, 0xc3, 0x3b, 0x53, 0x6a, 0xed, 0x1a,
-  0x3a, 0x4d, 0xc5, 0x7d, 0x50, 0x2c, 0x9a, 0x5c, 0x21, 0x0f, 0xfd, 0x3f,
-  0x34, 0x6e, 0xba, 0x1e, 0x3a, 0x51, 0xf2, 0x01, 0x24, 0x30, 0xfd, 0x60,
-  0x2c, 0x13, 0xac, 0x43, 0x06, 0x72, 0x80, 0x22, 0x34, 0x55, 0xf1, 0x05,
-  0x58, 0x34, 0xc8, 0x64, 0xe4, 0x17, 0x0f, 0x46, 0xf5, 0x76, 0x46, 0x29,
-  0x3b, 0x58, 0x80, 0x08, 0x62, 0x3b, 0xde, 0x6b, 0xa1, 0x1a, 0x1e, 0x4d,
-  0x90, 0x7d, 0xb1, 0x2c, 0x7b, 0x5f, 0x85, 0x0f, 0x92, 0x3e, 0x61, 0x71,
-  0x2b, 0x20, 0xea, 0x50, 0xf0, 0x03, 0x7c, 0x32, 0x20, 0x65, 0xb5, 0x15,
-  0xbf, 0x44, 0x6d, 0x77, 0x21, 0x26, 0xe3, 0x56, 0xdc, 0x09, 0x05, 0x38,
-  0x75, 0x6b, 0x2b, 0x1a, 0xd4, 0x4a, 0xcd, 0x7d, 0x8d, 0x2c, 0x1d, 0x5f,
-  0x67, 0x0e, 0x1a, 0x41, 0x21, 0x70, 0xd9, 0x20, 0xf4, 0x53, 0x93, 0x02,
-  0xe3, 0x35, 0x59, 0x64, 0x10, 0x17, 0x77, 0x46, 0x7d, 0x79, 0x16, 0x28,
-  0x1b, 0x5b, 0x6d, 0x0a, 0x20, 0x3d, 0x3c, 0x6c, 0x3d, 0x1f, 0x34, 0x4e,
-  0x33, 0x01, 0x3c, 0x30, 0x3e, 0x63, 0x3a, 0x12, 0x64, 0x45, 0x39, 0x74,
-  0x18, 0x27, 0x00, 0x56, 0x34, 0x09, 0x66, 0x38, 0x5f, 0x6b, 0x43, 0x1a,
-  0xb0, 0x4d, 0x98, 0x7c, 0xfe, 0x2f, 0xc1, 0x5e, 0x27, 0x10, 0x55, 0x43,
-  0x75, 0x72, 0x4b, 0x25, 0xa1, 0x54, 0x83, 0x07, 0x90, 0x36, 0x2c, 0x68,
-  0x72, 0x1b, 0x05, 0x4a, 0x87, 0x7d, 0xe8, 0x2c, 0x64, 0x5e, 0x79, 0x11,
-  0xb9, 0x40, 0xf1, 0x73, 0x7a, 0x25, 0x35, 0x54, 0xf0, 0x07, 0xca, 0x36,
-  0x21, 0x68, 0x2a, 0x1b, 0x9c, 0x4a, 0xc9, 0x7d, 0x34, 0x2f, 0xad, 0x5e,
-  0xd1, 0x11, 0x1b, 0x43, 0xa1, 0x72, 0x9d, 0x25, 0x64, 0x57, 0x9a, 0x06,
-  0x74, 0x38, 0x53, 0x6b, 0xf9, 0x1a, 0x1a, 0x4c, 0xb1, 0x7f, 0xdf, 0x2e,
-  0x55, 0x60, 0xa5, 0x13, 0x7b, 0x45, 0x90, 0x74, 0x04, 0x26, 0xed, 0x59,
-  0x30, 0x0b, 0xb5, 0x3a, 0x35, 0x6c, 0xf5, 0x1f, 0x38, 0x51, 0xba, 0x00,
-  0x33, 0x32, 0xb6, 0x65, 0x64, 0x17, 0xa0, 0x46, 0x15, 0x78, 0x86, 0x2b,
-  0x7c, 0x5d, 0xe4, 0x0c, 0x5e, 0x3e, 0xc4, 0x71, 0xb7, 0x23, 0x10, 0x55,
-  0xbe, 0x04, 0x3f, 0x36, 0x5e, 0x68, 0xb1, 0x1b, 0x71, 0x4d, 0xc4, 0x7c,
-  0xe4, 0x2e, 0x5e, 0x60, 0x8a, 0x13, 0xe5, 0x45, 0x40, 0x77, 0xcd, 0x26,
-  0x95, 0x58, 0x2d, 0x0a, 0x20, 0x3c, 0xf2, 0x6f, 0xbf, 0x21, 0x67, 0x53,
-  0x74, 0x05, 0xe1, 0x34, 0xbf, 0x66, 0x3d, 0x18, 0x30, 0x4a, 0xe5, 0x7d,
-  0x95, 0x2f, 0x05, 0x61, 0x62, 0x13, 0x24, 0x45, 0xc5, 0x74, 0x81, 0x26,
-  0xb0, 0x58, 0x1d, 0x0a, 0x78, 0x3c, 0x14, 0x6e, 0x27, 0x20, 0x95, 0x53,
-  0xf1, 0x05, 0xdd, 0x37, 0xaa, 0x69, 0x58, 0x1b, 0x5d, 0x4d, 0x67, 0x7f,
-  0x71, 0x31, 0x17, 0x63, 0x50, 0x15, 0x2e, 0x47, 0x25, 0x79, 0x2f, 0x2b,
-  0x26, 0x5d, 0x30, 0x0f, 0x30, 0x41, 0x75, 0x73, 0x39, 0x25, 0x33, 0x57,
-  0x30, 0x09, 0x22, 0x3b, 0x50, 0x6d, 0x0c, 0x1f, 0x60, 0x51, 0x2b, 0x03,
-  0x10, 0x35, 0x0d, 0x67, 0x81, 0x19, 0x9c, 0x4b, 0xf3, 0x7d, 0xdd, 0x2f,
-  0x74, 0x60, 0x07, 0x12, 0x7f, 0x44, 0x52, 0x76, 0xa9, 0x28, 0xcd, 0x5a,
-  0xdc, 0x0c, 0x20, 0x41, 0x75, 0x73, 0x41, 0x25, 0x99, 0x57, 0xe3, 0x09,
-  0x23, 0x3a, 0x3d, 0x6c, 0xa5, 0x1e, 0xe5, 0x50, 0x74, 0x05, 0x61, 0x37,
-  0xbf, 0x69, 0xbd, 0x1b, 0x30, 0x4c, 0x65, 0x7e, 0x95, 0x30, 0x85, 0x62,
-  0x62, 0x17, 0xa4, 0x49, 0xc5, 0x7b, 0x01, 0x2c, 0xb0, 0x5e, 0x9d, 0x10,
-  0x78, 0x45, 0x94, 0x77, 0x27, 0x28, 0x15, 0x5a, 0xfd, 0x0c, 0x12, 0x41,
-  0xb6, 0x73, 0xc8, 0x25, 0x10, 0x56, 0xeb, 0x08, 0x61, 0x3d, 0x88, 0x6f,
-  0x12, 0x20, 0xa8, 0x52, 0x36, 0x07, 0xae, 0x39, 0x70, 0x6a, 0xba, 0x1c,
-  0x26, 0x51, 0xf5, 0x03, 0x23, 0x34, 0xa4, 0x66, 0x29, 0x1b, 0xaf, 0x4d,
-  0x1f, 0x7e, 0x89, 0x30, 0x67, 0x65, 0xa5, 0x17, 0x55, 0x48, 0xc0, 0x7a,
-  0xa6, 0x2f, 0x18, 0x60, 0xf4, 0x12, 0x51, 0x47, 0x31, 0x78, 0x91, 0x2a,
-  0x30, 0x5f, 0xd4, 0x11, 0xaa, 0x42, 0x4d, 0x77, 0xdd, 0x29, 0xaa, 0x5a,
-  0x67, 0x0f, 0xc4, 0x41, 0x99, 0x72, 0x6e, 0x27, 0x37, 0x58, 0xbd, 0x0a,
-  0xb9, 0x3f, 0x7b, 0x70, 0x74, 0x25, 0xe1, 0x57, 0xb8, 0x08, 0x78, 0x3d,
-  0x64, 0x6e, 0xeb, 0x20, 0x9c, 0x55, 0x4a, 0x06, 0x7b, 0x3b, 0x37, 0x6c,
-  0xc3, 0x1e, 0xc3, 0x53, 0xe4, 0x04, 0x1d, 0x39, 0x47, 0x6a, 0x10, 0x1f,
-  0x74, 0x50, 0xd0, 0x02, 0xe6, 0x37, 0x98, 0x68, 0xaa, 0x1d, 0x0d, 0x4e,
-  0x56, 0x03, 0x6a, 0x34, 0x61, 0x69, 0x0b, 0x1a, 0x14, 0x4f, 0x6d, 0x00,
-  0x25, 0x35, 0x7d, 0x66, 0x23, 0x1b, 0x21, 0x4c, 0x26, 0x01, 0x34, 0x32,
-  0x3e, 0x67, 0x3a, 0x18, 0x21, 0x4d, 0x6d, 0x7e, 0x17, 0x33, 0x09, 0x64,
-  0x75, 0x19, 0x76, 0x4a, 0x43, 0x7f, 0x0d, 0x30, 0xab, 0x65, 0x8f, 0x16,
-  0xf2, 0x4b, 0x95, 0x7c, 0x3d, 0x30, 0x1b, 0x65, 0x30, 0x16, 0x49, 0x4b,
-  0xac, 0x7c, 0x88, 0x31, 0x90, 0x62, 0x24, 0x16, 0x7a, 0x4b, 0x51, 0x7c,
-  0x95, 0x31, 0xee, 0x62, 0x2c, 0x16, 0x7c, 0x4b, 0xbd, 0x7c, 0xf7, 0x31,
-  0x31, 0x65, 0x67, 0x16, 0xf0, 0x4b, 0xf2, 0x7c, 0x2a, 0x30, 0x2d, 0x65,
-  0x91, 0x16, 0x85, 0x4b, 0x64, 0x7f, 0xa0, 0x30, 0xd4, 0x65, 0x08, 0x19,
-  0xb7, 0x4a, 0xc9, 0x7f, 0x71, 0x33, 0x99, 0x64, 0x74, 0x18, 0x5c, 0x4d,
-  0xe4, 0x7e, 0x0e, 0x32, 0xa1, 0x67, 0xc1, 0x18, 0x56, 0x4c, 0xa5, 0x01,
-  0x78, 0x35, 0x84, 0x66, 0x12, 0x1a, 0xa8, 0x4f, 0x28, 0x03, 0xb8, 0x34,
-  0x34, 0x68, 0xf5, 0x1d, 0x23, 0x51, 0xbc, 0x02, 0x24, 0x36, 0xb5, 0x6b,
-  0x64, 0x1f, 0xac, 0x50, 0x50, 0x04, 0x8b, 0x39, 0x61, 0x6d, 0xe8, 0x1e,
-  0x52, 0x52, 0xc8, 0x07, 0xb6, 0x3b, 0x53, 0x6f, 0xb0, 0x20, 0x15, 0x54,
-  0x03, 0x08, 0x9d, 0x3d, 0x71, 0x71, 0xc9, 0x22, 0xe4, 0x56, 0x0e, 0x0a,
-  0xdf, 0x3f, 0xb0, 0x73, 0x78, 0x27, 0xc1, 0x58, 0xd0, 0x0c, 0x79, 0x40,
-  0x2c, 0x74, 0xf8, 0x29, 0xa9, 0x5d, 0x35, 0x11, 0x39, 0x45, 0xf0, 0x76,
-  0xb1, 0x2a, 0x73, 0x5e, 0x7b, 0x12, 0x87, 0x47, 0xfa, 0x7b, 0x61, 0x2f,
-  0x75, 0x63, 0x3c, 0x17, 0x90, 0x48, 0xd8, 0x7c, 0xfe, 0x30, 0x1d, 0x64,
-  0x47, 0x18, 0x10, 0x4c, 0x74, 0x00, 0xd3, 0x35, 0xf9, 0x69, 0x93, 0x1d,
-  0xa5, 0x51, 0x41, 0x05, 0x5c, 0x39, 0x7c, 0x6d, 0x34, 0x21, 0x07, 0x55,
-  0x05, 0x09, 0x24, 0x3d, 0x28, 0x71, 0x29, 0x25, 0x70, 0x59, 0x20, 0x0d,
-  0x24, 0x41, 0x75, 0x75, 0x24, 0x29, 0x35, 0x5d, 0x21, 0x11, 0x6d, 0x45,
-  0x13, 0x79, 0x0a, 0x2d, 0x61, 0x61, 0x77, 0x15, 0x51, 0x49, 0x4a, 0x7d,
-  0xa1, 0x31, 0xdd, 0x65, 0xe4, 0x19, 0xda, 0x4d, 0x74, 0x00, 0x01, 0x34,
-  0x7f, 0x68, 0x48, 0x1c, 0xa7, 0x50, 0x85, 0x04, 0x90, 0x38, 0x31, 0x6f,
-  0x7c, 0x23, 0x40, 0x57, 0xd0, 0x0b, 0xfe, 0x3f, 0x30, 0x72, 0x6f, 0x26,
-  0xb1, 0x5a, 0xfb, 0x0e, 0x33, 0x45, 0x70, 0x79, 0xf0, 0x2d, 0xf2, 0x61,
-  0x36, 0x14, 0x6f, 0x48, 0xd0, 0x7c, 0xcc, 0x30, 0x7a, 0x67, 0xe5, 0x1b,
-  0xc4, 0x4f, 0x05, 0x02, 0xa1, 0x36, 0x9d, 0x6a, 0x71, 0x21, 0x9b, 0x55,
-  0x20, 0x08, 0x50, 0x3c, 0xf3, 0x70, 0x15, 0x27, 0xa5, 0x5b, 0xc0, 0x0f,
-  0x52, 0x42, 0xe0, 0x76, 0x66, 0x2d, 0xcb, 0x61, 0x50, 0x14, 0xed, 0x48,
-  0x0d, 0x7f, 0xa9, 0x33, 0x70, 0x66, 0xb3, 0x1a, 0x38, 0x51, 0xb4, 0x05,
-  0x23, 0x38, 0xb5, 0x6c, 0x21, 0x23, 0xbe, 0x57, 0x50, 0x0a, 0x86, 0x3e,
-  0x7b, 0x75, 0xe9, 0x29, 0x5f, 0x5c, 0xdf, 0x10, 0xb7, 0x47, 0x5d, 0x7a,
-  0xf1, 0x2e, 0x46, 0x65, 0x74, 0x18, 0x82, 0x4c, 0x75, 0x03, 0x9d, 0x37,
-  0xa7, 0x6a, 0x0c, 0x21, 0xc2, 0x55, 0xb7, 0x08, 0x6d, 0x3f, 0x85, 0x73,
-  0x99, 0x26, 0x79, 0x5d, 0x64, 0x10, 0xfb, 0x44, 0xa2, 0x7b, 0x7a, 0x2e,
-  0x39, 0x65, 0xb5, 0x19, 0xa2, 0x4c, 0x72, 0x03, 0x2b, 0x36, 0xe0, 0x6a,
-  0xd0, 0x21, 0x51, 0x54, 0x7b, 0x0b, 0x65, 0x3e, 0xc2, 0x72, 0x82, 0x29,
-  0xab, 0x5c, 0x50, 0x13, 0x3c, 0x46, 0x55, 0x7d, 0x35, 0x30, 0xdb, 0x64,
-  0xf4, 0x1b, 0xdd, 0x4e, 0xb7, 0x05, 0x42, 0x38, 0x5d, 0x6f, 0x60, 0x22,
-  0x60, 0x59, 0x0c, 0x0c, 0x1d, 0x43, 0x28, 0x76, 0x37, 0x2d, 0x7d, 0x60,
-  0x24, 0x17, 0x3d, 0x4a, 0x31, 0x01, 0x75, 0x34, 0x23, 0x6b, 0x24, 0x1e,
-  0x29, 0x55, 0x2f, 0x08, 0x1f, 0x3f, 0x09, 0x72, 0x67, 0x29, 0x25, 0x5c,
-  0x59, 0x13, 0x43, 0x46, 0xe4, 0x7d, 0x89, 0x30, 0xf8, 0x67, 0xd0, 0x1a,
-  0x74, 0x50, 0x07, 0x07, 0x7f, 0x3a, 0x52, 0x71, 0xa9, 0x24, 0x9e, 0x5b,
-  0x90, 0x0e, 0x23, 0x44, 0x78, 0x7b, 0x44, 0x2e, 0x83, 0x65, 0xe5, 0x18,
-  0x64, 0x4e, 0x7e, 0x05, 0xbf, 0x38, 0xf9, 0x6f, 0x3b, 0x25, 0x67, 0x58,
-  0xa3, 0x0f, 0xbd, 0x42, 0x25, 0x78, 0x7e, 0x2f, 0xd0, 0x62, 0xd2, 0x19,
-  0x71, 0x4f, 0xa9, 0x02, 0xdc, 0x39, 0x43, 0x6f, 0xe4, 0x22, 0x9d, 0x59,
-  0x59, 0x0f, 0x81, 0x42, 0x74, 0x78, 0x46, 0x2f, 0xf9, 0x62, 0x10, 0x18,
-  0xb4, 0x4f, 0xc1, 0x02, 0x49, 0x38, 0xa5, 0x6f, 0x71, 0x25, 0x93, 0x58,
-  0x11, 0x0e, 0xbd, 0x45, 0x2b, 0x7b, 0xaf, 0x2e, 0x31, 0x64, 0xa1, 0x1b,
-  0x31, 0x51, 0xa6, 0x04, 0x70, 0x3a, 0xb4, 0x71, 0x22, 0x27, 0xed, 0x5a,
-  0x07, 0x10, 0x80, 0x47, 0x34, 0x7d, 0xf1, 0x30, 0x42, 0x66, 0xd4, 0x1d,
-  0xe4, 0x53, 0x09, 0x09, 0xff, 0x3c, 0x15, 0x72, 0x38, 0x28, 0x90, 0x5f,
-  0x71, 0x15, 0xcb, 0x48, 0xa1, 0x7e, 0x4d, 0x34, 0xc7, 0x6b, 0xac, 0x21,
-  0x60, 0x57, 0xcd, 0x0a, 0xd0, 0x40, 0x64, 0x76, 0x30, 0x2c, 0xb1, 0x63,
-  0xf0, 0x19, 0x77, 0x4f, 0x21, 0x05, 0xe1, 0x38, 0xf0, 0x6e, 0x7c, 0x24,
-  0x2a, 0x5a, 0xe2, 0x11, 0x84, 0x47, 0x4d, 0x7d, 0x71, 0x33, 0x37, 0x69,
-  0x90, 0x1c, 0x8c, 0x52, 0xb4, 0x08, 0x4d, 0x3e, 0x75, 0x74, 0x14, 0x2a,
-  0x26, 0x60, 0xc6, 0x17, 0xb0, 0x4d, 0x92, 0x03, 0xaa, 0x39, 0x0d, 0x6f,
-  0x44, 0x25, 0x6d, 0x5b, 0x71, 0x11, 0x45, 0x47, 0x00, 0x7d, 0x28, 0x33,
-  0x20, 0x69, 0x38, 0x1f, 0x23, 0x55, 0x21, 0x0b, 0x35, 0x41, 0x39, 0x77,
-  0x70, 0x2d, 0x34, 0x63, 0x2a, 0x19, 0x6d, 0x4f, 0x04, 0x05, 0x0d, 0x3b,
-  0x71, 0x71, 0x25, 0x27, 0x51, 0x5d, 0x43, 0x13, 0xb0, 0x49, 0x98, 0x7f,
-  0xf3, 0x35, 0xdd, 0x6b, 0x35, 0x20, 0x18, 0x56, 0x72, 0x0c, 0x58, 0x42,
-  0xb6, 0x78, 0xcd, 0x2e, 0xc3, 0x64, 0x2d, 0x1d, 0x7b, 0x53, 0x57, 0x09,
-  0x84, 0x3f, 0xe1, 0x75, 0x3d, 0x2a, 0x3d, 0x60, 0xa4, 0x16, 0xfd, 0x4c,
-  0x31, 0x05, 0x67, 0x3b, 0xb5, 0x71, 0xfc, 0x27, 0x22, 0x5c, 0x79, 0x12,
-  0x95, 0x48, 0xd7, 0x7e, 0x3a, 0x37, 0xe5, 0x6d, 0x90, 0x23, 0x24, 0x58,
-  0xb0, 0x0e, 0x9d, 0x44, 0x71, 0x7d, 0x99, 0x33, 0x27, 0x68, 0x5a, 0x1e,
-  0xb0, 0x54, 0x0e, 0x0d, 0xa1, 0x43, 0xc8, 0x79, 0x5d, 0x2e, 0xf6, 0x64,
-  0x34, 0x1d, 0x91, 0x53, 0x1f, 0x08, 0xed, 0x3e, 0x20, 0x77, 0xb2, 0x2d,
-  0x70, 0x62, 0xa1, 0x18, 0x3c, 0x51, 0xbc, 0x07, 0x23, 0x3c, 0xfd, 0x72,
-  0x21, 0x2b, 0xbb, 0x61, 0x15, 0x16, 0x8b, 0x4c, 0x34, 0x05, 0xf2, 0x3b,
-  0x58, 0x70, 0xc8, 0x26, 0xaa, 0x5f, 0x5d, 0x14, 0xe7, 0x4a, 0x50, 0x03,
-  0x74, 0x38, 0x87, 0x6e, 0x75, 0x27, 0xc9, 0x5d, 0xb1, 0x12, 0x1f, 0x4b,
-  0xde, 0x01, 0xe5, 0x36, 0x63, 0x6f, 0xcc, 0x25, 0x84, 0x5a, 0x65, 0x13,
-  0x64, 0x48, 0xf4, 0x7e, 0xa4, 0x37, 0x35, 0x6c, 0x20, 0x25, 0xfa, 0x5b,
-  0xf0, 0x10, 0x69, 0x49, 0x2c, 0x7e, 0xe8, 0x34, 0xd0, 0x6d, 0x44, 0x22,
-  0x7a, 0x5b, 0x31, 0x10, 0xd5, 0x46, 0x8e, 0x7f, 0xac, 0x34, 0x5c, 0x6d,
-  0x7d, 0x22, 0x17, 0x5b, 0x31, 0x10, 0xc7, 0x46, 0xb0, 0x7f, 0x9b, 0x34,
-  0xb6, 0x6d, 0x42, 0x22, 0x5d, 0x5b, 0x25, 0x10, 0x60, 0x49, 0x0d, 0x7e,
-  0x15, 0x37, 0x6d, 0x6c, 0x2b, 0x25, 0x29, 0x5a, 0x38, 0x13, 0x30, 0x48,
-  0x26, 0x01, 0x75, 0x36, 0x22, 0x6f, 0x32, 0x24, 0x2b, 0x5d, 0x20, 0x12,
-  0x03, 0x4b, 0x4b, 0x00, 0x1e, 0x39, 0x0f, 0x6e, 0x74, 0x27, 0x4c, 0x5c,
-  0xbd, 0x15, 0xdd, 0x4a, 0xa8, 0x03, 0x8f, 0x38, 0x74, 0x70, 0x22, 0x29,
-  0x78, 0x5e, 0x58, 0x17, 0xaa, 0x4c, 0xcd, 0x05, 0xc4, 0x3a, 0x2d, 0x72,
-  0x71, 0x2b, 0x05, 0x60, 0x9f, 0x19, 0xff, 0x4e, 0x26, 0x06, 0x3d, 0x3f,
-  0xb9, 0x74, 0xe6, 0x2d, 0x74, 0x65, 0x76, 0x1a, 0xb1, 0x53, 0xef, 0x08,
-  0x36, 0x40, 0x64, 0x79, 0x95, 0x2e, 0xc1, 0x67, 0x34, 0x1f, 0xb1, 0x54,
-  0xdf, 0x0d, 0x4d, 0x45, 0xb0, 0x7a, 0xd5, 0x33, 0x75, 0x6b, 0xd5, 0x20,
-  0x22, 0x58, 0x54, 0x11, 0xe5, 0x46, 0x11, 0x7e, 0xb0, 0x37, 0x8d, 0x6c,
-  0x54, 0x24, 0xea, 0x5d, 0x7b, 0x15, 0x97, 0x4a, 0x5c, 0x02, 0xed, 0x3b,
-  0x30, 0x73, 0xb5, 0x28, 0x35, 0x60, 0xf5, 0x19, 0x3a, 0x51, 0xa0, 0x06,
-  0x3d, 0x3e, 0xbf, 0x77, 0x21, 0x2f, 0xbf, 0x64, 0x03, 0x1c, 0xc5, 0x55,
-  0x7b, 0x0d, 0xeb, 0x42, 0x10, 0x7a, 0xd9, 0x33, 0xac, 0x6b, 0x18, 0x23,
-  0xb0, 0x58, 0x51, 0x10, 0x3b, 0x48, 0x9a, 0x01, 0x62, 0x39, 0x9d, 0x6e,
-  0xa2, 0x26, 0x01, 0x5e, 0xd1, 0x17, 0xb6, 0x4f, 0x7c, 0x07, 0x85, 0x3c,
-  0x92, 0x74, 0x61, 0x2c, 0x25, 0x64, 0xfe, 0x1d, 0xbb, 0x55, 0x39, 0x0d,
-  0x74, 0x45, 0xf4, 0x7a, 0xbe, 0x32, 0x79, 0x6a, 0x64, 0x22, 0xf9, 0x5b,
-  0x98, 0x13, 0x40, 0x4b, 0x7a, 0x03, 0x65, 0x3b, 0xc4, 0x70, 0x85, 0x28,
-  0xa1, 0x60, 0x1d, 0x18, 0x7f, 0x50, 0x07, 0x08, 0x36, 0x40, 0x95, 0x79,
-  0xf5, 0x31, 0x8b, 0x69, 0xa5, 0x21, 0x5d, 0x59, 0x5f, 0x11, 0x77, 0x49,
-  0x75, 0x01, 0x11, 0x39, 0x15, 0x71, 0x3e, 0x29, 0x6a, 0x61, 0x7d, 0x19,
-  0x70, 0x51, 0x11, 0x09, 0x3d, 0x41, 0x31, 0x79, 0x70, 0x31, 0x2a, 0x69,
-  0x21, 0x21, 0x6d, 0x59, 0x14, 0x11, 0x0a, 0x49, 0x34, 0x01, 0x76, 0x39,
-  0x5f, 0x71, 0x40, 0x29, 0xa1, 0x61, 0x89, 0x19, 0xf8, 0x51, 0xdc, 0x09,
-  0x3a, 0x40, 0x12, 0x78, 0x30, 0x30, 0x4a, 0x68, 0xb6, 0x20, 0x82, 0x58,
-  0xde, 0x10, 0x22, 0x4b, 0x2b, 0x03, 0x05, 0x3b, 0xd0, 0x73, 0xc9, 0x2b,
-  0x2b, 0x62, 0x78, 0x1a, 0xa3, 0x52, 0xfb, 0x0a, 0x73, 0x45, 0x61, 0x7d,
-  0xf0, 0x35, 0xe9, 0x6d, 0x2c, 0x24, 0x68, 0x5c, 0xd0, 0x14, 0xc1, 0x4c,
-  0x7b, 0x07, 0xaa, 0x3f, 0xc2, 0x77, 0x4d, 0x2e, 0xa8, 0x66, 0xd4, 0x1e,
-  0x7b, 0x59, 0x90, 0x11, 0x74, 0x48, 0x40, 0x00, 0xe3, 0x38, 0x42, 0x73,
-  0xe4, 0x2b, 0x8d, 0x63, 0x67, 0x1a, 0xe0, 0x52, 0x34, 0x0d, 0x84, 0x45,
-  0x1c, 0x7c, 0xbe, 0x34, 0x2b, 0x6f, 0xfd, 0x27, 0x36, 0x5e, 0xba, 0x16,
-  0x21, 0x51, 0xbb, 0x09, 0x34, 0x40, 0xfd, 0x78, 0x25, 0x33, 0xed, 0x6b,
-  0x03, 0x22, 0x88, 0x5a, 0x75, 0x15, 0xe9, 0x4d, 0x5c, 0x04, 0x8d, 0x3c,
-  0xac, 0x77, 0x12, 0x2e, 0xe5, 0x66, 0x47, 0x21, 0x33, 0x58, 0x99, 0x10,
-  0x71, 0x4b, 0xce, 0x03, 0xb7, 0x3a, 0x4d, 0x75, 0xde, 0x2d, 0xa0, 0x64,
-  0x75, 0x1f, 0xd7, 0x57, 0xd0, 0x0e, 0x79, 0x49, 0x2c, 0x00, 0xf8, 0x38,
-  0xf0, 0x73, 0x71, 0x2a, 0x3b, 0x65, 0xfa, 0x1d, 0xa2, 0x54, 0x31, 0x0f,
-  0x64, 0x46, 0xe8, 0x7e, 0x9e, 0x39, 0x41, 0x70, 0x78, 0x2b, 0x20, 0x62,
-  0xc3, 0x1a, 0x9e, 0x55, 0xa8, 0x0c, 0x44, 0x47, 0x30, 0x7e, 0x07, 0x39,
-  0x21, 0x70, 0xdb, 0x28, 0xfe, 0x63, 0x94, 0x1a, 0xaa, 0x55, 0x4a, 0x0c,
-  0x1e, 0x47, 0x25, 0x7e, 0x34, 0x39, 0x2c, 0x70, 0x03, 0x2b, 0x6d, 0x62,
-  0x2d, 0x1d, 0x29, 0x54, 0x70, 0x0f, 0x22, 0x46, 0x35, 0x01, 0x3c, 0x38,
-  0x24, 0x73, 0x34, 0x2a, 0x2a, 0x65, 0x2a, 0x1c, 0x50, 0x57, 0x03, 0x0e,
-  0x7b, 0x49, 0x77, 0x00, 0x10, 0x3b, 0x5e, 0x72, 0xab, 0x2d, 0x90, 0x64,
-  0xf5, 0x1f, 0xc1, 0x56, 0x3c, 0x10, 0x1c, 0x4b, 0x7e, 0x02, 0x5a, 0x3d,
-  0xfb, 0x74, 0xe7, 0x2f, 0xba, 0x66, 0x01, 0x20, 0x75, 0x5b, 0x5c, 0x12,
-  0xd0, 0x4d, 0xbc, 0x04, 0x77, 0x3e, 0x27, 0x79, 0xf0, 0x30, 0xc6, 0x6b,
-  0x3b, 0x25, 0x78, 0x5c, 0xb5, 0x17, 0xbd, 0x4e, 0x2b, 0x08, 0x6b, 0x43,
-  0xd0, 0x7a, 0xc8, 0x35, 0x6d, 0x6f, 0xe5, 0x26, 0xd3, 0x61, 0x1f, 0x1b,
-  0xa1, 0x52, 0xca, 0x0d, 0x30, 0x47, 0x86, 0x7e, 0x23, 0x38, 0x50, 0x73,
-  0xf1, 0x2a, 0x0f, 0x64, 0xe4, 0x1f, 0xd9, 0x56, 0x58, 0x10, 0xe0, 0x4b,
-  0x34, 0x05, 0x8a, 0x3c, 0x02, 0x76, 0xaf, 0x31, 0x64, 0x6b, 0xbc, 0x22,
-  0x33, 0x5c, 0xa1, 0x17, 0x21, 0x51, 0xb4, 0x08, 0x3c, 0x42, 0xb1, 0x7d,
-  0x3d, 0x37, 0xed, 0x6e, 0x17, 0x28, 0x80, 0x63, 0x60, 0x1d, 0xf6, 0x54,
-  0x10, 0x0e, 0xc5, 0x49, 0xa1, 0x03, 0x1c, 0x3d, 0xe6, 0x74, 0x50, 0x2e,
-  0x26, 0x68, 0xd5, 0x23, 0x7f, 0x5d, 0xcf, 0x14, 0xe4, 0x4e, 0x01, 0x08,
-  0xd9, 0x43, 0xa2, 0x7d, 0x7c, 0x37, 0xd1, 0x6e, 0x95, 0x28, 0x7f, 0x62,
-  0x64, 0x1c, 0xfc, 0x57, 0xa3, 0x11, 0x35, 0x4b, 0x20, 0x05, 0xfd, 0x3c,
-  0xb5, 0x76, 0x64, 0x30, 0x64, 0x6a, 0xfa, 0x25, 0x91, 0x5f, 0x49, 0x19,
-  0x7f, 0x53, 0x65, 0x0d, 0xd1, 0x44, 0x9f, 0x7e, 0xab, 0x38, 0x48, 0x72,
-  0x7e, 0x2c, 0x11, 0x66, 0x74, 0x20, 0xc2, 0x5b, 0xf9, 0x15, 0x89, 0x4f,
-  0xac, 0x09, 0x0d, 0x43, 0x59, 0x7d, 0x71, 0x37, 0x3a, 0x71, 0x45, 0x2b,
-  0x50, 0x65, 0x04, 0x1f, 0x37, 0x59, 0x7d, 0x13, 0x24, 0x4d, 0x3d, 0x07,
-  0x35, 0x41, 0x21, 0x7b, 0x70, 0x35, 0x38, 0x6f, 0x32, 0x29, 0x28, 0x63,
-  0x1e, 0x1d, 0x45, 0x57, 0x64, 0x11, 0x6a, 0x4b, 0x43, 0x05, 0x5e, 0x3f,
-  0xad, 0x79, 0x9f, 0x33, 0xfc, 0x6d, 0xd0, 0x27, 0x6b, 0x60, 0x55, 0x1a,
-  0x30, 0x54, 0x69, 0x0e, 0xac, 0x48, 0x88, 0x02, 0xc9, 0x3c, 0x65, 0x79,
-  0x67, 0x33, 0x44, 0x6d, 0x89, 0x27, 0xad, 0x61, 0x30, 0x1a, 0x75, 0x54,
-  0xb1, 0x0e, 0xe1, 0x48, 0x74, 0x05, 0x7c, 0x3f, 0xb6, 0x79, 0xbd, 0x33,
-  0x30, 0x6c, 0x65, 0x26, 0x95, 0x60, 0xdc, 0x1a, 0x34, 0x57, 0xb2, 0x11,
-  0xd1, 0x4b, 0x01, 0x04, 0xaf, 0x3e, 0x9d, 0x78, 0x64, 0x35, 0x9d, 0x6f,
-  0x26, 0x28, 0x5a, 0x62, 0xe5, 0x1c, 0x1a, 0x59, 0xac, 0x13, 0x8d, 0x4d,
-  0x53, 0x06, 0xe0, 0x40, 0x66, 0x7d, 0x91, 0x37, 0x11, 0x70, 0xa4, 0x2a,
-  0x2a, 0x67, 0xfd, 0x21, 0x22, 0x5a, 0xba, 0x14, 0x3b, 0x51, 0xb8, 0x0b,
-  0x23, 0x44, 0xfd, 0x7e, 0x36, 0x3b, 0xa8, 0x75, 0x00, 0x2e, 0x80, 0x68,
-  0x75, 0x25, 0xf1, 0x5f, 0x55, 0x18, 0xc9, 0x52, 0xa8, 0x0f, 0x04, 0x48,
-  0xbc, 0x02, 0x15, 0x3f, 0x20, 0x78, 0x9d, 0x32, 0x75, 0x6f, 0xc4, 0x29,
-  0xe4, 0x62, 0x0b, 0x1f, 0xd5, 0x59, 0xa0, 0x12, 0x78, 0x4f, 0x85, 0x09,
-  0x99, 0x42, 0x79, 0x7f, 0x64, 0x38, 0xfa, 0x72, 0xb5, 0x2f, 0x61, 0x68,
-  0x20, 0x25, 0xfc, 0x5f, 0xbe, 0x18, 0x7a, 0x55, 0x64, 0x0e, 0xe1, 0x48,
-  0x99, 0x05, 0x42, 0x3e, 0x7c, 0x7b, 0x31, 0x34, 0xd5, 0x6e, 0x9f, 0x2b,
-  0xe4, 0x64, 0x5c, 0x21, 0x7e, 0x5a, 0x11, 0x17, 0x74, 0x50, 0xd9, 0x0a,
-  0xf9, 0x47, 0x9a, 0x00, 0xac, 0x3d, 0x59, 0x76, 0x55, 0x33, 0x77, 0x6c,
-  0x38, 0x29, 0x45, 0x62, 0x12, 0x1f, 0x38, 0x58, 0x30, 0x15, 0x7d, 0x4e,
-  0x39, 0x0b, 0x21, 0x44, 0x74, 0x01, 0x30, 0x3a, 0x26, 0x77, 0x38, 0x30,
-  0x2a, 0x6d, 0x39, 0x26, 0x05, 0x63, 0x04, 0x1c, 0x78, 0x59, 0x69, 0x12,
-  0x49, 0x4f, 0x0d, 0x08, 0xae, 0x45, 0x88, 0x7e, 0xe3, 0x3b, 0xc1, 0x74,
-  0x74, 0x30, 0x10, 0x6d, 0x66, 0x26, 0x5c, 0x63, 0xb4, 0x1c, 0x82, 0x59,
-  0xc2, 0x12, 0x24, 0x4e, 0x60, 0x0b, 0x40, 0x44, 0x83, 0x01, 0xad, 0x3a,
-  0x25, 0x76, 0x73, 0x33, 0xb4, 0x6c, 0xb5, 0x29, 0x35, 0x65, 0x35, 0x1e,
-  0xbe, 0x5b, 0xf8, 0x14, 0x33, 0x50, 0x2d, 0x0d, 0x9f, 0x46, 0xcb, 0x03,
-  0x71, 0x3f, 0xe5, 0x78, 0xd1, 0x35, 0x1d, 0x71, 0xb4, 0x2a, 0xd8, 0x67,
-  0x71, 0x23, 0x87, 0x5c, 0x27, 0x18, 0x15, 0x55, 0xf1, 0x0e, 0x0e, 0x4a,
-  0xe4, 0x07, 0xd8, 0x40, 0x43, 0x7c, 0xf0, 0x39, 0x75, 0x75, 0x89, 0x2e,
-  0x5e, 0x6a, 0xc7, 0x27, 0x4e, 0x63, 0x99, 0x1c, 0x31, 0x58, 0xac, 0x15,
-  0x74, 0x51, 0xe7, 0x0a, 0x61, 0x46, 0xe7, 0x03, 0x64, 0x3f, 0x83, 0x78,
-  0x1f, 0x34, 0x92, 0x71, 0x34, 0x2d, 0xcc, 0x66, 0x10, 0x22, 0xce, 0x5f,
-  0xa5, 0x1b, 0x13, 0x57, 0xb0, 0x10, 0x53, 0x4c, 0x31, 0x08, 0x90, 0x45,
-  0x7c, 0x01, 0x9d, 0x3a, 0xb0, 0x76, 0x05, 0x32, 0xd5, 0x6f, 0xe5, 0x2b,
-  0x7b, 0x67, 0xd7, 0x20, 0x92, 0x5c, 0x2d, 0x18, 0x27, 0x54, 0xf5, 0x11,
-  0xb1, 0x4d, 0x7b, 0x09, 0x33, 0x45, 0xfc, 0x7e, 0xbe, 0x3a, 0x7a, 0x76,
-  0x64, 0x32, 0xfa, 0x6f, 0x95, 0x2b, 0x4c, 0x67, 0x73, 0x23, 0x2d, 0x5f,
-  0xc4, 0x18, 0xcd, 0x54, 0xa5, 0x10, 0x4e, 0x4c, 0x30, 0x08, 0x3c, 0x44,
-  0x74, 0x00, 0xc2, 0x3d, 0xf1, 0x79, 0x91, 0x35, 0xaf, 0x71, 0x0d, 0x2d,
-  0x51, 0x69, 0x77, 0x25, 0x7b, 0x61, 0x10, 0x1d, 0x1e, 0x59, 0x29, 0x15,
-  0x6a, 0x51, 0x7d, 0x0d, 0x70, 0x49, 0x1c, 0x05, 0x20, 0x41, 0x75, 0x7d,
-  0x34, 0x39, 0x38, 0x75, 0x34, 0x31, 0x28, 0x6d, 0x1e, 0x29, 0x01, 0x65,
-  0x67, 0x21, 0x25, 0x5d, 0x5f, 0x19, 0x43, 0x55, 0xe4, 0x11, 0x89, 0x4d,
-  0xf8, 0x09, 0xd0, 0x45, 0x74, 0x00, 0x14, 0x3c, 0x62, 0x78, 0x58, 0x34,
-  0xa5, 0x70, 0xcd, 0x2c, 0x9d, 0x68, 0x65, 0x27, 0x60, 0x63, 0x4d, 0x1f,
-  0x95, 0x5b, 0xad, 0x17, 0x27, 0x52, 0x75, 0x0e, 0xb1, 0x4a, 0xfb, 0x06,
-  0x33, 0x45, 0x70, 0x01, 0xf0, 0x3d, 0xf4, 0x79, 0x37, 0x34, 0x2d, 0x70,
-  0x86, 0x2c, 0xc0, 0x68, 0x66, 0x27, 0xbc, 0x63, 0x90, 0x1f, 0x1e, 0x5a,
-  0xb1, 0x16, 0xdf, 0x52, 0x64, 0x11, 0x99, 0x4d, 0x31, 0x08, 0x15, 0x44,
-  0xf9, 0x00, 0x13, 0x3f, 0xe4, 0x7b, 0xde, 0x37, 0x5f, 0x72, 0xe8, 0x2e,
-  0x71, 0x6d, 0xc5, 0x29, 0x00, 0x64, 0xa1, 0x20, 0x25, 0x5f, 0xbe, 0x1b,
-  0x35, 0x56, 0xa6, 0x12, 0x78, 0x51, 0xf5, 0x0d, 0x32, 0x48, 0xa8, 0x04,
-  0x30, 0x43, 0xed, 0x7f, 0x13, 0x3a, 0x80, 0x76, 0x66, 0x35, 0xf1, 0x71,
-  0x51, 0x2c, 0xc4, 0x68, 0xaa, 0x27, 0x11, 0x62, 0xe9, 0x1e, 0x15, 0x5d,
-  0x39, 0x18, 0x9a, 0x54, 0x62, 0x13, 0xd8, 0x4f, 0xe4, 0x0a, 0x03, 0x49,
-  0xdf, 0x05, 0xb1, 0x40, 0x7d, 0x7f, 0xc6, 0x3b, 0x95, 0x76, 0x6c, 0x35,
-  0x26, 0x70, 0xf1, 0x2c, 0xb5, 0x6b, 0x35, 0x26, 0x3d, 0x65, 0xfb, 0x21,
-  0xf0, 0x5c, 0x72, 0x1b, 0x30, 0x56, 0xe5, 0x12, 0x95, 0x51, 0x57, 0x0c,
-  0x67, 0x4b, 0x69, 0x06, 0x90, 0x42, 0x88, 0x01, 0xb7, 0x3c, 0x4d, 0x7b,
-  0x75, 0x36, 0x16, 0x75, 0x3d, 0x30, 0xd4, 0x6c, 0xfc, 0x2b, 0x91, 0x66,
-  0xbd, 0x25, 0x0d, 0x60, 0x47, 0x1f, 0x6d, 0x5a, 0x71, 0x19, 0x0b, 0x54,
-  0x50, 0x13, 0x04, 0x4e, 0x64, 0x0d, 0x2a, 0x48, 0x31, 0x07, 0x39, 0x42,
-  0x3f, 0x01, 0x75, 0x3c, 0x39, 0x7b, 0x33, 0x36, 0x30, 0x75, 0x22, 0x30,
-  0x50, 0x6f, 0x04, 0x2a, 0x34, 0x69, 0x77, 0x24, 0x5f, 0x63, 0x42, 0x1e,
-  0xa9, 0x5d, 0xdd, 0x18, 0xe7, 0x57, 0xdc, 0x12, 0x20, 0x50, 0x1d, 0x0f,
-  0x30, 0x4a, 0x5c, 0x09, 0xe4, 0x44, 0x81, 0x03, 0xd1, 0x3e, 0x37, 0x7c,
-  0x73, 0x3b, 0x40, 0x76, 0x82, 0x35, 0xad, 0x70, 0x2a, 0x2e, 0x68, 0x6d,
-  0xbd, 0x28, 0xf7, 0x67, 0x31, 0x25, 0x67, 0x60, 0xf0, 0x1f, 0xf2, 0x5a,
-  0x36, 0x18, 0x2d, 0x57, 0x9f, 0x12, 0xd0, 0x51, 0x60, 0x0f, 0xe5, 0x4a,
-  0xdf, 0x09, 0x0b, 0x47, 0xe4, 0x02, 0xdc, 0x41, 0x30, 0x7f, 0x87, 0x3a,
-  0x3b, 0x78, 0x5a, 0x37, 0xfd, 0x72, 0x5d, 0x30, 0xa9, 0x6f, 0xcc, 0x2a,
-  0x42, 0x68, 0xee, 0x27, 0x71, 0x65, 0x81, 0x20, 0x50, 0x5e, 0xea, 0x1d,
-  0x6e, 0x5b, 0xfa, 0x16, 0x7e, 0x54, 0xf5, 0x13, 0x74, 0x51, 0x85, 0x0c,
-  0x35, 0x4a, 0xaf, 0x09, 0x2c, 0x47, 0xac, 0x02, 0x00, 0x40, 0x96, 0x7f,
-  0x34, 0x3d, 0xf2, 0x78, 0x55, 0x36, 0x8d, 0x75, 0xa7, 0x33, 0x1c, 0x71,
-  0xfe, 0x2c, 0x15, 0x6a, 0x35, 0x28, 0x96, 0x67, 0x64, 0x25, 0xc8, 0x60,
-  0xa5, 0x1e, 0x01, 0x5c, 0xdc, 0x1b, 0xbc, 0x59, 0x34, 0x17, 0xc6, 0x52,
-  0x9f, 0x10, 0x63, 0x4e, 0x30, 0x0c, 0xef, 0x4b, 0xbf, 0x09, 0x79, 0x47,
-  0x74, 0x05, 0xe1, 0x40, 0xb8, 0x7e, 0x78, 0x3c, 0x64, 0x7a, 0xfa, 0x39,
-  0x95, 0x77, 0x4c, 0x35, 0x73, 0x73, 0x2d, 0x31, 0xc4, 0x6c, 0xcd, 0x2a,
-  0xab, 0x68, 0x5b, 0x26, 0x30, 0x64, 0x01, 0x22, 0x3c, 0x60, 0xdc, 0x1f,
-  0xe3, 0x5d, 0xdd, 0x1b, 0xa9, 0x59, 0x54, 0x17, 0x43, 0x55, 0x71, 0x13,
-  0x71, 0x51, 0x17, 0x0f, 0x19, 0x4d, 0x22, 0x0b, 0x31, 0x49, 0x2e, 0x07,
-  0x70, 0x45, 0x3a, 0x03, 0x26, 0x41, 0x37, 0x7f, 0x6f, 0x3d, 0x57, 0x7b,
-  0x4e, 0x39, 0x09, 0x77, 0x11, 0x35, 0x1c, 0x73, 0x34, 0x31, 0x36, 0x6f,
-  0x04, 0x2d, 0x17, 0x6b, 0xe4, 0x29, 0xb2, 0x67, 0xfe, 0x25, 0xd0, 0x63,
-  0x74, 0x20, 0x1a, 0x5e, 0x76, 0x1c, 0x1d, 0x5a, 0xb0, 0x18, 0x85, 0x56,
-  0xd5, 0x14, 0x65, 0x55, 0x77, 0x13, 0x57, 0x51, 0x95, 0x0f, 0xfa, 0x4d,
-  0x29, 0x0a, 0x78, 0x48, 0xbd, 0x06, 0xf7, 0x44, 0x31, 0x05, 0x67, 0x43,
-  0xa3, 0x01, 0xbd, 0x3f, 0x33, 0x7c, 0x6c, 0x3a, 0x83, 0x78, 0x85, 0x36,
-  0x63, 0x77, 0xa4, 0x35, 0xde, 0x73, 0x09, 0x30, 0xa1, 0x6e, 0xcf, 0x2c,
-  0x79, 0x6d, 0x9b, 0x2b, 0x33, 0x68, 0x15, 0x26, 0xe4, 0x64, 0x15, 0x25,
-  0xa1, 0x63, 0x8d, 0x21, 0x42, 0x5e, 0xea, 0x1c, 0x7b, 0x5d, 0x88, 0x1b,
-  0x03, 0x58, 0xed, 0x16, 0x30, 0x57, 0xb2, 0x15, 0x34, 0x52, 0xb4, 0x10,
-  0x2d, 0x51, 0xf5, 0x0f, 0x31, 0x4c, 0xb3, 0x0a, 0x20, 0x4b, 0xed, 0x09,
-  0x13, 0x46, 0x89, 0x04, 0x75, 0x45, 0xec, 0x03, 0x5d, 0x40, 0xc8, 0x7e,
-  0xa0, 0x3f, 0x5d, 0x7c, 0xe4, 0x3a, 0x5d, 0x7b, 0x35, 0x38, 0x81, 0x76,
-  0x30, 0x37, 0xc9, 0x75, 0xac, 0x32, 0x08, 0x73, 0x90, 0x31, 0xab, 0x6e,
-  0x61, 0x2f, 0xc8, 0x6d, 0x92, 0x2a, 0x68, 0x6b, 0x36, 0x28, 0xee, 0x66,
-  0xf0, 0x27, 0x7a, 0x64, 0x3a, 0x25, 0xb5, 0x63, 0xa4, 0x20, 0x75, 0x61,
-  0x21, 0x1e, 0xad, 0x5c, 0x94, 0x1d, 0x4a, 0x5a, 0x7b, 0x1b, 0x37, 0x58,
-  0x90, 0x16, 0x8b, 0x57, 0xa8, 0x14, 0x5c, 0x55, 0x63, 0x12, 0x1d, 0x53,
-  0x31, 0x10, 0xd1, 0x4e, 0xb0, 0x0f, 0x8a, 0x4c, 0xac, 0x0d, 0x44, 0x4a,
-  0x44, 0x0b, 0x60, 0x48, 0x34, 0x09, 0x04, 0x46, 0x03, 0x07, 0x6d, 0x44,
-  0x2c, 0x05, 0x38, 0x42, 0x70, 0x03, 0x34, 0x40, 0x24, 0x01, 0x25, 0x3e,
-  0x22, 0x7f, 0x32, 0x3c, 0x25, 0x7d, 0x2e, 0x3a, 0x18, 0x7b, 0x00, 0x38,
-  0x70, 0x79, 0x24, 0x36, 0x10, 0x77, 0x0d, 0x34, 0x8c, 0x75, 0x98, 0x32,
-  0xb0, 0x73, 0xc6, 0x30, 0x35, 0x70, 0x1c, 0x31, 0x74, 0x6e, 0x1d, 0x2f,
-  0xb0, 0x6c, 0x85, 0x2d, 0xd5, 0x6a, 0x65, 0x2a, 0x70, 0x6b, 0x4a, 0x28,
-  0x9f, 0x69, 0xff, 0x26, 0x64, 0x66, 0x6e, 0x27, 0xa4, 0x64, 0xfc, 0x25,
-  0x38, 0x65, 0x79, 0x22, 0xf0, 0x63, 0xf9, 0x20, 0x2d, 0x60, 0x69, 0x21,
-  0x9e, 0x5e, 0x82, 0x1f, 0x60, 0x5f, 0xe5, 0x1c, 0xdf, 0x5d, 0x1d, 0x1d,
-  0xa1, 0x5a, 0xd3, 0x1b, 0x3c, 0x5b, 0xd5, 0x18, 0x36, 0x58, 0x40, 0x19,
-  0xe4, 0x56, 0x5d, 0x16, 0xac, 0x57, 0xc8, 0x14, 0x10, 0x54, 0xeb, 0x15,
-  0x7b, 0x55, 0x91, 0x12, 0x19, 0x52, 0xae, 0x13, 0x21, 0x53, 0xb9, 0x10,
-  0x70, 0x50, 0xa1, 0x11, 0x3c, 0x51, 0xb4, 0x0e, 0x24, 0x4e, 0xfd, 0x0f,
-  0x30, 0x4f, 0xa5, 0x0c, 0x15, 0x4c, 0xc5, 0x0d, 0x7c, 0x4d, 0xea, 0x0a,
-  0x45, 0x4a, 0xdf, 0x0b, 0xa3, 0x4b, 0x11, 0x0b, 0xf1, 0x48, 0x46, 0x08,
-  0x27, 0x48, 0xd5, 0x09, 0x78, 0x49, 0xdc, 0x06, 0xa0, 0x46, 0x4d, 0x06,
-  0xc2, 0x47, 0xb0, 0x07, 0x7a, 0x47, 0x85, 0x04, 0x9f, 0x44, 0x78, 0x04,
-  0x30, 0x44, 0xbd, 0x05, 0xb1, 0x45, 0x7b, 0x05, 0x30, 0x45, 0xb5, 0x02,
-  0xb6, 0x42, 0x71, 0x02, 0x25, 0x42, 0xfe, 0x03, 0x98, 0x43, 0x40, 0x03,
-  0x70, 0x43, 0x65, 0x03, 0xd2, 0x40, 0x81, 0x00, 0xa5, 0x40, 0x5e, 0x00,
-  0x7b, 0x40, 0x5b, 0x00, 0x74, 0x40, 0x95, 0x01, 0xc7, 0x41, 0x95, 0x01,
-  0xa1, 0x41, 0x43, 0x01, 0x10, 0x41, 0x72, 0x01, 0x71, 0x41, 0x45, 0x01,
-  0x07, 0x41, 0x28, 0x01, 0x2a, 0x41, 0x29, 0x01, 0x70, 0x41, 0x21, 0x01,
-  0x3b, 0x41, 0x75, 0x01, 0x33, 0x41, 0x35, 0x01, 0x21, 0x41, 0x2e, 0x01,
-  0x1b, 0x41, 0x45, 0x01, 0x7b, 0x41, 0x6b, 0x01, 0x10, 0x41, 0x44, 0x01,
-  0xb0, 0x41, 0xd1, 0x01, 0xb0, 0x41, 0xdc, 0x01, 0x20, 0x40, 0x55, 0x00,
-  0x67, 0x40, 0x5c, 0x00, 0xb7, 0x40, 0xcd, 0x00, 0xc3, 0x40, 0x31, 0x03,
-  0x7d, 0x43, 0x49, 0x03, 0x9c, 0x43, 0xad, 0x03, 0x36, 0x42, 0x68, 0x02,
-  0xbe, 0x42, 0xfb, 0x02, 0x3d, 0x45, 0x7b, 0x05, 0xb7, 0x45, 0xbd, 0x05,
-  0x28, 0x44, 0x64, 0x04, 0x9b, 0x44, 0xc0, 0x04, 0x34, 0x47, 0xac, 0x07,
-  0xc4, 0x47, 0x4d, 0x06, 0xa5, 0x46, 0xd1, 0x06, 0x67, 0x49, 0x94, 0x09,
-  0x2d, 0x48, 0x46, 0x08, 0xb0, 0x48, 0x19, 0x0b, 0xab, 0x4b, 0xc8, 0x0b,
-  0x43, 0x4a, 0xab, 0x0a, 0x34, 0x4d, 0xc5, 0x0d, 0x20, 0x4c, 0xa8, 0x0c,
-  0x36, 0x4f, 0xb5, 0x0f, 0x31, 0x4e, 0xa5, 0x0e, 0x27, 0x51, 0xf5, 0x11,
-  0x38, 0x50, 0xb8, 0x10, 0x64, 0x53, 0xa4, 0x13, 0x03, 0x52, 0xc5, 0x12,
-  0x73, 0x55, 0xea, 0x15, 0x59, 0x54, 0xc3, 0x14, 0xa3, 0x57, 0x5d, 0x16,
-  0xfd, 0x56, 0x54, 0x19, 0x30, 0x58, 0xca, 0x18, 0x30, 0x5b, 0x9d, 0x1b,
-  0x8d, 0x5a, 0x0b, 0x1d, 0x90, 0x5d, 0xab, 0x1c, 0x7b, 0x5f, 0xd1, 0x1f,
-  0xdc, 0x5e, 0x2d, 0x21, 0x33, 0x60, 0xf5, 0x20, 0xb9, 0x63, 0x76, 0x22,
-  0x3c, 0x65, 0xb5, 0x25, 0xb4, 0x64, 0x72, 0x27, 0x64, 0x66, 0xfa, 0x26,
-  0x95, 0x69, 0x05, 0x28, 0x7a, 0x6b, 0x20, 0x2a, 0xd5, 0x6a, 0x89, 0x2d,
-  0xe4, 0x6c, 0x49, 0x2f, 0x7f, 0x6e, 0x55, 0x31, 0x35, 0x70, 0xc5, 0x30,
-  0xe0, 0x73, 0x98, 0x32, 0xa5, 0x75, 0x5e, 0x34, 0x55, 0x77, 0x3f, 0x36,
-  0x34, 0x79, 0x11, 0x38, 0x18, 0x7b, 0x28, 0x3a, 0x64, 0x7d, 0x39, 0x3c,
-  0x3f, 0x7f, 0x3a, 0x3e, 0x26, 0x01, 0x75, 0x40, 0x3f, 0x03, 0x2f, 0x42,
-  0x64, 0x05, 0x39, 0x44, 0x18, 0x07, 0x00, 0x46, 0x34, 0x09, 0x6d, 0x48,
-  0x5f, 0x0b, 0x58, 0x4a, 0xb6, 0x0d, 0x9a, 0x4c, 0xfc, 0x0f, 0xd4, 0x4e,
-  0x27, 0x10, 0x06, 0x53, 0x2f, 0x12, 0x1d, 0x55, 0xe4, 0x14, 0xaf, 0x57,
-  0xdf, 0x16, 0x31, 0x58, 0x7c, 0x1b, 0x1a, 0x5a, 0xfa, 0x1d, 0x87, 0x5c,
-  0x00, 0x1e, 0x7c, 0x61, 0xa9, 0x20, 0xb5, 0x63, 0x61, 0x25, 0x20, 0x64,
-  0xea, 0x27, 0xbd, 0x66, 0x10, 0x28, 0x65, 0x6b, 0x95, 0x2a, 0x85, 0x6d,
-  0x72, 0x2f, 0xac, 0x6e, 0xc2, 0x31, 0x08, 0x73, 0xa2, 0x32, 0xd1, 0x75,
-  0x79, 0x37, 0x90, 0x76, 0x27, 0x38, 0x15, 0x7b, 0xf1, 0x3a, 0x0f, 0x7c,
-  0xa1, 0x3f, 0x8d, 0x7e, 0x57, 0x40, 0xe0, 0x03, 0x60, 0x45, 0x91, 0x04,
-  0x19, 0x46, 0xa3, 0x09, 0x23, 0x4b, 0xfd, 0x0a, 0x23, 0x4c, 0xa0, 0x0f,
-  0x27, 0x51, 0xa5, 0x10, 0x39, 0x52, 0xbe, 0x15, 0x2d, 0x57, 0xa2, 0x16,
-  0x05, 0x58, 0x96, 0x1b, 0x3a, 0x5d, 0xa5, 0x1c, 0x10, 0x5e, 0xe2, 0x21,
-  0xaa, 0x63, 0x18, 0x25, 0xb0, 0x64, 0x5a, 0x26, 0x32, 0x68, 0xd5, 0x2b,
-  0x64, 0x6d, 0xd5, 0x2c, 0xa1, 0x6e, 0x00, 0x30, 0x90, 0x73, 0xa9, 0x35,
-  0x7b, 0x77, 0xca, 0x36, 0x9b, 0x78, 0x68, 0x3a, 0x20, 0x7c, 0xbd, 0x3f,
-  0xb1, 0x01, 0x61, 0x43, 0x74, 0x05, 0xf8, 0x44, 0xb5, 0x06, 0x3d, 0x48,
-  0x22, 0x0a, 0xf8, 0x4d, 0x9e, 0x0f, 0x4b, 0x51, 0x6d, 0x13, 0x65, 0x55,
-  0xc4, 0x14, 0x82, 0x56, 0xa0, 0x18, 0x5c, 0x5a, 0x69, 0x1c, 0x55, 0x5e,
-  0x35, 0x20, 0xdb, 0x63, 0xf4, 0x25, 0xdd, 0x67, 0xb0, 0x29, 0x45, 0x6b,
-  0x55, 0x2d, 0x6b, 0x6f, 0x34, 0x31, 0x03, 0x73, 0x1c, 0x35, 0x28, 0x77,
-  0x33, 0x39, 0x7d, 0x7b, 0x3f, 0x3d, 0x33, 0x7f, 0x32, 0x41, 0x7b, 0x03,
-  0x70, 0x45, 0x7d, 0x07, 0x0d, 0x49, 0x6d, 0x0b, 0x04, 0x4d, 0x0d, 0x0f,
-  0x7d, 0x51, 0x6b, 0x13, 0x5b, 0x55, 0x0d, 0x17, 0x8d, 0x59, 0xdd, 0x1b,
-  0xe3, 0x5d, 0xd4, 0x1f, 0x23, 0x60, 0x55, 0x22, 0x71, 0x64, 0x53, 0x26,
-  0xab, 0x68, 0x99, 0x2a, 0xd8, 0x6c, 0x20, 0x31, 0x66, 0x73, 0x05, 0x35,
-  0x9f, 0x77, 0xe3, 0x39, 0x21, 0x7a, 0x3d, 0x3c, 0xb2, 0x7e, 0xf9, 0x40,
-  0x3d, 0x05, 0x7b, 0x47, 0xbb, 0x09, 0xf4, 0x4b, 0x2a, 0x0c, 0x6a, 0x4e,
-  0xd0, 0x10, 0xc4, 0x52, 0x34, 0x17, 0xa9, 0x59, 0xd9, 0x1b, 0x19, 0x5c,
-  0xb0, 0x1e, 0xd1, 0x60, 0x75, 0x25, 0xd5, 0x67, 0x32, 0x28, 0x54, 0x6a,
-  0xe3, 0x2c, 0x09, 0x71, 0xa1, 0x33, 0xdf, 0x75, 0x10, 0x36, 0xf1, 0x78,
-  0x7c, 0x3d, 0x84, 0x7f, 0x1e, 0x40, 0xed, 0x02, 0x31, 0x47, 0xae, 0x09,
-  0x25, 0x4a, 0xb4, 0x0c, 0x38, 0x51, 0xfb, 0x13, 0x70, 0x54, 0xfd, 0x16,
-  0x0b, 0x5b, 0xbf, 0x1d, 0x50, 0x5e, 0x92, 0x20, 0x75, 0x65, 0xf6, 0x27,
-  0x10, 0x68, 0xc4, 0x2a, 0xb0, 0x6f, 0x5d, 0x30, 0xf1, 0x72, 0x15, 0x37,
-  0x38, 0x78, 0x9c, 0x3a, 0x64, 0x7f, 0xc9, 0x41, 0xa8, 0x02, 0x08, 0x47,
-  0x90, 0x09, 0xb6, 0x4a, 0x78, 0x0f, 0xca, 0x51, 0x87, 0x12, 0x68, 0x57,
-  0x36, 0x18, 0xa2, 0x5a, 0xf0, 0x1f, 0x35, 0x60, 0x03, 0x25, 0xf0, 0x67,
-  0xf0, 0x28, 0x7c, 0x6d, 0x36, 0x2e, 0xe8, 0x70, 0xd0, 0x35, 0x42, 0x76,
-  0x71, 0x3b, 0x31, 0x7c, 0xc4, 0x3e, 0x84, 0x03, 0xaa, 0x44, 0x5a, 0x09,
-  0x30, 0x4a, 0x17, 0x0f, 0x31, 0x50, 0xc1, 0x12, 0xe4, 0x57, 0x98, 0x18,
-  0xb6, 0x5d, 0x0d, 0x1e, 0x51, 0x63, 0x71, 0x24, 0x34, 0x69, 0x06, 0x2a,
-  0x1f, 0x6f, 0x23, 0x30, 0x30, 0x75, 0x2f, 0x36, 0x3f, 0x7b, 0x39, 0x3c,
-  0x38, 0x01, 0x3c, 0x42, 0x3e, 0x07, 0x3a, 0x48, 0x64, 0x0d, 0x39, 0x4e,
-  0x18, 0x13, 0x00, 0x54, 0x34, 0x19, 0x72, 0x5a, 0x55, 0x1f, 0x44, 0x60,
-  0xa3, 0x25, 0x95, 0x66, 0xe4, 0x2b, 0x95, 0x6c, 0x3b, 0x30, 0x13, 0x75,
-  0x30, 0x36, 0x49, 0x7b, 0xac, 0x3c, 0x88, 0x01, 0x90, 0x42, 0x2a, 0x06,
-  0x66, 0x4b, 0x47, 0x0c, 0xdc, 0x51, 0xad, 0x12, 0x25, 0x56, 0x73, 0x1b,
-  0xb4, 0x5c, 0xb5, 0x21, 0x23, 0x65, 0x70, 0x26, 0xf0, 0x6b, 0xe9, 0x2c,
-  0x2c, 0x70, 0x64, 0x35, 0x9e, 0x76, 0xce, 0x3b, 0x34, 0x7f, 0xb1, 0x40,
-  0xd8, 0x05, 0x0c, 0x49, 0xb0, 0x0a, 0x9a, 0x4f, 0x63, 0x13, 0xd5, 0x54,
-  0x23, 0x18, 0x5d, 0x5d, 0xf1, 0x1e, 0x09, 0x62, 0xe4, 0x27, 0xd9, 0x68,
-  0x58, 0x2c, 0xe0, 0x71, 0x34, 0x35, 0x8b, 0x76, 0x05, 0x3a, 0xa0, 0x7f,
-  0x26, 0x43, 0xb8, 0x04, 0x22, 0x48, 0xa6, 0x0d, 0x74, 0x51, 0xb4, 0x12,
-  0x22, 0x56, 0xb8, 0x1b, 0x64, 0x5f, 0xac, 0x20, 0x1c, 0x64, 0x89, 0x29,
-  0x34, 0x6d, 0xe4, 0x2e, 0x52, 0x72, 0xc2, 0x37, 0xb1, 0x7b, 0x09, 0x3f,
-  0xbe, 0x00, 0x15, 0x44, 0x74, 0x08, 0xa1, 0x4d, 0x78, 0x11, 0xd8, 0x52,
-  0xe4, 0x16, 0x02, 0x5a, 0xc2, 0x1f, 0xa7, 0x63, 0x34, 0x27, 0xd6, 0x68,
-  0x84, 0x2c, 0x6c, 0x70, 0x36, 0x34, 0xe9, 0x79, 0xa3, 0x3d, 0x35, 0x01,
-  0x35, 0x45, 0xe1, 0x06, 0xf0, 0x4a, 0x69, 0x0e, 0x2c, 0x52, 0xe8, 0x17,
-  0xd0, 0x5b, 0x52, 0x1f, 0x71, 0x63, 0x2c, 0x27, 0xd7, 0x68, 0x85, 0x2c,
-  0xb0, 0x70, 0x1d, 0x34, 0x7c, 0x78, 0x14, 0x3c, 0x36, 0x00, 0xd0, 0x45,
-  0xfc, 0x09, 0x98, 0x4d, 0xa0, 0x11, 0x0d, 0x55, 0x5f, 0x19, 0x6b, 0x5d,
-  0x34, 0x21, 0x11, 0x65, 0x18, 0x29, 0x28, 0x6d, 0x64, 0x31, 0x2d, 0x75,
-  0x35, 0x39, 0x31, 0x7d, 0x31, 0x41, 0x26, 0x05, 0x24, 0x49, 0x3c, 0x0d,
-  0x28, 0x51, 0x61, 0x15, 0x50, 0x59, 0x04, 0x1d, 0x7a, 0x61, 0x61, 0x25,
-  0x10, 0x69, 0x4a, 0x2d, 0xab, 0x71, 0x98, 0x35, 0xe3, 0x79, 0x95, 0x3d,
-  0x30, 0x00, 0x1a, 0x44, 0x67, 0x08, 0x53, 0x4c, 0xe4, 0x10, 0x8c, 0x54,
-  0xc3, 0x18, 0x65, 0x5f, 0x63, 0x23, 0x40, 0x67, 0xd0, 0x2b, 0xe1, 0x6f,
-  0x21, 0x32, 0x7c, 0x76, 0xa6, 0x3a, 0xf0, 0x7e, 0x74, 0x45, 0x74, 0x09,
-  0xf0, 0x4d, 0xef, 0x11, 0x2b, 0x54, 0x62, 0x18, 0x9d, 0x5c, 0x85, 0x20,
-  0x79, 0x67, 0xa4, 0x2b, 0xc2, 0x6f, 0x06, 0x32, 0xa1, 0x76, 0xd9, 0x3a,
-  0x30, 0x01, 0xd2, 0x45, 0x79, 0x08, 0x12, 0x4c, 0xbc, 0x10, 0x5d, 0x57,
-  0xb1, 0x1b, 0xdd, 0x5f, 0x10, 0x22, 0xe4, 0x66, 0x67, 0x2d, 0xc5, 0x71,
-  0x07, 0x34, 0xa8, 0x78, 0x64, 0x3f, 0xb1, 0x03, 0x35, 0x46, 0xb4, 0x0a,
-  0x22, 0x51, 0xb0, 0x15, 0x70, 0x58, 0xbc, 0x1c, 0x64, 0x63, 0xbf, 0x27,
-  0x1f, 0x6a, 0x8a, 0x2e, 0x79, 0x75, 0xa5, 0x39, 0x5d, 0x7c, 0xcc, 0x40,
-  0xb6, 0x07, 0x16, 0x4a, 0xf5, 0x0e, 0x51, 0x55, 0x74, 0x18, 0xd2, 0x5c,
-  0x3b, 0x23, 0x9a, 0x67, 0xe8, 0x2a, 0x4d, 0x71, 0xd1, 0x35, 0xab, 0x78,
-  0x70, 0x3f, 0x85, 0x03, 0x85, 0x46, 0x7d, 0x0d, 0x64, 0x50, 0xf8, 0x14,
-  0xa6, 0x5b, 0x70, 0x1e, 0x3a, 0x65, 0xb5, 0x29, 0xbd, 0x6c, 0x72, 0x33,
-  0x36, 0x76, 0xe8, 0x3a, 0xd0, 0x01, 0x44, 0x44, 0x67, 0x0b, 0x65, 0x4e,
-  0xc7, 0x12, 0x88, 0x59, 0xe4, 0x1c, 0x51, 0x63, 0x75, 0x26, 0x14, 0x6d,
-  0x22, 0x30, 0xd0, 0x74, 0xb0, 0x3b, 0x9c, 0x7e, 0xe4, 0x45, 0x5f, 0x08,
-  0x5f, 0x4f, 0x6a, 0x12, 0x79, 0x59, 0x45, 0x1c, 0x1d, 0x63, 0x2c, 0x26,
-  0x36, 0x6d, 0x36, 0x30, 0x35, 0x77, 0x31, 0x3a, 0x74, 0x01, 0x72, 0x44,
-  0x7a, 0x0b, 0x7a, 0x4e, 0x6a, 0x15, 0x6d, 0x58, 0x50, 0x1f, 0x20, 0x62,
-  0x7a, 0x29, 0x71, 0x6c, 0x55, 0x33, 0x5f, 0x76, 0xad, 0x3d, 0x93, 0x00,
-  0xf7, 0x47, 0x95, 0x0a, 0x26, 0x50, 0x1a, 0x17, 0x7f, 0x5a, 0x50, 0x21,
-  0xb7, 0x64, 0xcd, 0x2b, 0xc7, 0x6e, 0x2c, 0x34, 0x60, 0x7b, 0x4d, 0x3e,
-  0xd0, 0x05, 0xe1, 0x48, 0x25, 0x0e, 0x6f, 0x55, 0xb7, 0x18, 0xf0, 0x5f,
-  0x26, 0x25, 0x35, 0x68, 0xbe, 0x2f, 0xe8, 0x72, 0x29, 0x38, 0x6f, 0x7f,
-  0x95, 0x42, 0xd7, 0x09, 0x67, 0x4f, 0xe5, 0x12, 0xd8, 0x59, 0x0c, 0x1f,
-  0xb7, 0x62, 0x9d, 0x29, 0x71, 0x6f, 0xd5, 0x32, 0x33, 0x78, 0x47, 0x3f,
-  0xf5, 0x02, 0x1c, 0x48, 0xb0, 0x0f, 0xc8, 0x52, 0x42, 0x18, 0xa5, 0x5f,
-  0x71, 0x25, 0x83, 0x68, 0x16, 0x2e, 0xa8, 0x75, 0x27, 0x3b, 0xa9, 0x7e,
-  0x7e, 0x44, 0xdf, 0x0b, 0x5e, 0x51, 0x91, 0x14, 0x31, 0x5a, 0xa4, 0x21,
-  0x64, 0x67, 0xf5, 0x2a, 0x49, 0x70, 0xdf, 0x37, 0x34, 0x7d, 0xc0, 0x40,
-  0x46, 0x06, 0xc8, 0x4d, 0xb6, 0x13, 0x04, 0x59, 0xb0, 0x1c, 0x5a, 0x62,
-  0x3a, 0x28, 0x96, 0x6f, 0x75, 0x35, 0x9d, 0x78, 0xad, 0x3e, 0x03, 0x04,
-  0x90, 0x4b, 0xa4, 0x11, 0x34, 0x57, 0xc2, 0x1a, 0x82, 0x60, 0x68, 0x26,
-  0x25, 0x6c, 0xe9, 0x33, 0xf0, 0x79, 0x62, 0x3f, 0x3c, 0x05, 0xfc, 0x48,
-  0xbc, 0x0e, 0x78, 0x54, 0x68, 0x1a, 0xad, 0x61, 0x9f, 0x27, 0x4b, 0x6d,
-  0x71, 0x33, 0x65, 0x79, 0xdf, 0x3c, 0x8b, 0x02, 0xe4, 0x48, 0x49, 0x0e,
-  0x78, 0x54, 0x10, 0x1a, 0x74, 0x60, 0xd6, 0x27, 0xe2, 0x6d, 0x98, 0x33,
-  0xb3, 0x79, 0x40, 0x3f, 0x55, 0x05, 0x68, 0x4b, 0x76, 0x11, 0x00, 0x57,
-  0x02, 0x1d, 0x3e, 0x63, 0x64, 0x29, 0x35, 0x6f, 0x31, 0x35, 0x26, 0x7b,
-  0x74, 0x41, 0x21, 0x07, 0x38, 0x4d, 0x38, 0x13, 0x64, 0x59, 0x3e, 0x1f,
-  0x11, 0x65, 0x08, 0x2b, 0x71, 0x71, 0x25, 0x37, 0x43, 0x7d, 0x59, 0x43,
-  0xab, 0x09, 0x8f, 0x4f, 0xe9, 0x15, 0x8f, 0x5b, 0x74, 0x20, 0x01, 0x66,
-  0x78, 0x2c, 0x5c, 0x72, 0xb0, 0x38, 0xcd, 0x7e, 0xc4, 0x44, 0x2d, 0x0d,
-  0x71, 0x53, 0x05, 0x19, 0x94, 0x5f, 0xe2, 0x25, 0x2b, 0x6a, 0x6f, 0x30,
-  0xf0, 0x76, 0xf3, 0x3c, 0x38, 0x05, 0x74, 0x4b, 0xa3, 0x11, 0xf5, 0x57,
-  0x21, 0x1c, 0x7e, 0x62, 0xd0, 0x28, 0xd2, 0x6e, 0x7c, 0x37, 0xac, 0x7d,
-  0xc4, 0x43, 0x08, 0x08, 0xe8, 0x4e, 0x9d, 0x14, 0x64, 0x5d, 0x9d, 0x23,
-  0x31, 0x68, 0x15, 0x2e, 0xf8, 0x74, 0x12, 0x3d, 0xb1, 0x03, 0xdf, 0x49,
-  0x57, 0x0e, 0xe9, 0x54, 0x75, 0x1d, 0x96, 0x63, 0x03, 0x28, 0xed, 0x6e,
-  0x2c, 0x37, 0xbc, 0x7d, 0x34, 0x42, 0xf5, 0x08, 0x35, 0x51, 0xb9, 0x17,
-  0x22, 0x5c, 0xb8, 0x22, 0x25, 0x6b, 0xa9, 0x31, 0x09, 0x76, 0xc5, 0x3c,
-  0x66, 0x05, 0xf0, 0x4b, 0x5e, 0x10, 0x8d, 0x56, 0xab, 0x1f, 0x08, 0x64,
-  0xe4, 0x2a, 0x19, 0x73, 0x74, 0x38, 0x9c, 0x7e, 0x64, 0x47, 0x9d, 0x0d,
-  0xa2, 0x52, 0x01, 0x1b, 0xd1, 0x61, 0xb6, 0x26, 0x7c, 0x6f, 0xc0, 0x35,
-  0x83, 0x7a, 0x2d, 0x43, 0x26, 0x08, 0xf1, 0x4e, 0xb1, 0x17, 0x76, 0x5c,
-  0x3f, 0x25, 0xb9, 0x6b, 0xf0, 0x30, 0x7c, 0x79, 0x2a, 0x3e, 0xe9, 0x04,
-  0xd0, 0x4d, 0x51, 0x12, 0x7c, 0x5b, 0x20, 0x20, 0x90, 0x66, 0x82, 0x2f,
-  0xb6, 0x74, 0x5f, 0x3d, 0x30, 0x02, 0x10, 0x4b, 0x22, 0x10, 0xd4, 0x56,
-  0xe0, 0x1f, 0x92, 0x64, 0xb6, 0x2d, 0x4c, 0x72, 0x44, 0x3b, 0x60, 0x00,
-  0x67, 0x49, 0x4b, 0x0e, 0x50, 0x57, 0x6d, 0x1c, 0x05, 0x65, 0x2f, 0x2a,
-  0x35, 0x73, 0x75, 0x38, 0x23, 0x01, 0x30, 0x46, 0x70, 0x0f, 0x29, 0x54,
-  0x2b, 0x1d, 0x22, 0x62, 0x50, 0x2b, 0x16, 0x70, 0x78, 0x39, 0x6a, 0x7e,
-  0x47, 0x47, 0x12, 0x0c, 0xe4, 0x55, 0xdd, 0x1a, 0xc7, 0x63, 0xd0, 0x28,
-  0x74, 0x70, 0x16, 0x39, 0x71, 0x7e, 0x53, 0x47, 0xe3, 0x0c, 0x99, 0x55,
-  0x90, 0x1a, 0x36, 0x62, 0x71, 0x2b, 0x40, 0x70, 0x9d, 0x39, 0xad, 0x7e,
-  0x30, 0x46, 0x72, 0x0f, 0xf0, 0x54, 0xf3, 0x1d, 0x3d, 0x65, 0x7b, 0x2a,
-  0xb4, 0x73, 0xbd, 0x38, 0x25, 0x00, 0x2d, 0x49, 0x87, 0x0e, 0xc4, 0x57,
-  0x6d, 0x1f, 0xe5, 0x64, 0xc4, 0x2d, 0x02, 0x75, 0xe4, 0x3a, 0xd0, 0x03,
-  0x71, 0x4b, 0x9e, 0x10, 0x31, 0x58, 0x15, 0x21, 0xe4, 0x66, 0x15, 0x2e,
-  0xa1, 0x77, 0x8d, 0x3c, 0x5f, 0x04, 0xf7, 0x4d, 0x76, 0x15, 0xc2, 0x5a,
-  0x03, 0x22, 0xed, 0x6b, 0x33, 0x33, 0xb8, 0x78, 0x39, 0x40, 0xb2, 0x09,
-  0x3c, 0x51, 0xa1, 0x16, 0x70, 0x5e, 0xb0, 0x27, 0x25, 0x6f, 0xb9, 0x34,
-  0x13, 0x7c, 0x8d, 0x45, 0x34, 0x0d, 0xf2, 0x52, 0x58, 0x1a, 0xcc, 0x63,
-  0xb0, 0x2b, 0x5d, 0x73, 0xe4, 0x38, 0x5d, 0x00, 0x31, 0x48, 0xd5, 0x11,
-  0x74, 0x59, 0xd2, 0x1e, 0xab, 0x66, 0x1f, 0x2e, 0x90, 0x77, 0xb2, 0x3f,
-  0x75, 0x07, 0xcb, 0x4c, 0x84, 0x14, 0x7e, 0x5c, 0x64, 0x24, 0xff, 0x6d,
-  0xb5, 0x35, 0x73, 0x7d, 0x3b, 0x45, 0xe7, 0x0a, 0xb5, 0x52, 0x3d, 0x1a,
-  0x30, 0x62, 0xe5, 0x2b, 0x95, 0x73, 0x05, 0x3b, 0x7c, 0x03, 0x2a, 0x4b,
-  0xc5, 0x10, 0x9f, 0x58, 0xa3, 0x20, 0x51, 0x68, 0x71, 0x30, 0x06, 0x78,
-  0x27, 0x40, 0x95, 0x09, 0xe2, 0x51, 0x88, 0x19, 0xaa, 0x61, 0x5e, 0x29,
-  0x10, 0x71, 0x6a, 0x39, 0x61, 0x01, 0x11, 0x49, 0x5e, 0x11, 0x6d, 0x59,
-  0x64, 0x21, 0x14, 0x69, 0x36, 0x31, 0x75, 0x79, 0x3b, 0x41, 0x3b, 0x09,
-  0x3c, 0x51, 0x24, 0x19, 0x64, 0x61, 0x3a, 0x29, 0x15, 0x71, 0x45, 0x39,
-  0x77, 0x01, 0x6a, 0x49, 0x45, 0x11, 0x41, 0x59, 0xa0, 0x21, 0xdd, 0x69,
-  0xf6, 0x31, 0xdc, 0x79, 0x3a, 0x40, 0x11, 0x08, 0x30, 0x50, 0x5c, 0x18,
-  0xe4, 0x60, 0x9e, 0x28, 0xd8, 0x70, 0x2a, 0x3b, 0x66, 0x03, 0x51, 0x4b,
-  0x95, 0x13, 0xff, 0x5b, 0x64, 0x22, 0x6f, 0x6a, 0xbf, 0x32, 0xe0, 0x7a,
-  0x20, 0x45, 0x70, 0x0d, 0xf0, 0x55, 0xe9, 0x1d, 0x2c, 0x64, 0x7f, 0x2c,
-  0x9f, 0x74, 0xd0, 0x3c, 0x73, 0x07, 0xad, 0x4f, 0x90, 0x17, 0x19, 0x5e,
-  0xac, 0x26, 0xd8, 0x6e, 0x30, 0x39, 0x87, 0x01, 0x3b, 0x48, 0x5a, 0x10,
-  0xfd, 0x58, 0x0e, 0x23, 0xea, 0x6b, 0x83, 0x33, 0x1e, 0x7a, 0x8f, 0x42,
-  0x1e, 0x0d, 0xa1, 0x55, 0x11, 0x1c, 0xb4, 0x64, 0x64, 0x2f, 0xec, 0x77,
-  0x64, 0x3e, 0xe1, 0x06, 0x6e, 0x51, 0xf5, 0x19, 0x07, 0x60, 0xb8, 0x28,
-  0x64, 0x73, 0xac, 0x3b, 0x02, 0x02, 0x80, 0x4a, 0x34, 0x15, 0xe4, 0x5d,
-  0x52, 0x24, 0xcc, 0x6c, 0xaa, 0x37, 0x19, 0x7e, 0xff, 0x46, 0x5b, 0x11,
-  0x3d, 0x58, 0x9b, 0x20, 0x77, 0x6b, 0x9d, 0x33, 0xb0, 0x7a, 0x05, 0x45,
-  0xd5, 0x0d, 0xe5, 0x54, 0x79, 0x1f, 0xcc, 0x67, 0x83, 0x2e, 0x7e, 0x79,
-  0x2d, 0x40, 0xf2, 0x08, 0xbe, 0x53, 0x3b, 0x1a, 0x74, 0x65, 0xb5, 0x2d,
-  0x9e, 0x74, 0x72, 0x3f, 0x2a, 0x06, 0xe8, 0x4e, 0xd0, 0x19, 0x4a, 0x60,
-  0x72, 0x2b, 0x65, 0x72, 0xc5, 0x3a, 0x9e, 0x05, 0xe4, 0x4c, 0x5e, 0x17,
-  0x71, 0x5e, 0x1b, 0x29, 0x74, 0x70, 0xc2, 0x38, 0xff, 0x03, 0x8f, 0x4a,
-  0xaf, 0x15, 0x0d, 0x5c, 0x5f, 0x27, 0x70, 0x6e, 0x60, 0x39, 0x45, 0x00,
-  0x04, 0x4b, 0x25, 0x12, 0x21, 0x5d, 0x7d, 0x24, 0x23, 0x6f, 0x3a, 0x36,
-  0x38, 0x01, 0x20, 0x48, 0x24, 0x13, 0x34, 0x5a, 0x2b, 0x25, 0x23, 0x6c,
-  0x50, 0x37, 0x11, 0x7e, 0x7b, 0x49, 0x25, 0x10, 0x44, 0x5b, 0x45, 0x22,
-  0xa1, 0x6d, 0xdd, 0x34, 0xe0, 0x7f, 0xc0, 0x46, 0x2e, 0x10, 0x0f, 0x5b,
-  0x7c, 0x22, 0x58, 0x6d, 0xea, 0x34, 0xcd, 0x7f, 0x90, 0x46, 0x0c, 0x10,
-  0x34, 0x5b, 0x52, 0x22, 0x99, 0x6d, 0xe1, 0x34, 0x28, 0x7e, 0x3d, 0x49,
-  0xbc, 0x10, 0xf0, 0x5b, 0x35, 0x25, 0x63, 0x6c, 0xb5, 0x37, 0xbd, 0x7e,
-  0x30, 0x48, 0x65, 0x13, 0x99, 0x5a, 0xd6, 0x25, 0x34, 0x6f, 0xaf, 0x36,
-  0xdf, 0x01, 0x18, 0x4b, 0xb6, 0x12, 0xd3, 0x5d, 0x71, 0x27, 0x99, 0x6e,
-  0x74, 0x38, 0x5d, 0x03, 0xf5, 0x4a, 0x0f, 0x14, 0xa1, 0x5f, 0x8d, 0x26,
-  0x44, 0x70, 0xea, 0x3b, 0x34, 0x05, 0x8d, 0x4c, 0x15, 0x16, 0xa1, 0x61,
-  0x34, 0x2b, 0xfd, 0x72, 0x36, 0x3c, 0xa0, 0x07, 0x20, 0x51, 0xa0, 0x18,
-  0x22, 0x62, 0xb8, 0x2d, 0x64, 0x77, 0xac, 0x3e, 0x14, 0x08, 0x93, 0x53,
-  0x71, 0x1d, 0xeb, 0x64, 0x44, 0x2e, 0xd8, 0x79, 0xb6, 0x43, 0x18, 0x0d,
-  0xe2, 0x54, 0x46, 0x1e, 0x78, 0x68, 0xd5, 0x33, 0x64, 0x7d, 0xd5, 0x44,
-  0xab, 0x0e, 0x18, 0x58, 0xd7, 0x23, 0xad, 0x6d, 0x34, 0x37, 0xec, 0x7e,
-  0xd0, 0x48, 0x6c, 0x12, 0x29, 0x5c, 0xbd, 0x27, 0xbe, 0x71, 0x7a, 0x3b,
-  0x20, 0x05, 0xb5, 0x4c, 0xa3, 0x16, 0x68, 0x60, 0x36, 0x2a, 0xe8, 0x75,
-  0xd0, 0x3f, 0x52, 0x09, 0x7c, 0x53, 0x24, 0x1d, 0xc4, 0x64, 0xcd, 0x2e,
-  0xac, 0x78, 0x58, 0x42, 0x7c, 0x0c, 0x05, 0x56, 0x74, 0x20, 0xdc, 0x6b,
-  0xe4, 0x35, 0xdd, 0x7f, 0xb3, 0x49, 0x44, 0x13, 0x5c, 0x5d, 0x69, 0x27,
-  0x34, 0x71, 0x02, 0x3b, 0x19, 0x05, 0x3b, 0x4f, 0x21, 0x19, 0x73, 0x63,
-  0x70, 0x2d, 0x75, 0x77, 0x13, 0x41, 0x3a, 0x0b, 0x3f, 0x55, 0x39, 0x1f,
-  0x64, 0x69, 0x21, 0x33, 0x05, 0x7d, 0x06, 0x47, 0x7f, 0x11, 0x24, 0x5b,
-  0x04, 0x25, 0x4c, 0x6f, 0xa6, 0x39, 0x9e, 0x03, 0xf4, 0x4d, 0xd0, 0x17,
-  0x32, 0x60, 0x12, 0x2a, 0x78, 0x74, 0x54, 0x3e, 0xae, 0x08, 0x86, 0x52,
-  0xdc, 0x1c, 0x28, 0x69, 0x7a, 0x33, 0x4a, 0x7d, 0x80, 0x47, 0xfc, 0x11,
-  0x36, 0x5a, 0x6e, 0x24, 0xa4, 0x6e, 0xe0, 0x38, 0x22, 0x05, 0x62, 0x4f,
-  0xa8, 0x19, 0xe4, 0x63, 0x3e, 0x2c, 0x4c, 0x76, 0xb2, 0x40, 0xe6, 0x0a,
-  0x50, 0x57, 0x80, 0x21, 0xf6, 0x6b, 0x2a, 0x34, 0x8c, 0x7e, 0xf4, 0x48,
-  0x5a, 0x15, 0xbe, 0x5f, 0x18, 0x28, 0x78, 0x72, 0xde, 0x3c, 0x32, 0x09,
-  0x94, 0x53, 0xfc, 0x1d, 0x62, 0x66, 0xd6, 0x30, 0x40, 0x7d, 0xb0, 0x47,
-  0x26, 0x10, 0x9a, 0x5a, 0x1c, 0x27, 0x84, 0x71, 0x0a, 0x3a, 0xc2, 0x04,
-  0x30, 0x51, 0xb7, 0x1b, 0x21, 0x64, 0xad, 0x2e, 0x33, 0x7b, 0xb8, 0x45,
-  0x19, 0x0e, 0x8a, 0x58, 0x78, 0x25, 0xfd, 0x6f, 0x46, 0x38, 0x95, 0x02,
-  0x93, 0x4f, 0x29, 0x18, 0xc9, 0x62, 0x60, 0x2f, 0x1d, 0x78, 0xba, 0x42,
-  0x51, 0x0f, 0xf5, 0x59, 0x9c, 0x22, 0x3b, 0x6f, 0xfd, 0x39, 0xc7, 0x02,
-  0x73, 0x4f, 0xca, 0x19, 0xf4, 0x62, 0x61, 0x2f, 0x2b, 0x78, 0xf2, 0x42,
-  0xbb, 0x0f, 0x11, 0x58, 0x3c, 0x25, 0xf0, 0x6f, 0xbc, 0x38, 0x6d, 0x05,
-  0x47, 0x4e, 0xe4, 0x18, 0x9e, 0x65, 0x53, 0x2e, 0x10, 0x7b, 0x31, 0x44,
-  0xd1, 0x0e, 0x86, 0x5b, 0xa1, 0x24, 0x39, 0x71, 0x74, 0x3a, 0x07, 0x07,
-  0x3b, 0x50, 0xc5, 0x1a, 0x93, 0x67, 0x88, 0x30, 0xb7, 0x7d, 0x48, 0x46,
-  0x10, 0x13, 0x05, 0x5c, 0x14, 0x29, 0x65, 0x72, 0x70, 0x3f, 0x4d, 0x08,
-  0x44, 0x55, 0x5d, 0x1e, 0x50, 0x6b, 0x55, 0x34, 0x54, 0x01, 0x55, 0x4a,
-  0x50, 0x17, 0x5d, 0x60, 0x44, 0x2d, 0x4d, 0x76, 0x70, 0x43, 0x65, 0x0c,
-  0x14, 0x59, 0x05, 0x22, 0x30, 0x6f, 0x2d, 0x38, 0xc4, 0x05, 0xfd, 0x4e,
-  0x90, 0x1b, 0xb5, 0x64, 0x54, 0x30, 0x75, 0x7d, 0x10, 0x46, 0x3d, 0x13,
-  0xc4, 0x5c, 0xed, 0x29, 0xb0, 0x72, 0x40, 0x3e, 0x73, 0x0b, 0x57, 0x54,
-  0x95, 0x21, 0xe8, 0x6a, 0x2a, 0x36, 0x1e, 0x03, 0xa2, 0x4c, 0xf0, 0x19,
-  0x30, 0x65, 0x13, 0x2e, 0xa9, 0x7b, 0xf8, 0x44, 0x28, 0x10, 0x61, 0x5d,
-  0x9f, 0x26, 0xd2, 0x73, 0x2b, 0x3f, 0x84, 0x08, 0xc3, 0x55, 0x4d, 0x21,
-  0xbd, 0x6a, 0xd2, 0x37, 0x65, 0x03, 0xd5, 0x4c, 0x31, 0x18, 0x5b, 0x65,
-  0xe4, 0x2e, 0x18, 0x7a, 0xb6, 0x47, 0x8d, 0x10, 0x44, 0x5c, 0xed, 0x29,
-  0x71, 0x75, 0xc5, 0x3e, 0x02, 0x0a, 0xa2, 0x57, 0x2b, 0x23, 0xb0, 0x6c,
-  0x7c, 0x38, 0xf5, 0x05, 0x20, 0x51, 0xbd, 0x1a, 0x35, 0x66, 0xfd, 0x33,
-  0x37, 0x7f, 0xb4, 0x48, 0x1d, 0x14, 0x87, 0x61, 0x7b, 0x2d, 0xe9, 0x76,
-  0x10, 0x42, 0xc2, 0x0f, 0xaa, 0x5b, 0x5d, 0x27, 0xe4, 0x70, 0x5d, 0x3c,
-  0x31, 0x08, 0xd5, 0x55, 0x76, 0x21, 0xd1, 0x6a, 0xab, 0x36, 0x02, 0x02,
-  0xc2, 0x4f, 0xe5, 0x1b, 0x76, 0x67, 0xd7, 0x30, 0x99, 0x7c, 0x68, 0x48,
-  0x22, 0x14, 0xf1, 0x61, 0xa9, 0x2d, 0x35, 0x79, 0x32, 0x45, 0xf9, 0x0e,
-  0xb1, 0x5a, 0x6e, 0x26, 0x2c, 0x72, 0xe8, 0x3f, 0x83, 0x0b, 0x05, 0x57,
-  0x35, 0x23, 0x6b, 0x6f, 0x90, 0x38, 0xcd, 0x04, 0x90, 0x50, 0x55, 0x1c,
-  0x75, 0x68, 0x55, 0x34, 0x3b, 0x00, 0xc7, 0x4d, 0xf2, 0x19, 0xdd, 0x65,
-  0xa6, 0x31, 0x48, 0x7d, 0x57, 0x49, 0x6c, 0x15, 0x7a, 0x61, 0x16, 0x2d,
-  0x50, 0x79, 0x3e, 0x45, 0x31, 0x11, 0x3f, 0x5d, 0x24, 0x29, 0x39, 0x75,
-  0x2d, 0x41, 0x75, 0x0d, 0x37, 0x59, 0x31, 0x25, 0x2b, 0x71, 0x3a, 0x3d,
-  0x19, 0x09, 0x0b, 0x55, 0x73, 0x21, 0x25, 0x6d, 0x1f, 0x39, 0x6c, 0x05,
-  0xb7, 0x51, 0xdd, 0x1d, 0xe9, 0x69, 0xda, 0x35, 0x21, 0x00, 0x55, 0x4c,
-  0x75, 0x18, 0x53, 0x64, 0xb0, 0x30, 0x88, 0x7c, 0xc2, 0x48, 0x65, 0x17,
-  0x60, 0x63, 0x4d, 0x2f, 0x95, 0x7b, 0xad, 0x47, 0x36, 0x12, 0x72, 0x5e,
-  0xbf, 0x2a, 0xf8, 0x76, 0x78, 0x45, 0x35, 0x11, 0xa4, 0x5d, 0xf5, 0x29,
-  0x21, 0x74, 0x2d, 0x40, 0x9f, 0x0c, 0xd7, 0x58, 0x76, 0x27, 0xe5, 0x73,
-  0xd2, 0x3f, 0x1f, 0x0a, 0xad, 0x56, 0xd8, 0x22, 0x76, 0x71, 0x99, 0x3d,
-  0x2d, 0x08, 0x15, 0x54, 0xf6, 0x20, 0x11, 0x6f, 0xa5, 0x3b, 0xde, 0x07,
-  0x58, 0x52, 0xe0, 0x1e, 0x67, 0x6d, 0xc5, 0x39, 0x30, 0x04, 0xe3, 0x50,
-  0x64, 0x1f, 0xfd, 0x6b, 0x04, 0x36, 0xbd, 0x02, 0x31, 0x51, 0xf5, 0x1d,
-  0x3e, 0x68, 0xa8, 0x34, 0x29, 0x03, 0xaf, 0x4f, 0x15, 0x1a, 0x97, 0x66,
-  0x34, 0x35, 0xea, 0x01, 0x5e, 0x4c, 0x8d, 0x18, 0xb0, 0x67, 0x15, 0x32,
-  0xf5, 0x7e, 0x15, 0x4d, 0x32, 0x18, 0x99, 0x64, 0x7f, 0x33, 0xd2, 0x7f,
-  0xb6, 0x4a, 0x4d, 0x19, 0xc6, 0x65, 0xac, 0x30, 0x76, 0x7f, 0xd7, 0x4b,
-  0x91, 0x16, 0x79, 0x65, 0x21, 0x30, 0xee, 0x7c, 0xf0, 0x4b, 0x66, 0x16,
-  0x20, 0x65, 0xe7, 0x31, 0xb1, 0x7c, 0x73, 0x4b, 0x23, 0x16, 0xe8, 0x62,
-  0x9c, 0x31, 0x5c, 0x7c, 0x34, 0x4b, 0x27, 0x16, 0xd5, 0x62, 0x83, 0x31,
-  0xa1, 0x7c, 0x5c, 0x4b, 0x64, 0x16, 0x1d, 0x65, 0x74, 0x30, 0xcc, 0x7c,
-  0xff, 0x4b, 0x88, 0x16, 0xb6, 0x65, 0x0d, 0x30, 0x56, 0x7f, 0x60, 0x4a,
-  0x71, 0x19, 0x11, 0x64, 0x5e, 0x33, 0x52, 0x7e, 0x64, 0x4d, 0x7d, 0x18,
-  0x04, 0x67, 0x3d, 0x32, 0x31, 0x01, 0x75, 0x4c, 0x3f, 0x1b, 0x2f, 0x66,
-  0x26, 0x35, 0x6d, 0x00, 0x03, 0x4f, 0x00, 0x1a, 0x71, 0x69, 0x68, 0x34,
-  0x43, 0x03, 0x0d, 0x4e, 0xb0, 0x1d, 0x92, 0x68, 0xb0, 0x37, 0xd2, 0x02,
-  0x31, 0x50, 0x01, 0x1f, 0x30, 0x6a, 0x55, 0x39, 0xa1, 0x04, 0x8c, 0x53,
-  0xc6, 0x1e, 0x2c, 0x6c, 0x71, 0x3b, 0x57, 0x06, 0xde, 0x55, 0x92, 0x20,
-  0x64, 0x6e, 0x3d, 0x3d, 0x84, 0x08, 0xfd, 0x57, 0x31, 0x25, 0x35, 0x70,
-  0xbf, 0x3f, 0xef, 0x0a, 0x26, 0x58, 0x2d, 0x27, 0x83, 0x72, 0xc0, 0x41,
-  0x71, 0x0f, 0xa8, 0x5a, 0xc3, 0x29, 0x4d, 0x77, 0xb0, 0x42, 0xd2, 0x11,
-  0x30, 0x5f, 0x92, 0x2a, 0x31, 0x78, 0x41, 0x47, 0xb0, 0x12, 0x11, 0x60,
-  0xad, 0x2f, 0xca, 0x7a, 0x58, 0x48, 0xf1, 0x17, 0x71, 0x65, 0x97, 0x30,
-  0x5e, 0x7e, 0xd8, 0x4d, 0x64, 0x1b, 0xfd, 0x66, 0x04, 0x34, 0xbd, 0x03,
-  0x31, 0x51, 0xf5, 0x1c, 0x3f, 0x6a, 0xaf, 0x39, 0x26, 0x07, 0xed, 0x52,
-  0x03, 0x20, 0x8d, 0x6f, 0x75, 0x3d, 0xf1, 0x08, 0x44, 0x56, 0xc8, 0x25,
-  0xb6, 0x73, 0x0e, 0x41, 0xb1, 0x0c, 0x3f, 0x5a, 0x5e, 0x28, 0xd5, 0x77,
-  0x51, 0x45, 0xce, 0x10, 0xe4, 0x5e, 0x14, 0x2c, 0xdf, 0x7b, 0xb0, 0x49,
-  0x34, 0x17, 0xc4, 0x62, 0x80, 0x30, 0x7d, 0x7e, 0x36, 0x4c, 0xf2, 0x1b,
-  0xb1, 0x69, 0x76, 0x37, 0x3c, 0x05, 0xb5, 0x50, 0xa4, 0x1e, 0x75, 0x6c,
-  0x21, 0x3a, 0xad, 0x09, 0x86, 0x57, 0x44, 0x25, 0x61, 0x73, 0x29, 0x41,
-  0xc4, 0x0c, 0xcd, 0x5a, 0xa0, 0x28, 0x52, 0x76, 0x7f, 0x44, 0x07, 0x12,
-  0x78, 0x60, 0x95, 0x2f, 0xbb, 0x7d, 0x89, 0x4b, 0xac, 0x19, 0x48, 0x67,
-  0x10, 0x35, 0x6b, 0x03, 0x61, 0x51, 0x08, 0x1f, 0x12, 0x6d, 0x28, 0x3b,
-  0x36, 0x09, 0x7d, 0x57, 0x3f, 0x25, 0x3b, 0x73, 0x74, 0x41, 0x21, 0x0f,
-  0x38, 0x5d, 0x38, 0x2b, 0x64, 0x79, 0x3b, 0x47, 0x11, 0x15, 0x10, 0x63,
-  0x78, 0x31, 0x71, 0x7f, 0x10, 0x4d, 0x49, 0x1b, 0xab, 0x69, 0x92, 0x37,
-  0xe2, 0x05, 0x95, 0x53, 0x32, 0x20, 0x19, 0x6e, 0x71, 0x3c, 0x4e, 0x0a,
-  0xac, 0x58, 0x88, 0x26, 0xc3, 0x74, 0x65, 0x45, 0x76, 0x13, 0x49, 0x61,
-  0x91, 0x2f, 0xee, 0x7d, 0x2f, 0x4a, 0x33, 0x18, 0xf9, 0x66, 0xb5, 0x34,
-  0x74, 0x05, 0x41, 0x53, 0xb8, 0x21, 0xf8, 0x6f, 0x64, 0x3c, 0x62, 0x0a,
-  0x82, 0x58, 0xc7, 0x26, 0x34, 0x77, 0xa0, 0x45, 0xc6, 0x13, 0x0c, 0x60,
-  0xb4, 0x2e, 0xd2, 0x7c, 0x62, 0x4d, 0x94, 0x1b, 0x20, 0x68, 0x50, 0x36,
-  0xe3, 0x04, 0x5d, 0x55, 0xab, 0x23, 0xd8, 0x71, 0x44, 0x3e, 0xa5, 0x0c,
-  0x7b, 0x5d, 0x83, 0x2b, 0x50, 0x78, 0xb4, 0x46, 0x2b, 0x17, 0xa8, 0x65,
-  0x22, 0x32, 0xf5, 0x00, 0x3c, 0x51, 0xb4, 0x1f, 0x3e, 0x6c, 0xb9, 0x3a,
-  0x37, 0x0b, 0xe3, 0x59, 0x7a, 0x26, 0xef, 0x74, 0x3f, 0x45, 0xf1, 0x13,
-  0x58, 0x60, 0xc8, 0x2e, 0xe4, 0x7f, 0x13, 0x4c, 0xe5, 0x1a, 0x58, 0x6b,
-  0x36, 0x38, 0x90, 0x06, 0x62, 0x57, 0x9d, 0x25, 0xab, 0x72, 0x03, 0x43,
-  0x90, 0x11, 0xb1, 0x5e, 0x7c, 0x2f, 0xc0, 0x7d, 0xd0, 0x4a, 0x7b, 0x1b,
-  0x25, 0x68, 0xe8, 0x36, 0xbc, 0x07, 0x61, 0x54, 0x74, 0x25, 0xf1, 0x73,
-  0xbf, 0x40, 0x72, 0x11, 0x36, 0x5e, 0xad, 0x2c, 0x96, 0x7d, 0x49, 0x4a,
-  0x75, 0x1b, 0x36, 0x68, 0xd8, 0x36, 0x88, 0x07, 0xb7, 0x54, 0x1d, 0x25,
-  0x67, 0x72, 0x1d, 0x43, 0x3d, 0x10, 0xc1, 0x5e, 0xf5, 0x2f, 0xdc, 0x7c,
-  0xa7, 0x4d, 0x0d, 0x1a, 0x10, 0x6b, 0x51, 0x38, 0x7c, 0x09, 0x00, 0x56,
-  0x50, 0x27, 0x25, 0x74, 0x2b, 0x45, 0x28, 0x12, 0x22, 0x63, 0x32, 0x30,
-  0x38, 0x01, 0x34, 0x4e, 0x23, 0x1f, 0x2e, 0x6c, 0x64, 0x3d, 0x25, 0x0a,
-  0x11, 0x5b, 0x16, 0x28, 0x34, 0x79, 0x64, 0x46, 0x5c, 0x17, 0x5f, 0x64,
-  0xa1, 0x35, 0x9c, 0x02, 0xf4, 0x53, 0xcc, 0x20, 0x74, 0x70, 0x07, 0x41,
-  0x65, 0x0e, 0x53, 0x5f, 0xe4, 0x2c, 0x82, 0x7d, 0xc5, 0x4a, 0x31, 0x1a,
-  0x3a, 0x6b, 0x05, 0x38, 0xd0, 0x09, 0xc4, 0x56, 0x30, 0x26, 0x3d, 0x77,
-  0xb6, 0x44, 0xf9, 0x15, 0x35, 0x65, 0x66, 0x32, 0xb8, 0x03, 0xf8, 0x50,
-  0x37, 0x20, 0x2d, 0x71, 0x92, 0x3e, 0xc9, 0x0f, 0x75, 0x5f, 0xa6, 0x2c,
-  0xdb, 0x7d, 0x4d, 0x4d, 0xa5, 0x1a, 0xd3, 0x6b, 0x74, 0x3b, 0xd5, 0x08,
-  0x32, 0x58, 0x59, 0x29, 0xf9, 0x76, 0x0d, 0x46, 0xb7, 0x17, 0x8d, 0x64,
-  0x5f, 0x34, 0xf3, 0x05, 0x71, 0x55, 0x97, 0x22, 0x5c, 0x72, 0xed, 0x43,
-  0x36, 0x13, 0xb8, 0x60, 0x23, 0x30, 0xa1, 0x01, 0x35, 0x51, 0xa7, 0x1e,
-  0x24, 0x6e, 0xb4, 0x3f, 0x2a, 0x0f, 0xaa, 0x5c, 0x50, 0x2c, 0x91, 0x7d,
-  0x7c, 0x4d, 0xe0, 0x1a, 0x10, 0x6a, 0xcb, 0x3b, 0xa8, 0x0b, 0x12, 0x5b,
-  0xe7, 0x28, 0x15, 0x78, 0x3b, 0x48, 0x93, 0x19, 0x30, 0x69, 0xce, 0x36,
-  0xa5, 0x06, 0x03, 0x56, 0xd4, 0x27, 0xeb, 0x77, 0x90, 0x47, 0x85, 0x14,
-  0xd0, 0x64, 0x59, 0x34, 0x2c, 0x04, 0xf8, 0x55, 0xf0, 0x25, 0x7d, 0x75,
-  0x3b, 0x45, 0xe0, 0x12, 0xa2, 0x62, 0x7a, 0x32, 0x28, 0x02, 0xec, 0x53,
-  0x83, 0x23, 0x56, 0x73, 0x34, 0x43, 0x2c, 0x13, 0xc3, 0x60, 0xcd, 0x30,
-  0xb7, 0x00, 0x49, 0x50, 0x79, 0x20, 0x19, 0x70, 0x38, 0x40, 0x95, 0x11,
-  0xe2, 0x61, 0x88, 0x31, 0xaa, 0x01, 0x43, 0x51, 0x59, 0x21, 0x6b, 0x71,
-  0x73, 0x41, 0x44, 0x11, 0x50, 0x61, 0x6d, 0x31, 0x0d, 0x01, 0x29, 0x51,
-  0x70, 0x21, 0x33, 0x71, 0x38, 0x41, 0x34, 0x11, 0x23, 0x61, 0x35, 0x31,
-  0x21, 0x01, 0x3e, 0x51, 0x50, 0x21, 0x12, 0x71, 0x7c, 0x41, 0x6c, 0x11,
-  0x44, 0x61, 0x48, 0x31, 0xe5, 0x01, 0xdd, 0x51, 0xb0, 0x21, 0xec, 0x71,
-  0x3b, 0x40, 0x00, 0x10, 0x30, 0x60, 0x55, 0x30, 0xa1, 0x00, 0x8c, 0x50,
-  0xc2, 0x20, 0x65, 0x73, 0x75, 0x43, 0x05, 0x13, 0x93, 0x63, 0xe1, 0x33,
-  0x2d, 0x02, 0x7e, 0x52, 0xbb, 0x22, 0xb5, 0x72, 0x32, 0x45, 0x67, 0x15,
-  0xbf, 0x65, 0xf0, 0x35, 0x64, 0x04, 0x79, 0x54, 0x98, 0x24, 0xc0, 0x74,
-  0x34, 0x47, 0xb3, 0x17, 0xd1, 0x67, 0x18, 0x36, 0xa8, 0x06, 0xc9, 0x56,
-  0x30, 0x29, 0x91, 0x79, 0x3b, 0x48, 0x5a, 0x18, 0xe2, 0x68, 0x53, 0x3b,
-  0xe4, 0x0b, 0x8d, 0x5b, 0x64, 0x2a, 0xed, 0x7a, 0x71, 0x4d, 0xc5, 0x1d,
-  0x1f, 0x6c, 0xbf, 0x3c, 0x26, 0x0f, 0xfd, 0x5f, 0x35, 0x2e, 0xa3, 0x7e,
-  0x35, 0x51, 0xa5, 0x21, 0x3f, 0x70, 0xaf, 0x40, 0x25, 0x13, 0xb9, 0x63,
-  0x15, 0x32, 0x96, 0x02, 0x34, 0x55, 0xea, 0x25, 0x45, 0x74, 0xd9, 0x44,
-  0xe4, 0x17, 0x12, 0x66, 0xf6, 0x36, 0x15, 0x09, 0x3c, 0x58, 0x9a, 0x28,
-  0x65, 0x7b, 0xcf, 0x4b, 0xe4, 0x1a, 0x05, 0x6d, 0xd1, 0x3d, 0xab, 0x0c,
-  0x70, 0x5f, 0xd6, 0x2f, 0xde, 0x7e, 0x07, 0x51, 0x4e, 0x20, 0x9a, 0x70,
-  0x91, 0x43, 0x66, 0x12, 0x74, 0x65, 0xec, 0x35, 0xbf, 0x04, 0x68, 0x57,
-  0x64, 0x26, 0x88, 0x76, 0x9c, 0x49, 0x40, 0x18, 0x75, 0x6b, 0x33, 0x3a,
-  0xd5, 0x0a, 0xe8, 0x5d, 0xa1, 0x2c, 0x53, 0x7f, 0x64, 0x4e, 0x10, 0x21,
-  0x26, 0x70, 0xe3, 0x40, 0xb0, 0x13, 0x89, 0x62, 0xac, 0x35, 0x48, 0x04,
-  0x10, 0x57, 0x77, 0x26, 0x7b, 0x79, 0x0a, 0x48, 0x1d, 0x1b, 0x61, 0x6a,
-  0x64, 0x3d, 0x29, 0x0c, 0x38, 0x5f, 0x30, 0x2e, 0x74, 0x01, 0x3a, 0x50,
-  0x22, 0x23, 0x3f, 0x72, 0x64, 0x45, 0x28, 0x14, 0x06, 0x67, 0x04, 0x36,
-  0x64, 0x09, 0x6a, 0x58, 0x42, 0x2b, 0x4c, 0x7a, 0xb0, 0x4d, 0x98, 0x1c,
-  0xe3, 0x6f, 0x95, 0x3e, 0x3b, 0x10, 0x00, 0x63, 0x64, 0x32, 0x1d, 0x05,
-  0xab, 0x54, 0x8b, 0x27, 0x90, 0x76, 0x3c, 0x48, 0x7b, 0x1b, 0x50, 0x6a,
-  0x82, 0x3d, 0xad, 0x0c, 0x2c, 0x5e, 0x7c, 0x31, 0xbe, 0x00, 0xf1, 0x53,
-  0x27, 0x25, 0x34, 0x74, 0xf0, 0x47, 0xbd, 0x16, 0x0d, 0x68, 0x79, 0x3b,
-  0xd0, 0x0a, 0xd7, 0x5d, 0x71, 0x2f, 0xa8, 0x7e, 0xd1, 0x51, 0x19, 0x23,
-  0xa1, 0x72, 0xcf, 0x45, 0x79, 0x17, 0x94, 0x66, 0x38, 0x38, 0x5c, 0x0b,
-  0xea, 0x5a, 0x18, 0x2c, 0xb7, 0x7f, 0x8d, 0x4e, 0x5f, 0x20, 0xeb, 0x73,
-  0x34, 0x45, 0x8c, 0x14, 0x04, 0x66, 0xbe, 0x39, 0x64, 0x0b, 0xad, 0x5a,
-  0x35, 0x2c, 0xb1, 0x7f, 0x31, 0x51, 0xa6, 0x20, 0x24, 0x72, 0xbc, 0x45,
-  0x28, 0x17, 0xe3, 0x66, 0x7a, 0x38, 0xef, 0x0b, 0x0e, 0x5d, 0xd1, 0x2c,
-  0x58, 0x7e, 0xc8, 0x51, 0xe4, 0x23, 0x0b, 0x75, 0xf1, 0x44, 0x40, 0x16,
-  0x38, 0x68, 0x81, 0x3b, 0x30, 0x0d, 0xd9, 0x5c, 0xab, 0x2e, 0x02, 0x00,
-  0xc2, 0x53, 0xe5, 0x25, 0x7d, 0x77, 0xd6, 0x46, 0xd0, 0x18, 0x7e, 0x6a,
-  0x21, 0x3c, 0xfc, 0x0f, 0xbc, 0x61, 0x70, 0x33, 0x30, 0x05, 0xbb, 0x54,
-  0xda, 0x26, 0x2d, 0x78, 0xee, 0x7e, 0x1b, 0x29, 0x6b, 0x5b, 0xfb, 0x75,
-  0x99, 0x27, 0xde, 0x51, 0x22, 0x00, 0x75, 0x32, 0x17, 0x6c, 0xb7, 0x1e,
-  0x8b, 0x48, 0xf8, 0x7a, 0xde, 0x14, 0x6b, 0x47, 0x0d, 0x71, 0x6c, 0x23,
-  0x57, 0x5d, 0xa3, 0x0f, 0xa2, 0x39, 0x9e, 0x6b, 0x9e, 0x05, 0xf2, 0x37,
-  0xe1, 0x61, 0xdd, 0x13, 0x9a, 0x4d, 0xc0, 0x7f, 0xc1, 0x29, 0xcf, 0x5b,
-  0xcf, 0x75, 0x8b, 0x27, 0xc7, 0x51, 0xd0, 0x03, 0x80, 0x3d, 0x93, 0x6f,
-  0xdd, 0x19, 0xe8, 0x4b, 0xbb, 0x65, 0xbf, 0x17, 0xa6, 0x41, 0x81, 0x73,
-  0x73, 0x2d, 0x72, 0x5f, 0x39, 0x09, 0x05, 0x3b, 0xe2, 0x54, 0xf9, 0x06,
-  0xe4, 0x30, 0xc9, 0x62, 0xc6, 0x28, 0x2d, 0x62, 0x78, 0x54, 0x47, 0x21,
-  0x03, 0x7a, 0x37, 0x4c, 0xf1, 0x17, 0xae, 0x70, 0x45, 0x3a, 0x10, 0x05,
-  0xd2, 0x5e, 0x2c, 0x29, 0xeb, 0x1c, 0x17, 0x57, 0xcc, 0x20, 0x90, 0x72,
-  0x46, 0x4c, 0x26, 0x04, 0xc1, 0x6a, 0xa7, 0x42, 0x35, 0x1e, 0xd2, 0x60,
-  0xb2, 0x3b, 0x90, 0x16, 0xc0, 0x45, 0xbf, 0x30, 0x36, 0x0c, 0xe2, 0x5e,
-  0x56, 0x28, 0xa5, 0x61, 0x09, 0x57, 0x7f, 0x21, 0xef, 0x7a, 0x8c, 0x4c,
-  0x31, 0x16, 0xe4, 0x74, 0x15, 0x3d, 0xd5, 0x06, 0x72, 0x60, 0x89, 0x2f,
-  0x0d, 0x1a, 0xdf, 0x59, 0x6a, 0x23, 0xe0, 0x75, 0x55, 0x51, 0x6e, 0x3e,
-  0x51, 0x74, 0xed, 0x4f, 0x46, 0x1b, 0xa7, 0x73, 0x1f, 0x20, 0xe7, 0x10,
-  0x24, 0x6c, 0xba, 0x3e, 0x33, 0x08, 0x9d, 0x45, 0xf3, 0x30, 0x43, 0x1f,
-  0x93, 0x52, 0x0f, 0x2e, 0x1d, 0x71, 0xb1, 0x43, 0x12, 0x1f, 0xf2, 0x6e,
-  0x4d, 0x5d, 0x6f, 0x17, 0x65, 0x76, 0x1b, 0x25, 0x16, 0x0f, 0xde, 0x68,
-  0xcf, 0x3b, 0x08, 0x07, 0x2b, 0x78, 0xeb, 0x0a, 0xac, 0x5f, 0x97, 0x70,
-  0xd3, 0x05, 0x90, 0x77, 0xef, 0x41, 0x53, 0x14, 0x17, 0x67, 0xd5, 0x49,
-  0xad, 0x1c, 0x26, 0x66, 0xc0, 0x1b, 0x9f, 0x2c, 0x50, 0x7e, 0xee, 0x33,
-  0x97, 0x0d, 0x74, 0x50, 0x5e, 0x23, 0x76, 0x7f, 0x79, 0x71, 0x86, 0x03,
-  0xa9, 0x56, 0xfe, 0x48, 0x8d, 0x14, 0x63, 0x67, 0x63, 0x4a, 0x01, 0x14,
-  0xdf, 0x48, 0xb4, 0x1b, 0xa7, 0x2e, 0x91, 0x41, 0x40, 0x35, 0x3a, 0x0f,
-  0x08, 0x52, 0x1c, 0x25, 0x22, 0x08, 0x56, 0x52, 0x79, 0x05, 0x72, 0x5a,
-  0x71, 0x6f, 0x4e, 0x1e, 0x2d, 0x7a, 0x07, 0x4d, 0x5d, 0x10, 0x01, 0x6a,
-  0xfe, 0x1d, 0xf9, 0x32, 0x1e, 0x47, 0x22, 0x14, 0x94, 0x0b, 0xd9, 0x55,
-  0x1a, 0x39, 0x26, 0x0c, 0x66, 0x5f, 0x3e, 0x2b, 0xe8, 0x5f, 0xdf, 0x72,
-  0x87, 0x01, 0x46, 0x76, 0x47, 0x42, 0x6b, 0x15, 0x97, 0x78, 0x8c, 0x42,
-  0xc1, 0x35, 0x1c, 0x6b, 0x99, 0x35, 0x94, 0x11, 0x86, 0x46, 0x14, 0x36,
-  0x99, 0x02, 0x9f, 0x5c, 0x5b, 0x14, 0x28, 0x21, 0xf2, 0x56, 0xf6, 0x22,
-  0x5a, 0x76, 0xc7, 0x50, 0x1b, 0x01, 0xdd, 0x5d, 0xc6, 0x4a, 0x3d, 0x16,
-  0x54, 0x7a, 0xf7, 0x44, 0xb1, 0x3c, 0xdf, 0x49, 0x92, 0x3e, 0x06, 0x1b,
-  0x41, 0x6e, 0xaf, 0x38, 0x2f, 0x29, 0xa1, 0x44, 0x16, 0x35, 0x65, 0x0f,
-  0xfa, 0x53, 0xcf, 0x2f, 0xdf, 0x26, 0x7d, 0x71, 0x52, 0x28, 0x50, 0x74,
-  0xdb, 0x58, 0xd7, 0x22, 0xf4, 0x50, 0x74, 0x6d, 0x46, 0x1f, 0x47, 0x79,
-  0xe4, 0x4d, 0xe7, 0x19, 0x7f, 0x4a, 0xf4, 0x19, 0x32, 0x12, 0x34, 0x6e,
-  0x4b, 0x32, 0x79, 0x0f, 0x33, 0x48, 0x9c, 0x1c, 0xfb, 0x20, 0x41, 0x75,
-  0x14, 0x31, 0x22, 0x0b, 0x50, 0x5f, 0xc9, 0x23, 0x1e, 0x76, 0xc0, 0x53,
-  0x1f, 0x26, 0xaa, 0x79, 0xe3, 0x4d, 0x14, 0x21, 0x5b, 0x75, 0x98, 0x49,
-  0xd0, 0x1d, 0x15, 0x71, 0x54, 0x45, 0x95, 0x16, 0xd0, 0x6a, 0x1c, 0x3e,
-  0x23, 0x3b, 0x8c, 0x67, 0x69, 0x32, 0x27, 0x0f, 0xea, 0x4a, 0x46, 0x1d,
-  0xb2, 0x08, 0x44, 0x55, 0x5d, 0x39, 0x3c, 0x04, 0x99, 0x72, 0x74, 0x2c,
-  0xf0, 0x09, 0xb7, 0x55, 0xd6, 0x02, 0xb4, 0x56, 0xc6, 0x51, 0x9e, 0x2c,
-  0xa9, 0x70, 0x04, 0x4d, 0xea, 0x0a, 0x64, 0x75, 0xde, 0x40, 0x4c, 0x1d,
-  0x5c, 0x5c, 0x5c, 0x45, 0xed, 0x10, 0x54, 0x6d, 0x93, 0x6c, 0x54, 0x15,
-  0xe8, 0x60, 0x5e, 0x3d, 0x3b, 0x3f, 0xc9, 0x4b, 0xf9, 0x17, 0x66, 0x0d,
-  0xd3, 0x68, 0xc9, 0x3c, 0xe1, 0x00, 0x2f, 0x5d, 0x58, 0x1e, 0x5c, 0x2a,
-  0x92, 0x59, 0x77, 0x24, 0x85, 0x09, 0x77, 0x54, 0xb0, 0x18, 0x98, 0x4c,
-  0xc6, 0x50, 0x2f, 0x2d, 0x66, 0x71, 0x46, 0x4f, 0x96, 0x12, 0xad, 0x46,
-  0x7e, 0x7a, 0x8e, 0x1f, 0x9f, 0x7b, 0xdf, 0x4f, 0x06, 0x13, 0x96, 0x6e,
-  0x4a, 0x77, 0x31, 0x2b, 0xfa, 0x5f, 0x9e, 0x41, 0x9f, 0x1d, 0xc1, 0x61,
-  0x21, 0x35, 0xa7, 0x10, 0x32, 0x54, 0xe9, 0x08, 0xb2, 0x0f, 0x8d, 0x6b,
-  0x15, 0x3f, 0xbf, 0x0a, 0x70, 0x55, 0x93, 0x01, 0x56, 0x08, 0xd0, 0x55,
-  0x4b, 0x39, 0x7f, 0x07, 0xb6, 0x6e, 0xd5, 0x1a, 0x32, 0x02, 0x6f, 0x5f,
-  0xf4, 0x24, 0xe7, 0x01, 0x19, 0x62, 0xa2, 0x1e, 0x46, 0x7f, 0x32, 0x5a,
-  0xb5, 0x2f, 0xd7, 0x7a, 0xaa, 0x67, 0xd1, 0x12, 0x52, 0x78, 0x29, 0x45,
-  0xae, 0x2a, 0xce, 0x77, 0x2b, 0x72, 0x84, 0x26, 0x73, 0x4d, 0x86, 0x49,
-  0xce, 0x15, 0x42, 0x79, 0x3d, 0x4e, 0x7c, 0x1a, 0xb5, 0x57, 0x34, 0x45,
-  0xa0, 0x11, 0xf7, 0x6c, 0xb1, 0x7a, 0x1a, 0x2e, 0xc6, 0x6a, 0x52, 0x4b,
-  0x44, 0x1c, 0xc7, 0x68, 0x2d, 0x05, 0x9b, 0x29, 0xf2, 0x66, 0x05, 0x37,
-  0x53, 0x1a, 0x9e, 0x64, 0x02, 0x01, 0xc2, 0x34, 0x89, 0x5f, 0x96, 0x39,
-  0xdd, 0x06, 0x01, 0x69, 0x47, 0x3c, 0x8e, 0x0a, 0x9e, 0x5a, 0x56, 0x0f,
-  0x6d, 0x30, 0x46, 0x5e, 0xa2, 0x38, 0xcc, 0x03, 0xcc, 0x56, 0x3e, 0x33,
-  0x90, 0x3a, 0xf3, 0x61, 0xdf, 0x0c, 0xb6, 0x04, 0xb6, 0x51, 0xf0, 0x24,
-  0x97, 0x0f, 0x2e, 0x58, 0x2f, 0x12, 0x20, 0x3f, 0x3e, 0x64, 0x66, 0x2c,
-  0x73, 0x09, 0x51, 0x5c, 0x6f, 0x27, 0x59, 0x00, 0xec, 0x6a, 0x97, 0x17,
-  0x93, 0x3c, 0x98, 0x69, 0x54, 0x2b, 0x55, 0x74, 0x65, 0x5f, 0x7d, 0x22,
-  0x67, 0x75, 0x61, 0x52, 0x75, 0x17, 0x62, 0x42, 0x5c, 0x6d, 0x5f, 0x18,
-  0xc0, 0x7d, 0xf0, 0x5a, 0xb6, 0x2d, 0x80, 0x70, 0x48, 0x5a, 0x76, 0x27,
-  0x13, 0x45, 0x34, 0x6e, 0xcb, 0x1b, 0xee, 0x7b, 0xa2, 0x44, 0x7f, 0x2e,
-  0x35, 0x71, 0x26, 0x4e, 0x50, 0x1a, 0x2b, 0x47, 0xef, 0x71, 0x1e, 0x25,
-  0xc7, 0x72, 0xa5, 0x45, 0x6b, 0x2f, 0x11, 0x78, 0xef, 0x0f, 0xd8, 0x62,
-  0x0e, 0x38, 0x5d, 0x0f, 0xf4, 0x22, 0xb9, 0x73, 0x21, 0x45, 0x81, 0x28,
-  0x9b, 0x73, 0x69, 0x4f, 0x25, 0x62, 0x5a, 0x39, 0xfc, 0x0f, 0x07, 0x62,
-  0x50, 0x78, 0x14, 0x45, 0xaa, 0x28, 0x34, 0x72, 0xf4, 0x45, 0xae, 0x22,
-  0xb6, 0x39, 0x09, 0x0e, 0x86, 0x64, 0xe6, 0x78, 0x56, 0x44, 0x83, 0x2f,
-  0x71, 0x71, 0xde, 0x4e, 0x6a, 0x66, 0x95, 0x39, 0x11, 0x13, 0xd6, 0x24,
-  0x7b, 0x70, 0x99, 0x5b, 0xba, 0x2e, 0xce, 0x7a, 0xa7, 0x12, 0x38, 0x65,
-  0xf6, 0x3f, 0x86, 0x50, 0x00, 0x2c, 0xe4, 0x77, 0xfb, 0x59, 0x7e, 0x29,
-  0xe5, 0x3f, 0x4e, 0x11, 0xd4, 0x6b, 0xf6, 0x7f, 0x25, 0x5f, 0xf3, 0x22,
-  0x80, 0x74, 0x6f, 0x54, 0xa1, 0x6f, 0xd2, 0x45, 0x16, 0x57, 0x9f, 0x20,
-  0xb9, 0x0a, 0x0c, 0x56, 0xb3, 0x68, 0x9c, 0x03, 0xc2, 0x53, 0x17, 0x2f,
-  0xd5, 0x40, 0x1c, 0x1d, 0xd2, 0x2e, 0x40, 0x0e, 0x19, 0x50, 0x8f, 0x31,
-  0xfd, 0x41, 0x34, 0x1b, 0x16, 0x33, 0x27, 0x03, 0xd2, 0x56, 0xee, 0x32,
-  0xbd, 0x4e, 0x40, 0x18, 0x92, 0x72, 0x76, 0x0a, 0x33, 0x6a, 0xd2, 0x3d,
-  0xf7, 0x07, 0xfd, 0x63, 0xc4, 0x39, 0x3d, 0x0f, 0x5c, 0x6f, 0x75, 0x31,
-  0x60, 0x1b, 0x1d, 0x6d, 0x0c, 0x37, 0xcd, 0x19, 0xc0, 0x63, 0xd5, 0x35,
-  0xdc, 0x1f, 0xc5, 0x61, 0xc0, 0x4b, 0xcd, 0x1d, 0xf4, 0x67, 0xf5, 0x49,
-  0xd8, 0x13, 0xed, 0x65, 0x77, 0x45, 0x32, 0x7e, 0x4e, 0x14, 0x5a, 0x22,
-  0x54, 0x78, 0x45, 0x16, 0xa9, 0x2c, 0x8f, 0x7a, 0x97, 0x75, 0x18, 0x47,
-  0xc0, 0x2b, 0x70, 0x7b, 0x32, 0x41, 0x75, 0x2f, 0x64, 0x75, 0x1d, 0x43,
-  0xa1, 0x24, 0xbe, 0x76, 0xb2, 0x58, 0xbc, 0x22, 0x60, 0x74, 0x08, 0x5e,
-  0x95, 0x21, 0x88, 0x0b, 0x4e, 0x5d, 0x44, 0x27, 0xdc, 0x0e, 0x8b, 0x50,
-  0x54, 0x3a, 0x4c, 0x0c, 0xd1, 0x57, 0x93, 0x39, 0x3e, 0x03, 0x5e, 0x55,
-  0x02, 0x37, 0xfb, 0x01, 0xb8, 0x6f, 0x7f, 0x34, 0x83, 0x02, 0xa9, 0x68,
-  0x12, 0x31, 0xf7, 0x1f, 0x13, 0x64, 0x3c, 0x32, 0x98, 0x18, 0x3a, 0x61,
-  0xd0, 0x4f, 0xbf, 0x15, 0x34, 0x62, 0x8a, 0x48, 0x53, 0x11, 0xeb, 0x7f,
-  0x63, 0x44, 0xcf, 0x12, 0x4e, 0x7b, 0x94, 0x41, 0x3d, 0x2e, 0xcf, 0x78,
-  0xa5, 0x69, 0x7a, 0x1f, 0xc3, 0x44, 0x4f, 0x6a, 0xd1, 0x13, 0x51, 0x39,
-  0xf8, 0x6e, 0x3e, 0x14, 0x80, 0x3d, 0x18, 0x63, 0xeb, 0x08, 0x3f, 0x3e,
-  0x51, 0x67, 0xf2, 0x0c, 0x0e, 0x32, 0xbc, 0x5b, 0xca, 0x00, 0x7d, 0x36,
-  0x9f, 0x5f, 0x66, 0x05, 0x57, 0x2a, 0xf3, 0x53, 0x39, 0x79, 0x5b, 0x2e,
-  0xd5, 0x57, 0x54, 0x7d, 0xc1, 0x1a, 0xaf, 0x1e, 0x8f, 0x25, 0x12, 0x73,
-  0x54, 0x1a, 0x90, 0x21, 0x98, 0x48, 0x0a, 0x16, 0x1b, 0x3d, 0x83, 0x44,
-  0xc1, 0x13, 0x02, 0x39, 0x7e, 0x40, 0xbc, 0x6f, 0x8c, 0x36, 0xda, 0x5d,
-  0x3a, 0x6b, 0x68, 0x32, 0x4b, 0x59, 0xed, 0x60, 0xdb, 0x0f, 0xea, 0x56,
-  0xcd, 0x7d, 0x27, 0x0b, 0x5b, 0x52, 0x31, 0x79, 0x47, 0x00, 0xa3, 0x2f,
-  0xb7, 0x76, 0x9e, 0x1d, 0xd8, 0x24, 0xae, 0x73, 0xfd, 0x1a, 0xc9, 0x21,
-  0xdd, 0x48, 0x96, 0x17, 0xd2, 0x3e, 0xd0, 0x45, 0xcc, 0x6c, 0xca, 0x3b,
-  0xc9, 0x42, 0xc3, 0x69, 0xcc, 0x30, 0xd2, 0x5f, 0xf2, 0x66, 0xe1, 0x0d,
-  0x91, 0x54, 0x9d, 0x63, 0xf5, 0x0a, 0xcc, 0x51, 0x3c, 0x14, 0x69, 0x56,
-  0x07, 0x7f, 0x22, 0x24, 0xc7, 0x4c, 0x87, 0x75, 0xc8, 0x22, 0xe5, 0x4b,
-  0x65, 0x70, 0x7a, 0x19, 0x3d, 0x46, 0x9d, 0x6e, 0x81, 0x17, 0xbc, 0x3c,
-  0x71, 0x65, 0x55, 0x12, 0xd1, 0x3a, 0x80, 0x63, 0x5a, 0x08, 0x08, 0x31,
-  0xc0, 0x59, 0x94, 0x06, 0x08, 0x2f, 0x42, 0x54, 0xd0, 0x7c, 0x9a, 0x25,
-  0x67, 0x52, 0x36, 0x7b, 0xcb, 0x23, 0x1d, 0x48, 0x3c, 0x71, 0xfa, 0x19,
-  0x1c, 0x46, 0x20, 0x6f, 0x90, 0x17, 0x6c, 0x3c, 0xc1, 0x64, 0xa4, 0x0d,
-  0x06, 0x3a, 0xe0, 0x62, 0x1c, 0x0b, 0x21, 0x30, 0xa0, 0x58, 0x18, 0x01,
-  0xcc, 0x29, 0x6f, 0x56, 0xe7, 0x7e, 0x5a, 0x27, 0xd1, 0x4f, 0x09, 0x74,
-  0x88, 0x1c, 0x42, 0x45, 0xde, 0x6d, 0x0d, 0x1a, 0xd1, 0x42, 0x4a, 0x6b,
-  0xc9, 0x13, 0x15, 0x38, 0xe5, 0x60, 0x7c, 0x09, 0x95, 0x31, 0x5d, 0x5e,
-  0xef, 0x06, 0x39, 0x2f, 0x53, 0x57, 0xea, 0x7f, 0x03, 0x24, 0xed, 0x4c,
-  0x90, 0x74, 0x7e, 0x1d, 0x9d, 0x45, 0x27, 0x72, 0x56, 0x1a, 0xf0, 0x42,
-  0x2b, 0x6b, 0x49, 0x13, 0xd2, 0x3b, 0x7a, 0x60, 0x28, 0x08, 0xdd, 0x30,
-  0xcf, 0x58, 0x10, 0x01, 0x4b, 0x29, 0x85, 0x51, 0x8c, 0x79, 0x0c, 0x26,
-  0x5b, 0x4e, 0xc5, 0x76, 0x9b, 0x1e, 0x19, 0x47, 0x67, 0x6f, 0xb2, 0x17,
-  0x87, 0x3f, 0x9d, 0x67, 0x2b, 0x0c, 0x7d, 0x34, 0x5d, 0x5c, 0xac, 0x04,
-  0x9a, 0x2c, 0xaa, 0x54, 0x85, 0x7c, 0x6d, 0x25, 0x1c, 0x4d, 0x6a, 0x75,
-  0x1c, 0x1d, 0xb0, 0x45, 0xb0, 0x6d, 0x9c, 0x15, 0x81, 0x3d, 0xf4, 0x65,
-  0xe6, 0x0d, 0xd0, 0x35, 0x9c, 0x5d, 0xd6, 0x05, 0xc7, 0x2d, 0xc0, 0x55,
-  0xc9, 0x7d, 0xd9, 0x25, 0xc0, 0x4d, 0xcc, 0x75, 0xd2, 0x1d, 0xd2, 0x45,
-  0xa8, 0x6d, 0xee, 0x15, 0x9c, 0x3d, 0x98, 0x65, 0xab, 0x0d, 0xbc, 0x35,
-  0x5a, 0x5d, 0x6c, 0x05, 0x0b, 0x2d, 0x63, 0x55, 0xa6, 0x7c, 0xea, 0x24,
-  0x87, 0x4c, 0xcf, 0x74, 0x1c, 0x1c, 0x35, 0x44, 0x11, 0x6c, 0xd2, 0x17,
-  0x99, 0x3f, 0xfd, 0x67, 0x65, 0x0f, 0x14, 0x37, 0xc5, 0x5e, 0xc5, 0x06,
-  0x0f, 0x2e, 0x0a, 0x56, 0xc3, 0x79, 0xcd, 0x21, 0x14, 0x49, 0x00, 0x71,
-  0xc4, 0x18, 0x9c, 0x40, 0x7c, 0x68, 0x63, 0x10, 0xcb, 0x3b, 0x1d, 0x63,
-  0x3c, 0x0b, 0xfa, 0x32, 0x1c, 0x5a, 0x31, 0x02, 0x9a, 0x25, 0x6c, 0x4d,
-  0xda, 0x74, 0xa8, 0x1c, 0x04, 0x44, 0xa5, 0x6f, 0x55, 0x17, 0x3b, 0x3f,
-  0xe8, 0x66, 0x09, 0x0e, 0x84, 0x31, 0x7c, 0x59, 0xfc, 0x00, 0x15, 0x28,
-  0xd8, 0x53, 0x4c, 0x7b, 0xda, 0x22, 0x48, 0x4a, 0xcf, 0x6d, 0x59, 0x15,
-  0xc1, 0x3c, 0x4a, 0x64, 0xd2, 0x0f, 0x15, 0x37, 0xa0, 0x5e, 0x6e, 0x06,
-  0x99, 0x29, 0x1e, 0x51, 0xa0, 0x78, 0x75, 0x20, 0x5d, 0x4b, 0xf6, 0x72,
-  0x48, 0x1a, 0xea, 0x3d, 0xcb, 0x64, 0x62, 0x0c, 0xc8, 0x37, 0x32, 0x5f,
-  0x59, 0x06, 0xe6, 0x29, 0x3c, 0x51, 0x1a, 0x78, 0xc5, 0x23, 0x71, 0x4b,
-  0x28, 0x72, 0x9a, 0x15, 0xce, 0x3c, 0x45, 0x64, 0x51, 0x0f, 0x82, 0x36,
-  0xd9, 0x59, 0x4d, 0x01, 0x45, 0x28, 0x84, 0x53, 0xc5, 0x7a, 0x55, 0x22,
-  0x65, 0x45, 0xb8, 0x6c, 0x9e, 0x17, 0xd8, 0x3e, 0x24, 0x66, 0x6c, 0x09,
-  0x1c, 0x30, 0xe2, 0x5b, 0xd4, 0x02, 0xe8, 0x25, 0xd4, 0x4c, 0x24, 0x74,
-  0x1c, 0x1f, 0x3b, 0x46, 0x1b, 0x69, 0xf5, 0x10, 0xe0, 0x3b, 0x8e, 0x62,
-  0x99, 0x05, 0xfe, 0x2c, 0xe0, 0x57, 0x95, 0x7e, 0xdd, 0x21, 0xd6, 0x48,
-  0x88, 0x73, 0x8a, 0x1a, 0xdb, 0x3d, 0xc8, 0x64, 0xdb, 0x0f, 0xd1, 0x36,
-  0x9b, 0x59, 0x9c, 0x00, 0xa6, 0x2b, 0x97, 0x52, 0x85, 0x75, 0x93, 0x1c,
-  0xbe, 0x47, 0xdf, 0x6e, 0x1c, 0x11, 0x25, 0x38, 0x3c, 0x63, 0x22, 0x0a,
-  0x8c, 0x2c, 0xfe, 0x57, 0x8d, 0x7e, 0xa0, 0x21, 0x1c, 0x48, 0x61, 0x73,
-  0x20, 0x1a, 0xd8, 0x3c, 0xcc, 0x67, 0xbe, 0x0e, 0x67, 0x31, 0x1b, 0x58,
-  0xc8, 0x02, 0x80, 0x25, 0x46, 0x4c, 0x19, 0x77, 0xdf, 0x19, 0xcd, 0x40,
-  0x47, 0x6b, 0x03, 0x12, 0x9c, 0x34, 0x8c, 0x5f, 0x67, 0x06, 0x28, 0x29,
-  0x9e, 0x53, 0x1d, 0x7a, 0x21, 0x1d, 0xfb, 0x47, 0x4a, 0x6e, 0x20, 0x11,
-  0x86, 0x3b, 0x79, 0x62, 0xc3, 0x04, 0xbf, 0x2f, 0x11, 0x56, 0xa9, 0x78,
-  0x1c, 0x23, 0x38, 0x4a, 0xad, 0x6c, 0x0f, 0x17, 0x89, 0x39, 0x71, 0x60,
-  0xf1, 0x0a, 0x15, 0x2d, 0x9b, 0x57, 0x4c, 0x7e, 0xc6, 0x20, 0x5b, 0x4b,
-  0x8b, 0x6d, 0x03, 0x14, 0xa2, 0x3e, 0x51, 0x61, 0xdd, 0x0b, 0x5e, 0x32,
-  0xed, 0x54, 0x17, 0x7f, 0xcc, 0x21, 0x5d, 0x48, 0x91, 0x72, 0x3a, 0x15,
-  0x49, 0x3f, 0xa5, 0x61, 0x05, 0x08, 0xac, 0x32, 0xd5, 0x54, 0x2d, 0x7f,
-  0xcf, 0x21, 0x31, 0x48, 0x5d, 0x72, 0xfe, 0x14, 0x2d, 0x3f, 0x1d, 0x61,
-  0xd0, 0x0b, 0x34, 0x32, 0x7c, 0x54, 0x90, 0x7e, 0xd1, 0x20, 0x5b, 0x4b,
-  0x0f, 0x6d, 0xcd, 0x17, 0x84, 0x39, 0x1e, 0x60, 0x5d, 0x0a, 0x86, 0x2c,
-  0xd4, 0x56, 0x55, 0x79, 0x69, 0x23, 0xae, 0x45, 0xcc, 0x6f, 0x9a, 0x11,
-  0x3c, 0x38, 0x74, 0x62, 0x57, 0x04, 0xa0, 0x2e, 0xc8, 0x50, 0xe1, 0x7a,
-  0xcd, 0x1c, 0x3f, 0x47, 0x0f, 0x69, 0x60, 0x13, 0x1c, 0x35, 0xa7, 0x5f,
-  0xa7, 0x01, 0x9e, 0x2b, 0x87, 0x4d, 0xba, 0x77, 0xa1, 0x19, 0x9b, 0x43,
-  0xb6, 0x65, 0xc1, 0x0f, 0xda, 0x31, 0xc2, 0x5b, 0xdc, 0x7d, 0xa7, 0x27,
-  0x88, 0x49, 0x85, 0x73, 0xe8, 0x15, 0xda, 0x3f, 0xa8, 0x61, 0xf9, 0x0b,
-  0x9e, 0x2d, 0x92, 0x57, 0xb8, 0x79, 0xf5, 0x23, 0x4f, 0x45, 0x6a, 0x6f,
-  0x05, 0x11, 0x28, 0x3b, 0xd8, 0x5c, 0xe5, 0x06, 0x81, 0x28, 0xab, 0x52,
-  0x5b, 0x74, 0x35, 0x1e, 0x21, 0x40, 0xd3, 0x65, 0xcc, 0x0f, 0xa4, 0x31,
-  0x67, 0x5b, 0x00, 0x7d, 0xce, 0x26, 0xc5, 0x48, 0x41, 0x72, 0x03, 0x14,
-  0xda, 0x39, 0x88, 0x63, 0x46, 0x05, 0x11, 0x2f, 0xd3, 0x50, 0x87, 0x7a,
-  0x71, 0x1c, 0x71, 0x46, 0xcc, 0x6b, 0x44, 0x0d, 0x27, 0x37, 0xe0, 0x58,
-  0x1c, 0x02, 0x28, 0x24, 0x89, 0x49, 0x74, 0x73, 0x8c, 0x14, 0xea, 0x3e,
-  0x0c, 0x60, 0xf7, 0x05, 0x53, 0x2f, 0x25, 0x51, 0xe8, 0x7a, 0x41, 0x1c,
-  0x85, 0x41, 0x69, 0x6b, 0xed, 0x0c, 0x58, 0x36, 0x82, 0x5b, 0x02, 0x7d,
-  0x86, 0x26, 0x27, 0x48, 0xd9, 0x6d, 0x5e, 0x17, 0xcd, 0x38, 0x2f, 0x62,
-  0x9c, 0x07, 0x15, 0x29, 0xd1, 0x52, 0x72, 0x74, 0x99, 0x19, 0x5d, 0x43,
-  0xa5, 0x64, 0x34, 0x0e, 0x45, 0x33, 0xa5, 0x54, 0x09, 0x7e, 0xae, 0x23,
-  0xd8, 0x44, 0x64, 0x6e, 0x9e, 0x13, 0x24, 0x35, 0x48, 0x5e, 0xf0, 0x03,
-  0x68, 0x25, 0x52, 0x4e, 0x9e, 0x73, 0x7d, 0x15, 0x67, 0x3e, 0x81, 0x63,
-  0xd4, 0x04, 0x00, 0x2e, 0x5a, 0x53, 0x9a, 0x74, 0xc5, 0x19, 0x1e, 0x43,
-  0x4d, 0x64, 0xc5, 0x09, 0xdd, 0x32, 0x05, 0x54, 0x78, 0x79, 0xb1, 0x22,
-  0x95, 0x47, 0x9d, 0x68, 0x29, 0x12, 0x7b, 0x37, 0x1c, 0x58, 0xac, 0x7d,
-  0x9c, 0x26, 0xe8, 0x4b, 0xc1, 0x6c, 0x6d, 0x16, 0x1f, 0x3b, 0x6c, 0x5c,
-  0x48, 0x01, 0xbd, 0x2a, 0xe8, 0x4f, 0xda, 0x70, 0x99, 0x15, 0xee, 0x3e,
-  0xed, 0x63, 0x95, 0x04, 0x80, 0x29, 0xcc, 0x52, 0xdc, 0x77, 0xc8, 0x18,
-  0xc1, 0x3d, 0x93, 0x66, 0x8f, 0x0b, 0x8b, 0x2c, 0xb6, 0x51, 0x5d, 0x46,
-  0x50, 0x57, 0x73, 0x08, 0x18, 0x2d, 0x0e, 0x46, 0x69, 0x7b, 0x3d, 0x1c,
-  0xd3, 0x31, 0xf2, 0x6a, 0x8c, 0x0f, 0xa2, 0x20, 0x59, 0x44, 0x63, 0x79,
-  0x1b, 0x12, 0x3d, 0x37, 0x87, 0x68, 0x9e, 0x0d, 0xb7, 0x52, 0xf7, 0x41,
-  0x93, 0x64, 0xa8, 0x0b, 0x73, 0x2e, 0x05, 0x75, 0x8c, 0x19, 0xf1, 0x3c,
-  0xcb, 0x2c, 0x3f, 0x4e, 0xc8, 0x22, 0x93, 0x79, 0x03, 0x5c, 0x1d, 0x33,
-  0xd2, 0x17, 0x9b, 0x6a, 0x23, 0x41, 0x38, 0x24, 0x88, 0x78, 0x16, 0x5f,
-  0x30, 0x32, 0xeb, 0x16, 0x54, 0x6d, 0x26, 0x40, 0xc3, 0x24, 0x6f, 0x7b,
-  0xd3, 0x5f, 0xa3, 0x32, 0x0e, 0x09, 0xae, 0x6d, 0x5f, 0x40, 0x3b, 0x27,
-  0xb1, 0x7b, 0x13, 0x5e, 0xc9, 0x32, 0x1c, 0x09, 0x79, 0x2a, 0x7d, 0x19,
-  0xc2, 0x7d, 0x46, 0x22, 0xd4, 0x06, 0x51, 0x6b, 0xc5, 0x4f, 0x45, 0x34,
-  0x8a, 0x18, 0x23, 0x7d, 0x66, 0x3f, 0xff, 0x42, 0x74, 0x2e, 0xfb, 0x0b,
-  0x5f, 0x77, 0x8d, 0x5c, 0x3a, 0x38, 0xa8, 0x65, 0x88, 0x41, 0x62, 0x2d,
-  0xdb, 0x0a, 0x38, 0x76, 0x56, 0x52, 0xf0, 0x3f, 0x1f, 0x1b, 0xf6, 0x40,
-  0xdb, 0x2c, 0x6e, 0x08, 0xba, 0x75, 0xda, 0x51, 0x5f, 0x3d, 0xa7, 0x1a,
-  0xf5, 0x46, 0x46, 0x22, 0x56, 0x0e, 0x99, 0x6b, 0xce, 0x57, 0x0c, 0x33,
-  0x1f, 0x1f, 0x8e, 0x44, 0xda, 0x20, 0x15, 0x0c, 0x44, 0x68, 0xc8, 0x55,
-  0x91, 0x31, 0x07, 0x47, 0x2d, 0x14, 0x4a, 0x48, 0xa5, 0x6f, 0xad, 0x03,
-  0xc7, 0x27, 0x3c, 0x5b, 0x1e, 0x7f, 0x32, 0x13, 0x40, 0x37, 0xf5, 0x6a,
-  0x96, 0x0e, 0xf4, 0x22, 0xca, 0x46, 0x29, 0x7a, 0x70, 0x1e, 0x11, 0x32,
-  0x1c, 0x56, 0x64, 0x0a, 0x64, 0x2e, 0x0d, 0x42, 0x4d, 0x66, 0x53, 0x1a,
-  0x10, 0x3e, 0x4c, 0x52, 0x5b, 0x76, 0x40, 0x2a, 0x42, 0x4e, 0x1d, 0x62,
-  0x54, 0x06, 0x4c, 0x3a, 0x73, 0x5e, 0x6e, 0x72, 0x5a, 0x16, 0x6f, 0x4a,
-  0x11, 0x59, 0x02, 0x11, 0xdd, 0x35, 0xfe, 0x49, 0xc6, 0x6d, 0xa2, 0x01,
-  0x50, 0x24, 0x66, 0x78, 0x08, 0x1c, 0x6c, 0x30, 0xc6, 0x54, 0xbb, 0x68,
-  0xb5, 0x0c, 0x46, 0x23, 0x10, 0x47, 0x36, 0x1b, 0xa6, 0x3f, 0x93, 0x53,
-  0x5d, 0x76, 0x1c, 0x0a, 0x86, 0x2e, 0x97, 0x42, 0x4d, 0x61, 0x43, 0x05,
-  0xd3, 0x59, 0x98, 0x7d, 0x57, 0x10, 0x5b, 0x34, 0xf2, 0x48, 0xbb, 0x6c,
-  0x03, 0x03, 0xc7, 0x27, 0xe8, 0x7b, 0x11, 0x1e, 0xdb, 0x16, 0x84, 0x3a,
-  0x1f, 0x19, 0xe0, 0x65, 0x14, 0x40, 0x3d, 0x2c, 0x91, 0x08, 0x6b, 0x57,
-  0xc1, 0x33, 0xed, 0x1f, 0x32, 0x7a, 0x80, 0x46, 0x11, 0x25, 0xeb, 0x01,
-  0x30, 0x6c, 0xc8, 0x48, 0x45, 0x17, 0xc9, 0x73, 0x55, 0x5e, 0xdb, 0x3a,
-  0x14, 0x19, 0xd7, 0x65, 0x49, 0x40, 0x9d, 0x2c, 0x45, 0x0b, 0x8d, 0x57,
-  0x77, 0x32, 0xf7, 0x1e, 0x01, 0x7d, 0x80, 0x59, 0x7e, 0x24, 0xc7, 0x00,
-  0xfa, 0x27, 0xd9, 0x42, 0x1f, 0x1e, 0xbb, 0x7d, 0xc0, 0x58, 0x77, 0x34,
-  0x9b, 0x13, 0x3f, 0x6f, 0x47, 0x4a, 0xaa, 0x29, 0x38, 0x05, 0x4c, 0x60,
-  0xd3, 0x3f, 0x36, 0x1b, 0x7f, 0x76, 0x8f, 0x55, 0x83, 0x30, 0x0d, 0x0c,
-  0x56, 0x6b, 0x9e, 0x46, 0xdf, 0x25, 0x52, 0x01, 0x58, 0x5c, 0x9c, 0x3b,
-  0x83, 0x16, 0x05, 0x72, 0x79, 0x51, 0xa7, 0x2c, 0xd3, 0x0b, 0xcd, 0x66,
-  0x31, 0x42, 0x2a, 0x21, 0x57, 0x7c, 0xb2, 0x5b, 0x92, 0x36, 0xb2, 0x15,
-  0xc3, 0x70, 0x33, 0x4c, 0x04, 0x2b, 0x69, 0x06, 0x42, 0x65, 0xad, 0x40,
-  0xb2, 0x1f, 0x95, 0x7a, 0x92, 0x59, 0xfb, 0x34, 0xe4, 0x13, 0x86, 0x6e,
-  0x83, 0x4d, 0xc3, 0x28, 0xd8, 0x07, 0xc7, 0x62, 0x93, 0x41, 0xc1, 0x1c,
-  0xd2, 0x7b, 0xdf, 0x56, 0x99, 0x35, 0xa0, 0x10, 0x9d, 0x6f, 0xa2, 0x4a,
-  0xd3, 0x29, 0xc2, 0x04, 0xf7, 0x63, 0x2e, 0x7e, 0xbb, 0x1c, 0x42, 0x67,
-  0x2d, 0x31, 0x9e, 0x72, 0xb4, 0x3b, 0x95, 0x44, 0xa3, 0x61, 0xb8, 0x02,
-  0x5b, 0x2f, 0x27, 0x48, 0x2e, 0x15, 0xce, 0x37, 0x95, 0x50, 0xaa, 0x7d,
-  0x3a, 0x1e, 0x09, 0x3b, 0xc1, 0x45, 0x83, 0x66, 0x5f, 0x03, 0x5f, 0x2c,
-  0xd1, 0x4e, 0x99, 0x6b, 0x1a, 0x34, 0x03, 0x51, 0xc6, 0x73, 0x8e, 0x1c,
-  0x69, 0x39, 0x6f, 0x5a, 0x9f, 0x64, 0x41, 0x01, 0x3e, 0x22, 0xa7, 0x4c,
-  0x45, 0x69, 0x32, 0x0a, 0x9f, 0x54, 0x6f, 0x71, 0x9e, 0x13, 0xa8, 0x3c,
-  0x1b, 0x59, 0xfb, 0x7b, 0x45, 0x04, 0x2e, 0x21, 0xb4, 0x43, 0x08, 0x6c,
-  0xd0, 0x0e, 0x05, 0x2b, 0x90, 0x75, 0xd8, 0x7d, 0x73, 0x19, 0xd6, 0x74,
-  0x52, 0x56, 0xc2, 0x31, 0x17, 0x13, 0xd2, 0x6e, 0x5c, 0x48, 0xd1, 0x2b,
-  0x55, 0x05, 0x8e, 0x60, 0x7a, 0x42, 0xf5, 0x1d, 0x57, 0x7f, 0x8a, 0x5a,
-  0x3c, 0x34, 0xad, 0x17, 0xcc, 0x71, 0x7b, 0x53, 0x97, 0x2e, 0x78, 0x08,
-  0x3d, 0x6a, 0xee, 0x07, 0xa7, 0x0c, 0x3c, 0x29, 0x5f, 0x77, 0xa3, 0x15,
-  0x38, 0x32, 0x42, 0x50, 0x94, 0x7e, 0x2f, 0x1b, 0x3e, 0x39, 0x9a, 0x47,
-  0xc5, 0x65, 0x06, 0x02, 0x4c, 0x20, 0x88, 0x4e, 0xdf, 0x6c, 0x17, 0x09,
-  0x58, 0x57, 0xd3, 0x75, 0xdd, 0x13, 0x11, 0x30, 0x77, 0x5e, 0xbf, 0x7c,
-  0x93, 0x1a, 0xc5, 0x38, 0x39, 0x45, 0x23, 0x63, 0x08, 0x01, 0x3e, 0x46,
-  0x00, 0x56, 0x85, 0x09, 0x68, 0x76, 0x86, 0x3f, 0xdd, 0x5a, 0xb2, 0x3c,
-  0xc4, 0x1e, 0x2c, 0x70, 0x7f, 0x52, 0x1e, 0x34, 0x13, 0x16, 0x6f, 0x68,
-  0x3f, 0x4a, 0x56, 0x2c, 0x4a, 0x0e, 0x50, 0x60, 0x53, 0x42, 0x5f, 0x24,
-  0x4f, 0x06, 0x14, 0x58, 0x1f, 0x3a, 0x12, 0x1c, 0x7b, 0x7e, 0x47, 0x50,
-  0x6d, 0x32, 0x62, 0x14, 0x1a, 0x76, 0x1a, 0x48, 0x2c, 0x2a, 0x62, 0x0c,
-  0xc2, 0x6e, 0xe6, 0x40, 0xd8, 0x22, 0xa9, 0x04, 0x1b, 0x67, 0x69, 0x39,
-  0x10, 0x1b, 0x3f, 0x7d, 0xce, 0x5f, 0xa2, 0x31, 0xb4, 0x13, 0x43, 0x72,
-  0x15, 0x54, 0x2e, 0x36, 0xbf, 0x08, 0x8d, 0x6a, 0x4d, 0x4d, 0x52, 0x2f,
-  0xdc, 0x01, 0x95, 0x63, 0x5f, 0x42, 0x1f, 0x24, 0x80, 0x06, 0xf8, 0x58,
-  0x21, 0x3b, 0x35, 0x5a, 0xd4, 0x3e, 0xb7, 0x10, 0x1c, 0x71, 0x98, 0x53,
-  0xab, 0x35, 0x79, 0x16, 0xd5, 0x68, 0xac, 0x4a, 0x4d, 0x2b, 0xf1, 0x0d,
-  0x46, 0x6e, 0x3d, 0x40, 0x9f, 0x22, 0x20, 0x03, 0xd5, 0x65, 0xb1, 0x47,
-  0x23, 0x18, 0x8c, 0x7a, 0x0c, 0x5b, 0xea, 0x3d, 0x63, 0x1e, 0x90, 0x70,
-  0x4e, 0x51, 0xc9, 0x33, 0x59, 0x14, 0xc0, 0x76, 0x09, 0x57, 0xc7, 0x29,
-  0x44, 0x0a, 0xcc, 0x6c, 0x17, 0x4d, 0x90, 0x2f, 0x2d, 0x00, 0xd1, 0x62,
-  0x1d, 0x43, 0xd8, 0x25, 0x3e, 0x06, 0xb5, 0x58, 0xdc, 0x39, 0x6d, 0x1a,
-  0x9e, 0x7c, 0x68, 0x5d, 0x5d, 0x3e, 0xe7, 0x10, 0x4d, 0x71, 0xa3, 0x53,
-  0xd1, 0x34, 0x75, 0x15, 0xa8, 0x77, 0xca, 0x48, 0x49, 0x29, 0xad, 0x0b,
-  0xfd, 0x6c, 0x51, 0x4d, 0x33, 0x2e, 0xea, 0x00, 0xea, 0x67, 0x23, 0x09,
-  0x54, 0x68, 0x8f, 0x4e, 0x98, 0x2d, 0x1e, 0x0c, 0x47, 0x53, 0xc2, 0x31,
-  0xf7, 0x10, 0x2b, 0x77, 0x0d, 0x56, 0x4f, 0x35, 0xff, 0x1b, 0xf6, 0x7a,
-  0xc4, 0x59, 0x72, 0x38, 0x19, 0x1f, 0x73, 0x7e, 0x55, 0x5d, 0xbe, 0x23,
-  0xdf, 0x02, 0xe1, 0x61, 0xc4, 0x40, 0x2f, 0x27, 0x3a, 0x06, 0x1e, 0x65,
-  0x13, 0x44, 0x63, 0x2b, 0x71, 0x0a, 0x45, 0x69, 0x0b, 0x48, 0x46, 0x2f,
-  0x50, 0x0e, 0x1a, 0x6d, 0x4b, 0x4c, 0x4f, 0x13, 0x4b, 0x72, 0x12, 0x51,
-  0x5f, 0x30, 0x4a, 0x17, 0x7a, 0x76, 0x2a, 0x55, 0x14, 0x34, 0x03, 0x1b,
-  0x33, 0x7a, 0x62, 0x59, 0xc2, 0x38, 0xfc, 0x1f, 0x8b, 0x7e, 0xb5, 0x5d,
-  0x1b, 0x3d, 0x7c, 0x1c, 0x16, 0x63, 0x20, 0x42, 0xd8, 0x21, 0xf6, 0x00,
-  0xf1, 0x67, 0x20, 0x47, 0x71, 0x26, 0x3c, 0x48, 0x5e, 0x01, 0x15, 0x2e,
-  0xc6, 0x4e, 0xca, 0x6f, 0x4b, 0x0c, 0x0b, 0x2d, 0xc4, 0x4d, 0x8a, 0x6a,
-  0x53, 0x0b, 0x4a, 0x28, 0xca, 0x48, 0x95, 0x69, 0x72, 0x36, 0x20, 0x57,
-  0xc3, 0x77, 0x5e, 0x14, 0x26, 0x35, 0xf4, 0x55, 0x47, 0x72, 0x2f, 0x13,
-  0x95, 0x33, 0x6c, 0x50, 0x8d, 0x70, 0xc8, 0x11, 0x6d, 0x3e, 0x64, 0x76,
-  0x79, 0x76, 0x26, 0x15, 0xa1, 0x35, 0x41, 0x54, 0x94, 0x74, 0x6e, 0x13,
-  0xe1, 0x33, 0x5a, 0x52, 0xc5, 0x72, 0x19, 0x11, 0xcd, 0x31, 0x5e, 0x50,
-  0xc5, 0x70, 0x43, 0x0f, 0x94, 0x2f, 0x55, 0x4e, 0xc1, 0x6e, 0x47, 0x0d,
-  0xe0, 0x2d, 0x64, 0x4c, 0x82, 0x6c, 0x0f, 0x0b, 0xfa, 0x2b, 0x43, 0x4a,
-  0x2a, 0x6a, 0x57, 0x2b, 0x37, 0x7a, 0xa4, 0x1a, 0xdf, 0x3a, 0x2c, 0x5b,
-  0x9c, 0x7b, 0x26, 0x14, 0x1a, 0x34, 0xfd, 0x54, 0x21, 0x75, 0x4f, 0x15,
-  0xca, 0x35, 0x28, 0x56, 0x7b, 0x76, 0x81, 0x16, 0xdf, 0x36, 0x43, 0x57,
-  0x59, 0x77, 0x83, 0x17, 0xcb, 0x37, 0x1f, 0x50, 0x0e, 0x70, 0x97, 0x10,
-  0xd5, 0x30, 0x53, 0x51, 0x6a, 0x71, 0xb4, 0x11, 0xca, 0x31, 0xcc, 0x51,
-  0x27, 0x72, 0x67, 0x12, 0x52, 0x32, 0xe3, 0x52, 0x9a, 0x72, 0xe3, 0x12,
-  0xcf, 0x32, 0x6b, 0x53, 0x0d, 0x73, 0x6c, 0x13, 0x53, 0x33, 0xbd, 0x53,
-  0xe0, 0x73, 0xf1, 0x13, 0x1a, 0x41, 0xdd, 0x34, 0xfe, 0x14, 0xd9, 0x74,
-  0x85, 0x54, 0xcc, 0x34, 0xdd, 0x14, 0xd5, 0x74, 0xd6, 0x54, 0xd1, 0x34,
-  0x91, 0x14, 0xc8, 0x74, 0xcd, 0x54, 0xc9, 0x34, 0xb1, 0x14, 0x7b, 0x61,
-  0x52, 0x33, 0x0a, 0x53, 0x38, 0x73, 0x3f, 0x13, 0xcd, 0x33, 0xbb, 0x53,
-  0x82, 0x73, 0xbb, 0x13, 0x57, 0x32, 0x33, 0x52, 0x1a, 0x72, 0x3e, 0x12,
-  0xc4, 0x32, 0xff, 0x52, 0xbb, 0x72, 0x4c, 0x11, 0x01, 0x31, 0x37, 0x51,
-  0xb6, 0x71, 0x84, 0x11, 0x52, 0x30, 0x1e, 0x50, 0xd8, 0x70, 0xd3, 0x10,
-  0x41, 0x37, 0x1f, 0x57, 0xd9, 0x77, 0x8f, 0x17, 0x0c, 0x36, 0x61, 0x56,
-  0xb2, 0x04, 0x0c, 0x20, 0x8f, 0x03, 0x0d, 0x63, 0x21, 0x43, 0xea, 0x22,
-  0x59, 0x02, 0x75, 0x62, 0x88, 0x4d, 0x71, 0x2d, 0xdd, 0x0c, 0xbe, 0x6c,
-  0x1d, 0x4c, 0xb5, 0x2f, 0x58, 0x0f, 0x2d, 0x6f, 0xbd, 0x4e, 0x4d, 0x2e,
-  0x90, 0x09, 0x6c, 0x69, 0xeb, 0x48, 0x51, 0x28, 0x8c, 0x0b, 0x56, 0x6b,
-  0xd7, 0x4a, 0x54, 0x2a, 0xd2, 0x15, 0x11, 0x75, 0x98, 0x54, 0x41, 0x34,
-  0xc4, 0x17, 0x40, 0x77, 0xe1, 0x56, 0x2d, 0x36, 0x9d, 0x11, 0x1f, 0x71,
-  0xbd, 0x50, 0x65, 0x30, 0x4d, 0x13, 0xf9, 0x72, 0x14, 0x52, 0xfd, 0x3d,
-  0xce, 0x1c, 0x78, 0x7c, 0x94, 0x5f, 0x30, 0x3f, 0x4d, 0x1e, 0xf6, 0x79,
-  0x3d, 0x59, 0x49, 0x38, 0xdc, 0x1b, 0x22, 0x7b, 0x76, 0x5a, 0x91, 0x45,
-  0xc3, 0x24, 0x55, 0x04, 0x4c, 0x67, 0x95, 0x46, 0xd9, 0x21, 0x5d, 0x01,
-  0x5e, 0x60, 0x99, 0x43, 0xc3, 0x22, 0x0a, 0x02, 0x6a, 0x6d, 0xe3, 0x4c,
-  0xf6, 0x2f, 0x07, 0x4a, 0x98, 0x39, 0xf7, 0x1e, 0x8d, 0x7f, 0x2d, 0x5c,
-  0x16, 0x3d, 0x69, 0x02, 0x1d, 0x63, 0xac, 0x43, 0x95, 0x20, 0xf5, 0x01,
-  0xce, 0x66, 0x21, 0x47, 0x79, 0x24, 0x18, 0x05, 0x15, 0x6a, 0x69, 0x4b,
-  0x39, 0x28, 0x48, 0x09, 0x4c, 0x6e, 0x47, 0x4f, 0x4d, 0x2c, 0x1c, 0x0d,
-  0x5e, 0x12, 0x53, 0x73, 0x50, 0x50, 0x5a, 0x31, 0x01, 0x16, 0x04, 0x77,
-  0x60, 0x54, 0x63, 0x35, 0x08, 0x1a, 0x4c, 0x7b, 0x31, 0x58, 0x21, 0x39,
-  0xcc, 0x1e, 0xe6, 0x7f, 0xd9, 0x5c, 0xbd, 0x3d, 0x1d, 0x03, 0x7f, 0x60,
-  0x15, 0x41, 0x3d, 0x26, 0xce, 0x07, 0xef, 0x64, 0xf9, 0x45, 0x4a, 0x2b,
-  0x0f, 0x08, 0x23, 0x69, 0xf4, 0x4e, 0xc4, 0x2f, 0x59, 0x0d, 0x1c, 0x12,
-  0xdc, 0x73, 0xdc, 0x50, 0x53, 0x36, 0x13, 0x17, 0xcb, 0x74, 0x80, 0x55,
-  0x45, 0x3b, 0x44, 0x18, 0xfd, 0x79, 0xa3, 0x5e, 0x12, 0x3c, 0xde, 0x1d,
-  0xf7, 0x62, 0x0e, 0x40, 0x6d, 0x32, 0x08, 0x11, 0xc4, 0x73, 0x72, 0x52,
-  0xd4, 0x3c, 0xb3, 0x1f, 0x05, 0x7e, 0xe7, 0x58, 0x57, 0x3b, 0x3c, 0x1a,
-  0xe8, 0x04, 0x51, 0x67, 0x85, 0x41, 0x7d, 0x20, 0xe1, 0x02, 0x5a, 0x6d,
-  0xc4, 0x4f, 0x5b, 0x2e, 0xcb, 0x08, 0x4f, 0x6b, 0xc9, 0x55, 0x42, 0x34,
-  0x84, 0x16, 0x5f, 0x71, 0xdf, 0x53, 0x50, 0x32, 0xe7, 0x1c, 0x74, 0x7f,
-  0xc0, 0x59, 0x18, 0x38, 0xb7, 0x1a, 0x79, 0x05, 0x40, 0x67, 0xfb, 0x41,
-  0x0b, 0x20, 0xab, 0x02, 0xc5, 0x6c, 0x62, 0x4f, 0x90, 0x29, 0x2c, 0x08,
-  0x54, 0x6a, 0xb9, 0x54, 0x2d, 0x37, 0x5f, 0x11, 0x94, 0x73, 0x3e, 0x52,
-  0x24, 0x3c, 0x80, 0x1e, 0xdf, 0x78, 0x1c, 0x5b, 0x56, 0x45, 0xc1, 0x27,
-  0xcd, 0x01, 0x08, 0x60, 0x4a, 0x42, 0x8d, 0x2c, 0x8a, 0x0e, 0x73, 0x69,
-  0x0e, 0x4b, 0xf1, 0x35, 0xc0, 0x17, 0x93, 0x71, 0x11, 0x50, 0x77, 0x32,
-  0x45, 0x1c, 0xba, 0x7e, 0x91, 0x58, 0xe0, 0x3a, 0xcc, 0x24, 0x61, 0x07,
-  0x17, 0x61, 0x6c, 0x43, 0x44, 0x2d, 0xad, 0x0f, 0xad, 0x69, 0x9f, 0x4b,
-  0x87, 0x35, 0xb1, 0x17, 0xe0, 0x71, 0xdc, 0x53, 0xc4, 0x3d, 0xcc, 0x1f,
-  0xc7, 0x79, 0xd5, 0x5b, 0xc5, 0x45, 0xc5, 0x27, 0x85, 0x01, 0x89, 0x63,
-  0x90, 0x4d, 0xea, 0x2f, 0xf0, 0x09, 0xf0, 0x6b, 0x92, 0x55, 0x85, 0x37,
-  0xad, 0x11, 0xb7, 0x73, 0x57, 0x5d, 0x29, 0x3f, 0x07, 0x19, 0x2e, 0x7b,
-  0xce, 0x64, 0xe7, 0x46, 0x8d, 0x20, 0xbb, 0x02, 0x5d, 0x6c, 0x78, 0x4e,
-  0x30, 0x28, 0xd8, 0x15, 0x8f, 0x77, 0xbf, 0x51, 0x24, 0x33, 0x09, 0x1d,
-  0xc2, 0x7e, 0x86, 0x58, 0x47, 0x3a, 0x04, 0x24, 0xd3, 0x01, 0x92, 0x63,
-  0x05, 0x4d, 0x49, 0x2f, 0x90, 0x08, 0xbc, 0x6a, 0x77, 0x54, 0x25, 0x36,
-  0x89, 0x13, 0x5c, 0x7d, 0x25, 0x5f, 0xed, 0x38, 0x55, 0x1a, 0x2d, 0x04,
-  0xc4, 0x61, 0x75, 0x43, 0xc9, 0x2c, 0xac, 0x0e, 0x01, 0x68, 0xa9, 0x55,
-  0x44, 0x37, 0x36, 0x11, 0xe4, 0x72, 0x12, 0x5c, 0x8f, 0x39, 0x7c, 0x1b,
-  0xf4, 0x04, 0x55, 0x66, 0xd5, 0x43, 0x5d, 0x2d, 0xcd, 0x0e, 0x4e, 0x68,
-  0xce, 0x55, 0x1b, 0x37, 0x84, 0x10, 0x18, 0x72, 0x90, 0x5f, 0x5b, 0x39,
-  0xed, 0x1a, 0x7d, 0x04, 0x8c, 0x61, 0x18, 0x43, 0xab, 0x2c, 0x37, 0x0e,
-  0x10, 0x6b, 0xf0, 0x54, 0x01, 0x36, 0xa0, 0x13, 0xd2, 0x7c, 0x72, 0x5e,
-  0xca, 0x3b, 0x6b, 0x25, 0x3a, 0x06, 0x93, 0x63, 0x52, 0x49, 0x6e, 0x04,
-  0x89, 0x21, 0x22, 0x5f, 0x22, 0x7c, 0x88, 0x19, 0xd7, 0x36, 0x04, 0x54,
-  0x47, 0x71, 0xc7, 0x6e, 0xd3, 0x0b, 0x17, 0x29, 0x02, 0x46, 0x80, 0x63,
-  0xd8, 0x00, 0x5f, 0x3e, 0x63, 0x5b, 0xf7, 0x78, 0x95, 0x15, 0xd6, 0x32,
-  0x2c, 0x50, 0x7b, 0x4d, 0x4f, 0x6a, 0xef, 0x07, 0x80, 0x24, 0xe2, 0x41,
-  0xc7, 0x7e, 0x24, 0x1c, 0x0a, 0x39, 0x2f, 0x56, 0x41, 0x73, 0xb6, 0x10,
-  0xb6, 0x0d, 0x9f, 0x2a, 0xc6, 0x47, 0xf6, 0x64, 0xa2, 0x01, 0xcc, 0x3e,
-  0xda, 0x5b, 0xc6, 0x78, 0xc5, 0x15, 0xcf, 0x32, 0xd2, 0x2f, 0x87, 0x4c,
-  0xca, 0x69, 0xca, 0x06, 0xd7, 0x23, 0xdb, 0x40, 0xe3, 0x7d, 0xf4, 0x1a,
-  0x8e, 0x37, 0x92, 0x54, 0xec, 0x71, 0xff, 0x6e, 0x16, 0x0b, 0x5b, 0x28,
-  0x0a, 0x45, 0x22, 0x62, 0x86, 0x1e, 0xeb, 0x3b, 0x83, 0x58, 0xbc, 0x75,
-  0x42, 0x12, 0x3f, 0x0f, 0x36, 0x2c, 0xdf, 0x48, 0x8f, 0x65, 0xb9, 0x02,
-  0x65, 0x3f, 0x5f, 0x5c, 0xcf, 0x78, 0x80, 0x15, 0x57, 0x32, 0x47, 0x2f,
-  0xd4, 0x4b, 0x82, 0x68, 0x4f, 0x05, 0x0a, 0x22, 0xdb, 0x5e, 0x9d, 0x7b,
-  0x67, 0x18, 0x25, 0x35, 0xc6, 0x51, 0x5e, 0x4e, 0x31, 0x6b, 0xbf, 0x07,
-  0x57, 0x24, 0x2c, 0x41, 0x96, 0x7d, 0x6e, 0x1a, 0xd0, 0x36, 0xa6, 0x53,
-  0x16, 0x70, 0xe6, 0x6c, 0x58, 0x09, 0x38, 0x26, 0xe2, 0x42, 0x03, 0x7f,
-  0x8e, 0x1b, 0x76, 0x38, 0xf6, 0x54, 0x1f, 0x71, 0xc2, 0x6d, 0x4a, 0x0a,
-  0xce, 0x26, 0x42, 0x43, 0xd6, 0x7f, 0x48, 0x1c, 0xd0, 0x38, 0x5b, 0x55,
-  0xd3, 0x71, 0x4d, 0x6e, 0xac, 0x0a, 0x39, 0x27, 0xc8, 0x43, 0x57, 0x60,
-  0xa0, 0x1c, 0x2a, 0x39, 0x42, 0x55, 0xaf, 0x71, 0x0c, 0x6e, 0xa8, 0x0a,
-  0xd1, 0x26, 0x27, 0x43, 0x9b, 0x7f, 0x20, 0x1c, 0x43, 0x38, 0xbf, 0x54,
-  0x21, 0x71, 0x56, 0x6d, 0x88, 0x09, 0x70, 0x26, 0x76, 0x42, 0xdf, 0x7e,
-  0xd0, 0x1a, 0x06, 0x37, 0x4c, 0x53, 0x83, 0x4f, 0x86, 0x6b, 0x0e, 0x08,
-  0x56, 0x24, 0xcf, 0x40, 0xd7, 0x7c, 0x11, 0x19, 0x7b, 0x35, 0xa0, 0x51,
-  0x8e, 0x4d, 0xd2, 0x69, 0x30, 0x06, 0x7a, 0x22, 0x16, 0x5e, 0xa6, 0x7a,
-  0x8c, 0x16, 0xa7, 0x32, 0xdf, 0x2e, 0x28, 0x4b, 0x17, 0x67, 0x7d, 0x03,
-  0x16, 0x3f, 0xaf, 0x5b, 0xa3, 0x77, 0x94, 0x13, 0x8d, 0x0f, 0xb9, 0x2b,
-  0xa2, 0x47, 0x9f, 0x63, 0xe5, 0x1f, 0xc0, 0x3b, 0xcf, 0x57, 0xc2, 0x73,
-  0xc9, 0x6f, 0xc9, 0x0b, 0xc7, 0x27, 0x8f, 0x43, 0xc5, 0x7f, 0xda, 0x1b,
-  0xe7, 0x37, 0xfa, 0x53, 0x95, 0x4f, 0xd7, 0x6b, 0xb6, 0x07, 0xb0, 0x23,
-  0x16, 0x5f, 0x67, 0x7b, 0x03, 0x17, 0x31, 0x33, 0xc3, 0x2e, 0xa7, 0x4a,
-  0x86, 0x66, 0xbd, 0x02, 0x57, 0x3e, 0x68, 0x5a, 0x2c, 0x76, 0x97, 0x11,
-  0x87, 0x0d, 0xf7, 0x29, 0x6f, 0x45, 0x1a, 0x61, 0xc5, 0x1c, 0x9c, 0x38,
-  0x43, 0x54, 0x00, 0x70, 0xc3, 0x6b, 0xc7, 0x07, 0x4b, 0x23, 0x01, 0x5f,
-  0x96, 0x7a, 0x8b, 0x16, 0x6a, 0x32, 0x32, 0x2e, 0xc6, 0x49, 0x44, 0x65,
-  0x23, 0x01, 0xf1, 0x3c, 0x52, 0x58, 0x6f, 0x74, 0x8a, 0x6f, 0x62, 0x0b,
-  0xd4, 0x26, 0xa2, 0x42, 0x58, 0x7e, 0x85, 0x19, 0x3c, 0x35, 0x7f, 0x51,
-  0xe2, 0x4c, 0x57, 0x68, 0xc6, 0x03, 0xe6, 0x11, 0x77, 0x6e, 0x94, 0x0f,
-  0x93, 0x4a, 0x47, 0x23, 0x2f, 0x64, 0xaa, 0x08, 0x68, 0x33, 0xd4, 0x57,
-  0x05, 0x7a, 0xca, 0x1e, 0x54, 0x01, 0xdf, 0x25, 0x6c, 0x48, 0xfe, 0x6c,
-  0x12, 0x17, 0xd0, 0x3b, 0x31, 0x5e, 0xb7, 0x42, 0x91, 0x65, 0x7a, 0x08,
-  0x84, 0x2c, 0x29, 0x57, 0x4f, 0x7a, 0xae, 0x1e, 0x45, 0x01, 0xe8, 0x25,
-  0xe5, 0x48, 0x70, 0x73, 0xa0, 0x17, 0x90, 0x3a, 0x0c, 0x5d, 0xb5, 0x41,
-  0xf6, 0x64, 0x0b, 0x0f, 0x50, 0x32, 0x8f, 0x56, 0xc0, 0x79, 0x40, 0x1c,
-  0x56, 0x07, 0x81, 0x2b, 0xd6, 0x4e, 0x00, 0x71, 0x54, 0x14, 0x8b, 0x38,
-  0xa5, 0x23, 0x31, 0x46, 0x16, 0x69, 0x51, 0x0c, 0xbc, 0x30, 0xb6, 0x5b,
-  0x91, 0x7e, 0x68, 0x61, 0x3c, 0x04, 0x6f, 0x2f, 0x54, 0x52, 0xe0, 0x76,
-  0x91, 0x19, 0xe9, 0x3c, 0xda, 0x27, 0x3d, 0x4a, 0x65, 0x6d, 0x11, 0x10,
-  0x41, 0x3b, 0x74, 0x5e, 0x60, 0x41, 0x5d, 0x64, 0x41, 0x0f, 0x08, 0x32,
-  0x47, 0x55, 0x52, 0x78, 0x44, 0x63, 0x41, 0x06, 0x51, 0x29, 0x40, 0x4c,
-  0x11, 0x77, 0x59, 0x1a, 0x6b, 0x3d, 0x74, 0x20, 0x41, 0x4b, 0x16, 0x6e,
-  0x20, 0x11, 0x3d, 0x34, 0xdd, 0x5f, 0xa8, 0x42, 0x83, 0x65, 0xa9, 0x08,
-  0x53, 0x32, 0x6d, 0x55, 0x09, 0x78, 0x31, 0x63, 0x91, 0x06, 0xff, 0x29,
-  0xb7, 0x4c, 0x5f, 0x76, 0x14, 0x19, 0x3e, 0x3c, 0xe1, 0x27, 0x9d, 0x4a,
-  0x55, 0x6c, 0x48, 0x17, 0xcc, 0x3a, 0x8e, 0x5d, 0x01, 0x47, 0x12, 0x6a,
-  0xc0, 0x0d, 0x89, 0x30, 0x5d, 0x5a, 0x11, 0x7d, 0xf1, 0x60, 0xa9, 0x0b,
-  0x41, 0x2d, 0xd1, 0x50, 0xb6, 0x7b, 0x38, 0x1d, 0xc5, 0x00, 0xa0, 0x2b,
-  0x00, 0x4d, 0xa0, 0x70, 0x44, 0x1a, 0x26, 0x3d, 0x83, 0x20, 0x6d, 0x4a,
-  0xd2, 0x6d, 0xac, 0x10, 0x36, 0x3a, 0xd0, 0x5d, 0x0e, 0x47, 0xf6, 0x6a,
-  0x25, 0x0c, 0xcc, 0x37, 0x59, 0x59, 0xcd, 0x7c, 0x05, 0x66, 0xd4, 0x09,
-  0x44, 0x33, 0xcc, 0x56, 0x40, 0x78, 0xd8, 0x63, 0x5e, 0x05, 0xca, 0x28,
-  0x71, 0x52, 0xf1, 0x75, 0x15, 0x1f, 0x99, 0x02, 0x2a, 0x24, 0xb6, 0x4f,
-  0x91, 0x71, 0x7f, 0x1b, 0x80, 0x3e, 0x21, 0x20, 0x53, 0x4a, 0xa0, 0x6d,
-  0x0a, 0x17, 0xae, 0x3a, 0xd7, 0x5c, 0x36, 0x46, 0xcf, 0x69, 0xba, 0x13,
-  0x84, 0x57, 0x84, 0x16, 0xb0, 0x0c, 0x1e, 0x2a, 0x50, 0x40, 0x8f, 0x7f,
-  0xd1, 0x15, 0x1b, 0x33, 0x53, 0x29, 0x90, 0x44, 0x9c, 0x62, 0x5d, 0x18,
-  0x41, 0x36, 0x81, 0x2d, 0xf5, 0x4b, 0x26, 0x61, 0x00, 0x1f, 0x57, 0x35,
-  0xbf, 0x50, 0xe3, 0x4e, 0xcd, 0x64, 0x3e, 0x02, 0x50, 0x38, 0x63, 0x56,
-  0x5b, 0x4c, 0xbc, 0x6b, 0x93, 0x01, 0xf8, 0x3f, 0x84, 0x55, 0x24, 0x73,
-  0x23, 0x69, 0x45, 0x07, 0x04, 0x3d, 0x77, 0x5b, 0x7f, 0x71, 0x47, 0x6f,
-  0x41, 0x05, 0x5e, 0x23, 0x44, 0x59, 0x50, 0x77, 0x50, 0x6d, 0x15, 0x0b,
-  0x59, 0x21, 0x53, 0x5f, 0x50, 0x75, 0x42, 0x13, 0x30, 0x09, 0x7c, 0x27,
-  0x1b, 0x5d, 0x10, 0x7b, 0x22, 0x11, 0x6d, 0x0f, 0xc9, 0x25, 0xf4, 0x43,
-  0x9e, 0x79, 0xb1, 0x17, 0x0e, 0x0c, 0x1f, 0x2a, 0x7a, 0x40, 0x7d, 0x7e,
-  0x84, 0x14, 0xaf, 0x32, 0x9d, 0x28, 0x4c, 0x41, 0x07, 0x7f, 0x26, 0x15,
-  0xf1, 0x33, 0x81, 0x29, 0x4d, 0x46, 0x1f, 0x7c, 0xc2, 0x1a, 0x94, 0x30,
-  0x40, 0x29, 0x1c, 0x47, 0xdf, 0x7d, 0x93, 0x1b, 0x04, 0x30, 0x09, 0x2e,
-  0xf5, 0x44, 0xb1, 0x62, 0x11, 0x1b, 0xc6, 0x31, 0xa4, 0x2f, 0x68, 0x44,
-  0xc0, 0x62, 0xfc, 0x18, 0x50, 0x31, 0xb5, 0x2f, 0x75, 0x44, 0x37, 0x62,
-  0x9f, 0x18, 0x6f, 0x31, 0xd0, 0x2f, 0xa4, 0x45, 0x3e, 0x62, 0x82, 0x18,
-  0x54, 0x31, 0xf1, 0x2f, 0x75, 0x44, 0xc1, 0x62, 0x41, 0x1b, 0xcd, 0x31,
-  0x5f, 0x2e, 0xc7, 0x44, 0x40, 0x7d, 0xd4, 0x1b, 0x44, 0x30, 0xd4, 0x2e,
-  0x4b, 0x47, 0xc3, 0x7d, 0x31, 0x1a, 0xa7, 0x30, 0x7e, 0x29, 0xef, 0x47,
-  0x1e, 0x7c, 0xa2, 0x1a, 0xd0, 0x33, 0x75, 0x28, 0x99, 0x46, 0x3b, 0x7f,
-  0x53, 0x14, 0xb5, 0x32, 0x15, 0x2b, 0xb1, 0x41, 0xd7, 0x7e, 0x68, 0x17,
-  0xf0, 0x0d, 0xd6, 0x2a, 0x11, 0x43, 0xa0, 0x79, 0xfd, 0x16, 0x1e, 0x0f,
-  0x04, 0x24, 0x89, 0x42, 0xdf, 0x7b, 0x55, 0x10, 0x5c, 0x09, 0x94, 0x27,
-  0xc0, 0x5c, 0x0d, 0x75, 0x41, 0x12, 0x83, 0x08, 0xbe, 0x21, 0x4f, 0x5e,
-  0x7e, 0x77, 0x30, 0x40, 0x07, 0x74, 0x6c, 0x5d, 0x5f, 0x26, 0xf3, 0x0f,
-  0x9f, 0x10, 0xf8, 0x79, 0xce, 0x42, 0x32, 0x24, 0x08, 0x0d, 0x72, 0x16,
-  0x5e, 0x7f, 0xa6, 0x40, 0xfe, 0x29, 0x9f, 0x32, 0x92, 0x1b, 0xee, 0x7c,
-  0xbe, 0x45, 0xd7, 0x2e, 0xcf, 0x37, 0xdf, 0x18, 0xdb, 0x61, 0xcb, 0x4a,
-  0xd5, 0x53, 0xc9, 0x34, 0xca, 0x1d, 0xd6, 0x66, 0xd8, 0x4f, 0x82, 0x50,
-  0xbe, 0x39, 0xab, 0x02, 0xbb, 0x6b, 0x98, 0x4c, 0xfe, 0x55, 0xba, 0x3e,
-  0x45, 0x07, 0x66, 0x68, 0x5e, 0x71, 0x28, 0x5a, 0xca, 0x22, 0xf2, 0x0b,
-  0x8c, 0x6c, 0xb2, 0x75, 0x46, 0x5e, 0x23, 0x27, 0x2a, 0x08, 0xc3, 0x10,
-  0x88, 0x79, 0xa4, 0x42, 0x6b, 0x2b, 0x04, 0x0c, 0xc2, 0x14, 0xd3, 0x7d,
-  0x4a, 0x46, 0x12, 0x2f, 0xd7, 0x37, 0x9e, 0x18, 0x1e, 0x61, 0x12, 0x4a,
-  0xc4, 0x52, 0x87, 0x3b, 0x3e, 0x1c, 0x38, 0x65, 0x8a, 0x4d, 0x4a, 0x56,
-  0x3d, 0x3f, 0xe6, 0x07, 0x06, 0x68, 0x73, 0x71, 0x87, 0x59, 0x74, 0x22,
-  0xcf, 0x0a, 0xfb, 0x13, 0x0a, 0x74, 0xfb, 0x5c, 0x43, 0x25, 0x2d, 0x0e,
-  0xb5, 0x16, 0x4b, 0x7f, 0x83, 0x47, 0x64, 0x28, 0xeb, 0x30, 0x03, 0x19,
-  0xd9, 0x61, 0x56, 0x4a, 0xdb, 0x52, 0x1b, 0x3b, 0xdb, 0x03, 0x1b, 0x64,
-  0xce, 0x4c, 0x52, 0x55, 0xde, 0x3d, 0x57, 0x06, 0xfb, 0x6e, 0x79, 0x77,
-  0x94, 0x5f, 0x4b, 0x20, 0xb7, 0x08, 0x2d, 0x11, 0x0a, 0x79, 0xe7, 0x41,
-  0x16, 0x2a, 0xbe, 0x32, 0x9a, 0x1a, 0x68, 0x63, 0x8a, 0x4b, 0x32, 0x2c,
-  0x58, 0x34, 0xf0, 0x1c, 0x70, 0x65, 0x05, 0x4d, 0xd4, 0x55, 0x41, 0x3e,
-  0x14, 0x06, 0xc3, 0x6e, 0x8a, 0x76, 0x53, 0x5f, 0x1e, 0x27, 0x16, 0x5d,
-  0x3e, 0x09, 0x60, 0x4f, 0x97, 0x0a, 0x44, 0x7a, 0x31, 0x69, 0xf8, 0x40,
-  0xce, 0x38, 0x3c, 0x10, 0x1f, 0x08, 0x5f, 0x60, 0xbd, 0x5b, 0xb2, 0x33,
-  0xda, 0x2b, 0x62, 0x03, 0x09, 0x7b, 0x6f, 0x53, 0x5c, 0x4b, 0xea, 0x22,
-  0x82, 0x1a, 0xed, 0x72, 0xd6, 0x6a, 0x37, 0x42, 0x21, 0x3a, 0x0e, 0x12,
-  0x18, 0x0a, 0x36, 0x62, 0x2f, 0x5a, 0x4b, 0x32, 0x54, 0x2a, 0x57, 0x02,
-  0x0f, 0x7a, 0x4c, 0x52, 0x42, 0x4a, 0x44, 0x22, 0x4b, 0x1a, 0x02, 0x72,
-  0x42, 0x6a, 0x5d, 0x42, 0x7a, 0x3a, 0x68, 0x12, 0x18, 0x0a, 0x1f, 0x62,
-  0x23, 0x5a, 0x34, 0x32, 0x9b, 0x2a, 0xe0, 0x02, 0x8e, 0x7a, 0xa9, 0x52,
-  0x40, 0x4b, 0x2a, 0x23, 0x00, 0x1b, 0x2c, 0x73, 0x9b, 0x6b, 0xe1, 0x43,
-  0xa0, 0x3b, 0x56, 0x10, 0x02, 0x08, 0x3e, 0x60, 0xaf, 0x58, 0x95, 0x30,
-  0x49, 0x29, 0x0d, 0x01, 0xda, 0x79, 0x84, 0x51, 0x4f, 0x4e, 0x4a, 0x26,
-  0xce, 0x1e, 0x8c, 0x76, 0x5f, 0x6f, 0x52, 0x47, 0xee, 0x3f, 0xfa, 0x17,
-  0x07, 0x0c, 0xd3, 0x64, 0xbb, 0x5c, 0x66, 0x35, 0xd7, 0x2d, 0xa7, 0x05,
-  0x4f, 0x72, 0xee, 0x6a, 0x42, 0x43, 0x39, 0x3b, 0x80, 0x13, 0x70, 0x08,
-  0xd2, 0x60, 0xb7, 0x58, 0x21, 0x31, 0x8e, 0x29, 0x0e, 0x06, 0xfe, 0x7e,
-  0x21, 0x57, 0xb8, 0x4f, 0x31, 0x24, 0x65, 0x17, 0x7f, 0x1a, 0xcc, 0x02,
-  0x57, 0x35, 0x83, 0x5d, 0x41, 0x44, 0xca, 0x6c, 0x48, 0x17, 0xde, 0x3f,
-  0x26, 0x26, 0xfa, 0x4e, 0x0c, 0x71, 0x87, 0x19, 0x29, 0x00, 0xfb, 0x28,
-  0xc6, 0x53, 0x63, 0x7a, 0x83, 0x62, 0x63, 0x15, 0x4f, 0x3c, 0xea, 0x24,
-  0x14, 0x4f, 0xb9, 0x77, 0xdd, 0x1e, 0x69, 0x01, 0xea, 0x29, 0x93, 0x50,
-  0x03, 0x7b, 0xbd, 0x63, 0xe2, 0x0a, 0x5b, 0x3d, 0x4b, 0x24, 0x84, 0x4c,
-  0xd3, 0x77, 0x43, 0x1e, 0x51, 0x01, 0x86, 0x29, 0xc3, 0x50, 0x4b, 0x7b,
-  0x4b, 0x62, 0x94, 0x0a, 0xf3, 0x3d, 0x21, 0x24, 0x11, 0x4f, 0x56, 0x76,
-  0xaa, 0x1e, 0xfd, 0x01, 0x92, 0x28, 0x2c, 0x53, 0x07, 0x7a, 0x79, 0x6d,
-  0x4b, 0x14, 0xad, 0x3c, 0x81, 0x27, 0xab, 0x4e, 0xd0, 0x71, 0x3a, 0x18,
-  0x25, 0x03, 0x18, 0x2a, 0x4c, 0x5d, 0x33, 0x44, 0x26, 0x6f, 0x79, 0x16,
-  0x47, 0x39, 0x5f, 0x20, 0x06, 0x4b, 0x54, 0x72, 0x43, 0x65, 0x4a, 0x0c,
-  0x52, 0x37, 0x0a, 0x5e, 0x12, 0x41, 0x1b, 0x68, 0x4f, 0x13, 0x67, 0x3a,
-  0x42, 0x2d, 0x1f, 0x54, 0x29, 0x7f, 0x34, 0x66, 0xd9, 0x09, 0xf8, 0x30,
-  0xc6, 0x5b, 0xaf, 0x42, 0x4b, 0x74, 0x68, 0x1f, 0x03, 0x06, 0x6b, 0x29,
-  0xc1, 0x50, 0xf4, 0x7b, 0xab, 0x62, 0x56, 0x14, 0x0d, 0x3f, 0x3d, 0x26,
-  0xe3, 0x49, 0xdb, 0x70, 0x45, 0x1a, 0x19, 0x0d, 0xc9, 0x34, 0x97, 0x5f,
-  0x47, 0x41, 0x43, 0x68, 0xc9, 0x13, 0x85, 0x3a, 0x12, 0x2c, 0x02, 0x57,
-  0xe9, 0x7e, 0xa6, 0x61, 0x10, 0x0b, 0x93, 0x32, 0xa0, 0x25, 0x7a, 0x4f,
-  0xd1, 0x76, 0xae, 0x19, 0x46, 0x03, 0xf4, 0x2a, 0x4a, 0x5c, 0x2a, 0x47,
-  0x8a, 0x6e, 0x6e, 0x10, 0x92, 0x3b, 0xa2, 0x22, 0x29, 0x54, 0x86, 0x7f,
-  0x42, 0x61, 0xe4, 0x08, 0x63, 0x32, 0xc9, 0x25, 0x57, 0x4f, 0x8b, 0x76,
-  0x53, 0x18, 0xcd, 0x03, 0x41, 0x35, 0xcc, 0x5c, 0x48, 0x46, 0xd8, 0x69,
-  0x51, 0x13, 0xd2, 0x3a, 0x69, 0x2c, 0xe6, 0x57, 0x11, 0x79, 0xd3, 0x60,
-  0x29, 0x0a, 0xb5, 0x3d, 0x92, 0x27, 0x7f, 0x49, 0x8e, 0x70, 0x26, 0x1a,
-  0x02, 0x0c, 0xe1, 0x37, 0x03, 0x59, 0xaa, 0x40, 0xd1, 0x6a, 0x73, 0x1c,
-  0xe7, 0x07, 0x93, 0x29, 0x42, 0x53, 0x87, 0x7a, 0xee, 0x6c, 0x09, 0x16,
-  0x5d, 0x38, 0x9e, 0x23, 0xc1, 0x55, 0x0b, 0x7f, 0x02, 0x61, 0x97, 0x08,
-  0xce, 0x32, 0x0e, 0x24, 0x12, 0x4e, 0x96, 0x71, 0xef, 0x1b, 0x21, 0x0d,
-  0x10, 0x37, 0x5c, 0x59, 0xb4, 0x40, 0xb7, 0x6a, 0x92, 0x1c, 0x32, 0x06,
-  0x09, 0x28, 0x76, 0x52, 0x02, 0x44, 0xb0, 0x6f, 0x83, 0x11, 0xee, 0x3b,
-  0x92, 0x2d, 0x79, 0x57, 0x33, 0x1d, 0x36, 0x5c, 0x55, 0x74, 0x78, 0x2e,
-  0x17, 0x45, 0x03, 0x4b, 0x08, 0x7d, 0x42, 0x67, 0x5f, 0x09, 0x4b, 0x33,
-  0x59, 0x25, 0x4e, 0x4f, 0x50, 0x71, 0x54, 0x1b, 0x4c, 0x0d, 0x01, 0x37,
-  0x75, 0x59, 0x67, 0x43, 0x58, 0x75, 0x0a, 0x1f, 0x34, 0x01, 0x20, 0x2b,
-  0xda, 0x5d, 0xf2, 0x47, 0x93, 0x69, 0xb8, 0x13, 0x54, 0x04, 0x39, 0x2e,
-  0x13, 0x50, 0x3f, 0x7a, 0x88, 0x6c, 0xf8, 0x16, 0xb3, 0x38, 0x5c, 0x2d,
-  0x0a, 0x57, 0x69, 0x79, 0xfa, 0x63, 0x8e, 0x15, 0x5a, 0x3e, 0x14, 0x20,
-  0xd4, 0x4a, 0x9c, 0x7c, 0x59, 0x61, 0x1d, 0x0b, 0x92, 0x3d, 0xfb, 0x27,
-  0x22, 0x48, 0x22, 0x72, 0xf3, 0x64, 0xa7, 0x0e, 0x1f, 0x33, 0xdb, 0x25,
-  0xbd, 0x4f, 0x75, 0x70, 0xdd, 0x1a, 0xbd, 0x0c, 0x1d, 0x31, 0xed, 0x5b,
-  0x51, 0x4c, 0x36, 0x76, 0x92, 0x18, 0x62, 0x0d, 0x93, 0x37, 0xe1, 0x59,
-  0x25, 0x42, 0x86, 0x74, 0x0d, 0x19, 0xa9, 0x03, 0x74, 0x34, 0xc0, 0x5e,
-  0x5e, 0x43, 0xd4, 0x75, 0x1c, 0x1e, 0xcb, 0x00, 0x5d, 0x35, 0xd8, 0x5f,
-  0x5f, 0x40, 0xd9, 0x6a, 0x4d, 0x1f, 0xc5, 0x01, 0x3c, 0x2a, 0xfd, 0x5c,
-  0x10, 0x41, 0x8c, 0x6b, 0x7c, 0x1c, 0xa4, 0x06, 0xc6, 0x2b, 0x75, 0x5c,
-  0xdc, 0x46, 0x36, 0x6b, 0x5e, 0x1c, 0xb9, 0x06, 0x08, 0x2b, 0xb9, 0x5d,
-  0xcd, 0x46, 0x21, 0x6b, 0xbf, 0x1d, 0xc1, 0x06, 0x19, 0x2b, 0xa5, 0x5d,
-  0xf0, 0x46, 0x04, 0x6b, 0x46, 0x1c, 0x96, 0x06, 0xd9, 0x2b, 0x58, 0x5c,
-  0x32, 0x41, 0xf3, 0x6b
-};
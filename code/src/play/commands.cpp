@@ -19,6 +19,52 @@ namespace paiv {
   }
 
 
+  static vector<string>
+  savedSnapshots()
+  {
+    vector<string> files;
+    if (DIR* dir = opendir("saves"))
+    {
+      while (dirent* entry = readdir(dir))
+        if (entry->d_name[0] != '.')
+          files.push_back(string("saves/") + entry->d_name);
+      closedir(dir);
+    }
+    sort(begin(files), end(files));
+    return files;
+  }
+
+  // address and key of every hit, with the text found there
+  static void
+  showHits(ostream& so, const string& where, const u16* mem, const vector<SearchHit>& hits, u8 text, u8 prefixed)
+  {
+    for (auto& hit : hits)
+    {
+      so << where << setfill('0') << setw(4) << hex << hit.address;
+      if (hit.key)
+        so << " key " << setw(4) << hit.key;
+      so << dec << setfill(' ');
+
+      if (text)
+      {
+        u16 at = hit.address + (prefixed ? 1 : 0);
+        u16 length = prefixed ? mem[hit.address] : 40;
+        string s;
+        for (u16 i = 0; i < length && at + i < 32768; i++)
+        {
+          u16 c = mem[at + i] ^ hit.key;
+          if (!prefixed && (c < ' ' || c > '~'))
+            break;
+          s.push_back(c < ' ' || c > '~' ? '.' : (char)c);
+        }
+        so << "  \"" << s << '"';
+      }
+
+      so << endl;
+    }
+  }
+
+
   class Command
   {
   public:
@@ -73,7 +119,9 @@ namespace paiv {
 
     static const char* commands[] = { "save", "load", "restore", "restart", "reset",
       "di", "dis", "disassemble", "reg", "regs", "registers", "s", "si", "step", "c", "cont",
-      "b", "break", "clear", "fin", "finish", "m", "mem", "memory", "stack", "write" };
+      "b", "break", "clear", "fin", "finish", "m", "mem", "memory", "stack", "write",
+      "record", "replay", "profile", "heat", "stats", "watchdog", "bt", "ct", "find", "scan",
+      "saves", "drop", "gc", "goto", "tree" };
 
     if (name == "q" || name == "quit" || name == "exit")
     {
@@ -126,13 +174,21 @@ namespace paiv {
   {
   public:
     CommandHandler(zmq::context_t* context, zmq::socket_t* socket, int pty, const vector<u16>& image)
-      : context(context), socket(socket), pty(pty), worker(0), baseImage(image)
+      : context(context), socket(socket), pty(pty), worker(0), baseImage(image), watching(true), store("saves/store"), tree("saves/store/tree"), inputMark(0)
     {
+      store.open();
+      tree.open();
+    }
+
+    ~CommandHandler()
+    {
+      finishSaving();
     }
 
     void run();
 
     u8 resetWorker(const string& fn = "");
+    u8 replayWorker(const string& log, u64 tick);
     u8 process(const Command& command);
     void handle(const VmEvent& event);
 
@@ -144,26 +200,48 @@ namespace paiv {
     int pty;
     const vector<u16>& baseImage;
     pthread_t worker;
+    unique_ptr<Recorder> recorder;
+    Profiler profiler;
+    Heatmap heatmap;
+    Watchdog watchdog;
+    u8 watching;
+    Scanner scanner;
+    SnapshotStore store;
+    thread saving;
+    SavepointTree tree;
+    string currentNode;
+    size_t inputMark;
+
+  private:
+    u8 loadSaved(const string& key, Snapshot& snapshot);
+    u8 gotoSaved(const string& key);
+    Snapshot current();
+    void finishSaving();
+    void stopWorker();
+    u8 startWorker();
   };
 
 
-  u8
-  CommandHandler::resetWorker(const string& fn)
+  void
+  CommandHandler::stopWorker()
   {
     if (worker)
     {
       vm->halt();
       vm = nullptr;
 
-      dprintf(pty, "\n\n");
       pthread_join(worker, nullptr);
 
       debugEvents = nullptr;
       worker = 0;
-      int c;
-      while ((c = getchar()) != '\n' && c != EOF) ;
     }
 
+    recorder = nullptr;
+
+    // a new game is not on the tree until it is saved or loaded from it
+    currentNode.clear();
+    inputMark = 0;
+
     if (!vm)
     {
       vm = make_shared<SynacorVM>();
@@ -172,11 +250,35 @@ namespace paiv {
       debugEvents->connect(vm->reportingEndpoint());
       debugEvents->setsockopt(ZMQ_SUBSCRIBE, "", 0);
     }
+  }
+
+  u8
+  CommandHandler::startWorker()
+  {
+    vm->setProfiler(&profiler);
+    vm->setHeatmap(&heatmap);
+    vm->setWatchdog(&watchdog, watching);
+
+    WorkerArgs args = { vm.get(), context };
+    pthread_t tid;
+    if (pthread_create(&tid, nullptr, vmworker, &args) == 0)
+    {
+      worker = tid;
+      return true;
+    }
+
+    return false;
+  }
+
+  u8
+  CommandHandler::resetWorker(const string& fn)
+  {
+    stopWorker();
 
     Snapshot snapshot;
     if (fn.size() > 0)
     {
-      if (!snapshot.load(fn))
+      if (!loadSaved(fn, snapshot))
       {
         cerr << "failed to load snapshot " << fn << endl;
         return false;
@@ -184,20 +286,123 @@ namespace paiv {
     }
     else
     {
+      WarmStart warm(baseImage);
+      if (warm.restore(vm.get()))
+      {
+        cout << warm.transcript << flush;
+        return startWorker();
+      }
+
       snapshot.loadImage(baseImage);
     }
 
     vm->load(snapshot);
 
-    WorkerArgs args = { vm.get(), context };
-    pthread_t tid;
-    if (pthread_create(&tid, nullptr, vmworker, &args) == 0)
+    auto entry = store.find(fn);
+    if (entry && tree.find(entry->name))
+      currentNode = entry->name;
+
+    return startWorker();
+  }
+
+  // the state at an instruction boundary, without stopping the game
+  Snapshot
+  CommandHandler::current()
+  {
+    Snapshot snapshot;
+    snapshot.take(vm->requestCapture().get());
+    return snapshot;
+  }
+
+  void
+  CommandHandler::finishSaving()
+  {
+    if (saving.joinable())
+      saving.join();
+  }
+
+  // a save in the store by name or tag, or a snapshot file
+  u8
+  CommandHandler::loadSaved(const string& key, Snapshot& snapshot)
+  {
+    return store.load(key, snapshot) || snapshot.load(key);
+  }
+
+  // moves the running game to a save, writing only the pages that differ
+  u8
+  CommandHandler::gotoSaved(const string& key)
+  {
+    auto entry = store.find(key);
+    if (!entry)
     {
-      worker = tid;
-      return true;
+      cerr << "no save " << key << endl;
+      return false;
     }
 
-    return false;
+    string name = entry->name;
+
+    if (!worker || vm->isHalted())
+    {
+      if (!resetWorker(name))
+        return false;
+    }
+    else
+    {
+      // compared and applied between two instructions, so that nothing
+      // the game writes meanwhile is left over
+      auto machine = vm.get();
+      u8 loaded = false;
+      vm->requestCall([this, machine, &name, &loaded]() {
+        Capture now = machine->capture();
+        Capture target;
+        loaded = store.load(name, target, &now);
+        if (loaded)
+        {
+          // a replay log holds one run of the machine, and ends here
+          if (recorder)
+            recorder->stop(machine);
+          machine->apply(target);
+        }
+      }).get();
+
+      if (!loaded)
+      {
+        cerr << "failed to load snapshot " << name << endl;
+        return false;
+      }
+
+      if (recorder)
+      {
+        cout << "recording stopped" << endl;
+        recorder = nullptr;
+      }
+    }
+
+    currentNode = name;
+    inputMark = 0;
+    return true;
+  }
+
+  u8
+  CommandHandler::replayWorker(const string& fn, u64 tick)
+  {
+    ReplayLog log;
+    if (!log.load(fn))
+    {
+      cerr << "failed to load replay " << fn << endl;
+      return false;
+    }
+
+    stopWorker();
+
+    Replayer replayer(log);
+    if (!replayer.seek(vm.get(), tick))
+    {
+      cerr << "failed to seek to " << tick << endl;
+      return false;
+    }
+
+    return startWorker();
   }
 
   void
@@ -239,8 +444,9 @@ namespace paiv {
         zmq::message_t message;
         debugEvents->recv(&message);
 
-        VmEvent event = *message.data<VmEvent>();
-        handle(event);
+        VmEvent event;
+        if (unpack(message, event))
+          handle(event);
       }
     }
   }
@@ -250,16 +456,104 @@ namespace paiv {
   {
     const string& name = command.name;
 
+    // the store is used by one save at a time, and by nothing else meanwhile
+    finishSaving();
+
     if (name == "save")
     {
-      mkdir("saves", S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
-      auto snapshot = vm->save();
-      snapshot.save(availableFilename("saves/save"));
+      // pages written since the last save are copied at an instruction
+      // boundary, and the rest is written out while the game goes on
+      Capture state = vm->requestCapture().get();
+      string tag = command.args.size() > 0 ? command.args[0] : "";
+
+      // the input since the previous save, or all of it after a reset
+      Savepoint node = { store.nextName(), currentNode, checksum(state),
+        state.input.substr(min(inputMark, state.input.size())) };
+      size_t mark = state.input.size();
+
+      // the tree moves on once the save is written; the next command
+      // waits for it in finishSaving
+      cout << "saving " << node.name << endl;
+      saving = thread([this, state, tag, node, mark]() {
+        if (store.save(state, tag).empty())
+          cerr << "failed to save" << endl;
+        else if (!tree.add(node))
+          cerr << "failed to add " << node.name << " to the tree" << endl;
+        else
+        {
+          currentNode = node.name;
+          inputMark = mark;
+        }
+      });
+    }
+    else if (name == "goto")
+    {
+      if (command.args.size() > 0)
+      {
+        if (gotoSaved(command.args[0]))
+        {
+          dprintf(pty, "look\n");
+        }
+      }
+    }
+    else if (name == "tree")
+    {
+      tree.print(cout, currentNode);
+    }
+    else if (name == "saves")
+    {
+      for (auto& entry : store.saves())
+        cout << entry.name << (entry.tag.size() > 0 ? "  " + entry.tag : "") << endl;
+    }
+    else if (name == "drop")
+    {
+      for (auto& key : command.args)
+        if (!store.drop(key))
+          cerr << "no save " << key << endl;
+    }
+    else if (name == "gc")
+    {
+      u64 reclaimed = store.collect();
+      cout << "reclaimed " << dec << reclaimed << " bytes, " << store.objectCount() << " objects kept" << endl;
     }
     else if (name == "restart" || name == "reset")
     {
       resetWorker();
     }
+    else if (name == "record")
+    {
+      mkdir("saves", S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+      string fn = command.args.size() > 0 ? command.args[0] : availableFilename("saves/replay");
+
+      stopWorker();
+
+      WarmStart warm(baseImage);
+      if (warm.restore(vm.get()))
+        cout << warm.transcript << flush;
+      else
+        vm->load(baseImage);
+
+      recorder = unique_ptr<Recorder>(new Recorder(fn));
+      if (recorder->start(vm.get()))
+        cout << "recording to " << fn << endl;
+      else
+        cerr << "failed to record to " << fn << endl;
+
+      startWorker();
+    }
+    else if (name == "replay")
+    {
+      if (command.args.size() > 0)
+      {
+        u64 tick = UINT64_MAX;
+        if (command.args.size() > 1)
+          tick = stoull(command.args[1], 0, 10);
+        if (replayWorker(command.args[0], tick))
+        {
+          dprintf(pty, "look\n");
+        }
+      }
+    }
     else if (name == "load" || name == "restore")
     {
       if (command.args.size() > 0)
@@ -348,6 +642,108 @@ namespace paiv {
         dbg.listBreakpoints();
       }
     }
+    else if (name == "find")
+    {
+      // find [-s] [-x] [-a] "text" | hex words
+      u8 prefixed = false;
+      u8 obfuscated = false;
+      u8 saved = false;
+      size_t argi = 0;
+      for (; argi < command.args.size() && command.args[argi][0] == '-'; argi++)
+      {
+        prefixed |= command.args[argi].find('s') != string::npos;
+        obfuscated |= command.args[argi].find('x') != string::npos;
+        saved |= command.args[argi].find('a') != string::npos;
+      }
+
+      auto quote = command.line.find_first_of("\"'");
+      u8 text = quote != string::npos;
+      unique_ptr<MemorySearch> search;
+      if (text)
+      {
+        auto end = command.line.find(command.line[quote], quote + 1);
+        search.reset(new MemorySearch(command.line.substr(quote + 1, end - quote - 1), prefixed, obfuscated));
+      }
+      else
+      {
+        vector<u16> words;
+        for (; argi < command.args.size(); argi++)
+          words.push_back(stoul(command.args[argi], 0, 16));
+        search.reset(new MemorySearch(words));
+      }
+
+      if (search->size() > 0)
+      {
+        auto snapshot = current();
+        showHits(cout, "", &snapshot.mem[0], search->find(&snapshot.mem[0], 32768), text, prefixed);
+
+        if (saved)
+        {
+          for (auto& entry : store.saves())
+          {
+            Snapshot save;
+            if (store.load(entry.name, save))
+              showHits(cout, entry.name + ' ', &save.mem[0], search->find(&save.mem[0], 32768), text, prefixed);
+          }
+          for (auto& fn : savedSnapshots())
+          {
+            Snapshot save;
+            if (save.load(fn))
+              showHits(cout, fn + ' ', &save.mem[0], search->find(&save.mem[0], 32768), text, prefixed);
+          }
+        }
+      }
+    }
+    else if (name == "scan")
+    {
+      // scan start | changed | unchanged | inc | dec | eq value [snapshot]
+      Scanner::Predicate predicate;
+      size_t argi = 1;
+      u16 value = 0;
+      auto memory = current();
+
+      if (command.args.size() > 0 && Scanner::parse(command.args[0], predicate)
+        && predicate == Scanner::Equals && command.args.size() > 1)
+        value = stoul(command.args[argi++], 0, 16);
+
+      unique_ptr<Snapshot> snapshot;
+      if (command.args.size() > argi)
+      {
+        snapshot.reset(new Snapshot());
+        if (!loadSaved(command.args[argi], *snapshot))
+        {
+          cerr << "failed to load snapshot " << command.args[argi] << endl;
+          return true;
+        }
+      }
+      const u16* mem = snapshot ? &snapshot->mem[0] : &memory.mem[0];
+
+      if (command.args.size() > 0 && command.args[0] == "start")
+        scanner.start(mem);
+      else if (command.args.size() > 0 && Scanner::parse(command.args[0], predicate))
+        scanner.narrow(mem, predicate, value);
+      else if (command.args.size() > 0)
+        cerr << "unknown predicate " << command.args[0] << endl;
+
+      scanner.report(cout);
+    }
+    else if (name == "bt" || name == "ct")
+    {
+      // the rest of the line, spaces and all
+      string text;
+      auto at = command.line.find(name);
+      at = command.line.find_first_not_of(' ', at + name.size());
+      if (at != string::npos)
+        text = command.line.substr(at);
+
+      Debugger dbg(context, vm.get());
+      if (name == "ct")
+        dbg.clearTextBreakpoint(text);
+      else if (text.size() > 0)
+        dbg.breakOnText(text);
+      else
+        dbg.listBreakpoints();
+    }
     else if (name == "clear")
     {
       Debugger dbg(context, vm.get());
@@ -363,6 +759,103 @@ namespace paiv {
       Debugger dbg(context, vm.get());
       dbg.stepOut();
     }
+    else if (name == "profile")
+    {
+      if (!Profiler::Enabled)
+      {
+        cerr << "profiler not built in, configure with -DSYNACOR_PROFILE=ON" << endl;
+      }
+      else if (command.args.size() > 0 && command.args[0] == "reset")
+      {
+        // the counts are the machine's to update, and are touched between
+        // its instructions
+        vm->requestCall([this]() { profiler.reset(); }).get();
+      }
+      else if (command.args.size() > 1 && command.args[0] == "folded")
+      {
+        NameMap names;
+        if (command.args.size() > 2 && !names.load(command.args[2]))
+          cerr << "failed to load names " << command.args[2] << endl;
+
+        ofstream so(command.args[1]);
+        vm->requestCall([this, &so, &names]() { profiler.folded(so, names); }).get();
+      }
+      else
+      {
+        auto snapshot = current();
+        if (command.args.size() > 0)
+        {
+          ofstream so(command.args[0]);
+          vm->requestCall([this, &so, &snapshot]() { profiler.report(so, &snapshot.mem[0]); }).get();
+        }
+        else
+        {
+          vm->requestCall([this, &snapshot]() { profiler.report(cout, &snapshot.mem[0], 8); }).get();
+        }
+      }
+    }
+    else if (name == "heat")
+    {
+      // the counts are the machine's to update, and are touched between
+      // its instructions
+      const string& what = command.args.size() > 0 ? command.args[0] : "";
+      if (what == "reset")
+      {
+        vm->requestCall([this]() { heatmap.reset(); }).get();
+      }
+      else if (what == "window")
+      {
+        u64 from = command.args.size() > 1 ? stoull(command.args[1]) : UINT64_MAX;
+        u64 to = command.args.size() > 2 ? stoull(command.args[2]) : UINT64_MAX;
+        auto machine = vm.get();
+        vm->requestCall([this, machine, from, to]() {
+          heatmap.reset();
+          heatmap.setWindow(from != UINT64_MAX ? from : machine->clock(), to);
+        }).get();
+      }
+      else if (what == "csv" && command.args.size() > 1)
+      {
+        ofstream so(command.args[1]);
+        vm->requestCall([this, &so]() { heatmap.csv(so); }).get();
+      }
+      else if (what == "pgm" && command.args.size() > 1)
+      {
+        auto access = command.args.size() < 3 ? Heatmap::Accesses
+          : command.args[2] == "reads" ? Heatmap::Reads
+          : command.args[2] == "writes" ? Heatmap::Writes
+          : Heatmap::Accesses;
+        ofstream so(command.args[1], ios::binary);
+        vm->requestCall([this, &so, access]() { heatmap.pgm(so, access); }).get();
+      }
+      else
+      {
+        vm->requestCall([this]() { heatmap.report(cout, NameMap(), 10); }).get();
+      }
+    }
+    else if (name == "watchdog")
+    {
+      if (command.args.size() > 0)
+      {
+        watching = command.args[0] != "off";
+        Debugger dbg(context, vm.get());
+        dbg.watch(watching);
+      }
+      cout << "watchdog " << (watching ? "on" : "off") << endl;
+    }
+    else if (name == "stats")
+    {
+      Debugger dbg(context, vm.get());
+
+      // the counters are the machine's to update, and are touched between
+      // its instructions
+      auto machine = vm.get();
+      if (command.args.size() > 0 && command.args[0] == "reset")
+        vm->requestCall([machine]() { machine->resetStatistics(); }).get();
+      else if (command.args.size() > 1 && command.args[0] == "every")
+        dbg.reportStats(stoul(command.args[1]));
+      else
+        vm->requestCall([&dbg]() { dbg.showStats(cout); }).get();
+    }
     else
     {
       cerr << "handler: unhandled " << command.line << endl;
@@ -382,6 +875,22 @@ namespace paiv {
     {
       cout << "breakpoints: " << event.arg << endl;
     }
+    else if (event.name == "output")
+    {
+      cout << "stopped on output \"" << event.arg << "\"" << endl;
+      Debugger dbg(context, vm.get());
+      dbg.disassemble(cout);
+    }
+    else if (event.name == "runaway")
+    {
+      cout << "stopped: " << event.arg << endl;
+      Debugger dbg(context, vm.get());
+      dbg.disassemble(cout);
+    }
+    else if (event.name == "stats")
+    {
+      cout << "stats: " << event.arg << endl;
+    }
   }
 
 }
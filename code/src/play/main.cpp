@@ -1,40 +1,64 @@
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <iterator>
+#include <memory>
 #include <numeric>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <readline/readline.h>
 #include <readline/history.h>
 #include <unistd.h>
+#include <dirent.h>
 #include <fcntl.h>
 #include <zmq.hpp>
 #include <signal.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/wait.h>
 
 using namespace std;
 
 #include "../vm/types.hpp"
 #include "../vm/opcodes.hpp"
+#include "../vm/memory.hpp"
 #include "../vm/loader.hpp"
-#include "../vm/vm.cpp"
-#include "../ida/disasm.cpp"
-#include "../vm/debugger.cpp"
+#include "../vm/hash.hpp"
+#include "../vm/vm.hpp"
+#include "../vm/replay.hpp"
+#include "../vm/warm.hpp"
+#include "../vm/disasm.hpp"
+#include "../vm/debugger.hpp"
+#include "../vm/profiler.hpp"
+#include "../vm/heatmap.hpp"
+#include "../vm/watchdog.hpp"
+#include "../vm/search.hpp"
+#include "../vm/scanner.hpp"
+#include "../vm/store.hpp"
+#include "../vm/savetree.hpp"
 #include "commands.cpp"
 
 using namespace paiv;
 
-// #include "challenge.cpp"
+#ifdef SYNACOR_EMBED_IMAGE
+#include "embedded_image.hpp"
+#endif
 
 
 int main(int argc, char* argv[])
 {
+#ifndef SYNACOR_EMBED_IMAGE
   if (argc < 2)
   {
     cout << "usage: play <image>" << endl;
     return 0;
   }
+#endif
 
   // parent process -> zmq -> child process [command handler]
   // child [command handler] -> vm worker thread
@@ -98,8 +122,11 @@ int main(int argc, char* argv[])
     socket.bind("tcp://*:7199");
 
     ImageLoader loader;
+#ifdef SYNACOR_EMBED_IMAGE
+    auto image = argc < 2 ? loader.read(embedded_image) : loader.read(argv[1]);
+#else
     auto image = loader.read(argv[1]);
-    // vector<u8> image(begin(challenge_bin), end(challenge_bin));
+#endif
 
     CommandHandler handler(&context, &socket, fdparent, image);
     handler.run();
@@ -0,0 +1,70 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unistd.h>
+
+using namespace std;
+
+#include "../vm/types.hpp"
+#include "../vm/vm.hpp"
+#include "../vm/scanner.hpp"
+#include "../vm/store.hpp"
+
+using namespace paiv;
+
+
+int main(int argc, char* argv[])
+{
+  if (argc < 4)
+  {
+    cout << "usage: scan <snapshot> <changed|unchanged|inc|dec|eq value> <snapshot>..." << endl
+      << "  keeps the addresses whose values compare as asked between consecutive snapshots" << endl
+      << "  snapshots are save names or tags in saves/store, or snapshot files" << endl;
+    return 0;
+  }
+
+  Scanner scanner;
+  unique_ptr<Snapshot> snapshot(new Snapshot());
+
+  // the debugger's saves, when run where it was; not created otherwise
+  SnapshotStore store("saves/store");
+  if (access("saves/store/index", F_OK) == 0)
+    store.open();
+
+  for (int argi = 1; argi < argc; argi++)
+  {
+    Scanner::Predicate predicate = Scanner::Unchanged;
+    u16 value = 0;
+
+    if (argi > 1)
+    {
+      if (!Scanner::parse(argv[argi], predicate))
+      {
+        cerr << "unknown predicate " << argv[argi] << endl;
+        return 1;
+      }
+      if (predicate == Scanner::Equals && argi + 1 < argc)
+        value = stoul(argv[++argi], 0, 16);
+      if (++argi >= argc)
+      {
+        cerr << "missing snapshot after " << argv[argi - 1] << endl;
+        return 1;
+      }
+    }
+
+    if (!store.load(argv[argi], *snapshot) && !snapshot->load(argv[argi]))
+    {
+      cerr << "failed to load snapshot " << argv[argi] << endl;
+      return 1;
+    }
+
+    if (argi == 1)
+      scanner.start(&snapshot->mem[0]);
+    else
+      cerr << argv[argi] << ": " << scanner.narrow(&snapshot->mem[0], predicate, value) << endl;
+  }
+
+  scanner.report(cout, 32768);
+  return 0;
+}
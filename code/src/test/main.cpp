@@ -1,14 +1,39 @@
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstring>
+#include <fcntl.h>
+#include <functional>
+#include <iomanip>
 #include <iostream>
 #include <fstream>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
 #include <vector>
+#include <zmq.hpp>
+
+using namespace std;
 
 #include "../vm/types.hpp"
 #include "../vm/opcodes.hpp"
-#include "../vm/vm.cpp"
+#include "../vm/memory.hpp"
+#include "../vm/hash.hpp"
+#include "../vm/vm.hpp"
+#include "../vm/trace.hpp"
+#include "../vm/textmatch.hpp"
+#include "../vm/search.hpp"
+#include "../vm/scanner.hpp"
+#include "../vm/store.hpp"
+#include "../vm/savetree.hpp"
+#include "../vm/replay.hpp"
+#include "../vm/watchdog.hpp"
+#include "../libsynacor/synacor.h"
 
-using namespace std;
 using namespace paiv;
 
 #define RUN_TEST(name) name()
@@ -20,6 +45,7 @@ public:
   u16 mem(u16 index) { return SynacorVM::mem[index]; }
   u16 ip() { return SynacorVM::ip; }
   u16 sp() { return SynacorVM::sp; }
+  u16 reg(u16 index) { return SynacorVM::reg[index]; }
 };
 
 
@@ -70,12 +96,670 @@ vm_out()
   vm.exec(image);
 }
 
+void
+vm_clock()
+{
+  vector<u16> image = { Op::NOOP, Op::NOOP, Op::JMP, 5, Op::HALT, Op::NOOP, Op::HALT };
+  CheckedSynacorVM vm;
+
+  vm.load(image);
+  vm.runUntil(2);
+
+  assert(vm.clock() == 2);
+  assert(vm.ip() == 2);
+
+  vm.runUntil(100);
+
+  assert(vm.clock() == 4);
+  assert(vm.ip() == 6);
+}
+
+void
+vm_input()
+{
+  vector<u16> image = { Op::IN, 32768, Op::IN, 32769, Op::IN, 32770, Op::HALT };
+  CheckedSynacorVM vm;
+  string text = "ok";
+  size_t p = 0;
+
+  vm.setInput([&text, &p]() { return p < text.size() ? text[p++] : EOF; });
+  vm.exec(image);
+
+  assert(vm.reg(0) == 'o');
+  assert(vm.reg(1) == 'k');
+  assert(vm.ip() == 4);
+  assert(vm.clock() == 2);
+}
+
+void
+vm_mapped_image()
+{
+  vector<u16> image = { Op::WMEM, 0, Op::HALT, Op::HALT };
+  string fn = "test_mapped_image.bin";
+  {
+    ofstream ofs(fn, ios::binary | ios::trunc);
+    ofs.write((char*)&image[0], image.size() * 2);
+  }
+
+  MappedFile file;
+  assert(file.open(fn));
+
+  CheckedSynacorVM vm;
+  vm.load(file);
+  vm.run();
+
+  assert(vm.mem(0) == Op::HALT);
+  assert(vm.mem(3) == Op::HALT);
+  assert(vm.mem(4) == 0);
+  assert(((const u16*)file.data())[0] == Op::WMEM);
+
+  unlink(fn.c_str());
+}
+
+void
+vm_trace()
+{
+  // the WMEM writes over its own first operand
+  vector<u16> image = { Op::WMEM, 1, 5, Op::ADD, 32768, 2, 3, Op::HALT };
+  string fn = "test_trace.trc";
+
+  TraceWriter writer;
+  assert(writer.open(fn));
+
+  CheckedSynacorVM vm;
+  vm.load(image);
+  vm.setTracer(&writer);
+  vm.run();
+  assert(writer.close());
+
+  TraceReader reader;
+  assert(reader.open(fn));
+  assert(reader.instructions() == 2);
+
+  TraceRecord r;
+  assert(reader.next(r));
+  assert(r.tick == 0 && r.ip == 0 && r.opcode == Op::WMEM);
+  assert(r.a == 1 && r.b == 5 && r.written && r.value == 5);
+  assert(reader.next(r));
+  assert(r.tick == 1 && r.ip == 3 && r.opcode == Op::ADD && r.value == 5);
+  assert(!reader.next(r));
+
+  unlink(fn.c_str());
+}
+
+void
+vm_trace_rewind()
+{
+  string fn = "test_trace_rewind.trc";
+
+  // the clock goes back, as after a load, and the later ticks are replaced
+  TraceWriter writer;
+  assert(writer.open(fn));
+  for (u64 t = 0; t < 2 * TraceWriter::BlockSize + 10; t++)
+    writer.retire(t, t % 100, Op::ADD, 32768, 1, 2, u16(t));
+  for (u64 t = 70000; t < 80000; t++)
+    writer.retire(t, t % 100, Op::ADD, 32768, 1, 2, u16(t + 7));
+  assert(writer.close());
+
+  TraceReader reader;
+  assert(reader.open(fn));
+  assert(reader.instructions() == 80000);
+  assert(reader.lastTick() == 80000);
+
+  TraceRecord r;
+  assert(reader.seek(60000) && reader.next(r));
+  assert(r.tick == 60000 && r.value == 60000);
+  assert(reader.seek(75000) && reader.next(r));
+  assert(r.tick == 75000 && r.value == u16(75007));
+
+  unlink(fn.c_str());
+}
+
+void
+vm_text_match()
+{
+  TextMatcher matcher;
+  matcher.add("he");
+  matcher.add("she");
+  matcher.add("hers");
+  matcher.add("she");
+  assert(matcher.patterns().size() == 3);
+
+  // overlapping patterns, the longest reported
+  string text = "ushers";
+  string matches;
+  for (char c : text)
+    if (matcher.feed(c))
+      matches += matcher.matched() + ",";
+  assert(matches == "she,hers,");
+
+  assert(matcher.remove("she"));
+  assert(!matcher.remove("she"));
+
+  matches.clear();
+  for (char c : text)
+    if (matcher.feed(c))
+      matches += matcher.matched() + ",";
+  assert(matches == "he,hers,");
+
+  matcher.clear();
+  assert(matcher.empty());
+  assert(!matcher.feed('h') && !matcher.feed('e'));
+}
+
+// every start tried one by one, as the vector kernel must agree with it
+static vector<SearchHit>
+searchSlowly(const u16* memory, size_t size, const vector<u16>& pattern, size_t anchor, u8 keyed)
+{
+  vector<SearchHit> hits;
+  for (size_t i = 0; i + pattern.size() <= size; i++)
+  {
+    u16 key = keyed ? memory[i + anchor] ^ pattern[anchor] : 0;
+    size_t k = 0;
+    while (k < pattern.size() && (memory[i + k] ^ (keyed && k >= anchor ? key : 0)) == pattern[k])
+      k++;
+    if (k == pattern.size())
+      hits.push_back(SearchHit{ (u16)i, key });
+  }
+  return hits;
+}
+
+static void
+assertSameHits(const vector<SearchHit>& a, const vector<SearchHit>& b)
+{
+  assert(a.size() == b.size());
+  for (size_t i = 0; i < a.size(); i++)
+    assert(a[i].address == b[i].address && a[i].key == b[i].key);
+}
+
+void
+vm_memory_search()
+{
+  // plants of "abc" plain, XOR-ed and after a length word, over every
+  // size up to a few vectors, so that hits land in the tail as well
+  for (size_t size = 0; size < 48; size++)
+  {
+    vector<u16> memory(size);
+    for (size_t i = 0; i < size; i++)
+      memory[i] = (i * 7919) % 5;
+
+    for (size_t at = 0; at + 4 <= size; at += 5)
+    {
+      u16 key = at % 2 ? 0x1234 : 0;
+      memory[at] = 3;
+      memory[at + 1] = 'a' ^ key;
+      memory[at + 2] = 'b' ^ key;
+      memory[at + 3] = 'c' ^ key;
+    }
+
+    vector<u16> abc = { 'a', 'b', 'c' };
+    vector<u16> prefixed = { 3, 'a', 'b', 'c' };
+
+    assertSameHits(MemorySearch(abc).find(memory.data(), size),
+      searchSlowly(memory.data(), size, abc, 0, false));
+    assertSameHits(MemorySearch("abc").find(memory.data(), size),
+      searchSlowly(memory.data(), size, abc, 0, false));
+    assertSameHits(MemorySearch("abc", false, true).find(memory.data(), size),
+      searchSlowly(memory.data(), size, abc, 0, true));
+    assertSameHits(MemorySearch("abc", true).find(memory.data(), size),
+      searchSlowly(memory.data(), size, prefixed, 1, false));
+    assertSameHits(MemorySearch("abc", true, true).find(memory.data(), size),
+      searchSlowly(memory.data(), size, prefixed, 1, true));
+  }
+
+  vector<u16> memory = { 0, 3, 'a' ^ 0x55, 'b' ^ 0x55, 'c' ^ 0x55, 0, 0, 0, 0, 0 };
+  auto hits = MemorySearch("abc", true, true).find(memory.data(), memory.size());
+  assert(hits.size() == 1 && hits[0].address == 1 && hits[0].key == 0x55);
+}
+
+void
+vm_scanner()
+{
+  vector<u16> memory(32768, 7);
+  Scanner scanner;
+  assert(!scanner.isStarted() && scanner.count() == 0);
+
+  scanner.start(memory.data());
+  assert(scanner.count() == 32768);
+
+  // unsigned, across the sign bit both ways
+  memory[10] = 8;
+  memory[20] = 6;
+  memory[30] = 0x8000;
+  memory[32767] = 0xFFFF;
+  assert(scanner.narrow(memory.data(), Scanner::Changed) == 4);
+
+  memory[10] = 9;
+  memory[20] = 5;
+  memory[30] = 0x8001;
+  memory[32767] = 0;
+  assert(scanner.narrow(memory.data(), Scanner::Increased) == 2);
+  assert((scanner.candidates() == vector<u16>{ 10, 30 }));
+
+  memory[30] = 0x7FFF;
+  assert(scanner.narrow(memory.data(), Scanner::Decreased) == 1);
+  assert(scanner.candidates() == vector<u16>{ 30 });
+
+  assert(scanner.narrow(memory.data(), Scanner::Unchanged) == 1);
+  assert(scanner.narrow(memory.data(), Scanner::Equals, 0x7FFE) == 0);
+
+  Scanner::Predicate predicate;
+  assert(Scanner::parse("eq", predicate) && predicate == Scanner::Equals);
+  assert(!Scanner::parse("ne", predicate));
+}
+
+void
+vm_snapshot_file()
+{
+  // bases are kept next to the test, not in the user's cache
+  setenv("XDG_CACHE_HOME", "test_cache", 1);
+  string fn = "test_snapshot";
+
+  vector<u16> image = { Op::WMEM, 700, 1, Op::PUSH, 9, Op::WMEM, 3000, 2, Op::SET, 32770, 4, Op::IN, 32768, Op::HALT };
+  CheckedSynacorVM vm;
+  vm.load(image);
+  vm.setInput([]() { return InputPending; });
+  vm.runUntil(4);
+
+  {
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    snapshot->take(&vm);
+    assert(snapshot->save(fn));
+  }
+
+  // a few runs of changed words against the image
+  struct stat params;
+  assert(stat(fn.c_str(), &params) == 0 && params.st_size < 200);
+
+  {
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    assert(snapshot->load(fn));
+    CheckedSynacorVM copy;
+    copy.load(*snapshot);
+    assert(copy.hash() == vm.hash() && copy.clock() == 4);
+    assert(copy.mem(700) == 1 && copy.mem(3000) == 2 && copy.reg(2) == 4 && copy.sp() == 1);
+  }
+
+  // a damaged payload, and sizes no writer gives
+  {
+    fstream fs(fn, ios::binary | ios::in | ios::out);
+    fs.seekg(-1, ios::end);
+    char c = fs.get();
+    fs.seekp(-1, ios::end);
+    fs.put(c ^ 0x5A);
+  }
+  unique_ptr<Snapshot> damaged(new Snapshot());
+  assert(!damaged->load(fn));
+
+  for (u32 rawSize : { 0xFFFFFFFEu, 33u })
+  {
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    snapshot->take(&vm);
+    assert(snapshot->save(fn));
+    {
+      fstream fs(fn, ios::binary | ios::in | ios::out);
+      fs.seekp(8 + 8 + 4);
+      fs.write((const char*)&rawSize, 4);
+    }
+    assert(!snapshot->load(fn));
+  }
+
+  // the first format: registers, ip, sp, the stack, then used memory
+  {
+    vector<u16> v1 = { 1, 2, 3, 4, 5, 6, 7, 8, 2, 2, 10, 11, 3, Op::NOOP, Op::NOOP, Op::HALT };
+    ofstream ofs(fn, ios::binary | ios::trunc);
+    ofs.write("SYNACOR", 8);
+    ofs.write((const char*)v1.data(), v1.size() * 2);
+  }
+
+  unique_ptr<Snapshot> old(new Snapshot());
+  assert(old->load(fn));
+  CheckedSynacorVM copy;
+  copy.load(*old);
+  assert(copy.reg(0) == 1 && copy.reg(7) == 8 && copy.ip() == 2 && copy.sp() == 2);
+  assert(copy.mem(1) == Op::NOOP && copy.mem(2) == Op::HALT && copy.mem(3) == 0);
+  assert(old->stack[0] == 10 && old->stack[1] == 11);
+
+  unlink(fn.c_str());
+  system("rm -rf test_cache");
+  unsetenv("XDG_CACHE_HOME");
+}
+
+void
+vm_snapshot_store()
+{
+  string dir = "test_store";
+  system(("rm -rf " + dir).c_str());
+
+  vector<u16> image = { Op::WMEM, 700, 1, Op::WMEM, 900, 2, Op::HALT };
+  CheckedSynacorVM vm;
+  vm.load(image);
+  Capture before = vm.capture();
+  vm.run();
+  Capture after = vm.capture();
+
+  {
+    SnapshotStore store(dir);
+    assert(store.open());
+    assert(store.nextName() == "save0000");
+    assert(store.save(before) == "save0000");
+    assert(store.save(after, "done") == "save0001");
+    assert(store.save(after) == "save0002");
+
+    // the pages of the second and third saves are shared
+    u64 objects = store.objectCount();
+    assert(store.save(after) == "save0003");
+    assert(store.objectCount() == objects);
+  }
+
+  SnapshotStore store(dir);
+  assert(store.open());
+  assert(store.saves().size() == 4);
+  assert(store.find("done") && store.find("done")->name == "save0001");
+
+  Capture state;
+  assert(store.load("save0000", state));
+  assert(checksum(state) == checksum(before));
+  assert(store.load("done", state));
+  assert(checksum(state) == checksum(after) && state.ip == after.ip);
+
+  // against the current state only the pages that differ are given
+  assert(store.load("save0000", state, &after));
+  size_t given = count_if(begin(state.pages), end(state.pages),
+    [](const shared_ptr<const vector<u16>>& page) { return page != nullptr; });
+  assert(given == 2);
+
+  unique_ptr<Snapshot> snapshot(new Snapshot());
+  assert(store.load("done", *snapshot) && snapshot->fn == "save0001");
+  assert(snapshot->mem[700] == 1 && snapshot->mem[900] == 2);
+
+  assert(store.drop("save0000"));
+  assert(!store.drop("save0000"));
+  assert(store.drop("save0003"));
+  assert(!store.find("save0000"));
+  assert(store.collect() > 0);
+
+  // names stay taken after their saves are collected
+  SnapshotStore reopened(dir);
+  assert(reopened.open());
+  assert(reopened.saves().size() == 2);
+  assert(reopened.nextName() == "save0004");
+  assert(reopened.load("save0002", state) && checksum(state) == checksum(after));
+
+  system(("rm -rf " + dir).c_str());
+}
+
+void
+vm_capture()
+{
+  // parked on IN, waiting for input that does not come
+  vector<u16> image = { Op::WMEM, 700, 1, Op::IN, 32768, Op::HALT };
+  CheckedSynacorVM vm;
+  vm.load(image);
+  vm.setInput([]() { return InputPending; });
+
+  Capture first = vm.requestCapture().get();
+  assert(first.ticks == 0 && first.pages.size() == 65536 / PageWords);
+
+  thread worker([&vm]() { vm.run(); });
+  Capture second;
+  do
+    second = vm.requestCapture().get();
+  while (second.ticks < 1);
+  assert(second.ticks == 1 && second.ip == 3);
+
+  // only the page written is copied again
+  for (size_t i = 0; i < first.pages.size(); i++)
+    assert((first.pages[i] == second.pages[i]) == (i != 700 / PageWords));
+  assert((*second.pages[700 / PageWords])[700 % PageWords] == 1);
+
+  assert(checksum(second) == vm.hash());
+  unique_ptr<Snapshot> snapshot(new Snapshot());
+  snapshot->take(second);
+  CheckedSynacorVM copy;
+  copy.load(*snapshot);
+  assert(copy.hash() == vm.hash());
+
+  vm.halt();
+  worker.join();
+}
+
+void
+vm_savepoint_tree()
+{
+  string fn = "test_tree";
+  unlink(fn.c_str());
+
+  {
+    SavepointTree tree(fn);
+    assert(tree.open());
+    assert(tree.add(Savepoint{ "save0000", "", 0x1234, "take tablet\n" }));
+    assert(tree.add(Savepoint{ "save0001", "save0000", 0x5678, "use \\ tablet\nlook\n" }));
+    assert(tree.add(Savepoint{ "save0002", "save0000", 0x9abc, "" }));
+  }
+
+  SavepointTree tree(fn);
+  assert(tree.open());
+  auto node = tree.find("save0001");
+  assert(node && node->parent == "save0000" && node->hash == 0x5678);
+  assert(node->input == "use \\ tablet\nlook\n");
+  assert(tree.find("save0000")->parent.empty());
+  assert(!tree.find("save0003"));
+  assert(tree.children("save0000").size() == 2);
+
+  stringstream so;
+  tree.print(so, "save0001");
+  assert(so.str() ==
+    "  save0000  0000000000001234  take tablet\\n\n"
+    "*   save0001  0000000000005678  use \\\\ tablet\\nlook\\n\n"
+    "    save0002  0000000000009abc\n");
+
+  unlink(fn.c_str());
+}
+
+void
+vm_apply()
+{
+  vector<u16> image = { Op::WMEM, 700, 1, Op::IN, 32768, Op::WMEM, 900, 32768, Op::HALT };
+  string text = "x";
+  size_t p = 0;
+
+  CheckedSynacorVM vm;
+  vm.load(image);
+  vm.setInput([&text, &p]() { return p < text.size() ? text[p++] : EOF; });
+  vm.runUntil(2);
+  Capture saved = vm.capture();
+  vm.run();
+  Capture now = vm.capture();
+  assert(vm.mem(900) == 'x' && now.input == "x");
+
+  // going back writes the changed page, and nothing is left over
+  string dir = "test_apply";
+  system(("rm -rf " + dir).c_str());
+  SnapshotStore store(dir);
+  assert(store.open());
+  string name = store.save(saved);
+
+  Capture target;
+  assert(store.load(name, target, &now));
+  vm.apply(target);
+  assert(vm.hash() == checksum(saved));
+  assert(vm.ip() == 5 && vm.mem(900) == 0 && vm.mem(700) == 1);
+  assert(!vm.isHalted() && vm.capture().input.empty());
+
+  system(("rm -rf " + dir).c_str());
+}
+
+void
+vm_bad_instruction()
+{
+  // images from outside halt the machine, and not the process
+  vector<vector<u16>> images = {
+    { 99, 0 },
+    { Op::SET, 5, 1, Op::HALT },
+    { Op::ADD, 32776, 1, 2, Op::HALT },
+    { Op::IN, 40000, Op::HALT },
+    { Op::MOD, 32768, 1, 0, Op::HALT },
+  };
+
+  for (auto& image : images)
+  {
+    synacor_vm* vm = synacor_create();
+    assert(vm);
+    assert(synacor_load_image_data(vm, image.data(), image.size()) == 0);
+    synacor_feed(vm, "x", 1);
+    assert(synacor_run(vm, 100) == SYNACOR_HALTED);
+    assert(synacor_clock(vm) == 0);
+    for (int r = 0; r < 8; r++)
+      assert(synacor_get_register(vm, r) == 0);
+    synacor_destroy(vm);
+  }
+}
+
+
+void
+vm_replay()
+{
+  setenv("XDG_CACHE_HOME", "test_cache", 1);
+  string fn = "test_replay.log";
+
+  // adds each character into r1 and keeps the sums from 1001 on, then
+  // spins 200 ticks, so records need more than one varint byte
+  vector<u16> image = {
+    Op::IN, 32768,
+    Op::ADD, 32769, 32769, 32768,
+    Op::ADD, 32770, 32770, 1,
+    Op::ADD, 32771, 32770, 1000,
+    Op::WMEM, 32771, 32769,
+    Op::SET, 32772, 100,
+    Op::ADD, 32772, 32772, 32767,
+    Op::JT, 32772, 20,
+    Op::JMP, 0,
+  };
+  string script = "north\ntake lamp\nuse lamp\n";
+  auto scripted = [&script](size_t& at) -> InputSource {
+    return [&script, &at]() { return at < script.size() ? (int)script[at++] : InputPending; };
+  };
+
+  size_t recorded = 0;
+  CheckedSynacorVM vm;
+  vm.load(image);
+  Recorder recorder(fn, 500);
+  assert(recorder.start(&vm, scripted(recorded)));
+  vm.runUntil(UINT64_MAX);
+  recorder.stop(&vm);
+  assert(vm.isWaiting() && vm.mem(1000 + script.size()) != 0);
+
+  ReplayLog log;
+  assert(log.load(fn));
+  assert(log.inputs.size() == script.size());
+  for (size_t i = 0; i < log.inputs.size(); i++)
+    assert(log.inputs[i].tick == 207 * i && log.inputs[i].c == (u8)script[i]);
+  assert(log.checkpoints.size() > 3 && log.checkpoints[0].tick == 0);
+  assert(log.lastTick() == 207 * (script.size() - 1) + 1);
+
+  // past the third checkpoint, between two inputs
+  u64 tick = log.checkpoints[2].tick + 300;
+
+  size_t straight = 0;
+  CheckedSynacorVM expected;
+  expected.load(image);
+  expected.setInput(scripted(straight));
+  expected.runUntil(tick);
+  assert(expected.clock() == tick);
+
+  CheckedSynacorVM replayed;
+  Replayer replayer(log);
+  assert(replayer.seek(&replayed, tick));
+  assert(replayed.clock() == tick && replayed.hash() == expected.hash());
+
+  // an input the log places on a different tick is reported
+  ReplayLog shifted = log;
+  shifted.inputs[shifted.checkpoints[2].input].tick++;
+  stringstream so;
+  auto buf = cerr.rdbuf(so.rdbuf());
+  Replayer diverging(shifted);
+  diverging.seek(&replayed, tick);
+  cerr.rdbuf(buf);
+  assert(so.str().find("replay diverged") != string::npos);
+
+  system("rm -rf test_replay.log* test_cache");
+  unsetenv("XDG_CACHE_HOME");
+}
+
+// what the watchdog reported on stderr over a run without a controller
+static string
+watched(CheckedSynacorVM& vm, const vector<u16>& image)
+{
+  Watchdog watchdog;
+  vm.load(image);
+  vm.setWatchdog(&watchdog);
+
+  stringstream so;
+  auto buf = cerr.rdbuf(so.rdbuf());
+  vm.run();
+  cerr.rdbuf(buf);
+  return so.str();
+}
+
+void
+vm_watchdog()
+{
+  {
+    CheckedSynacorVM vm;
+    string report = watched(vm, { Op::NOOP, Op::JMP, 1 });
+    assert(report.find("infinite loop") != string::npos);
+    assert(vm.isHalted() && vm.clock() <= 4 * Watchdog::Interval);
+  }
+
+  {
+    CheckedSynacorVM vm;
+    string report = watched(vm, { Op::CALL, 0 });
+    assert(report.find("runaway recursion") != string::npos);
+    assert(vm.isHalted() && vm.clock() == Watchdog::Interval);
+  }
+
+  // 60000 ticks of counting down after each character, so the watchdog
+  // looks in while the machine is busy, and between inputs
+  {
+    vector<u16> image = {
+      Op::IN, 32768,
+      Op::SET, 32769, 30000,
+      Op::ADD, 32769, 32769, 32767,
+      Op::JT, 32769, 5,
+      Op::JMP, 0,
+    };
+    string script = "go\n";
+    size_t at = 0;
+    CheckedSynacorVM vm;
+    vm.setInput([&]() { return at < script.size() ? (int)script[at++] : EOF; });
+    string report = watched(vm, image);
+    assert(report.empty());
+    assert(vm.isHalted() && vm.clock() == 60003 * script.size());
+  }
+}
 
 int main()
 {
   RUN_TEST(vm_loader);
   RUN_TEST(vm_halt);
   RUN_TEST(vm_noop);
+  RUN_TEST(vm_clock);
+  RUN_TEST(vm_input);
+  RUN_TEST(vm_mapped_image);
+  RUN_TEST(vm_trace);
+  RUN_TEST(vm_trace_rewind);
+  RUN_TEST(vm_text_match);
+  RUN_TEST(vm_memory_search);
+  RUN_TEST(vm_scanner);
+  RUN_TEST(vm_snapshot_file);
+  RUN_TEST(vm_snapshot_store);
+  RUN_TEST(vm_capture);
+  RUN_TEST(vm_savepoint_tree);
+  RUN_TEST(vm_apply);
+  RUN_TEST(vm_replay);
+  RUN_TEST(vm_watchdog);
+  RUN_TEST(vm_bad_instruction);
   // RUN_TEST(vm_out);
-  return 1;
+  return 0;
 }
@@ -0,0 +1,175 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "../vm/types.hpp"
+#include "../vm/opcodes.hpp"
+#include "../vm/disasm.hpp"
+#include "../vm/trace.hpp"
+
+using namespace paiv;
+
+
+static string
+format(const TraceRecord& r)
+{
+  Disassembler disasm;
+  Operation op = disasm.decode(r.opcode, r.a, r.b, r.c);
+  op.offset = r.ip;
+
+  stringstream so;
+  so << setw(12) << r.tick << "  ";
+  disasm.format(so, op);
+
+  string line = so.str();
+  line.pop_back();
+
+  if (r.written)
+  {
+    stringstream value;
+    value << "  = " << hex << r.value;
+    line += value.str();
+  }
+  return line;
+}
+
+static u8
+same(const TraceRecord& x, const TraceRecord& y)
+{
+  return x.ip == y.ip && x.opcode == y.opcode && x.a == y.a && x.b == y.b && x.c == y.c
+    && x.written == y.written && x.value == y.value;
+}
+
+static int
+diff(const string& fn1, const string& fn2, u64 from, u64 limit)
+{
+  TraceReader t1, t2;
+  if (!t1.open(fn1) || !t2.open(fn2))
+  {
+    cerr << "failed to open traces" << endl;
+    return 1;
+  }
+
+  from = max(from, max(t1.firstTick(), t2.firstTick()));
+  t1.seek(from);
+  t2.seek(from);
+
+  u64 compared = 0;
+  u64 differ = 0;
+  TraceRecord r1, r2;
+  while (t1.next(r1) && t2.next(r2))
+  {
+    compared++;
+    if (r1.tick != r2.tick)
+    {
+      cout << "traces lose step at " << r1.tick << " and " << r2.tick << endl;
+      break;
+    }
+
+    if (!same(r1, r2))
+    {
+      if (differ++ < limit)
+        cout << "< " << format(r1) << endl << "> " << format(r2) << endl;
+    }
+  }
+
+  cout << compared << " instructions from " << from << " compared, " << differ << " differ" << endl;
+  return differ > 0;
+}
+
+
+int main(int argc, char* argv[])
+{
+  u64 from = 0;
+  u64 to = UINT64_MAX;
+  u16 low = 0;
+  u16 high = 0x7FFF;
+  vector<u8> opcodes(OpCount, true);
+  u8 info = false;
+  u8 compare = false;
+  u64 limit = 10;
+
+  Disassembler disasm;
+
+  int argi = 1;
+  for (; argi < argc; argi++)
+  {
+    string arg = argv[argi];
+    if (arg == "--from" && argi + 1 < argc)
+      from = stoull(argv[++argi]);
+    else if (arg == "--to" && argi + 1 < argc)
+      to = stoull(argv[++argi]);
+    else if (arg == "--ip" && argi + 1 < argc)
+    {
+      string range = argv[++argi];
+      auto dash = range.find('-');
+      low = stoul(range.substr(0, dash), 0, 16);
+      high = dash == string::npos ? low : stoul(range.substr(dash + 1), 0, 16);
+    }
+    else if (arg == "--op" && argi + 1 < argc)
+    {
+      fill(begin(opcodes), end(opcodes), false);
+      stringstream names(argv[++argi]);
+      for (string name; getline(names, name, ','); )
+      {
+        u16 opcode = 0;
+        while (opcode < opcodes.size() && disasm.opname(opcode) != name)
+          opcode++;
+        if (opcode == opcodes.size())
+        {
+          cerr << "unknown instruction " << name << endl;
+          return 1;
+        }
+        opcodes[opcode] = true;
+      }
+    }
+    else if (arg == "--info")
+      info = true;
+    else if (arg == "--diff")
+      compare = true;
+    else if (arg == "--limit" && argi + 1 < argc)
+      limit = stoull(argv[++argi]);
+    else
+      break;
+  }
+
+  if (argi >= argc || (compare && argi + 1 >= argc))
+  {
+    cout << "usage: trace [--info] [--from instr] [--to instr] [--ip lo-hi] [--op name,...] <trace>" << endl
+      << "       trace --diff [--from instr] [--limit n] <trace> <trace>" << endl;
+    return 0;
+  }
+
+  if (compare)
+    return diff(argv[argi], argv[argi + 1], from, limit);
+
+  TraceReader trace;
+  if (!trace.open(argv[argi]))
+  {
+    cerr << "failed to open trace " << argv[argi] << endl;
+    return 1;
+  }
+
+  if (info)
+  {
+    cout << trace.instructions() << " instructions in " << trace.blocks() << " blocks, from "
+      << trace.firstTick() << " to " << trace.lastTick() << endl;
+    return 0;
+  }
+
+  trace.seek(from);
+
+  TraceRecord r;
+  while (trace.next(r) && r.tick < to)
+  {
+    if (r.ip >= low && r.ip <= high && r.opcode < opcodes.size() && opcodes[r.opcode])
+      cout << format(r) << '\n';
+  }
+
+  return 0;
+}
@@ -0,0 +1,84 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "batch.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  BatchRunner::BatchRunner(const Snapshot& parent, u64 budget)
+    : parent(parent), budget(budget), coverage(nullptr)
+  {
+    memory.create(&parent.mem[0], parent.memoryUsed() * 2);
+  }
+
+  vector<BatchResult>
+  BatchRunner::run(const vector<string>& transcripts, size_t threads)
+  {
+    if (threads == 0)
+      threads = max(1u, thread::hardware_concurrency());
+    threads = min(threads, transcripts.size());
+
+    vector<BatchResult> results(transcripts.size());
+    vector<unique_ptr<SynacorVM>> vms;
+    vector<Coverage> covered(coverage ? threads : 0);
+    for (size_t i = 0; i < threads; i++)
+    {
+      vms.push_back(unique_ptr<SynacorVM>(new SynacorVM()));
+      if (coverage)
+        vms[i]->setCoverage(&covered[i]);
+    }
+
+    atomic<size_t> next(0);
+    auto worker = [&](SynacorVM* vm)
+    {
+      for (size_t i; (i = next++) < transcripts.size(); )
+        results[i] = run(vm, transcripts[i]);
+    };
+
+    vector<thread> pool;
+    for (size_t i = 1; i < threads; i++)
+      pool.push_back(thread(worker, vms[i].get()));
+    if (threads > 0)
+      worker(vms[0].get());
+
+    for (auto& t : pool)
+      t.join();
+
+    for (auto& c : covered)
+      coverage->merge(c);
+
+    return results;
+  }
+
+  BatchResult
+  BatchRunner::run(SynacorVM* vm, const string& transcript) const
+  {
+    BatchResult res;
+
+    if (memory.data())
+      vm->load(parent, memory);
+    else
+      vm->load(parent);
+
+    size_t p = 0;
+    vm->setInput([&transcript, &p]() { return p < transcript.size() ? (u8)transcript[p++] : InputPending; });
+    vm->setOutput([&res](u16 c) { res.output.push_back((char)c); });
+
+    u64 start = vm->clock();
+    vm->runUntil(start + budget);
+
+    vm->setInput(nullptr);
+    vm->setOutput(nullptr);
+
+    res.hash = vm->hash();
+    res.ticks = vm->clock() - start;
+    res.halted = vm->isHalted();
+    return res;
+  }
+
+}
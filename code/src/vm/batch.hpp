@@ -0,0 +1,47 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "vm.hpp"
+#include "coverage.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    string output;
+    u64 hash;
+    u64 ticks;
+    u8 halted;
+  } BatchResult;
+
+
+  // Runs input transcripts from one parent state, each on its own VM.
+  // The parent's memory is written once to a temporary file, and every
+  // VM maps it copy-on-write.
+
+  class BatchRunner
+  {
+  public:
+    static const u64 DefaultBudget = 1ull << 30;
+
+    BatchRunner(const Snapshot& parent, u64 budget = DefaultBudget);
+
+    vector<BatchResult> run(const vector<string>& transcripts, size_t threads = 0);
+    BatchResult run(SynacorVM* vm, const string& transcript) const;
+
+    // union of the instructions executed by every transcript
+    void setCoverage(Coverage* coverage) { this->coverage = coverage; }
+
+  private:
+    const Snapshot& parent;
+    MappedFile memory;
+    u64 budget;
+    Coverage* coverage;
+  };
+
+}
@@ -0,0 +1,110 @@
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "cache.hpp"
+#include "hash.hpp"
+#include "memory.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // entries are never removed, so pointers to them stay valid
+  static map<u64, vector<u16>> bases;
+  static mutex basesLock;
+
+  string
+  cacheDirectory()
+  {
+    string dir;
+    const char* xdg = getenv("XDG_CACHE_HOME");
+    const char* home = getenv("HOME");
+
+    if (xdg && *xdg)
+      dir = xdg;
+    else if (home && *home)
+      dir = string(home) + "/.cache";
+    else
+      return ".";
+
+    mkdir(dir.c_str(), S_IRWXU);
+    dir += "/synacor";
+    mkdir(dir.c_str(), S_IRWXU);
+    return dir;
+  }
+
+  static string
+  baseFilename(u64 hash)
+  {
+    stringstream so;
+    so << cacheDirectory() << "/base-" << setfill('0') << setw(16) << hex << hash;
+    return so.str();
+  }
+
+  u64
+  addBase(const u16* memory, size_t size)
+  {
+    u64 hash = checksum(memory, size);
+
+    lock_guard<mutex> lock(basesLock);
+    if (bases.find(hash) == bases.end())
+      bases[hash].assign(memory, memory + size);
+
+    return hash;
+  }
+
+  const vector<u16>*
+  findBase(u64 hash)
+  {
+    lock_guard<mutex> lock(basesLock);
+
+    auto it = bases.find(hash);
+    if (it != bases.end())
+      return &it->second;
+
+    MappedFile file;
+    if (!file.open(baseFilename(hash)))
+      return nullptr;
+
+    const u16* p = (const u16*)file.data();
+    size_t size = file.size() / 2;
+    if (checksum(p, size) != hash)
+      return nullptr;
+
+    auto& base = bases[hash];
+    base.assign(p, p + size);
+    return &base;
+  }
+
+  u8
+  keepBase(u64 hash)
+  {
+    string fn = baseFilename(hash);
+
+    struct stat params;
+    if (stat(fn.c_str(), &params) == 0)
+      return true;
+
+    lock_guard<mutex> lock(basesLock);
+
+    auto it = bases.find(hash);
+    if (it == bases.end())
+      return false;
+
+    string tmp = fn + ".tmp" + to_string(getpid());
+    ofstream ofs(tmp, ios::binary | ios::trunc);
+    ofs.write((const char*)it->second.data(), it->second.size() * 2);
+    ofs.close();
+
+    return ofs.good() && rename(tmp.c_str(), fn.c_str()) == 0;
+  }
+
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // $XDG_CACHE_HOME/synacor, or ~/.cache/synacor, created on demand
+  string cacheDirectory();
+
+
+  // Memory that snapshots are saved as deltas against, by checksum: an
+  // image, or the memory of a well-known state such as the warm start.
+  // Bases added in this process are held in memory, and copied to the
+  // cache directory once a saved snapshot refers to them, where other
+  // processes find them.
+
+  u64 addBase(const u16* memory, size_t size);
+  const vector<u16>* findBase(u64 hash);
+  u8 keepBase(u64 hash);
+
+}
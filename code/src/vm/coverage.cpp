@@ -0,0 +1,199 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+#include "coverage.hpp"
+#include "disasm.hpp"
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  static const Signature SIGNcoverage = { "SYNCOVR" };
+
+  size_t
+  Coverage::count() const
+  {
+    return std::count(begin(marks), end(marks), 1);
+  }
+
+  void
+  Coverage::merge(const Coverage& other)
+  {
+    for (size_t i = 0; i < marks.size(); i++)
+      marks[i] |= other.marks[i];
+  }
+
+  void
+  Coverage::clear()
+  {
+    fill(begin(marks), end(marks), 0);
+  }
+
+  u8
+  Coverage::save(const string& fn) const
+  {
+    vector<u8> bits(marks.size() / 8, 0);
+    for (size_t i = 0; i < marks.size(); i++)
+      if (marks[i])
+        bits[i / 8] |= 1 << (i % 8);
+
+    ofstream so(fn, ios::binary | ios::trunc);
+    so.write(SIGNcoverage.chars, sizeof(Signature));
+    so.write((const char*)bits.data(), bits.size());
+    return so.good();
+  }
+
+  u8
+  Coverage::load(const string& fn)
+  {
+    ifstream si(fn, ios::binary);
+
+    Signature sign;
+    si.read(sign.chars, sizeof(Signature));
+    if (!si.good() || sign.word != SIGNcoverage.word)
+      return false;
+
+    vector<u8> bits(marks.size() / 8, 0);
+    si.read((char*)bits.data(), bits.size());
+    if (!si.good())
+      return false;
+
+    for (size_t i = 0; i < marks.size(); i++)
+      marks[i] = (bits[i / 8] >> (i % 8)) & 1;
+    return true;
+  }
+
+  u8
+  Coverage::accumulate(const string& fn) const
+  {
+    Coverage total;
+    total.load(fn);
+    total.merge(*this);
+    return total.save(fn);
+  }
+
+  // Linear sweep that stays aligned with executed code: an instruction
+  // that would swallow an executed address is shown as a data word.
+  static vector<Operation>
+  sweep(const u16* memory, const vector<u8>& marks)
+  {
+    Disassembler disasm;
+    vector<Operation> ops;
+
+    auto word = [memory](u32 p) -> u16 { return p < 32768 ? memory[p] : 0; };
+
+    for (u32 p = 0; p < 32768; )
+    {
+      Operation op = disasm.decode(word(p), word(p + 1), word(p + 2), word(p + 3));
+      op.offset = p;
+
+      if (!marks[p])
+        for (u32 q = p + 1; q < p + op.size && q < 32768; q++)
+          if (marks[q])
+          {
+            op = Operation{ 1, Op::DATA, memory[p] };
+            op.offset = p;
+            break;
+          }
+
+      ops.push_back(op);
+      p += op.size;
+    }
+
+    return ops;
+  }
+
+  void
+  Coverage::listing(ostream& so, const u16* memory, const NameMap& names) const
+  {
+    Disassembler disasm;
+    auto ops = sweep(memory, marks);
+
+    for (size_t i = 0; i < ops.size(); )
+    {
+      auto& op = ops[i];
+
+      // runs of data words are not worth a line each
+      size_t n = 0;
+      while (i + n < ops.size() && ops[i + n].opcode == Op::DATA && !marks[ops[i + n].offset])
+        n++;
+      if (n > 4)
+      {
+        so << "           " << setfill('0') << setw(4) << hex << uppercase << op.offset
+          << ".." << setw(4) << ops[i + n - 1].offset << "  " << dec << n << " data words" << endl;
+        i += n;
+        continue;
+      }
+
+      auto it = names.names.find(op.offset);
+      if (it != end(names.names))
+        so << endl << "           " << names.label(op.offset) << ':' << endl;
+
+      so << (marks[op.offset] ? "  +  " : "  -  ");
+      disasm.format(so, op);
+      i++;
+    }
+
+    so << dec << setfill(' ') << nouppercase;
+  }
+
+  void
+  Coverage::summary(ostream& so, const u16* memory, const NameMap& names) const
+  {
+    auto ops = sweep(memory, marks);
+
+    // functions are named addresses and the targets of direct calls
+    set<u16> entries;
+    for (auto& name : names.names)
+      entries.insert(name.first);
+    for (auto& op : ops)
+      if (op.opcode == Op::CALL && op.a < 32768 && (marks[op.offset] || marks[op.a]))
+        entries.insert(op.a);
+
+    size_t executed = 0;
+    size_t instructions = 0;
+    for (auto& op : ops)
+      if (op.opcode != Op::DATA)
+      {
+        instructions++;
+        executed += marks[op.offset];
+      }
+
+    so << fixed << setprecision(1);
+    so << "executed " << executed << " of " << instructions << " instructions ("
+      << (instructions ? 100.0 * executed / instructions : 0) << "%)" << endl << endl;
+
+    auto op = begin(ops);
+    for (auto it = begin(entries); it != end(entries); ++it)
+    {
+      u16 start = *it;
+      u32 stop = next(it) != end(entries) ? *next(it) : 32768;
+
+      while (op != end(ops) && op->offset < start)
+        ++op;
+
+      size_t total = 0;
+      size_t hit = 0;
+      for (auto p = op; p != end(ops) && p->offset < stop; ++p)
+        if (p->opcode != Op::DATA)
+        {
+          total++;
+          hit += marks[p->offset];
+        }
+
+      if (total == 0)
+        continue;
+
+      so << setw(6) << right << 100.0 * hit / total << "%  " << setw(5) << hit << '/' << left << setw(5) << total
+        << ' ' << names.label(start) << endl;
+    }
+
+    so << dec << setfill(' ') << right << defaultfloat;
+  }
+
+}
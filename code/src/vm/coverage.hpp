@@ -0,0 +1,45 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "namemap.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Addresses of executed instructions. The VM marks one byte per retired
+  // instruction; files hold the packed bitmap, and runs merge by OR.
+
+  class Coverage
+  {
+  public:
+    Coverage() : marks(32768, 0) {}
+
+    void mark(u16 address) { marks[address & 0x7FFF] = 1; }
+    u8 covered(u16 address) const { return marks[address & 0x7FFF]; }
+    size_t count() const;
+
+    void merge(const Coverage& other);
+    void clear();
+
+    u8 save(const string& fn) const;
+    u8 load(const string& fn);
+
+    // load and merge into the file, so runs accumulate
+    u8 accumulate(const string& fn) const;
+
+    // disassembly of memory with executed instructions marked, then the
+    // share of instructions executed in each function
+    void listing(ostream& so, const u16* memory, const NameMap& names = NameMap()) const;
+    void summary(ostream& so, const u16* memory, const NameMap& names = NameMap()) const;
+
+  private:
+    vector<u8> marks;
+  };
+
+}
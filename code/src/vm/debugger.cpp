@@ -1,38 +1,16 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <vector>
+
+#include "debugger.hpp"
+#include "disasm.hpp"
 
 namespace paiv
 {
-
-  class Debugger
-  {
-  public:
-    Debugger(zmq::context_t* context, SynacorVM* vm)
-      : context(context), vm(vm)
-    {
-    }
-
-    void disassemble(ostream& so);
-    void disassemble(ostream& so, u16 address);
-    void showRegisters(ostream& so);
-    void dumpMemory(ostream& so, u16 address, u16 size = 16);
-    void showStack(ostream& so, u16 size = 8);
-
-    void step();
-    void stepOut();
-    void resume();
-    void breakOn(u16 address);
-    void listBreakpoints();
-    void clearBreakpoint(u16 address);
-
-    void writeMemory(u16 address, u16 value);
-    void setRegister(u16 r, u16 value);
-
-  private:
-    zmq::context_t* context;
-    SynacorVM* vm;
-
-  private:
-    void sendCommand(const string& name, u16 arg = 0) const;
-  };
+  using namespace std;
 
 
   void
@@ -138,13 +116,44 @@ namespace paiv
   }
 
   void
-  Debugger::sendCommand(const string& name, u16 arg) const
+  Debugger::showStats(ostream& so)
+  {
+    VmStats stats = vm->statistics();
+    double seconds = stats.running + stats.waiting + stats.stopped;
+
+    so << fixed << setprecision(1);
+    so << "instructions  " << stats.instructions << ", "
+      << (stats.running > 0 ? stats.instructions / stats.running / 1e6 : 0) << " MIPS" << endl;
+    so << "stack         " << stats.stackDepth << ", max " << stats.maxStackDepth << endl;
+    so << "calls         " << stats.callDepth << ", max " << stats.maxCallDepth << endl;
+    so << "output        " << stats.outputChars << " chars" << endl;
+    so << "input         " << stats.inputLines << " lines" << endl;
+    so << "running       " << stats.running << " s" << endl;
+    so << "waiting       " << stats.waiting << " s for input" << endl;
+    so << "stopped       " << stats.stopped << " s ("
+      << (seconds > 0 ? 100 * stats.stopped / seconds : 0) << "%)" << endl;
+
+    vector<u16> opcodes(stats.opcodes.size());
+    iota(begin(opcodes), end(opcodes), 0);
+    sort(begin(opcodes), end(opcodes), [&stats](u16 a, u16 b) { return stats.opcodes[a] > stats.opcodes[b]; });
+
+    Disassembler disasm;
+    for (u16 opcode : opcodes)
+      if (stats.opcodes[opcode] > 0)
+        so << "  " << setw(4) << left << disasm.opname(opcode) << right << setw(14) << stats.opcodes[opcode]
+          << setw(7) << 100.0 * stats.opcodes[opcode] / stats.instructions << '%' << endl;
+
+    so << defaultfloat;
+  }
+
+  void
+  Debugger::sendCommand(const string& name, u16 arg, const string& text) const
   {
     zmq::socket_t socket(*context, ZMQ_PAIR);
     socket.connect(vm->messagingEndpoint());
 
-    DebuggerCommand command = { name, arg };
-    zmq::message_t message((void*)&command, sizeof(command));
+    string data = pack(DebuggerCommand{ name, arg, text });
+    zmq::message_t message(data.data(), data.size());
     socket.send(message);
   }
 
@@ -184,10 +193,35 @@ namespace paiv
     sendCommand("clear breakpoint", address);
   }
 
+  void
+  Debugger::breakOnText(const string& text)
+  {
+    sendCommand("set text breakpoint", 0, text);
+  }
+
+  void
+  Debugger::clearTextBreakpoint(const string& text)
+  {
+    sendCommand("clear text breakpoint", 0, text);
+  }
+
+  void
+  Debugger::reportStats(u16 seconds)
+  {
+    sendCommand("stats interval", seconds);
+  }
+
+  void
+  Debugger::watch(u8 on)
+  {
+    sendCommand("watchdog", on);
+  }
+
   void
   Debugger::writeMemory(u16 address, u16 value)
   {
     vm->mem[address] = value;
+    vm->touch(address);
   }
 
   void
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <iostream>
+#include <zmq.hpp>
+
+#include "vm.hpp"
+
+namespace paiv
+{
+  using namespace std;
+
+
+  class Debugger
+  {
+  public:
+    Debugger(zmq::context_t* context, SynacorVM* vm)
+      : context(context), vm(vm)
+    {
+    }
+
+    void disassemble(ostream& so);
+    void disassemble(ostream& so, u16 address);
+    void showRegisters(ostream& so);
+    void dumpMemory(ostream& so, u16 address, u16 size = 16);
+    void showStack(ostream& so, u16 size = 8);
+    void showStats(ostream& so);
+
+    void step();
+    void stepOut();
+    void resume();
+    void breakOn(u16 address);
+    void listBreakpoints();
+    void clearBreakpoint(u16 address);
+    void breakOnText(const string& text);
+    void clearTextBreakpoint(const string& text = "");
+
+    // publish a stats event every so many seconds of running, 0 to stop
+    void reportStats(u16 seconds);
+
+    // arm or disarm the watchdog given to the machine
+    void watch(u8 on);
+
+    void writeMemory(u16 address, u16 value);
+    void setRegister(u16 r, u16 value);
+
+  private:
+    zmq::context_t* context;
+    SynacorVM* vm;
+
+  private:
+    void sendCommand(const string& name, u16 arg = 0, const string& text = "") const;
+  };
+
+}
@@ -1,17 +1,12 @@
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "disasm.hpp"
 
 namespace paiv {
 
-  typedef struct
-  {
-    u8 size;
-    Op opcode;
-    u16 a;
-    u16 b;
-    u16 c;
-    u16 offset;
-    string s;
-    vector<u16> data;
-  } Operation;
+  using namespace std;
 
 
   static string
@@ -23,34 +18,17 @@ namespace paiv {
   }
 
 
-  class Disassembler
+  void
+  Disassembler::disassemble(const vector<u16>& image, ostream& so)
   {
-  public:
-    void disassemble(const vector<u16>& image, ostream& so);
-
-    vector<Operation> decode(const vector<u16>& image);
-    Operation decode(u16 opcode, u16 a, u16 b, u16 c);
-
-    void format(ostream& so, Operation& op, u8 selected = false);
-
-  private:
-    string formatData(const vector<u16>& data);
-    string opname(u16 opcode);
-    string argname(u16 arg);
-    string charof(u16 arg);
-    string char_or_hex(u16 x);
-    string extractAscii(const vector<Operation>& ops);
-    vector<u16> extractData(const vector<Operation>& ops);
-    vector<Operation> optimize(const vector<Operation>& ops);
-    vector<Operation> stringData(const vector<Operation>& ops);
-  };
+    disassemble(decode(image), so);
+  }
 
   void
-  Disassembler::disassemble(const vector<u16>& image, ostream& so)
+  Disassembler::disassemble(const vector<Operation>& ops, ostream& so)
   {
-    auto ops = decode(image);
-    ops = optimize(ops);
-    for (auto& op : ops)
+    auto res = optimize(ops);
+    for (auto& op : res)
       format(so, op);
   }
 
@@ -92,52 +70,32 @@ namespace paiv {
     return ops;
   }
 
-  Operation
-  Disassembler::decode(u16 opcode, u16 a, u16 b, u16 c)
+  vector<Operation>
+  Disassembler::decode(const DecodedOp* table, size_t size)
   {
-    Operation op = { 0, (Op)opcode, a, b, c };
+    vector<Operation> ops;
+    ops.reserve(size);
 
-    switch (opcode)
+    for (size_t i = 0; i < size; i++)
     {
-      case Op::HALT:
-      case Op::RET:
-      case Op::NOOP:
-        op.size = 1;
-        break;
-
-      case Op::PUSH:
-      case Op::POP:
-      case Op::JMP:
-      case Op::CALL:
-      case Op::OUT:
-      case Op::IN:
-        op.size = 2;
-        break;
+      auto& d = table[i];
+      auto op = Operation{ d.size, d.opcode, d.a, d.b, d.c };
+      op.offset = d.offset;
+      ops.push_back(op);
+    }
 
-      case Op::SET:
-      case Op::JT:
-      case Op::JF:
-      case Op::NOT:
-      case Op::RMEM:
-      case Op::WMEM:
-        op.size = 3;
-        break;
+    return ops;
+  }
 
-      case Op::EQ:
-      case Op::GT:
-      case Op::ADD:
-      case Op::MULT:
-      case Op::MOD:
-      case Op::AND:
-      case Op::OR:
-        op.size = 4;
-        break;
+  Operation
+  Disassembler::decode(u16 opcode, u16 a, u16 b, u16 c)
+  {
+    Operation op = { opinfo(opcode).size, (Op)opcode, a, b, c };
 
-      default:
-        op.size = 1;
-        op.opcode = Op::DATA;
-        op.a = opcode;
-        break;
+    if (!isOpcode(opcode))
+    {
+      op.opcode = Op::DATA;
+      op.a = opcode;
     }
 
     return op;
@@ -182,32 +140,8 @@ namespace paiv {
   string
   Disassembler::opname(u16 opcode)
   {
-    switch (opcode)
-    {
-      case Op::HALT:  return "halt";
-      case Op::SET:   return "set";
-      case Op::PUSH:  return "push";
-      case Op::POP:   return "pop";
-      case Op::EQ:    return "eq";
-      case Op::GT:    return "gt";
-      case Op::JMP:   return "jmp";
-      case Op::JT:    return "jt";
-      case Op::JF:    return "jf";
-      case Op::ADD:   return "add";
-      case Op::MULT:  return "mult";
-      case Op::MOD:   return "mod";
-      case Op::AND:   return "and";
-      case Op::OR:    return "or";
-      case Op::NOT:   return "not";
-      case Op::RMEM:  return "rmem";
-      case Op::WMEM:  return "wmem";
-      case Op::CALL:  return "call";
-      case Op::RET:   return "ret";
-      case Op::OUT:   return "out";
-      case Op::IN:    return "in";
-      case Op::NOOP:  return "noop";
-      case Op::DATA:  return "data";
-    }
+    if (isOpcode(opcode) || opcode == Op::DATA)
+      return opinfo(opcode).name;
     return "(invalid)";
   }
 
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "opcodes.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    u8 size;
+    Op opcode;
+    u16 a;
+    u16 b;
+    u16 c;
+    u16 offset;
+    string s;
+    vector<u16> data;
+  } Operation;
+
+
+  class Disassembler
+  {
+  public:
+    void disassemble(const vector<u16>& image, ostream& so);
+    void disassemble(const vector<Operation>& ops, ostream& so);
+
+    vector<Operation> decode(const vector<u16>& image);
+    vector<Operation> decode(const DecodedOp* table, size_t size);
+    Operation decode(u16 opcode, u16 a, u16 b, u16 c);
+
+    void format(ostream& so, Operation& op, u8 selected = false);
+    string opname(u16 opcode);
+
+  private:
+    string formatData(const vector<u16>& data);
+    string argname(u16 arg);
+    string charof(u16 arg);
+    string char_or_hex(u16 x);
+    string extractAscii(const vector<Operation>& ops);
+    vector<u16> extractData(const vector<Operation>& ops);
+    vector<Operation> optimize(const vector<Operation>& ops);
+    vector<Operation> stringData(const vector<Operation>& ops);
+  };
+
+}
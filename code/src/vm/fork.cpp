@@ -0,0 +1,221 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+#include "fork.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  ForkBrancher::ForkBrancher(const Snapshot& base, size_t processes, u64 budget)
+    : base(base), processes(processes), budget(budget)
+  {
+    if (this->processes == 0)
+      this->processes = max(1u, thread::hardware_concurrency());
+  }
+
+
+  class BranchWriter
+  {
+  public:
+    template<typename T>
+    void put(const T& x)
+    {
+      const u8* p = (const u8*)&x;
+      data.insert(end(data), p, p + sizeof(T));
+    }
+
+    void put(const void* p, size_t size)
+    {
+      put((u32)size);
+      data.insert(end(data), (const u8*)p, (const u8*)p + size);
+    }
+
+    vector<u8> data;
+  };
+
+
+  class BranchReader
+  {
+  public:
+    BranchReader(const vector<u8>& data) : data(data), pos(0) {}
+
+    template<typename T>
+    u8 get(T& x)
+    {
+      if (data.size() - pos < sizeof(T))
+        return false;
+      memcpy(&x, &data[pos], sizeof(T));
+      pos += sizeof(T);
+      return true;
+    }
+
+    u8 get(vector<u8>& bytes)
+    {
+      u32 size;
+      if (!get(size) || data.size() - pos < size)
+        return false;
+      bytes.assign(begin(data) + pos, begin(data) + pos + size);
+      pos += size;
+      return true;
+    }
+
+  private:
+    const vector<u8>& data;
+    size_t pos;
+  };
+
+
+  vector<Branch>
+  ForkBrancher::run(SynacorVM* vm, const vector<string>& inputs) const
+  {
+    vector<Branch> res(inputs.size());
+    vector<pid_t> pids(inputs.size(), -1);
+    vector<int> fds(inputs.size(), -1);
+
+    // keep up to `processes` children alive, collecting them in order
+    size_t started = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+      for (; started < inputs.size() && started < i + processes; started++)
+        pids[started] = spawn(vm, inputs[started], fds[started]);
+
+      if (pids[i] < 0 || !receive(fds[i], res[i]))
+      {
+        if (pids[i] < 0)
+          cerr << "fork failed: " << strerror(errno) << endl;
+
+        // run it here instead, then put the branch point back
+        unique_ptr<Snapshot> saved(new Snapshot());
+        saved->take(vm);
+        res[i] = capture(vm, inputs[i]);
+        vm->load(*saved);
+      }
+
+      if (fds[i] >= 0)
+        close(fds[i]);
+      if (pids[i] > 0)
+        waitpid(pids[i], nullptr, 0);
+    }
+
+    return res;
+  }
+
+  pid_t
+  ForkBrancher::spawn(SynacorVM* vm, const string& input, int& fd) const
+  {
+    int pipefd[2];
+    if (pipe(pipefd) != 0)
+      return -1;
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+      close(pipefd[0]);
+      close(pipefd[1]);
+      return -1;
+    }
+
+    if (pid == 0)
+    {
+      close(pipefd[0]);
+
+      Branch branch = capture(vm, input);
+
+      BranchWriter so;
+      so.put(branch.hash);
+      so.put(branch.ip);
+      so.put(branch.sp);
+      so.put(branch.reg);
+      so.put(branch.waiting);
+      so.put(branch.stack.data(), branch.stack.size() * sizeof(u16));
+      so.put(branch.delta.data(), branch.delta.size() * sizeof(pair<u16, u16>));
+      so.put(branch.output.data(), branch.output.size());
+
+      const u8* p = so.data.data();
+      for (size_t n = so.data.size(); n > 0; )
+      {
+        ssize_t written = write(pipefd[1], p, n);
+        if (written < 0 && errno == EINTR)
+          continue;
+        if (written <= 0)
+          _exit(1);
+        p += written;
+        n -= written;
+      }
+
+      // skip atexit handlers and stdio buffers shared with the parent
+      _exit(0);
+    }
+
+    close(pipefd[1]);
+    fd = pipefd[0];
+    return pid;
+  }
+
+  // Runs the input on this VM, leaving it at the branch's state
+  Branch
+  ForkBrancher::capture(SynacorVM* vm, const string& input) const
+  {
+    Branch branch;
+
+    size_t p = 0;
+    vm->setInput([&input, &p]() { return p < input.size() ? (int)(u8)input[p++] : InputPending; });
+    vm->setOutput([&branch](u16 c) { branch.output.push_back((char)c); });
+    vm->runUntil(vm->clock() + budget);
+    vm->setInput(nullptr);
+    vm->setOutput(nullptr);
+
+    branch.hash = vm->hash();
+    branch.ip = vm->ip;
+    branch.sp = vm->sp;
+    branch.reg = vm->reg;
+    branch.waiting = vm->isWaiting();
+    branch.stack.assign(vm->stack.begin(), vm->stack.begin() + vm->sp);
+
+    for (size_t i = 0; i < 32768; i++)
+      if (vm->mem[i] != base.mem[i])
+        branch.delta.push_back(make_pair((u16)i, vm->mem[i]));
+
+    return branch;
+  }
+
+  u8
+  ForkBrancher::receive(int fd, Branch& branch) const
+  {
+    vector<u8> data;
+    u8 buffer[65536];
+    while (true)
+    {
+      ssize_t n = read(fd, buffer, sizeof(buffer));
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n < 0)
+        return false;
+      if (n == 0)
+        break;
+      data.insert(end(data), buffer, buffer + n);
+    }
+
+    BranchReader si(data);
+    vector<u8> stack, delta, output;
+    if (!(si.get(branch.hash) && si.get(branch.ip) && si.get(branch.sp) && si.get(branch.reg)
+      && si.get(branch.waiting) && si.get(stack) && si.get(delta) && si.get(output)))
+      return false;
+
+    branch.stack.resize(stack.size() / sizeof(u16));
+    memcpy(branch.stack.data(), stack.data(), branch.stack.size() * sizeof(u16));
+    branch.delta.resize(delta.size() / sizeof(pair<u16, u16>));
+    memcpy((void*)branch.delta.data(), delta.data(), branch.delta.size() * sizeof(pair<u16, u16>));
+    branch.output.assign(begin(output), end(output));
+    return true;
+  }
+
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // VM state after one input, as the difference from a base snapshot
+  typedef struct
+  {
+    u64 hash;
+    u16 ip;
+    u16 sp;
+    array<u16, 8> reg;
+    vector<u16> stack;
+    vector<pair<u16, u16>> delta;
+    string output;
+    u8 waiting;
+  } Branch;
+
+
+  // Tries each input from the VM's current state in a forked child, so the
+  // kernel shares the VM's memory copy-on-write instead of copying a
+  // snapshot per branch. Children send back their state over a pipe.
+  // Only fork from a single-threaded process.
+
+  class ForkBrancher
+  {
+  public:
+    static const u64 DefaultBudget = 1 << 24;
+
+    ForkBrancher(const Snapshot& base, size_t processes = 0, u64 budget = DefaultBudget);
+
+    vector<Branch> run(SynacorVM* vm, const vector<string>& inputs) const;
+
+  private:
+    pid_t spawn(SynacorVM* vm, const string& input, int& fd) const;
+    Branch capture(SynacorVM* vm, const string& input) const;
+    u8 receive(int fd, Branch& branch) const;
+
+  private:
+    const Snapshot& base;
+    size_t processes;
+    u64 budget;
+  };
+
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // FNV-1a over 16-bit words, little-endian byte order
+  inline u64
+  checksum(const u16* data, size_t size, u64 h = 0xcbf29ce484222325)
+  {
+    for (size_t i = 0; i < size; i++)
+    {
+      h = (h ^ (data[i] & 0xFF)) * 0x100000001b3;
+      h = (h ^ (data[i] >> 8)) * 0x100000001b3;
+    }
+    return h;
+  }
+
+  inline u64
+  checksum(const vector<u16>& data)
+  {
+    return checksum(data.data(), data.size());
+  }
+
+}
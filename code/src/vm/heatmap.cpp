@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+
+#include "heatmap.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  void
+  Heatmap::reset()
+  {
+    reads.assign(32768, 0);
+    writes.assign(32768, 0);
+    from = 0;
+    to = UINT64_MAX;
+  }
+
+  static void
+  hottest(ostream& so, const string& title, const vector<u64>& counts, const NameMap& names, size_t top)
+  {
+    vector<u16> addresses;
+    for (u32 i = 0; i < counts.size(); i++)
+      if (counts[i] > 0)
+        addresses.push_back(i);
+
+    top = min(top, addresses.size());
+    partial_sort(begin(addresses), begin(addresses) + top, end(addresses),
+      [&counts](u16 a, u16 b) { return counts[a] > counts[b] || (counts[a] == counts[b] && a < b); });
+
+    u64 total = accumulate(begin(counts), end(counts), u64(0));
+    so << title << ": " << total << " at " << addresses.size() << " addresses" << endl;
+
+    for (size_t i = 0; i < top; i++)
+      so << setw(12) << counts[addresses[i]] << "  " << names.label(addresses[i]) << endl;
+  }
+
+  void
+  Heatmap::report(ostream& so, const NameMap& names, size_t top) const
+  {
+    hottest(so, "writes", writes, names, top);
+    so << endl;
+    hottest(so, "reads", reads, names, top);
+  }
+
+  void
+  Heatmap::csv(ostream& so) const
+  {
+    so << "address,reads,writes" << endl;
+    for (u32 i = 0; i < reads.size(); i++)
+      if (reads[i] || writes[i])
+        so << i << ',' << reads[i] << ',' << writes[i] << endl;
+  }
+
+  void
+  Heatmap::pgm(ostream& so, Access access) const
+  {
+    vector<u64> counts(reads.size(), 0);
+    for (size_t i = 0; i < counts.size(); i++)
+      counts[i] = (access & Reads ? reads[i] : 0) + (access & Writes ? writes[i] : 0);
+
+    double scale = log1p(double(*max_element(begin(counts), end(counts))));
+
+    vector<u8> pixels(counts.size(), 0);
+    for (size_t i = 0; i < counts.size(); i++)
+      if (counts[i] > 0)
+        pixels[i] = max(1, int(255 * log1p(double(counts[i])) / scale));
+
+    so << "P5\n" << ImageWidth << ' ' << ImageHeight << "\n255\n";
+    so.write((const char*)pixels.data(), pixels.size());
+  }
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <iostream>
+#include <vector>
+
+#include "types.hpp"
+#include "namemap.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Reads and writes per address by RMEM and WMEM, counted while the
+  // instruction clock is inside a window.
+
+  class Heatmap
+  {
+  public:
+    typedef enum
+    {
+      Reads = 1,
+      Writes = 2,
+      Accesses = 3,
+    } Access;
+
+    static const u16 ImageWidth = 256;
+    static const u16 ImageHeight = 128;
+
+    Heatmap() { reset(); }
+
+    void reset();
+
+    // count accesses at instruction counts in [from, to) only
+    void setWindow(u64 from, u64 to = UINT64_MAX) { this->from = from; this->to = to; }
+
+    void read(u16 address, u64 tick)
+    {
+      if (tick >= from && tick < to)
+        reads[address & 0x7FFF]++;
+    }
+
+    void write(u16 address, u64 tick)
+    {
+      if (tick >= from && tick < to)
+        writes[address & 0x7FFF]++;
+    }
+
+    u64 readCount(u16 address) const { return reads[address & 0x7FFF]; }
+    u64 writeCount(u16 address) const { return writes[address & 0x7FFF]; }
+
+    // most written and most read addresses
+    void report(ostream& so, const NameMap& names = NameMap(), size_t top = 20) const;
+
+    // "address,reads,writes" for every address accessed
+    void csv(ostream& so) const;
+
+    // binary greymap, one pixel per address in rows of 256, brightness
+    // on a log scale of the access count
+    void pgm(ostream& so, Access access = Accesses) const;
+
+  private:
+    vector<u64> reads;
+    vector<u64> writes;
+    u64 from;
+    u64 to;
+  };
+
+}
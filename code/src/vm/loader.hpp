@@ -1,20 +1,31 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "memory.hpp"
 
 namespace paiv
 {
+  using namespace std;
+
   class ImageLoader
   {
   public:
     vector<u16> read(const string& fileName) const
     {
-      ifstream ifs(fileName, ios::binary | ios::ate);
+      MappedFile file;
+      if (!file.open(fileName))
+        return vector<u16>();
 
-      auto size = ifs.tellg();
-      ifs.seekg(0, ios::beg);
-
-      vector<u16> res(size / 2);
-      ifs.read((char*)&res[0], size/2*2);
+      return read(file);
+    }
 
-      return res;
+    vector<u16> read(const MappedFile& file) const
+    {
+      auto p = (const u16*)file.data();
+      return vector<u16>(p, p + file.size() / 2);
     }
 
     template<size_t N>
@@ -24,6 +35,13 @@ namespace paiv
       return vector<u16>((u16*)&raw[0], (u16*)&raw[N/2*2]);
     }
 
+    template<size_t N>
+    inline vector<u16>
+    read(const u16 (&raw)[N]) const
+    {
+      return vector<u16>(&raw[0], &raw[N]);
+    }
+
     inline vector<u16>
     read(const vector<u8>& raw) const
     {
@@ -1,9 +1,16 @@
+#include <algorithm>
 #include <array>
+#include <cstring>
+#include <fcntl.h>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <numeric>
 #include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #include <vector>
 #include <zmq.hpp>
@@ -12,24 +19,251 @@ using namespace std;
 
 #include "types.hpp"
 #include "opcodes.hpp"
+#include "memory.hpp"
 #include "loader.hpp"
-#include "vm.cpp"
+#include "hash.hpp"
+#include "vm.hpp"
+#include "replay.hpp"
+#include "warm.hpp"
+#include "profiler.hpp"
+#include "coverage.hpp"
+#include "heatmap.hpp"
+#include "trace.hpp"
+#include "watchdog.hpp"
 
 using namespace paiv;
 
+#ifdef SYNACOR_EMBED_IMAGE
+#include "embedded_image.hpp"
+#endif
+
 int main(int argc, char* argv[])
 {
-  if (argc < 2)
+  string recordFn;
+  string replayFn;
+  string profileFn;
+  string foldedFn;
+  string namesFn;
+  string coverageFn;
+  string heatmapFn;
+  string heatmapImageFn;
+  string traceFn;
+  u64 windowFrom = 0;
+  u64 windowTo = UINT64_MAX;
+  u64 sampleInterval = Profiler::DefaultSampleInterval;
+  u64 seekTick = UINT64_MAX;
+  u8 cold = false;
+  u8 watch = true;
+  vector<string> breakTexts;
+
+  int argi = 1;
+  for (; argi < argc; argi++)
   {
-    cout << "usage: vm <image>" << endl;
-    return 0;
+    string arg = argv[argi];
+    if (arg == "--cold")
+      cold = true;
+    else if (arg == "--no-watchdog")
+      watch = false;
+    else if (arg == "--break-text" && argi + 1 < argc)
+      breakTexts.push_back(argv[++argi]);
+    else if (arg == "--record" && argi + 1 < argc)
+      recordFn = argv[++argi];
+    else if (arg == "--replay" && argi + 1 < argc)
+      replayFn = argv[++argi];
+    else if (arg == "--seek" && argi + 1 < argc)
+      seekTick = stoull(argv[++argi]);
+    else if (arg == "--profile" && argi + 1 < argc)
+      profileFn = argv[++argi];
+    else if (arg == "--folded" && argi + 1 < argc)
+      foldedFn = argv[++argi];
+    else if (arg == "--sample" && argi + 1 < argc)
+      sampleInterval = stoull(argv[++argi]);
+    else if (arg == "--names" && argi + 1 < argc)
+      namesFn = argv[++argi];
+    else if (arg == "--coverage" && argi + 1 < argc)
+      coverageFn = argv[++argi];
+    else if (arg == "--heatmap" && argi + 1 < argc)
+      heatmapFn = argv[++argi];
+    else if (arg == "--heatmap-pgm" && argi + 1 < argc)
+      heatmapImageFn = argv[++argi];
+    else if (arg == "--trace" && argi + 1 < argc)
+      traceFn = argv[++argi];
+    else if (arg == "--window" && argi + 2 < argc)
+    {
+      windowFrom = stoull(argv[++argi]);
+      windowTo = stoull(argv[++argi]);
+    }
+    else
+      break;
   }
 
   ImageLoader loader;
-  auto image = loader.read(argv[1]);
+  MappedFile imageFile;
+  vector<u16> image;
+
+  if (argi < argc && imageFile.open(argv[argi]))
+  {
+    image = loader.read(imageFile);
+  }
+#ifdef SYNACOR_EMBED_IMAGE
+  else
+  {
+    // already in memory, the warm start cache would only add file I/O
+    image = loader.read(embedded_image);
+    cold = true;
+  }
+#endif
+
+  if (image.size() == 0)
+  {
+    cout << "usage: vm [--cold] [--no-watchdog] [--break-text <text>]... [--record <log>] [--replay <log> [--seek <instr>]] [--profile <report>] [--folded <stacks> [--sample <instr>] [--names <namemap>]] [--coverage <bitmap>] [--heatmap <csv>] [--heatmap-pgm <pgm>] [--window <from> <to>] [--trace <trace>] <image>" << endl;
+    return 0;
+  }
+
+  unique_ptr<SynacorVM> vm(new SynacorVM());
+
+  ReplayLog log;
+  if (replayFn.size() == 0)
+  {
+    WarmStart warm(image);
+    if (!cold && warm.restore(vm.get()))
+      cout << warm.transcript << flush;
+    else if (imageFile.data())
+      vm->load(imageFile);
+    else
+      vm->load(image);
+  }
+  else
+  {
+    if (!log.load(replayFn))
+    {
+      cerr << "failed to load replay " << replayFn << endl;
+      return 1;
+    }
+
+    Replayer replayer(log);
+    if (!replayer.seek(vm.get(), seekTick))
+    {
+      cerr << "failed to seek to " << seekTick << endl;
+      return 1;
+    }
+
+    cerr << "replayed to " << vm->clock() << endl;
+  }
+
+  unique_ptr<Recorder> recorder;
+  if (recordFn.size() > 0)
+  {
+    recorder = unique_ptr<Recorder>(new Recorder(recordFn));
+    if (!recorder->start(vm.get()))
+    {
+      cerr << "failed to record to " << recordFn << endl;
+      return 1;
+    }
+  }
+
+  NameMap names;
+  if (namesFn.size() > 0 && !names.load(namesFn))
+  {
+    cerr << "failed to load names " << namesFn << endl;
+    return 1;
+  }
+
+  Profiler profiler;
+  profiler.setSampleInterval(foldedFn.size() > 0 ? sampleInterval : 0);
+  if (profileFn.size() > 0 || foldedFn.size() > 0)
+  {
+    if (!Profiler::Enabled)
+      cerr << "profiler not built in, configure with -DSYNACOR_PROFILE=ON" << endl;
+    vm->setProfiler(&profiler);
+  }
+
+  Coverage coverage;
+  if (coverageFn.size() > 0)
+    vm->setCoverage(&coverage);
+
+  Heatmap heatmap;
+  heatmap.setWindow(windowFrom, windowTo);
+  if (heatmapFn.size() > 0 || heatmapImageFn.size() > 0)
+    vm->setHeatmap(&heatmap);
+
+  for (auto& text : breakTexts)
+    vm->breakOnText(text);
+
+  Watchdog watchdog;
+  watchdog.setNames(names);
+  if (watch)
+    vm->setWatchdog(&watchdog);
+
+  TraceWriter tracer;
+  if (traceFn.size() > 0)
+  {
+    if (!tracer.open(traceFn))
+    {
+      cerr << "failed to trace to " << traceFn << endl;
+      return 1;
+    }
+    vm->setTracer(&tracer);
+  }
 
-  SynacorVM vm;
-  vm.exec(image);
+  vm->run();
+
+  if (traceFn.size() > 0 && !tracer.close())
+  {
+    cerr << "failed to write trace " << traceFn << endl;
+    return 1;
+  }
+
+  if (coverageFn.size() > 0 && !coverage.accumulate(coverageFn))
+  {
+    cerr << "failed to write coverage " << coverageFn << endl;
+    return 1;
+  }
+
+  if (profileFn.size() > 0 && Profiler::Enabled)
+  {
+    ofstream so(profileFn);
+    auto snapshot = vm->save();
+    profiler.report(so, &snapshot.mem[0]);
+    if (!so.good())
+    {
+      cerr << "failed to write profile " << profileFn << endl;
+      return 1;
+    }
+  }
+
+  if (foldedFn.size() > 0 && Profiler::Enabled)
+  {
+    ofstream so(foldedFn);
+    profiler.folded(so, names);
+    if (!so.good())
+    {
+      cerr << "failed to write stacks " << foldedFn << endl;
+      return 1;
+    }
+  }
+
+  if (heatmapFn.size() > 0)
+  {
+    ofstream so(heatmapFn);
+    heatmap.csv(so);
+    if (!so.good())
+    {
+      cerr << "failed to write heatmap " << heatmapFn << endl;
+      return 1;
+    }
+  }
+
+  if (heatmapImageFn.size() > 0)
+  {
+    ofstream so(heatmapImageFn, ios::binary);
+    heatmap.pgm(so);
+    if (!so.good())
+    {
+      cerr << "failed to write heatmap " << heatmapImageFn << endl;
+      return 1;
+    }
+  }
 
   return 0;
 }
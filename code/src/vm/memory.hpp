@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iterator>
+#include <new>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Read-only view of a whole file
+  class MappedFile
+  {
+  public:
+    MappedFile() : fd(-1), base(nullptr), length(0) {}
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+    u8 open(const string& fn)
+    {
+      close();
+
+      fd = ::open(fn.c_str(), O_RDONLY);
+      if (fd < 0)
+        return false;
+
+      struct stat params;
+      if (fstat(fd, &params) != 0)
+      {
+        close();
+        return false;
+      }
+
+      length = params.st_size;
+      if (length > 0)
+      {
+        void* p = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED)
+        {
+          close();
+          return false;
+        }
+        base = (const u8*)p;
+      }
+
+      return true;
+    }
+
+    void close()
+    {
+      if (base)
+        munmap((void*)base, length);
+      if (fd >= 0)
+        ::close(fd);
+      fd = -1;
+      base = nullptr;
+      length = 0;
+    }
+
+    // Unlinked temporary file holding a copy of the data
+    u8 create(const void* data, size_t size)
+    {
+      close();
+
+      const char* dir = getenv("TMPDIR");
+      string fn = string(dir && *dir ? dir : "/tmp") + "/synacor.XXXXXX";
+      fd = mkstemp(&fn[0]);
+      if (fd < 0)
+        return false;
+      unlink(fn.c_str());
+
+      const u8* p = (const u8*)data;
+      for (size_t n = size; n > 0; )
+      {
+        ssize_t written = write(fd, p, n);
+        if (written <= 0)
+        {
+          close();
+          return false;
+        }
+        p += written;
+        n -= written;
+      }
+
+      length = size;
+      if (length > 0)
+      {
+        void* m = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (m == MAP_FAILED)
+        {
+          close();
+          return false;
+        }
+        base = (const u8*)m;
+      }
+
+      return true;
+    }
+
+    int descriptor() const { return fd; }
+    const u8* data() const { return base; }
+    size_t size() const { return length; }
+
+  private:
+    int fd;
+    const u8* base;
+    size_t length;
+  };
+
+
+  // Fixed-size word array on its own anonymous mapping: untouched pages
+  // cost nothing, clearing drops pages instead of writing zeros, and
+  // a file can be mapped copy-on-write as the initial contents.
+  template<size_t N>
+  class Memory
+  {
+  public:
+    Memory() : words(allocate()) {}
+    Memory(const Memory& other) : words(allocate()) { *this = other; }
+    Memory(Memory&& other) : words(other.words) { other.words = nullptr; }
+    ~Memory() { if (words) munmap(words, Bytes); }
+
+    Memory& operator=(const Memory& other)
+    {
+      if (this != &other)
+        memcpy(words, other.words, Bytes);
+      return *this;
+    }
+
+    u16& operator[](size_t i) { return words[i]; }
+    const u16& operator[](size_t i) const { return words[i]; }
+
+    size_t size() const { return N; }
+
+    u16* begin() { return words; }
+    u16* end() { return words + N; }
+    const u16* begin() const { return words; }
+    const u16* end() const { return words + N; }
+    reverse_iterator<const u16*> rbegin() const { return reverse_iterator<const u16*>(end()); }
+    reverse_iterator<const u16*> rend() const { return reverse_iterator<const u16*>(begin()); }
+
+    void fill(u16 x)
+    {
+      if (x == 0)
+        clear();
+      else
+        std::fill(begin(), end(), x);
+    }
+
+    // the old pages may be gone when the new ones cannot be mapped, and
+    // the words are then not there at all
+    void clear()
+    {
+      void* p = mmap(words, Bytes, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED)
+        throw bad_alloc();
+    }
+
+    // Replaces the contents with the file, sharing its pages until written
+    u8 map(const MappedFile& file)
+    {
+      clear();
+
+      size_t length = file.size() / 2 * 2;
+      if (length > Bytes)
+        length = Bytes;
+      if (length == 0)
+        return true;
+
+      long page = sysconf(_SC_PAGESIZE);
+      size_t mapped = (length + page - 1) / page * page;
+
+      void* p = mmap(words, mapped, PROT_READ | PROT_WRITE, MAP_FIXED | MAP_PRIVATE, file.descriptor(), 0);
+      if (p == MAP_FAILED)
+        return false;
+
+      // words past an odd-sized tail are not part of the image
+      if (file.size() % 2)
+        words[length / 2] = 0;
+
+      return true;
+    }
+
+  private:
+    static const size_t Bytes = N * sizeof(u16);
+
+    static u16* allocate()
+    {
+      void* p = mmap(nullptr, Bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED)
+        throw bad_alloc();
+      return (u16*)p;
+    }
+
+  private:
+    u16* words;
+  };
+
+}
@@ -0,0 +1,52 @@
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "namemap.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  u8
+  NameMap::load(const string& fn)
+  {
+    ifstream si(fn);
+    if (!si.good())
+      return false;
+
+    string line;
+    while (getline(si, line))
+    {
+      istringstream ss(line);
+      u16 address;
+      if (!(ss >> hex >> address))
+        continue;
+
+      string name;
+      getline(ss >> ws, name);
+      while (name.size() > 0 && isspace((u8)name.back()))
+        name.pop_back();
+
+      if (name.size() > 0)
+        names[address] = name;
+    }
+
+    return true;
+  }
+
+  string
+  NameMap::label(u16 address) const
+  {
+    stringstream so;
+    so << setfill('0') << setw(4) << hex << uppercase << address;
+
+    auto it = names.find(address);
+    if (it != end(names))
+      so << ' ' << it->second;
+
+    return so.str();
+  }
+
+}
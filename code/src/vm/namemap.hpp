@@ -0,0 +1,27 @@
+#pragma once
+
+#include <map>
+#include <string>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Address names, one per line: hex address, then the name
+  //   05B2  print secure string
+
+  class NameMap
+  {
+  public:
+    u8 load(const string& fn);
+
+    // "05B2 print secure string", or "05B2" for an unnamed address
+    string label(u16 address) const;
+
+    map<u16, string> names;
+  };
+
+}
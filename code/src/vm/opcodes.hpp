@@ -1,3 +1,6 @@
+#pragma once
+
+#include "types.hpp"
 
 namespace paiv {
 
@@ -96,4 +99,106 @@ namespace paiv {
 
   } Op;
 
+
+  typedef enum : u8
+  {
+    // continues with the next instruction
+    FlowNext,
+    // jmp
+    FlowJump,
+    // jt, jf: jumps or continues
+    FlowBranch,
+    FlowCall,
+    FlowReturn,
+    FlowHalt,
+  } Flow;
+
+  // what an instruction touches besides its register operands
+  typedef enum : u8
+  {
+    EffectPush = 1,
+    EffectPop = 2,
+    EffectRead = 4,
+    EffectWrite = 8,
+    EffectOutput = 16,
+    EffectInput = 32,
+  } Effect;
+
+  // Operands are a, b, c; bit 0 of reads and writes is a. A written
+  // operand is a register, a read one a number or a register.
+
+  typedef struct
+  {
+    Op opcode;
+    const char* name;
+    u8 size;
+    u8 reads;
+    u8 writes;
+    Flow flow;
+    u8 effects;
+  } OpInfo;
+
+  constexpr OpInfo optable[] = {
+    { HALT,  "halt", 1, 0, 0, FlowHalt,   0 },
+    { SET,   "set",  3, 2, 1, FlowNext,   0 },
+    { PUSH,  "push", 2, 1, 0, FlowNext,   EffectPush },
+    { POP,   "pop",  2, 0, 1, FlowNext,   EffectPop },
+    { EQ,    "eq",   4, 6, 1, FlowNext,   0 },
+    { GT,    "gt",   4, 6, 1, FlowNext,   0 },
+    { JMP,   "jmp",  2, 1, 0, FlowJump,   0 },
+    { JT,    "jt",   3, 3, 0, FlowBranch, 0 },
+    { JF,    "jf",   3, 3, 0, FlowBranch, 0 },
+    { ADD,   "add",  4, 6, 1, FlowNext,   0 },
+    { MULT,  "mult", 4, 6, 1, FlowNext,   0 },
+    { MOD,   "mod",  4, 6, 1, FlowNext,   0 },
+    { AND,   "and",  4, 6, 1, FlowNext,   0 },
+    { OR,    "or",   4, 6, 1, FlowNext,   0 },
+    { NOT,   "not",  3, 2, 1, FlowNext,   0 },
+    { RMEM,  "rmem", 3, 2, 1, FlowNext,   EffectRead },
+    { WMEM,  "wmem", 3, 3, 0, FlowNext,   EffectWrite },
+    { CALL,  "call", 2, 1, 0, FlowCall,   EffectPush },
+    { RET,   "ret",  1, 0, 0, FlowReturn, EffectPop },
+    { OUT,   "out",  2, 1, 0, FlowNext,   EffectOutput },
+    { IN,    "in",   2, 0, 1, FlowNext,   EffectInput },
+    { NOOP,  "noop", 1, 0, 0, FlowNext,   0 },
+  };
+
+  constexpr OpInfo dataInfo = { DATA, "data", 1, 0, 0, FlowNext, 0 };
+
+  constexpr u16 OpCount = sizeof(optable) / sizeof(optable[0]);
+
+  // anything not an opcode is one word of data
+  constexpr const OpInfo&
+  opinfo(u16 opcode)
+  {
+    return opcode < OpCount ? optable[opcode] : dataInfo;
+  }
+
+  constexpr u8
+  isOpcode(u16 opcode)
+  {
+    return opcode < OpCount;
+  }
+
+  constexpr u8
+  opcodesOrdered(u16 i = 0)
+  {
+    return i == OpCount || (optable[i].opcode == i && opcodesOrdered(i + 1));
+  }
+
+  static_assert(opcodesOrdered(), "optable[] is indexed by opcode");
+  static_assert(OpCount == NOOP + 1, "optable[] covers every opcode");
+
+
+  // instruction decoded ahead of time, see embed
+  typedef struct
+  {
+    u16 offset;
+    Op opcode;
+    u8 size;
+    u16 a;
+    u16 b;
+    u16 c;
+  } DecodedOp;
+
 }
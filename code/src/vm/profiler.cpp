@@ -0,0 +1,145 @@
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "profiler.hpp"
+#include "disasm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    u16 start;
+    u16 size;
+    u64 runs;
+    u64 instructions;
+  } Block;
+
+
+  void
+  Profiler::reset()
+  {
+    hits.assign(32768, 0);
+    self.assign(32768, 0);
+    calls.assign(32768, 0);
+    frames.assign(1, 0);
+    total = 0;
+    countdown = interval;
+    samples.clear();
+  }
+
+  static u8
+  endsBlock(Op opcode)
+  {
+    return opinfo(opcode).flow != FlowNext;
+  }
+
+  void
+  Profiler::report(ostream& so, const u16* memory, size_t top) const
+  {
+    Disassembler disasm;
+    auto decode = [&](u16 address) {
+      Operation op = disasm.decode(memory[address], memory[address + 1], memory[address + 2], memory[address + 3]);
+      op.offset = address;
+      return op;
+    };
+    auto percent = [this](u64 n) {
+      stringstream s;
+      s << fixed << setprecision(2) << (total ? 100.0 * n / total : 0) << '%';
+      return s.str();
+    };
+
+    // runs of instructions executed the same number of times, cut after
+    // every jump, call and return
+    vector<Block> blocks;
+    for (u32 p = 0; p < 32768; )
+    {
+      if (hits[p] == 0)
+      {
+        p++;
+        continue;
+      }
+
+      Block block = { (u16)p, 0, hits[p], 0 };
+      while (p < 32768 && hits[p] == block.runs)
+      {
+        auto op = decode(p);
+        block.size++;
+        block.instructions += hits[p];
+        p += op.size;
+        if (endsBlock(op.opcode))
+          break;
+      }
+      blocks.push_back(block);
+    }
+
+    sort(begin(blocks), end(blocks), [](const Block& a, const Block& b) {
+      return a.instructions > b.instructions || (a.instructions == b.instructions && a.start < b.start);
+    });
+
+    vector<u16> functions;
+    for (u32 p = 0; p < 32768; p++)
+      if (self[p] > 0)
+        functions.push_back(p);
+
+    sort(begin(functions), end(functions), [this](u16 a, u16 b) {
+      return self[a] > self[b] || (self[a] == self[b] && a < b);
+    });
+
+    so << "instructions " << dec << total << endl;
+
+    so << endl << "functions by own instructions" << endl;
+    so << setw(12) << right << "self" << setw(9) << "%" << setw(10) << "calls" << "  entry" << endl;
+    for (size_t i = 0; i < functions.size() && i < top; i++)
+    {
+      u16 f = functions[i];
+      so << dec << setfill(' ') << right << setw(12) << self[f] << setw(9) << percent(self[f])
+        << setw(10) << calls[f] << "  ";
+      auto op = decode(f);
+      disasm.format(so, op);
+    }
+
+    so << endl << "blocks by instructions" << endl;
+    for (size_t i = 0; i < blocks.size() && i < top; i++)
+    {
+      auto& block = blocks[i];
+      so << endl << dec << setfill(' ') << right << setw(12) << block.instructions << setw(9)
+        << percent(block.instructions) << "  " << block.runs << " runs" << endl;
+
+      u32 p = block.start;
+      for (u16 n = 0; n < block.size; n++)
+      {
+        auto op = decode(p);
+        so << dec << setfill(' ') << right << setw(12) << hits[p] << setw(11) << ' ';
+        disasm.format(so, op);
+        p += op.size;
+      }
+    }
+
+    so << dec << setfill(' ') << right << nouppercase;
+  }
+
+  void
+  Profiler::folded(ostream& so, const NameMap& names) const
+  {
+    for (auto& sample : samples)
+    {
+      auto& stack = sample.first;
+
+      // the bottom frame is wherever the profiler was attached
+      so << "vm";
+      for (size_t i = 1; i < stack.size(); i++)
+      {
+        string label = names.label(stack[i]);
+        replace(begin(label), end(label), ';', ',');
+        so << ';' << label;
+      }
+
+      so << ' ' << dec << sample.second << endl;
+    }
+  }
+
+}
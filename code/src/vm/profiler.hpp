@@ -0,0 +1,83 @@
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include "types.hpp"
+#include "opcodes.hpp"
+#include "namemap.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Instruction counts per address and per call target. The VM only calls
+  // into it when built with SYNACOR_PROFILE.
+
+  class Profiler
+  {
+  public:
+#ifdef SYNACOR_PROFILE
+    static const u8 Enabled = true;
+#else
+    static const u8 Enabled = false;
+#endif
+
+    static const u64 DefaultSampleInterval = 997;
+
+    Profiler() : interval(DefaultSampleInterval) { reset(); }
+
+    void reset();
+
+    // record the shadow call stack every interval instructions, 0 to stop
+    void setSampleInterval(u64 interval) { this->interval = interval; countdown = interval; }
+
+    // after every retired instruction, with the address it was fetched from
+    // and the instruction pointer it left behind
+    void retire(u16 at, u16 opcode, u16 next)
+    {
+      hits[at & 0x7FFF]++;
+      self[frames.back()]++;
+      total++;
+
+      if (interval && --countdown == 0)
+      {
+        samples[frames]++;
+        countdown = interval;
+      }
+
+      if (opcode == Op::CALL)
+      {
+        calls[next & 0x7FFF]++;
+        frames.push_back(next & 0x7FFF);
+      }
+      else if (opcode == Op::RET && frames.size() > 1)
+      {
+        frames.pop_back();
+      }
+    }
+
+    u64 instructions() const { return total; }
+    u64 count(u16 address) const { return hits[address]; }
+
+    // hottest straight-line blocks and functions, disassembled from memory
+    void report(ostream& so, const u16* memory, size_t top = 20) const;
+
+    // sampled call stacks in folded form, one "outer;...;inner count" per
+    // line, as read by flamegraph.pl and compatible tools
+    void folded(ostream& so, const NameMap& names = NameMap()) const;
+
+  private:
+    vector<u64> hits;
+    vector<u64> self;
+    vector<u64> calls;
+    vector<u16> frames;
+    u64 total;
+    u64 interval;
+    u64 countdown;
+    map<vector<u16>, u64> samples;
+  };
+
+}
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "replay.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Replay log: signature, then a stream of varint-encoded records
+  //   (tick delta << 1 | 0), char   - input character consumed by IN
+  //   (tick delta << 1 | 1), seq    - checkpoint snapshot saved to <log>.<seq>
+
+  static const Signature SIGNreplay = { "SYNREPL" };
+
+  static void
+  writeVarint(ostream& so, u64 x)
+  {
+    while (x >= 0x80)
+    {
+      so.put((char)(x | 0x80));
+      x >>= 7;
+    }
+    so.put((char)x);
+  }
+
+  static u8
+  readVarint(istream& si, u64& x)
+  {
+    x = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+      int c = si.get();
+      if (c == EOF)
+        return false;
+      x |= (u64)(c & 0x7F) << shift;
+      if (!(c & 0x80))
+        return true;
+    }
+    return false;
+  }
+
+  static string
+  checkpointFilename(const string& log, u64 seq)
+  {
+    stringstream so;
+    so << log << '.' << setfill('0') << setw(4) << hex << seq;
+    return so.str();
+  }
+
+
+  u8
+  ReplayLog::load(const string& fn)
+  {
+    ifstream ifs(fn, ios::binary);
+    if (!ifs.good())
+      return false;
+
+    Signature sign;
+    ifs.read(&sign.chars[0], sizeof(Signature));
+    if (!ifs.good() || sign.word != SIGNreplay.word)
+      return false;
+
+    inputs.clear();
+    checkpoints.clear();
+
+    u64 tick = 0;
+    u64 record;
+
+    while (readVarint(ifs, record))
+    {
+      tick += record >> 1;
+
+      if (record & 1)
+      {
+        u64 seq;
+        if (!readVarint(ifs, seq))
+          return false;
+        checkpoints.push_back({ tick, inputs.size(), checkpointFilename(fn, seq) });
+      }
+      else
+      {
+        int c = ifs.get();
+        if (c == EOF)
+          return false;
+        inputs.push_back({ tick, (u16)c });
+      }
+    }
+
+    this->fn = fn;
+    return checkpoints.size() > 0;
+  }
+
+  u64
+  ReplayLog::lastTick() const
+  {
+    if (inputs.size() > 0)
+      return inputs.back().tick + 1;
+    if (checkpoints.size() > 0)
+      return checkpoints.back().tick;
+    return 0;
+  }
+
+
+  u8
+  Recorder::start(SynacorVM* vm, const InputSource& source)
+  {
+    log.open(fn, ios::binary | ios::trunc);
+    if (!log.good())
+      return false;
+
+    log.write(SIGNreplay.chars, sizeof(SIGNreplay));
+
+    this->source = source;
+    lastTick = vm->clock();
+
+    if (!checkpoint(vm))
+      return false;
+
+    vm->setInput([this, vm]() { return record(vm); });
+    return true;
+  }
+
+  void
+  Recorder::stop(SynacorVM* vm)
+  {
+    vm->setInput(source);
+    log.close();
+  }
+
+  int
+  Recorder::record(SynacorVM* vm)
+  {
+    // the state was replaced under the recorder, and the clock went back
+    if (log.is_open() && vm->clock() < lastTick)
+    {
+      cerr << "recording to " << fn << " stopped, the machine went back to " << vm->clock() << endl;
+      log.close();
+    }
+    if (!log.is_open())
+      return source ? source() : vm->readStdin();
+
+    // called from inside IN, before the instruction retires: a snapshot
+    // taken here restores to the same IN with the same input position
+    if (vm->clock() - lastCheckpoint >= interval)
+      checkpoint(vm);
+
+    int c = source ? source() : vm->readStdin();
+    if (c == InputPending)
+      return c;
+    if (c == EOF)
+    {
+      log.flush();
+      return c;
+    }
+
+    u64 tick = vm->clock();
+    writeVarint(log, (tick - lastTick) << 1);
+    log.put((char)c);
+    lastTick = tick;
+    inputCount++;
+
+    if (c == '\n')
+      log.flush();
+
+    return c;
+  }
+
+  u8
+  Recorder::checkpoint(SynacorVM* vm)
+  {
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    snapshot->take(vm);
+    if (!snapshot->save(checkpointFilename(fn, checkpointCount)))
+    {
+      cerr << "failed to save checkpoint " << checkpointFilename(fn, checkpointCount) << endl;
+      return false;
+    }
+
+    u64 tick = vm->clock();
+    writeVarint(log, (tick - lastTick) << 1 | 1);
+    writeVarint(log, checkpointCount);
+    log.flush();
+
+    lastTick = tick;
+    lastCheckpoint = tick;
+    checkpointCount++;
+    return true;
+  }
+
+
+  u8
+  Replayer::seek(SynacorVM* vm, u64 tick)
+  {
+    tick = min(tick, log.lastTick());
+
+    auto it = upper_bound(begin(log.checkpoints), end(log.checkpoints), tick,
+      [](u64 t, const Checkpoint& cp) { return t < cp.tick; });
+
+    if (it == begin(log.checkpoints))
+      return false;
+    auto& cp = *prev(it);
+
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    if (!snapshot->load(cp.fn))
+    {
+      cerr << "failed to load checkpoint " << cp.fn << endl;
+      return false;
+    }
+    snapshot->ticks = cp.tick;
+
+    vm->load(*snapshot);
+    vm->setInput([this, vm]() { return next(vm); });
+    vm->setOutput([](u16) {});
+
+    cursor = cp.input;
+    vm->runUntil(tick);
+
+    vm->setInput(nullptr);
+    vm->setOutput(nullptr);
+
+    return vm->clock() == tick;
+  }
+
+  int
+  Replayer::next(SynacorVM* vm)
+  {
+    if (cursor >= log.inputs.size())
+      return EOF;
+
+    auto& event = log.inputs[cursor++];
+    if (event.tick != vm->clock())
+      cerr << "replay diverged at " << vm->clock() << ", expected input at " << event.tick << endl;
+
+    return event.c;
+  }
+
+}
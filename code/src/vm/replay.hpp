@@ -0,0 +1,88 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    u64 tick;
+    u16 c;
+  } InputEvent;
+
+  typedef struct
+  {
+    u64 tick;
+    size_t input;
+    string fn;
+  } Checkpoint;
+
+
+  class ReplayLog
+  {
+  public:
+    u8 load(const string& fn);
+
+    u64 lastTick() const;
+
+    string fn;
+    vector<InputEvent> inputs;
+    vector<Checkpoint> checkpoints;
+  };
+
+
+  class Recorder
+  {
+  public:
+    static const u64 DefaultInterval = 1 << 20;
+
+    Recorder(const string& fn, u64 interval = DefaultInterval)
+      : fn(fn), interval(interval), lastTick(0), lastCheckpoint(0), inputCount(0), checkpointCount(0)
+    {
+    }
+
+    u8 start(SynacorVM* vm, const InputSource& source = nullptr);
+
+    // gives the machine back its input, from the thread running it; the
+    // log ends where the machine's state is replaced
+    void stop(SynacorVM* vm);
+
+  private:
+    int record(SynacorVM* vm);
+    u8 checkpoint(SynacorVM* vm);
+
+  private:
+    string fn;
+    ofstream log;
+    u64 interval;
+    u64 lastTick;
+    u64 lastCheckpoint;
+    u64 inputCount;
+    u64 checkpointCount;
+    InputSource source;
+  };
+
+
+  class Replayer
+  {
+  public:
+    Replayer(const ReplayLog& log) : log(log), cursor(0) {}
+
+    u8 seek(SynacorVM* vm, u64 tick);
+
+  private:
+    int next(SynacorVM* vm);
+
+  private:
+    const ReplayLog& log;
+    size_t cursor;
+  };
+
+}
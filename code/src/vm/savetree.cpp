@@ -0,0 +1,131 @@
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "savetree.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  static string
+  escape(const string& text)
+  {
+    string res;
+    for (char c : text)
+    {
+      if (c == '\n')
+        res += "\\n";
+      else if (c == '\\')
+        res += "\\\\";
+      else
+        res += c;
+    }
+    return res;
+  }
+
+  static string
+  unescape(const string& text)
+  {
+    string res;
+    for (size_t i = 0; i < text.size(); i++)
+    {
+      if (text[i] == '\\' && i + 1 < text.size())
+        res += text[++i] == 'n' ? '\n' : text[i];
+      else
+        res += text[i];
+    }
+    return res;
+  }
+
+
+  SavepointTree::SavepointTree(const string& fn)
+    : fn(fn)
+  {
+  }
+
+  u8
+  SavepointTree::open()
+  {
+    nodes.clear();
+    byName.clear();
+
+    ifstream ifs(fn);
+    for (string line; getline(ifs, line); )
+    {
+      Savepoint node;
+      stringstream si(line);
+      if (!(si >> node.name >> node.parent >> hex >> node.hash))
+        continue;
+      if (node.parent == "-")
+        node.parent.clear();
+
+      si.get();
+      string input;
+      getline(si, input);
+      node.input = unescape(input);
+
+      byName[node.name] = nodes.size();
+      nodes.push_back(node);
+    }
+
+    return true;
+  }
+
+  u8
+  SavepointTree::add(const Savepoint& node)
+  {
+    ofstream ofs(fn, ios::app);
+    ofs << node.name << ' ' << (node.parent.size() > 0 ? node.parent : "-") << ' '
+      << setfill('0') << setw(16) << hex << node.hash << ' ' << escape(node.input) << endl;
+    if (!ofs.good())
+      return false;
+
+    byName[node.name] = nodes.size();
+    nodes.push_back(node);
+    return true;
+  }
+
+  const Savepoint*
+  SavepointTree::find(const string& name) const
+  {
+    auto it = byName.find(name);
+    return it != byName.end() ? &nodes[it->second] : nullptr;
+  }
+
+  vector<const Savepoint*>
+  SavepointTree::children(const string& name) const
+  {
+    vector<const Savepoint*> res;
+    for (auto& node : nodes)
+      if (node.parent == name)
+        res.push_back(&node);
+    return res;
+  }
+
+  void
+  SavepointTree::print(ostream& so, const string& current) const
+  {
+    // saves whose parent is gone are roots as well
+    for (auto& node : nodes)
+      if (node.parent.empty() || !find(node.parent))
+        print(so, current, &node, 0);
+  }
+
+  void
+  SavepointTree::print(ostream& so, const string& current, const Savepoint* node, size_t depth) const
+  {
+    string input = escape(node->input);
+    if (input.size() > 60)
+      input = "..." + input.substr(input.size() - 57);
+
+    so << (node->name == current ? "* " : "  ") << string(2 * depth, ' ') << node->name
+      << "  " << setfill('0') << setw(16) << hex << node->hash << dec
+      << (input.size() > 0 ? "  " + input : "") << endl;
+
+    for (auto child : children(node->name))
+      print(so, current, child, depth + 1);
+  }
+
+}
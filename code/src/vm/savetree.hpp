@@ -0,0 +1,52 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // A save in the store, with the save it was made from, the input the
+  // game read in between, and the hash of the machine state
+  typedef struct
+  {
+    string name;
+    string parent;
+    u64 hash;
+    string input;
+  } Savepoint;
+
+
+  // History of saves as a tree, kept next to the store as lines of
+  // "name parent hash input", input escaped, appended as saves are made.
+
+  class SavepointTree
+  {
+  public:
+    SavepointTree(const string& fn);
+
+    u8 open();
+    u8 add(const Savepoint& node);
+
+    const Savepoint* find(const string& name) const;
+    vector<const Savepoint*> children(const string& name) const;
+
+    // indented by depth, current marked, and the input that led to each
+    void print(ostream& so, const string& current) const;
+
+  private:
+    void print(ostream& so, const string& current, const Savepoint* node, size_t depth) const;
+
+  private:
+    string fn;
+    vector<Savepoint> nodes;
+    unordered_map<string, size_t> byName;
+  };
+
+}
@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <iomanip>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "scanner.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  void
+  Scanner::start(const u16* memory)
+  {
+    fill(begin(mask), end(mask), 0xFFFF);
+    copy(memory, memory + previous.size(), begin(previous));
+    started = true;
+  }
+
+  static u8
+  holds(Scanner::Predicate predicate, u16 now, u16 before, u16 value)
+  {
+    switch (predicate)
+    {
+      case Scanner::Changed:    return now != before;
+      case Scanner::Unchanged:  return now == before;
+      case Scanner::Increased:  return now > before;
+      case Scanner::Decreased:  return now < before;
+      case Scanner::Equals:     return now == value;
+    }
+    return false;
+  }
+
+  size_t
+  Scanner::narrow(const u16* memory, Predicate predicate, u16 value)
+  {
+    if (!started)
+      start(memory);
+
+    size_t i = 0;
+    size_t size = mask.size();
+
+#ifdef __SSE2__
+    // unsigned words compare as signed once their top bits are flipped
+    const __m128i top = _mm_set1_epi16((short)0x8000);
+    const __m128i x = _mm_set1_epi16(value);
+
+    for (; i + 8 <= size; i += 8)
+    {
+      __m128i now = _mm_loadu_si128((const __m128i*)(memory + i));
+      __m128i before = _mm_loadu_si128((const __m128i*)&previous[i]);
+      __m128i keep;
+
+      switch (predicate)
+      {
+        case Changed:
+          keep = _mm_andnot_si128(_mm_cmpeq_epi16(now, before), _mm_set1_epi16(-1));
+          break;
+        case Unchanged:
+          keep = _mm_cmpeq_epi16(now, before);
+          break;
+        case Increased:
+          keep = _mm_cmpgt_epi16(_mm_xor_si128(now, top), _mm_xor_si128(before, top));
+          break;
+        case Decreased:
+          keep = _mm_cmplt_epi16(_mm_xor_si128(now, top), _mm_xor_si128(before, top));
+          break;
+        default:
+          keep = _mm_cmpeq_epi16(now, x);
+          break;
+      }
+
+      __m128i* m = (__m128i*)&mask[i];
+      _mm_storeu_si128(m, _mm_and_si128(_mm_loadu_si128(m), keep));
+      _mm_storeu_si128((__m128i*)&previous[i], now);
+    }
+#endif
+
+    for (; i < size; i++)
+    {
+      if (!holds(predicate, memory[i], previous[i], value))
+        mask[i] = 0;
+      previous[i] = memory[i];
+    }
+
+    return count();
+  }
+
+  size_t
+  Scanner::count() const
+  {
+    return started ? std::count(begin(mask), end(mask), 0xFFFF) : 0;
+  }
+
+  vector<u16>
+  Scanner::candidates() const
+  {
+    vector<u16> res;
+    for (u32 i = 0; started && i < mask.size(); i++)
+      if (mask[i])
+        res.push_back(i);
+    return res;
+  }
+
+  void
+  Scanner::report(ostream& so, size_t top) const
+  {
+    auto addresses = candidates();
+    so << addresses.size() << " candidates" << endl;
+
+    so << setfill('0') << hex;
+    for (size_t i = 0; i < addresses.size() && i < top; i++)
+      so << setw(4) << addresses[i] << ": " << setw(4) << previous[addresses[i]] << endl;
+    so << setfill(' ') << dec;
+  }
+
+  u8
+  Scanner::parse(const string& name, Predicate& predicate)
+  {
+    if (name == "changed")
+      predicate = Changed;
+    else if (name == "unchanged")
+      predicate = Unchanged;
+    else if (name == "inc")
+      predicate = Increased;
+    else if (name == "dec")
+      predicate = Decreased;
+    else if (name == "eq")
+      predicate = Equals;
+    else
+      return false;
+    return true;
+  }
+
+}
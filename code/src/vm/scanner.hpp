@@ -0,0 +1,51 @@
+#pragma once
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Narrows the addresses that may hold a game variable: each new memory
+  // image keeps the candidates whose value compares with the previous
+  // image as asked, then becomes the previous image.
+
+  class Scanner
+  {
+  public:
+    typedef enum
+    {
+      Changed,
+      Unchanged,
+      Increased,
+      Decreased,
+      Equals,
+    } Predicate;
+
+    Scanner() : mask(32768, 0), previous(32768, 0), started(false) {}
+
+    void start(const u16* memory);
+    size_t narrow(const u16* memory, Predicate predicate, u16 value = 0);
+
+    u8 isStarted() const { return started; }
+    size_t count() const;
+    vector<u16> candidates() const;
+
+    // the first candidates with their values
+    void report(ostream& so, size_t top = 32) const;
+
+    // "changed", "unchanged", "inc", "dec" or "eq"
+    static u8 parse(const string& name, Predicate& predicate);
+
+  private:
+    vector<u16> mask;
+    vector<u16> previous;
+    u8 started;
+  };
+
+}
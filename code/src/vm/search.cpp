@@ -0,0 +1,95 @@
+#include <algorithm>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "search.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  MemorySearch::MemorySearch(const vector<u16>& words)
+    : pattern(words), keyed(words.size(), false), anchor(0)
+  {
+  }
+
+  MemorySearch::MemorySearch(const string& text, u8 prefixed, u8 obfuscated)
+    : anchor(prefixed ? 1 : 0)
+  {
+    if (prefixed)
+    {
+      pattern.push_back(text.size());
+      keyed.push_back(false);
+    }
+
+    for (char c : text)
+    {
+      pattern.push_back((u8)c);
+      keyed.push_back(obfuscated);
+    }
+  }
+
+  vector<SearchHit>
+  MemorySearch::find(const u16* memory, size_t size) const
+  {
+    vector<SearchHit> hits;
+    size_t n = pattern.size();
+    if (n == 0 || size < n)
+      return hits;
+
+    u8 anyKey = anchor < n && keyed[anchor];
+    size_t last = size - n;
+
+    // a copy with room to read eight words past any start
+    vector<u16> words(memory, memory + size);
+    words.resize(size + n + 8, 0);
+    const u16* mem = words.data();
+
+    auto check = [&](size_t i) {
+      u16 key = anyKey ? mem[i + anchor] ^ pattern[anchor] : 0;
+      for (size_t k = 0; k < n; k++)
+        if ((mem[i + k] ^ (keyed[k] ? key : 0)) != pattern[k])
+          return;
+      hits.push_back(SearchHit{ (u16)i, key });
+    };
+
+    size_t i = 0;
+
+#ifdef __SSE2__
+    for (; i + 8 <= last + 1; i += 8)
+    {
+      __m128i key = _mm_setzero_si128();
+      if (anyKey)
+        key = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(mem + i + anchor)), _mm_set1_epi16(pattern[anchor]));
+
+      __m128i all = _mm_set1_epi16(-1);
+      for (size_t k = 0; k < n; k++)
+      {
+        if (anyKey && k == anchor)
+          continue;
+
+        __m128i v = _mm_loadu_si128((const __m128i*)(mem + i + k));
+        if (keyed[k])
+          v = _mm_xor_si128(v, key);
+
+        all = _mm_and_si128(all, _mm_cmpeq_epi16(v, _mm_set1_epi16(pattern[k])));
+        if (_mm_movemask_epi8(all) == 0)
+          break;
+      }
+
+      int mask = _mm_movemask_epi8(all);
+      for (int lane = 0; mask && lane < 8; lane++, mask >>= 2)
+        if (mask & 1)
+          hits.push_back(SearchHit{ (u16)(i + lane), anyKey ? (u16)(mem[i + lane + anchor] ^ pattern[anchor]) : (u16)0 });
+    }
+#endif
+
+    for (; i <= last; i++)
+      check(i);
+
+    return hits;
+  }
+
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    u16 address;
+    u16 key;
+  } SearchHit;
+
+
+  // Finds a pattern of words in memory, eight addresses at a time. Text
+  // takes one character per word, after the length word when prefixed,
+  // and when obfuscated may be XOR-ed with any key: the key is taken at
+  // each address from the first character, so every key is tried in a
+  // single pass.
+
+  class MemorySearch
+  {
+  public:
+    MemorySearch(const vector<u16>& words);
+    MemorySearch(const string& text, u8 prefixed = false, u8 obfuscated = false);
+
+    vector<SearchHit> find(const u16* memory, size_t size) const;
+
+    size_t size() const { return pattern.size(); }
+
+  private:
+    vector<u16> pattern;
+    vector<u8> keyed;
+    size_t anchor;
+  };
+
+}
@@ -0,0 +1,548 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <unordered_set>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "store.hpp"
+#include "hash.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // manifest: registers, ip, sp, ticks, base, page count, then the stack
+  // and four words of hash per page
+  static const size_t ManifestHeader = 8 + 2 + 4 + 4 + 1;
+
+  static const size_t ObjectHeader = 8 + 4;
+
+  static u8
+  readAt(int fd, void* data, size_t size, u64 offset)
+  {
+    u8* p = (u8*)data;
+    while (size > 0)
+    {
+      ssize_t n = pread(fd, p, size, offset);
+      if (n <= 0)
+        return false;
+      p += n;
+      size -= n;
+      offset += n;
+    }
+    return true;
+  }
+
+  static u8
+  writeAt(int fd, const void* data, size_t size, u64 offset)
+  {
+    const u8* p = (const u8*)data;
+    while (size > 0)
+    {
+      ssize_t n = pwrite(fd, p, size, offset);
+      if (n <= 0)
+        return false;
+      p += n;
+      size -= n;
+      offset += n;
+    }
+    return true;
+  }
+
+  static void
+  putWide(vector<u16>& words, u64 x)
+  {
+    for (u8 i = 0; i < 4; i++)
+      words.push_back(x >> (16 * i));
+  }
+
+  static u64
+  getWide(const u16* words)
+  {
+    u64 x = 0;
+    for (u8 i = 0; i < 4; i++)
+      x |= u64(words[i]) << (16 * i);
+    return x;
+  }
+
+
+  SnapshotStore::SnapshotStore(const string& dir)
+    : dir(dir), pack(-1), packSize(0), next(0)
+  {
+  }
+
+  SnapshotStore::~SnapshotStore()
+  {
+    close();
+  }
+
+  u8
+  SnapshotStore::open()
+  {
+    close();
+
+    for (size_t i = dir.find('/'); i != string::npos; i = dir.find('/', i + 1))
+      mkdir(dir.substr(0, i).c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+    mkdir(dir.c_str(), S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+
+    pack = ::open((dir + "/pack").c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (pack < 0)
+    {
+      cerr << "failed to open snapshot store " << dir << endl;
+      return false;
+    }
+
+    return readPack() && readIndex();
+  }
+
+  void
+  SnapshotStore::close()
+  {
+    if (pack >= 0)
+      ::close(pack);
+    pack = -1;
+    packSize = 0;
+    entries.clear();
+    byName.clear();
+    byTag.clear();
+    objects.clear();
+    next = 0;
+  }
+
+  u8
+  SnapshotStore::readPack()
+  {
+    struct stat params;
+    if (fstat(pack, &params) != 0)
+      return false;
+
+    u64 size = params.st_size;
+    u64 offset = 0;
+    while (offset + ObjectHeader <= size)
+    {
+      u64 hash;
+      u32 count;
+      if (!readAt(pack, &hash, 8, offset) || !readAt(pack, &count, 4, offset + 8))
+        return false;
+      if (offset + ObjectHeader + count * 2 > size)
+        break;
+
+      objects[hash] = offset;
+      offset += ObjectHeader + count * 2;
+    }
+
+    // the tail of an interrupted write
+    if (offset < size && ftruncate(pack, offset) != 0)
+      return false;
+
+    packSize = offset;
+    return true;
+  }
+
+  u8
+  SnapshotStore::readIndex()
+  {
+    ifstream ifs(dir + "/index");
+    for (string line; getline(ifs, line); )
+    {
+      StoredSave entry;
+      stringstream si(line);
+      if (!(si >> entry.name >> entry.tag >> hex >> entry.manifest))
+        continue;
+      if (entry.tag == "-")
+        entry.tag.clear();
+
+      // names are never reused, even of saves dropped and collected
+      if (entry.name.compare(0, 4, "save") == 0)
+        next = max<u32>(next, strtoul(entry.name.c_str() + 4, nullptr, 16) + 1);
+
+      if (entry.manifest == 0)
+      {
+        auto it = byName.find(entry.name);
+        if (it != byName.end())
+        {
+          entries[it->second].manifest = 0;
+          byName.erase(it);
+        }
+        continue;
+      }
+
+      byName[entry.name] = entries.size();
+      if (entry.tag.size() > 0)
+        byTag[entry.tag] = entries.size();
+      entries.push_back(entry);
+    }
+
+    // a tag names its latest live save
+    for (auto it = byTag.begin(); it != byTag.end(); )
+    {
+      size_t i = it->second + 1;
+      while (i-- > 0 && (entries[i].manifest == 0 || entries[i].tag != it->first))
+        ;
+      if (i < entries.size())
+        (it++)->second = i;
+      else
+        it = byTag.erase(it);
+    }
+
+    return true;
+  }
+
+  u8
+  SnapshotStore::put(const vector<u16>& object, u64& hash)
+  {
+    hash = checksum(object);
+
+    // an object is kept once per hash, and different contents with the
+    // same hash cannot be stored at all
+    if (objects.find(hash) != objects.end())
+    {
+      vector<u16> stored;
+      if (get(hash, stored) && stored == object)
+        return true;
+      cerr << "store: hash collision on " << setfill('0') << setw(16) << hex << hash << dec << endl;
+      return false;
+    }
+
+    u32 count = object.size();
+    if (!writeAt(pack, &hash, 8, packSize)
+      || !writeAt(pack, &count, 4, packSize + 8)
+      || !writeAt(pack, object.data(), count * 2, packSize + ObjectHeader))
+      return false;
+
+    objects[hash] = packSize;
+    packSize += ObjectHeader + count * 2;
+    return true;
+  }
+
+  u8
+  SnapshotStore::get(u64 hash, vector<u16>& object) const
+  {
+    auto it = objects.find(hash);
+    if (it == objects.end())
+      return false;
+
+    u32 count;
+    if (!readAt(pack, &count, 4, it->second + 8) || it->second + ObjectHeader + count * (u64)2 > packSize)
+      return false;
+
+    object.resize(count);
+    return readAt(pack, object.data(), count * 2, it->second + ObjectHeader);
+  }
+
+  static string
+  indexLine(const StoredSave& entry)
+  {
+    stringstream so;
+    so << entry.name << ' ' << (entry.tag.size() > 0 ? entry.tag : "-") << ' '
+      << setfill('0') << setw(16) << hex << entry.manifest << '\n';
+    return so.str();
+  }
+
+  u8
+  SnapshotStore::append(const StoredSave& entry)
+  {
+    int fd = ::open((dir + "/index").c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0)
+      return false;
+
+    string line = indexLine(entry);
+    u8 ok = write(fd, line.data(), line.size()) == (ssize_t)line.size() && fsync(fd) == 0;
+    ::close(fd);
+    return ok;
+  }
+
+  static string
+  saveName(u32 number)
+  {
+    stringstream so;
+    so << "save" << setfill('0') << setw(4) << hex << number;
+    return so.str();
+  }
+
+  string
+  SnapshotStore::nextName() const
+  {
+    return saveName(next);
+  }
+
+  string
+  SnapshotStore::save(const Snapshot& snapshot, const string& tag)
+  {
+    Capture capture;
+    capture.reg = snapshot.reg;
+    capture.ip = snapshot.ip;
+    capture.sp = snapshot.sp;
+    capture.ticks = snapshot.ticks;
+    capture.base = snapshot.base;
+    capture.stack.assign(snapshot.stack.begin(), snapshot.stack.begin() + snapshot.sp);
+
+    u16 pages = (snapshot.memoryUsed() + PageWords - 1) / PageWords;
+    for (u16 i = 0; i < pages; i++)
+    {
+      auto p = snapshot.mem.begin() + i * PageWords;
+      capture.pages.push_back(shared_ptr<const vector<u16>>(new vector<u16>(p, p + PageWords)));
+    }
+
+    return save(capture, tag);
+  }
+
+  string
+  SnapshotStore::save(const Capture& capture, const string& tag)
+  {
+    if (pack < 0)
+      return "";
+
+    // memory ends with its last page that is not all zeros
+    size_t pages = capture.pages.size();
+    while (pages > 0 && all_of(begin(*capture.pages[pages - 1]), end(*capture.pages[pages - 1]),
+        [](u16 x) { return x == 0; }))
+      pages--;
+
+    vector<u16> manifest(begin(capture.reg), end(capture.reg));
+    manifest.push_back(capture.ip);
+    manifest.push_back(capture.sp);
+    putWide(manifest, capture.ticks);
+    putWide(manifest, capture.base);
+    manifest.push_back(pages);
+    manifest.insert(end(manifest), begin(capture.stack), end(capture.stack));
+
+    for (size_t i = 0; i < pages; i++)
+    {
+      u64 hash;
+      if (!put(*capture.pages[i], hash))
+        return "";
+      putWide(manifest, hash);
+    }
+
+    StoredSave entry;
+    entry.name = nextName();
+    entry.tag = tag;
+
+    // a manifest of 0 in the index is a drop
+    if (!put(manifest, entry.manifest) || entry.manifest == 0 || fsync(pack) != 0 || !append(entry))
+      return "";
+
+    next++;
+    byName[entry.name] = entries.size();
+    if (tag.size() > 0)
+      byTag[tag] = entries.size();
+    entries.push_back(entry);
+
+    return entry.name;
+  }
+
+  const StoredSave*
+  SnapshotStore::find(const string& key) const
+  {
+    auto it = byName.find(key);
+    if (it != byName.end())
+      return &entries[it->second];
+    it = byTag.find(key);
+    return it != byTag.end() ? &entries[it->second] : nullptr;
+  }
+
+  u8
+  SnapshotStore::load(const string& key, Snapshot& snapshot) const
+  {
+    Capture state;
+    if (!load(key, state))
+      return false;
+
+    snapshot.take(state);
+    snapshot.fn = find(key)->name;
+    return true;
+  }
+
+  u8
+  SnapshotStore::load(const string& key, Capture& state, const Capture* current) const
+  {
+    auto entry = find(key);
+    vector<u16> manifest;
+    if (!entry || !get(entry->manifest, manifest) || manifest.size() < ManifestHeader)
+      return false;
+
+    const u16* p = manifest.data();
+    u16 sp = p[9];
+    u16 pages = p[18];
+    if (manifest.size() != ManifestHeader + sp + pages * 4 || pages > 65536 / PageWords)
+      return false;
+
+    copy(p, p + 8, begin(state.reg));
+    state.ip = p[8];
+    state.sp = sp;
+    state.ticks = getWide(p + 10);
+    state.base = getWide(p + 14);
+    p += ManifestHeader;
+
+    state.stack.assign(p, p + sp);
+    p += sp;
+
+    // pages the current state has the same are left out, and pages past
+    // the saved ones are zeros
+    size_t have = current ? current->pages.size() : 0;
+    auto zeros = make_shared<const vector<u16>>(PageWords, 0);
+    state.pages.assign(max<size_t>(pages, have), nullptr);
+
+    for (size_t i = 0; i < state.pages.size(); i++)
+    {
+      auto old = i < have ? current->pages[i] : nullptr;
+      if (i >= pages)
+      {
+        if (old && any_of(begin(*old), end(*old), [](u16 x) { return x != 0; }))
+          state.pages[i] = zeros;
+        continue;
+      }
+
+      auto page = make_shared<vector<u16>>();
+      if (!get(getWide(p + 4 * i), *page) || page->size() != PageWords)
+        return false;
+
+      // by contents, as a hash match alone does not make them the same
+      if (!old || *old != *page)
+        state.pages[i] = page;
+    }
+
+    state.input.clear();
+    return true;
+  }
+
+  u8
+  SnapshotStore::drop(const string& name)
+  {
+    auto it = byName.find(name);
+    if (it == byName.end())
+      return false;
+
+    size_t at = it->second;
+    StoredSave tombstone = { name, "", 0 };
+    if (!append(tombstone))
+      return false;
+
+    string tag = entries[at].tag;
+    entries[at].manifest = 0;
+    byName.erase(it);
+
+    auto t = byTag.find(tag);
+    if (t != byTag.end() && t->second == at)
+    {
+      size_t i = at;
+      while (i-- > 0 && (entries[i].manifest == 0 || entries[i].tag != tag))
+        ;
+      if (i < entries.size())
+        t->second = i;
+      else
+        byTag.erase(t);
+    }
+
+    return true;
+  }
+
+  u64
+  SnapshotStore::collect()
+  {
+    if (pack < 0)
+      return 0;
+
+    unordered_set<u64> live;
+    vector<u16> manifest;
+    for (auto& entry : entries)
+    {
+      if (entry.manifest == 0 || !get(entry.manifest, manifest) || manifest.size() < ManifestHeader)
+        continue;
+      live.insert(entry.manifest);
+      for (size_t i = ManifestHeader + manifest[9]; i + 4 <= manifest.size(); i += 4)
+        live.insert(getWide(&manifest[i]));
+    }
+
+    vector<pair<u64, u64>> kept;
+    for (auto& object : objects)
+      if (live.count(object.first))
+        kept.push_back(make_pair(object.second, object.first));
+    sort(begin(kept), end(kept));
+
+    // per-process names, so two collectors never write the same file
+    string packFn = dir + "/pack";
+    string indexFn = dir + "/index";
+    string packTmp = packFn + ".tmp" + to_string(getpid());
+    string indexTmp = indexFn + ".tmp" + to_string(getpid());
+    int fd = ::open(packTmp.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+      return 0;
+
+    u64 size = 0;
+    vector<u8> record;
+    for (auto& k : kept)
+    {
+      u32 count = 0;
+      if (!readAt(pack, &count, 4, k.first + 8) || k.first + ObjectHeader + count * (u64)2 > packSize)
+      {
+        cerr << "store: damaged object at " << k.first << " in " << dir << endl;
+        ::close(fd);
+        unlink(packTmp.c_str());
+        return 0;
+      }
+      record.resize(ObjectHeader + count * 2);
+      if (!readAt(pack, record.data(), record.size(), k.first) || !writeAt(fd, record.data(), record.size(), size))
+      {
+        ::close(fd);
+        unlink(packTmp.c_str());
+        return 0;
+      }
+      size += record.size();
+    }
+
+    {
+      ofstream ofs(indexTmp, ios::trunc);
+      for (auto& entry : entries)
+        if (entry.manifest != 0)
+          ofs << indexLine(entry);
+
+      // the last name given stays taken, as a drop
+      string last = saveName(next - 1);
+      if (next > 0 && byName.find(last) == byName.end())
+        ofs << indexLine({ last, "", 0 });
+
+      if (!ofs.good())
+      {
+        ::close(fd);
+        unlink(packTmp.c_str());
+        unlink(indexTmp.c_str());
+        return 0;
+      }
+    }
+
+    // the new pack holds every live save of the old index as well, so
+    // the store is whole between the two renames
+    fsync(fd);
+    ::close(fd);
+    if (rename(packTmp.c_str(), packFn.c_str()) != 0
+      || rename(indexTmp.c_str(), indexFn.c_str()) != 0)
+    {
+      unlink(packTmp.c_str());
+      unlink(indexTmp.c_str());
+      return 0;
+    }
+
+    u64 reclaimed = packSize - size;
+    open();
+    return reclaimed;
+  }
+
+  vector<StoredSave>
+  SnapshotStore::saves() const
+  {
+    vector<StoredSave> res;
+    for (auto& entry : entries)
+      if (entry.manifest != 0)
+        res.push_back(entry);
+    return res;
+  }
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    string name;
+    string tag;
+    u64 manifest;
+  } StoredSave;
+
+
+  // Saves by name, content-addressed underneath. Memory is cut into pages
+  // of PageWords kept once per distinct content, so saves that differ in
+  // a few words share all other pages. A save is a manifest object:
+  // registers, stack and the hashes of its pages.
+  //
+  // The directory holds a pack of objects, each a hash, a length and
+  // words, appended to and never modified, and an index of lines
+  // "name tag manifest", where a manifest of 0 drops the name. Both are
+  // read once on open; collect() rewrites them with only what live saves
+  // refer to.
+
+  class SnapshotStore
+  {
+  public:
+    SnapshotStore(const string& dir);
+    ~SnapshotStore();
+
+    u8 open();
+    void close();
+
+    // name of the new save, empty on failure; written through to disk
+    string save(const Snapshot& snapshot, const string& tag = "");
+    string save(const Capture& capture, const string& tag = "");
+    string nextName() const;
+
+    // by name, or the latest save with the tag
+    u8 load(const string& key, Snapshot& snapshot) const;
+
+    // leaves out the pages the current state has the same
+    u8 load(const string& key, Capture& state, const Capture* current = nullptr) const;
+    const StoredSave* find(const string& key) const;
+
+    u8 drop(const string& name);
+
+    // removes objects no save refers to, and returns the bytes reclaimed
+    u64 collect();
+
+    vector<StoredSave> saves() const;
+    u64 objectCount() const { return objects.size(); }
+
+  private:
+    u8 put(const vector<u16>& object, u64& hash);
+    u8 get(u64 hash, vector<u16>& object) const;
+    u8 append(const StoredSave& entry);
+    u8 readIndex();
+    u8 readPack();
+
+  private:
+    string dir;
+    int pack;
+    u64 packSize;
+    vector<StoredSave> entries;
+    unordered_map<string, size_t> byName;
+    unordered_map<string, size_t> byTag;
+    unordered_map<u64, u64> objects;
+    u32 next;
+  };
+
+}
@@ -0,0 +1,99 @@
+#include <algorithm>
+#include <queue>
+
+#include "textmatch.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  void
+  TextMatcher::add(const string& pattern)
+  {
+    if (pattern.size() > 0 && find(begin(list), end(list), pattern) == end(list))
+    {
+      list.push_back(pattern);
+      build();
+    }
+  }
+
+  u8
+  TextMatcher::remove(const string& pattern)
+  {
+    auto it = find(begin(list), end(list), pattern);
+    if (it == end(list))
+      return false;
+
+    list.erase(it);
+    build();
+    return true;
+  }
+
+  void
+  TextMatcher::clear()
+  {
+    list.clear();
+    build();
+  }
+
+  void
+  TextMatcher::build()
+  {
+    // trie, 0 standing for a missing edge, as nothing leads back to the root
+    next.assign(128, 0);
+    found.assign(1, -1);
+
+    for (size_t i = 0; i < list.size(); i++)
+    {
+      u32 s = 0;
+      for (char ch : list[i])
+      {
+        u32& edge = next[s * 128 + (ch & 0x7F)];
+        if (edge == 0)
+        {
+          edge = found.size();
+          next.resize(next.size() + 128, 0);
+          found.push_back(-1);
+        }
+        s = next[s * 128 + (ch & 0x7F)];
+      }
+      found[s] = i;
+    }
+
+    // breadth first, each state takes the edges its failure state has
+    // where it has none, and the failure state's match when it has none
+    vector<u32> fail(found.size(), 0);
+    queue<u32> pending;
+    for (u32 c = 0; c < 128; c++)
+      if (next[c])
+        pending.push(next[c]);
+
+    while (!pending.empty())
+    {
+      u32 s = pending.front();
+      pending.pop();
+
+      if (found[s] < 0)
+        found[s] = found[fail[s]];
+
+      for (u32 c = 0; c < 128; c++)
+      {
+        u32 t = next[s * 128 + c];
+        u32 f = next[fail[s] * 128 + c];
+        if (t)
+        {
+          fail[t] = f;
+          pending.push(t);
+        }
+        else
+        {
+          next[s * 128 + c] = f;
+        }
+      }
+    }
+
+    state = 0;
+  }
+
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Aho-Corasick automaton over ASCII: every pattern is found as the text
+  // goes by, one table lookup per character however many patterns there
+  // are. Adding or removing a pattern rebuilds the table.
+
+  class TextMatcher
+  {
+  public:
+    TextMatcher() { clear(); }
+
+    void add(const string& pattern);
+    u8 remove(const string& pattern);
+    void clear();
+
+    const vector<string>& patterns() const { return list; }
+    u8 empty() const { return list.empty(); }
+
+    // advance by one character, true when a pattern ends with it
+    u8 feed(u16 c)
+    {
+      state = next[state * 128 + (c & 0x7F)];
+      return found[state] >= 0;
+    }
+
+    // the longest pattern ending at the last character fed
+    const string& matched() const { return list[found[state]]; }
+
+  private:
+    void build();
+
+  private:
+    vector<string> list;
+    vector<u32> next;
+    vector<int> found;
+    u32 state;
+  };
+
+}
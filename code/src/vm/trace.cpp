@@ -0,0 +1,408 @@
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <zlib.h>
+
+#include "trace.hpp"
+#include "opcodes.hpp"
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  static const Signature SIGNtrace = { "SYNTRCE" };
+  static const Signature SIGNindex = { "SYNTIDX" };
+
+  static const u8 ExplicitAddress = 1;
+  static const u8 NewWords = 2;
+
+  static u8
+  length(u16 opcode)
+  {
+    return opinfo(opcode).size;
+  }
+
+  u8
+  traceWrites(u16 opcode)
+  {
+    auto& info = opinfo(opcode);
+    return info.writes != 0 || (info.effects & (EffectPush | EffectWrite | EffectOutput)) != 0;
+  }
+
+  static void
+  put16(vector<u8>& buf, u16 x)
+  {
+    buf.push_back(x & 0xFF);
+    buf.push_back(x >> 8);
+  }
+
+  static void
+  putVarint(vector<u8>& buf, u16 x)
+  {
+    while (x >= 0x80)
+    {
+      buf.push_back((x & 0x7F) | 0x80);
+      x >>= 7;
+    }
+    buf.push_back(x);
+  }
+
+  static u16
+  zigzag(u16 delta)
+  {
+    int16_t d = delta;
+    return (u16(d) << 1) ^ u16(d >> 15);
+  }
+
+  static u16
+  unzigzag(u16 x)
+  {
+    return (x >> 1) ^ u16(-(x & 1));
+  }
+
+  template<typename T>
+  static void
+  put(ofstream& file, const T& x)
+  {
+    file.write((const char*)&x, sizeof(x));
+  }
+
+
+  TraceWriter::TraceWriter()
+    : seen(32768, 0), words(4 * 32768, 0), values(32768, 0), first(0), next(0), count(0), expected(0), block(0)
+  {
+    raw.reserve(8 * BlockSize);
+  }
+
+  TraceWriter::~TraceWriter()
+  {
+    close();
+  }
+
+  u8
+  TraceWriter::open(const string& fn)
+  {
+    file.open(fn, ios::binary | ios::trunc);
+    file.write(SIGNtrace.chars, sizeof(Signature));
+    index.clear();
+    count = 0;
+    return file.good();
+  }
+
+  u8
+  TraceWriter::close()
+  {
+    if (!file.is_open())
+      return false;
+
+    flush();
+
+    u64 offset = file.tellp();
+    for (auto& entry : index)
+    {
+      put(file, entry.offset);
+      put(file, entry.tick);
+      put(file, entry.count);
+    }
+    put(file, offset);
+    put(file, u32(index.size()));
+    file.write(SIGNindex.chars, sizeof(Signature));
+
+    u8 ok = file.good();
+    file.close();
+    return ok;
+  }
+
+  void
+  TraceWriter::retire(u64 tick, u16 ip, u16 opcode, u16 a, u16 b, u16 c, u16 value)
+  {
+    if (count == BlockSize || (count > 0 && tick != next))
+      flush();
+
+    // the machine went back to an earlier state, by a load or a goto, and
+    // what it did after that is no longer its history; the blocks stay in
+    // the file, out of the index, which keeps to increasing ticks
+    if (tick < next)
+    {
+      while (!index.empty() && index.back().tick >= tick)
+        index.pop_back();
+      if (!index.empty() && index.back().tick + index.back().count > tick)
+        index.back().count = tick - index.back().tick;
+    }
+
+    if (count == 0)
+    {
+      first = tick;
+      block++;
+    }
+
+    ip &= 0x7FFF;
+    size_t at = raw.size();
+    raw.push_back(0);
+    u8 flags = 0;
+
+    if (count == 0 || ip != expected)
+    {
+      flags |= ExplicitAddress;
+      put16(raw, ip);
+    }
+
+    u16 instr[4] = { opcode, a, b, c };
+    u8 n = length(opcode);
+    u16* known = &words[4 * ip];
+
+    if (seen[ip] != block)
+    {
+      seen[ip] = block;
+      values[ip] = 0;
+    }
+    else if (equal(instr, instr + n, known))
+    {
+      n = 0;
+    }
+
+    if (n > 0)
+    {
+      flags |= NewWords;
+      raw.push_back(opcode);
+      for (u8 i = 1; i < n; i++)
+        put16(raw, instr[i]);
+      copy(instr, instr + n, known);
+    }
+
+    if (traceWrites(opcode))
+    {
+      putVarint(raw, zigzag(value - values[ip]));
+      values[ip] = value;
+    }
+
+    raw[at] = flags;
+    expected = ip + length(opcode);
+    next = tick + 1;
+    count++;
+  }
+
+  void
+  TraceWriter::flush()
+  {
+    if (count == 0)
+      return;
+
+    uLongf size = compressBound(raw.size());
+    packed.resize(size);
+    if (compress2(packed.data(), &size, raw.data(), raw.size(), Z_BEST_SPEED) != Z_OK)
+    {
+      // close() reports the trace as failed
+      file.setstate(ios::badbit);
+      raw.clear();
+      count = 0;
+      return;
+    }
+
+    index.push_back(TraceBlock{ (u64)file.tellp(), first, count });
+
+    put(file, u32(size));
+    put(file, u32(raw.size()));
+    file.write((const char*)packed.data(), size);
+
+    raw.clear();
+    count = 0;
+  }
+
+
+  u8
+  TraceReader::open(const string& fn)
+  {
+    index.clear();
+    records.clear();
+    block = 0;
+    cursor = 0;
+
+    if (!file.open(fn))
+      return false;
+
+    const u8* p = file.data();
+    size_t size = file.size();
+
+    Signature sign;
+    if (size < sizeof(Signature))
+      return false;
+    memcpy(sign.chars, p, sizeof(Signature));
+    if (sign.word != SIGNtrace.word)
+      return false;
+
+    const size_t entry = 8 + 8 + 4;
+    const size_t footer = 8 + 4 + sizeof(Signature);
+    if (size >= sizeof(Signature) + footer)
+    {
+      memcpy(sign.chars, p + size - sizeof(Signature), sizeof(Signature));
+
+      u64 offset;
+      u32 blocks;
+      memcpy(&offset, p + size - footer, 8);
+      memcpy(&blocks, p + size - footer + 8, 4);
+
+      if (sign.word == SIGNindex.word && offset + blocks * entry + footer == size)
+      {
+        for (u32 i = 0; i < blocks; i++)
+        {
+          TraceBlock b;
+          const u8* q = p + offset + i * entry;
+          memcpy(&b.offset, q, 8);
+          memcpy(&b.tick, q + 8, 8);
+          memcpy(&b.count, q + 16, 4);
+          index.push_back(b);
+        }
+        return seek(firstTick());
+      }
+    }
+
+    cerr << "trace " << fn << " has no index, the writer did not finish" << endl;
+    return false;
+  }
+
+  u64
+  TraceReader::instructions() const
+  {
+    u64 n = 0;
+    for (auto& b : index)
+      n += b.count;
+    return n;
+  }
+
+  u8
+  TraceReader::seek(u64 tick)
+  {
+    auto it = upper_bound(begin(index), end(index), tick,
+      [](u64 t, const TraceBlock& b) { return t < b.tick; });
+    size_t i = it == begin(index) ? 0 : distance(begin(index), it) - 1;
+
+    if (i >= index.size() || !decode(i))
+      return false;
+
+    auto& b = index[i];
+    cursor = tick > b.tick ? min<u64>(tick - b.tick, b.count) : 0;
+    return true;
+  }
+
+  u8
+  TraceReader::next(TraceRecord& record)
+  {
+    while (cursor >= records.size())
+    {
+      if (block + 1 >= index.size() || !decode(block + 1))
+        return false;
+      cursor = 0;
+    }
+
+    record = records[cursor++];
+    return true;
+  }
+
+  u8
+  TraceReader::decode(size_t i)
+  {
+    if (i == block && records.size() == index[i].count)
+      return true;
+
+    auto& b = index[i];
+    size_t available = file.size();
+
+    // at most a flags byte, an address, the words and a varint each
+    const size_t largest = size_t(b.count) * (1 + 2 + 1 + 3 * 2 + 3);
+
+    u32 size = 0;
+    u32 rawSize = 0;
+    if (b.offset <= available && available - b.offset >= 8)
+    {
+      memcpy(&size, file.data() + b.offset, 4);
+      memcpy(&rawSize, file.data() + b.offset + 4, 4);
+    }
+
+    if (b.offset > available || available - b.offset < 8 + u64(size)
+      || b.count > TraceWriter::BlockSize || rawSize > largest)
+    {
+      cerr << "trace block " << i << " is damaged" << endl;
+      return false;
+    }
+
+    const u8* p = file.data() + b.offset;
+    vector<u8> raw(rawSize);
+    uLongf unpacked = rawSize;
+    if (uncompress(raw.data(), &unpacked, p + 8, size) != Z_OK || unpacked != rawSize)
+    {
+      cerr << "trace block " << i << " is damaged" << endl;
+      return false;
+    }
+
+    vector<u8> seen(32768, 0);
+    vector<u16> words(4 * 32768, 0);
+    vector<u16> values(32768, 0);
+
+    records.clear();
+    records.reserve(b.count);
+
+    const u8* q = raw.data();
+    const u8* end = q + raw.size();
+    auto get16 = [&q]() { u16 x = q[0] | (q[1] << 8); q += 2; return x; };
+
+    // a record cut short ends the block, which then comes up short
+    u16 expected = 0;
+    for (u32 n = 0; n < b.count && q < end; n++)
+    {
+      TraceRecord r;
+      r.tick = b.tick + n;
+
+      u8 flags = *q++;
+      if ((flags & ExplicitAddress) && end - q < 2)
+        break;
+      r.ip = (flags & ExplicitAddress ? get16() : expected) & 0x7FFF;
+
+      u16* known = &words[4 * r.ip];
+      if (!seen[r.ip])
+      {
+        seen[r.ip] = true;
+        values[r.ip] = 0;
+      }
+
+      if (flags & NewWords)
+      {
+        if (q == end || end - q < 1 + 2 * (length(*q) - 1))
+          break;
+        known[0] = *q++;
+        for (u8 k = 1; k < 4; k++)
+          known[k] = k < length(known[0]) ? get16() : 0;
+      }
+
+      r.opcode = known[0];
+      r.a = known[1];
+      r.b = known[2];
+      r.c = known[3];
+      r.written = traceWrites(r.opcode);
+      r.value = 0;
+
+      if (r.written)
+      {
+        u16 x = 0;
+        for (u8 shift = 0; q < end; shift += 7)
+        {
+          u8 byte = *q++;
+          x |= u16(byte & 0x7F) << shift;
+          if (!(byte & 0x80))
+            break;
+        }
+        r.value = values[r.ip] += unzigzag(x);
+      }
+
+      records.push_back(r);
+      expected = (r.ip + length(r.opcode)) & 0x7FFF;
+    }
+
+    block = i;
+    cursor = 0;
+    return records.size() == b.count;
+  }
+
+}
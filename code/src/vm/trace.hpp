@@ -0,0 +1,106 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+#include "memory.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // One retired instruction: where it was fetched from, its words as
+  // fetched, and the value it left in a register, memory, on the stack or
+  // in the output, when it has one.
+
+  typedef struct
+  {
+    u64 tick;
+    u16 ip;
+    u16 opcode;
+    u16 a;
+    u16 b;
+    u16 c;
+    u16 value;
+    u8 written;
+  } TraceRecord;
+
+  typedef struct
+  {
+    u64 offset;
+    u64 tick;
+    u32 count;
+  } TraceBlock;
+
+
+  // Traces are blocks of up to BlockSize consecutive instructions, each
+  // delta-coded on its own and deflated, then an index of the blocks.
+  // An instruction takes a flags byte, its address only after a jump, its
+  // words only when they differ from the last time at that address in
+  // the block, and the value as a difference from the last one there.
+
+  class TraceWriter
+  {
+  public:
+    static const u32 BlockSize = 1 << 16;
+
+    TraceWriter();
+    ~TraceWriter();
+
+    u8 open(const string& fn);
+    u8 close();
+
+    void retire(u64 tick, u16 ip, u16 opcode, u16 a, u16 b, u16 c, u16 value);
+
+  private:
+    void flush();
+
+  private:
+    ofstream file;
+    vector<u8> raw;
+    vector<u8> packed;
+    vector<TraceBlock> index;
+    vector<u32> seen;
+    vector<u16> words;
+    vector<u16> values;
+    u64 first;
+    u64 next;
+    u32 count;
+    u16 expected;
+    u32 block;
+  };
+
+
+  class TraceReader
+  {
+  public:
+    u8 open(const string& fn);
+
+    size_t blocks() const { return index.size(); }
+    u64 firstTick() const { return index.empty() ? 0 : index.front().tick; }
+    u64 lastTick() const { return index.empty() ? 0 : index.back().tick + index.back().count; }
+    u64 instructions() const;
+
+    // position at the first record with a tick not less than tick
+    u8 seek(u64 tick);
+    u8 next(TraceRecord& record);
+
+  private:
+    u8 decode(size_t block);
+
+  private:
+    MappedFile file;
+    vector<TraceBlock> index;
+    vector<TraceRecord> records;
+    size_t block;
+    size_t cursor;
+  };
+
+
+  // does the instruction leave a value behind
+  u8 traceWrites(u16 opcode);
+
+}
@@ -1,114 +1,54 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+#include <fcntl.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#include "vm.hpp"
+#include "cache.hpp"
+#include "hash.hpp"
+#include "profiler.hpp"
+#include "coverage.hpp"
+#include "heatmap.hpp"
+#include "trace.hpp"
+#include "watchdog.hpp"
+
 
 namespace paiv {
 
   using namespace std;
 
 
-  typedef struct
-  {
-    string name;
-    u16 arg;
-  } DebuggerCommand;
-
-  typedef struct
-  {
-    string name;
-    string arg;
-  } VmEvent;
-
-
-  class SynacorVM;
-
-  class Snapshot
-  {
-  public:
-
-    void take(const SynacorVM* vm);
-    void restore(SynacorVM* vm) const;
-
-    u8 save(const string& fn);
-    u8 load(const string& fn);
-    u8 loadImage(const vector<u16>& image);
-
-    string fn;
-
-    array<u16, 16*32768> mem;
-    array<u16, 8> reg;
-    array<u16, 1024*1024> stack;
-    u16 ip;
-    u16 sp;
-
-    u16 memoryUsed() const;
-  };
-
-
   static u8 vmid_sequence;
 
-  class SynacorVM : public enable_shared_from_this<SynacorVM>
+  SynacorVM::SynacorVM()
+    : ip(0), sp(0), ticks(0), base(0), id(vmid_sequence++), halted(false), stopped(false), waiting(false), inputPos(0), inputClosed(false), parking(false), stdinPending(false), dirty(65536 / PageWords, true), requested(false), profiler(nullptr), coverage(nullptr), heatmap(nullptr), tracer(nullptr), watchdog(nullptr), watchdogAttached(nullptr), watchCountdown(0),
+      stats(), statsStopped(false), statsWaiting(false), timing(false), statsInterval(0)
   {
-  protected:
-    typedef vector<u16> Image;
-
-    array<u16, 16*32768> mem;
-    array<u16, 8> reg;
-    array<u16, 1024*1024> stack;
-    u16 ip;
-    u16 sp;
-
-    friend class Snapshot;
-    friend class Debugger;
-
-  public:
-    SynacorVM() : id(vmid_sequence++), ip(0), sp(0), halted(false), stopped(false) {
-      receiveEndpoint = string("inproc://debug") + to_string(id);
-      reportEndpoint = string("inproc://vm") + to_string(id);
-      mem.fill(0);
-      reg.fill(0);
-      stack.fill(0);
-    }
-
-    template<size_t N>
-    void exec(u16 (&image)[N]);
-    void exec(Image& image);
-
-    void load(Image& image);
-    void run(zmq::socket_t* controller = nullptr, zmq::socket_t* publisher = nullptr);
-    void step();
-    void halt() { stopped = halted = true; }
-
-    Snapshot save();
-    void load(const Snapshot& snapshot);
-
-    string messagingEndpoint() const { return receiveEndpoint; }
-    string reportingEndpoint() const { return reportEndpoint; }
-
-  private:
-    u8 dispatch(u16 opcode, u16 a, u16 b, u16 c);
-    u16 xnum(u16 x);
-    u16& regr(u16 x);
-    void report(zmq::socket_t* publisher, const string& name, const string& arg = "") const;
-
-  private:
-    u8 id;
-    string receiveEndpoint;
-    string reportEndpoint;
-    u8 halted;
-    u8 stopped;
-    u16 lastOp;
-    vector<u16> executionBreakpoints;
-  };
-
+    receiveEndpoint = string("inproc://debug") + to_string(id);
+    reportEndpoint = string("inproc://vm") + to_string(id);
+    reg.fill(0);
+    wakeFds[0] = wakeFds[1] = -1;
+  }
 
-  template<size_t N>
-  void
-  SynacorVM::exec(u16 (&image)[N])
+  SynacorVM::~SynacorVM()
   {
-    Image v(begin(image), end(image));
-    exec(v);
+    if (wakeFds[0] >= 0)
+    {
+      close(wakeFds[0]);
+      close(wakeFds[1]);
+    }
   }
 
   void
-  SynacorVM::exec(Image& image)
+  SynacorVM::exec(const Image& image)
   {
     load(image);
     run();
@@ -121,12 +61,61 @@ namespace paiv {
     u8 breakpointNext = false;
     u8 breakpointRet = false;
 
+    // time is accounted whenever the machine stops or resumes; the clock
+    // for periodic stats is read every 16K turns while running
+    statsSince = Clock::now();
+    statsStopped = stopped;
+    statsWaiting = false;
+    timing = true;
+    auto reported = statsSince;
+    VmStats last = statistics();
+    u32 turns = 0;
+
+    // a stopped machine, or one waiting for input, sleeps in poll on the
+    // controller socket, stdin, and a pipe halt() writes to from any thread
+    if (wakeFds[0] < 0 && pipe(wakeFds) == 0)
+    {
+      for (int fd : wakeFds)
+      {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+        fcntl(fd, F_SETFD, FD_CLOEXEC);
+      }
+    }
+    {
+      lock_guard<mutex> lock(captureLock);
+      parking = true;
+    }
+
     while (!halted)
     {
-      if (controller && controller->recv(&message, ZMQ_DONTWAIT))
+      if (requested)
+        serveRequests();
+
+      if (alarm.size() > 0)
       {
-        DebuggerCommand command = *message.data<DebuggerCommand>();
+        report(publisher, "runaway", alarm);
+        if (!controller)
+        {
+          cerr << alarm << endl;
+          halted = true;
+        }
+        alarm.clear();
+      }
+
+      if (textMatch.size() > 0)
+      {
+        report(publisher, "output", textMatch);
+        if (!controller)
+        {
+          cerr << "output matched \"" << textMatch << "\"" << endl;
+          halted = true;
+        }
+        textMatch.clear();
+      }
 
+      DebuggerCommand command;
+      if (controller && controller->recv(&message, ZMQ_DONTWAIT) && unpack(message, command))
+      {
         if (command.name == "step")
         {
           breakpointNext = true;
@@ -156,6 +145,8 @@ namespace paiv {
               so << a << ' ' << setfill('0') << setw(4) << hex << b;
               return so.str();
             });
+          for (auto& text : textBreakpoints.patterns())
+            bps += " \"" + text + "\"";
 
           report(publisher, "breakpoints", bps);
         }
@@ -169,6 +160,38 @@ namespace paiv {
           if (it != end(executionBreakpoints))
             executionBreakpoints.erase(it);
         }
+        else if (command.name == "set text breakpoint")
+        {
+          textBreakpoints.add(command.text);
+        }
+        else if (command.name == "clear text breakpoint")
+        {
+          if (command.text.size() > 0)
+            textBreakpoints.remove(command.text);
+          else
+            textBreakpoints.clear();
+        }
+        else if (command.name == "stats interval")
+        {
+          statsInterval = command.arg;
+          reported = Clock::now();
+          last = statistics();
+        }
+        else if (command.name == "watchdog")
+        {
+          watchdog = command.arg ? watchdogAttached : nullptr;
+          watchCountdown = Watchdog::Interval;
+        }
+      }
+
+      if (stopped != statsStopped || (waiting && !stopped) != statsWaiting)
+        account();
+
+      if (statsInterval && !stopped && (++turns & 0x3FFF) == 0
+        && Clock::now() - reported >= chrono::seconds(statsInterval))
+      {
+        reported = Clock::now();
+        report(publisher, "stats", statsLine(last));
       }
 
       if (!stopped)
@@ -185,12 +208,239 @@ namespace paiv {
         else
         {
           step();
+          if (waiting)
+          {
+            if (!statsWaiting)
+              account();
+            park(controller, stdinPending);
+          }
         }
       }
       else
       {
-        usleep(1000);
+        park(controller, false);
+      }
+    }
+
+    {
+      lock_guard<mutex> lock(captureLock);
+      parking = false;
+    }
+    serveRequests();
+
+    account();
+    timing = false;
+  }
+
+  void
+  SynacorVM::halt()
+  {
+    stopped = halted = true;
+    wake();
+  }
+
+  void
+  SynacorVM::wake()
+  {
+    if (wakeFds[1] >= 0)
+    {
+      // fails only when the pipe is full, and the machine awake already
+      ssize_t written = write(wakeFds[1], "", 1);
+      (void)written;
+    }
+  }
+
+  Capture
+  SynacorVM::capture()
+  {
+    if (pages.size() != dirty.size())
+    {
+      pages.assign(dirty.size(), nullptr);
+      fill(begin(dirty), end(dirty), true);
+    }
+
+    for (size_t i = 0; i < dirty.size(); i++)
+      if (dirty[i])
+      {
+        auto p = mem.begin() + i * PageWords;
+        pages[i] = shared_ptr<const vector<u16>>(new vector<u16>(p, p + PageWords));
+        dirty[i] = false;
       }
+
+    Capture state;
+    state.reg = reg;
+    state.ip = ip;
+    state.sp = sp;
+    state.ticks = ticks;
+    state.base = base;
+    state.stack.assign(stack.begin(), stack.begin() + sp);
+    state.pages = pages;
+    state.input = inputLog;
+    return state;
+  }
+
+  void
+  SynacorVM::apply(const Capture& state)
+  {
+    reg = state.reg;
+    ip = state.ip;
+    sp = state.sp;
+    ticks = state.ticks;
+    base = state.base;
+    copy(begin(state.stack), end(state.stack), stack.begin());
+
+    for (size_t i = 0; i < state.pages.size() && i < dirty.size(); i++)
+      if (state.pages[i])
+      {
+        copy(begin(*state.pages[i]), end(*state.pages[i]), mem.begin() + i * PageWords);
+        dirty[i] = true;
+      }
+
+    inputLog.clear();
+    halted = waiting = false;
+  }
+
+  future<void>
+  SynacorVM::requestCall(const function<void()>& task)
+  {
+    promise<void> request;
+    auto res = request.get_future();
+
+    lock_guard<mutex> lock(captureLock);
+    if (!parking)
+    {
+      task();
+      request.set_value();
+    }
+    else
+    {
+      callRequests.push_back(make_pair(task, move(request)));
+      requested = true;
+      wake();
+    }
+
+    return res;
+  }
+
+  future<Capture>
+  SynacorVM::requestCapture()
+  {
+    promise<Capture> request;
+    auto res = request.get_future();
+
+    lock_guard<mutex> lock(captureLock);
+    if (!parking)
+      request.set_value(capture());
+    else
+    {
+      captureRequests.push_back(move(request));
+      requested = true;
+      wake();
+    }
+
+    return res;
+  }
+
+  void
+  SynacorVM::serveRequests()
+  {
+    lock_guard<mutex> lock(captureLock);
+
+    for (auto& request : callRequests)
+    {
+      request.first();
+      request.second.set_value();
+    }
+    callRequests.clear();
+
+    if (captureRequests.size() > 0)
+    {
+      Capture state = capture();
+      for (auto& request : captureRequests)
+        request.set_value(state);
+      captureRequests.clear();
+    }
+
+    requested = false;
+  }
+
+  u64
+  checksum(const Capture& state)
+  {
+    u64 h = checksum(&state.reg[0], state.reg.size());
+    h = checksum(&state.ip, 1, h);
+    h = checksum(&state.sp, 1, h);
+    h = checksum(state.stack.data(), state.stack.size(), h);
+
+    static const vector<u16> zeros(PageWords, 0);
+    for (size_t i = 0; i < 32768 / PageWords; i++)
+    {
+      auto& page = i < state.pages.size() && state.pages[i] ? *state.pages[i] : zeros;
+      h = checksum(page.data(), page.size(), h);
+    }
+    return h;
+  }
+
+  void
+  SynacorVM::park(zmq::socket_t* controller, u8 forStdin)
+  {
+    vector<zmq::pollitem_t> items;
+    if (wakeFds[0] >= 0)
+      items.push_back({ nullptr, wakeFds[0], ZMQ_POLLIN, 0 });
+    if (controller)
+      items.push_back({ (void*)*controller, 0, ZMQ_POLLIN, 0 });
+    if (forStdin)
+      items.push_back({ nullptr, STDIN_FILENO, ZMQ_POLLIN, 0 });
+
+    // an input source other than stdin cannot be waited on, and is polled
+    if (!halted)
+      zmq::poll(items, forStdin || !waiting ? -1 : 1);
+
+    if (wakeFds[0] >= 0 && (items.front().revents & ZMQ_POLLIN))
+    {
+      char buf[64];
+      while (read(wakeFds[0], buf, sizeof(buf)) > 0)
+        ;
+    }
+
+    if (forStdin && (items.back().revents & (ZMQ_POLLIN | ZMQ_POLLERR)))
+      fillInput();
+
+    stdinPending = false;
+  }
+
+  int
+  SynacorVM::readStdin()
+  {
+    if (inputPos == inputBuffer.size() && !inputClosed)
+    {
+      if (parking)
+      {
+        stdinPending = true;
+        return InputPending;
+      }
+      fillInput();
+    }
+
+    if (inputPos == inputBuffer.size())
+      return EOF;
+    return (u8)inputBuffer[inputPos++];
+  }
+
+  void
+  SynacorVM::fillInput()
+  {
+    char buf[4096];
+    ssize_t n;
+    while ((n = read(STDIN_FILENO, buf, sizeof(buf))) < 0 && errno == EINTR)
+      ;
+
+    if (n <= 0)
+      inputClosed = true;
+    else
+    {
+      inputBuffer.assign(buf, n);
+      inputPos = 0;
     }
   }
 
@@ -199,19 +449,209 @@ namespace paiv {
   {
     if (publisher)
     {
-      VmEvent event = { name, arg };
-      zmq::message_t message((void*)&event, sizeof(event));
+      string data = pack(VmEvent{ name, arg });
+      zmq::message_t message(data.data(), data.size());
       publisher->send(message);
     }
   }
 
+  string
+  pack(const DebuggerCommand& command)
+  {
+    string data = command.name;
+    data.push_back('\0');
+    data.append((const char*)&command.arg, sizeof(command.arg));
+    data.append(command.text);
+    return data;
+  }
+
+  string
+  pack(const VmEvent& event)
+  {
+    string data = event.name;
+    data.push_back('\0');
+    data.append(event.arg);
+    return data;
+  }
+
+  u8
+  unpack(const zmq::message_t& message, DebuggerCommand& command)
+  {
+    const char* p = (const char*)message.data();
+    const char* end = p + message.size();
+    const char* nul = find(p, end, '\0');
+    if (end - nul < 1 + (ptrdiff_t)sizeof(command.arg))
+      return false;
+
+    command.name.assign(p, nul);
+    memcpy(&command.arg, nul + 1, sizeof(command.arg));
+    command.text.assign(nul + 1 + sizeof(command.arg), end);
+    return true;
+  }
+
+  u8
+  unpack(const zmq::message_t& message, VmEvent& event)
+  {
+    const char* p = (const char*)message.data();
+    const char* end = p + message.size();
+    const char* nul = find(p, end, '\0');
+    if (nul == end)
+      return false;
+
+    event.name.assign(p, nul);
+    event.arg.assign(nul + 1, end);
+    return true;
+  }
+
+  void
+  SynacorVM::account()
+  {
+    auto now = Clock::now();
+    double elapsed = chrono::duration<double>(now - statsSince).count();
+    (statsStopped ? stats.stopped : statsWaiting ? stats.waiting : stats.running) += elapsed;
+    statsSince = now;
+    statsStopped = stopped;
+    statsWaiting = waiting && !stopped;
+  }
+
+  VmStats
+  SynacorVM::statistics() const
+  {
+    VmStats res = stats;
+    res.instructions = accumulate(begin(stats.opcodes), end(stats.opcodes), u64(0));
+    res.stackDepth = sp;
+
+    if (timing)
+    {
+      double elapsed = chrono::duration<double>(Clock::now() - statsSince).count();
+      (statsStopped ? res.stopped : statsWaiting ? res.waiting : res.running) += elapsed;
+    }
+
+    return res;
+  }
+
+  void
+  SynacorVM::resetStatistics()
+  {
+    u32 callDepth = stats.callDepth;
+    stats = VmStats();
+    stats.maxStackDepth = sp;
+    stats.callDepth = stats.maxCallDepth = callDepth;
+    statsSince = Clock::now();
+  }
+
+  // instructions and MIPS since the last line, and the depths
+  string
+  SynacorVM::statsLine(VmStats& last) const
+  {
+    VmStats now = statistics();
+    double seconds = now.running - last.running;
+    double mips = seconds > 0 ? (now.instructions - last.instructions) / seconds / 1e6 : 0;
+
+    stringstream so;
+    so << now.instructions << " instructions, " << fixed << setprecision(1) << mips << " MIPS, stack "
+      << now.stackDepth << '/' << now.maxStackDepth << ", calls " << now.callDepth << '/' << now.maxCallDepth;
+
+    last = now;
+    return so.str();
+  }
+
   void
   SynacorVM::step()
   {
-    if (!dispatch(mem[ip], mem[ip + 1], mem[ip + 2], mem[ip + 3]))
+    u16 at = ip;
+    u16 opcode = mem[ip];
+    u16 a = mem[ip + 1];
+    u16 b = mem[ip + 2];
+    u16 c = mem[ip + 3];
+
+    if (!dispatch(opcode, a, b, c))
       halted = true;
+    else if (!waiting)
+    {
+      if (tracer)
+        trace(at, opcode, a, b, c);
+      ticks++;
+      if (watchdog && --watchCountdown == 0)
+        watch();
+      if (coverage)
+        coverage->mark(at);
+#ifdef SYNACOR_PROFILE
+      if (profiler)
+        profiler->retire(at, opcode, ip);
+#endif
+    }
+  }
+
+  void
+  SynacorVM::setWatchdog(Watchdog* watchdog, u8 armed)
+  {
+    watchdogAttached = watchdog;
+    this->watchdog = armed ? watchdog : nullptr;
+    watchCountdown = Watchdog::Interval;
+  }
+
+  void
+  SynacorVM::watch()
+  {
+    watchCountdown = Watchdog::Interval;
+    string message = watchdog->check(this);
+    if (message.size() > 0)
+    {
+      alarm = message;
+      stopped = true;
+    }
   }
 
+  // the value an instruction left in a register, memory, on the stack or
+  // in the output; operands as fetched, before it could write over them
+  void
+  SynacorVM::trace(u16 at, u16 opcode, u16 a, u16 b, u16 c)
+  {
+    u16 value = 0;
+
+    switch (opcode)
+    {
+      case Op::PUSH:
+      case Op::CALL:
+        value = stack[sp - 1];
+        break;
+      case Op::WMEM:
+        value = mem[xnum(a)];
+        break;
+      case Op::OUT:
+        value = xnum(a);
+        break;
+      default:
+        if (traceWrites(opcode))
+          value = reg[(a - 32768) & 7];
+        break;
+    }
+
+    tracer->retire(ticks, at, opcode, a, b, c, value);
+  }
+
+  void
+  SynacorVM::runUntil(u64 tick)
+  {
+    waiting = false;
+    while (!halted && !waiting && ticks < tick)
+      step();
+  }
+
+  u8
+  SynacorVM::runUntilInput(u64 budget)
+  {
+    u64 tick = ticks + budget;
+    while (!halted && ticks < tick && mem[ip] != Op::IN)
+      step();
+    return !halted && mem[ip] == Op::IN;
+  }
+
+  // the length of an instruction from the opcode table, as a constant
+  template<u16 opcode>
+  struct Next : integral_constant<u8, opinfo(opcode).size> {};
+
   inline u16
   SynacorVM::xnum(u16 x)
   {
@@ -221,12 +661,21 @@ namespace paiv {
   inline u16&
   SynacorVM::regr(u16 x)
   {
+    // one of the eight, as dispatch checks first
     return reg[x - 32768];
   }
 
   u8
   SynacorVM::dispatch(u16 opcode, u16 a, u16 b, u16 c)
   {
+    // any image can name a register past the eight to write to, and that
+    // halts the machine like an unknown opcode does
+    if ((opinfo(opcode).writes & 1) && u16(a - 32768) > 7)
+    {
+      cerr << "bad register " << a << " at " << ip << endl;
+      return false;
+    }
+
     switch (opcode)
     {
       case Op::HALT:
@@ -234,28 +683,30 @@ namespace paiv {
 
       case Op::SET:
         regr(a) = xnum(b);
-        ip += 3;
+        ip += Next<Op::SET>::value;
         break;
 
       case Op::PUSH:
         stack[sp++] = xnum(a);
-        ip += 2;
+        if (sp > stats.maxStackDepth)
+          stats.maxStackDepth = sp;
+        ip += Next<Op::PUSH>::value;
         break;
 
       case Op::POP:
         if (sp == 0) return false;
         regr(a) = stack[--sp];
-        ip += 2;
+        ip += Next<Op::POP>::value;
         break;
 
       case Op::EQ:
         regr(a) = xnum(b) == xnum(c);
-        ip += 4;
+        ip += Next<Op::EQ>::value;
         break;
 
       case Op::GT:
         regr(a) = xnum(b) > xnum(c);
-        ip += 4;
+        ip += Next<Op::GT>::value;
         break;
 
       case Op::JMP:
@@ -263,89 +714,136 @@ namespace paiv {
         break;
 
       case Op::JT:
-        ip = xnum(a) != 0 ? xnum(b) : ip + 3;
+        ip = xnum(a) != 0 ? xnum(b) : ip + Next<Op::JT>::value;
         break;
 
       case Op::JF:
-        ip = xnum(a) == 0 ? xnum(b) : ip + 3;
+        ip = xnum(a) == 0 ? xnum(b) : ip + Next<Op::JF>::value;
         break;
 
       case Op::ADD:
         regr(a) = (xnum(b) + xnum(c)) % 32768;
-        ip += 4;
+        ip += Next<Op::ADD>::value;
         break;
 
       case Op::MULT:
         regr(a) = (xnum(b) * xnum(c)) % 32768;
-        ip += 4;
+        ip += Next<Op::MULT>::value;
         break;
 
       case Op::MOD:
+        if (xnum(c) == 0)
+        {
+          cerr << "division by zero at " << ip << endl;
+          return false;
+        }
         regr(a) = xnum(b) % xnum(c);
-        ip += 4;
+        ip += Next<Op::MOD>::value;
         break;
 
       case Op::AND:
         regr(a) = xnum(b) & xnum(c);
-        ip += 4;
+        ip += Next<Op::AND>::value;
         break;
 
       case Op::OR:
         regr(a) = xnum(b) | xnum(c);
-        ip += 4;
+        ip += Next<Op::OR>::value;
         break;
 
       case Op::NOT:
         regr(a) = ~xnum(b) & 0x7FFF;
-        ip += 3;
+        ip += Next<Op::NOT>::value;
         break;
 
       case Op::RMEM:
-        regr(a) = mem[xnum(b)];
-        ip += 3;
+        {
+          u16 address = xnum(b);
+          regr(a) = mem[address];
+          if (heatmap)
+            heatmap->read(address, ticks);
+          ip += Next<Op::RMEM>::value;
+        }
         break;
 
       case Op::WMEM:
         mem[xnum(a)] = xnum(b);
-        ip += 3;
+        touch(xnum(a));
+        if (heatmap)
+          heatmap->write(xnum(a), ticks);
+        ip += Next<Op::WMEM>::value;
         break;
 
       case Op::CALL:
-        stack[sp++] = ip + 2;
+        stack[sp++] = ip + Next<Op::CALL>::value;
         ip = xnum(a);
+        if (sp > stats.maxStackDepth)
+          stats.maxStackDepth = sp;
+        if (++stats.callDepth > stats.maxCallDepth)
+          stats.maxCallDepth = stats.callDepth;
         break;
 
       case Op::RET:
         if (sp == 0) return false;
         ip = stack[--sp];
+        if (stats.callDepth > 0)
+          stats.callDepth--;
         break;
 
       case Op::OUT:
-        ip += 2;
-        printf("%c", xnum(a));
+        ip += Next<Op::OUT>::value;
+        stats.outputChars++;
+        if (output)
+          output(xnum(a));
+        else
+          printf("%c", xnum(a));
+        if (!textBreakpoints.empty() && textBreakpoints.feed(xnum(a)))
+        {
+          textMatch = textBreakpoints.matched();
+          stopped = true;
+        }
         break;
 
       case Op::IN:
-        regr(a) = getchar();
-        ip += 2;
+        {
+          int x = input ? input() : readStdin();
+          if (x == EOF) return false;
+          waiting = x == InputPending;
+          if (waiting) return true;
+          regr(a) = x;
+          inputLog.push_back(x);
+          if (x == '\n')
+            stats.inputLines++;
+          ip += Next<Op::IN>::value;
+        }
         break;
 
       case Op::NOOP:
-        ip++;
+        ip += Next<Op::NOOP>::value;
         break;
 
       default:
-        cerr << "unhandled opcode " << opcode << endl;
-        __builtin_trap();
-        break;
+        cerr << "unhandled opcode " << opcode << " at " << ip << endl;
+        return false;
     }
 
     lastOp = opcode;
+    stats.opcodes[opcode]++;
 
     return true;
   }
 
 
+  u64
+  SynacorVM::hash() const
+  {
+    u64 h = checksum(&reg[0], reg.size());
+    h = checksum(&ip, 1, h);
+    h = checksum(&sp, 1, h);
+    h = checksum(&stack[0], sp, h);
+    return checksum(&mem[0], 32768, h);
+  }
+
   Snapshot
   SynacorVM::save()
   {
@@ -358,14 +856,47 @@ namespace paiv {
   SynacorVM::load(const Snapshot& snapshot)
   {
     snapshot.restore(this);
+    halted = waiting = false;
   }
 
+  // Registers and stack from the snapshot, memory shared copy-on-write
+  // from a file holding the snapshot's memory
   void
-  SynacorVM::load(Image& image)
+  SynacorVM::load(const Snapshot& snapshot, const MappedFile& memory)
   {
-    Snapshot snapshot;
-    snapshot.loadImage(image);
-    load(snapshot);
+    ip = snapshot.ip;
+    sp = snapshot.sp;
+    ticks = snapshot.ticks;
+    base = snapshot.base;
+    reg = snapshot.reg;
+    copy(snapshot.stack.begin(), snapshot.stack.begin() + sp, stack.begin());
+    mem.map(memory);
+    pages.clear();
+    inputLog.clear();
+    halted = waiting = false;
+  }
+
+  void
+  SynacorVM::load(const Image& image)
+  {
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    snapshot->loadImage(image);
+    load(*snapshot);
+  }
+
+  void
+  SynacorVM::load(const MappedFile& image)
+  {
+    ip = 0;
+    sp = 0;
+    ticks = 0;
+    base = addBase((const u16*)image.data(), image.size() / 2);
+    reg.fill(0);
+    stack.clear();
+    mem.map(image);
+    pages.clear();
+    inputLog.clear();
+    halted = waiting = false;
   }
 
 
@@ -374,9 +905,26 @@ namespace paiv {
   {
     ip = vm->ip;
     sp = vm->sp;
+    ticks = vm->ticks;
+    base = vm->base;
     mem = vm->mem;
     reg = vm->reg;
-    stack = vm->stack;
+    copy(vm->stack.begin(), vm->stack.begin() + sp, stack.begin());
+  }
+
+  void
+  Snapshot::take(const Capture& capture)
+  {
+    ip = capture.ip;
+    sp = capture.sp;
+    ticks = capture.ticks;
+    base = capture.base;
+    reg = capture.reg;
+    copy(begin(capture.stack), end(capture.stack), stack.begin());
+    mem.clear();
+    for (size_t i = 0; i < capture.pages.size(); i++)
+      if (capture.pages[i])
+        copy(begin(*capture.pages[i]), end(*capture.pages[i]), mem.begin() + i * PageWords);
   }
 
   void
@@ -384,18 +932,17 @@ namespace paiv {
   {
     vm->ip = ip;
     vm->sp = sp;
+    vm->ticks = ticks;
+    vm->base = base;
     vm->mem = mem;
+    vm->pages.clear();
+    vm->inputLog.clear();
     vm->reg = reg;
-    vm->stack = stack;
+    copy(stack.begin(), stack.begin() + sp, vm->stack.begin());
   }
 
-  typedef union
-  {
-    char chars[8];
-    u64 word;
-  } Signature;
-
   static const Signature SIGNv1 = { "SYNACOR" };
+  static const Signature SIGNv2 = { "SYNACR2" };
 
   u16
   Snapshot::memoryUsed() const
@@ -404,78 +951,222 @@ namespace paiv {
     return distance(it, mem.rend());
   }
 
+  // Version 2: signature, base checksum, CRC-32 and size of the payload,
+  // then the payload deflated. The payload is registers, ip, sp, ticks,
+  // the stack, and memory as runs of words that differ from the base,
+  // each an offset and a length, up to a run of length 0.
   u8
   Snapshot::save(const string& fn)
   {
+    const vector<u16>* reference = base && keepBase(base) ? findBase(base) : nullptr;
+    u64 hash = reference ? base : 0;
+    size_t baseSize = reference ? reference->size() : 0;
+    auto old = [reference, baseSize](size_t i) -> u16 { return i < baseSize ? (*reference)[i] : 0; };
+
+    vector<u16> payload(begin(reg), end(reg));
+    payload.push_back(ip);
+    payload.push_back(sp);
+    for (u8 i = 0; i < 4; i++)
+      payload.push_back(ticks >> (16 * i));
+    payload.insert(end(payload), stack.begin(), stack.begin() + sp);
+
+    size_t used = max<size_t>(memoryUsed(), baseSize);
+    for (size_t i = 0; i < used; )
+    {
+      if (mem[i] == old(i))
+      {
+        i++;
+        continue;
+      }
+
+      // a run goes on over single unchanged words, cheaper than a new one
+      size_t j = i + 1;
+      while (j < used && (mem[j] != old(j) || (j + 1 < used && mem[j + 1] != old(j + 1))))
+        j++;
+
+      payload.push_back(i);
+      payload.push_back(j - i);
+      payload.insert(end(payload), &mem[i], &mem[j]);
+      i = j;
+    }
+    payload.push_back(0);
+    payload.push_back(0);
+
+    uLong rawSize = payload.size() * 2;
+    uLongf packedSize = compressBound(rawSize);
+    vector<u8> packed(packedSize);
+    if (compress2(packed.data(), &packedSize, (const Bytef*)payload.data(), rawSize, Z_BEST_SPEED) != Z_OK)
+      return false;
+
+    u32 crc = crc32(0, (const Bytef*)payload.data(), rawSize);
+    u32 size = rawSize;
+
     ofstream ofs(fn, ios::binary | ios::trunc);
     if (!ofs.good())
       return false;
 
-    u16 memUsed = memoryUsed();
+    ofs.write(SIGNv2.chars, sizeof(SIGNv2));
+    ofs.write((char*)&hash, 8);
+    ofs.write((char*)&crc, 4);
+    ofs.write((char*)&size, 4);
+    ofs.write((char*)packed.data(), packedSize);
 
-    ofs.write(SIGNv1.chars, sizeof(SIGNv1));
-    ofs.write((char*)&reg[0], reg.size() * 2);
-    ofs.write((char*)&ip, 2);
-    ofs.write((char*)&sp, 2);
-    ofs.write((char*)&stack[0], sp * 2);
-    ofs.write((char*)&memUsed, 2);
-    ofs.write((char*)&mem[0], memUsed * 2);
-
-    return true;
+    return ofs.good();
   }
 
   u8
   Snapshot::load(const string& fn)
   {
-    ifstream ifs(fn, ios::binary | ios::ate);
-    if (!ifs.good())
+    MappedFile file;
+    if (!file.open(fn))
       return false;
 
-    auto size = ifs.tellg();
-    ifs.seekg(0, ios::beg);
+    const u8* p = file.data();
+    size_t size = file.size();
 
-    size_t runlen = sizeof(Signature);
-    if (size > runlen)
+    Signature sign;
+    if (size < sizeof(Signature))
+      return false;
+    memcpy(&sign.chars[0], p, sizeof(Signature));
+
+    u8 loaded = sign.word == SIGNv2.word ? loadV2(p + sizeof(Signature), size - sizeof(Signature), fn)
+      : sign.word == SIGNv1.word ? loadV1(p + sizeof(Signature), size - sizeof(Signature))
+      : false;
+
+    if (loaded)
+      this->fn = fn;
+    return loaded;
+  }
+
+  u8
+  Snapshot::loadV2(const u8* p, size_t size, const string& fn)
+  {
+    const size_t header = 8 + 4 + 4;
+    if (size < header)
+      return false;
+
+    u64 hash;
+    u32 crc;
+    u32 rawSize;
+    memcpy(&hash, p, 8);
+    memcpy(&crc, p + 8, 4);
+    memcpy(&rawSize, p + 12, 4);
+
+    // registers and ticks, a full stack, and runs over every memory word
+    // at worst one word apart, with the terminating run
+    const size_t largest = (14 + stack.size() + 2 * mem.size() + 2) * 2;
+    if (rawSize % 2 != 0 || rawSize > largest)
+    {
+      cerr << "snapshot " << fn << " is damaged" << endl;
+      return false;
+    }
+
+    vector<u16> payload(rawSize / 2);
+    uLongf unpacked = rawSize;
+    if (uncompress((Bytef*)payload.data(), &unpacked, p + header, size - header) != Z_OK
+      || unpacked != rawSize || crc32(0, (const Bytef*)payload.data(), rawSize) != crc)
+    {
+      cerr << "snapshot " << fn << " is damaged" << endl;
+      return false;
+    }
+
+    const vector<u16>* reference = nullptr;
+    if (hash != 0 && (reference = findBase(hash)) == nullptr)
+    {
+      cerr << "snapshot " << fn << " is saved against memory " << setfill('0') << setw(16) << hex << hash << dec
+        << ", which is not in " << cacheDirectory() << endl;
+      return false;
+    }
+
+    const u16* q = payload.data();
+    const u16* end = q + payload.size();
+    if (end - q < 14)
+      return false;
+
+    copy(q, q + 8, begin(reg));
+    ip = q[8];
+    sp = q[9];
+    ticks = 0;
+    for (u8 i = 0; i < 4; i++)
+      ticks |= u64(q[10 + i]) << (16 * i);
+    q += 14;
+
+    if (end - q < sp)
+      return false;
+    stack.clear();
+    copy(q, q + sp, stack.begin());
+    q += sp;
+
+    mem.clear();
+    if (reference)
+      copy(reference->begin(), reference->end(), mem.begin());
+
+    while (end - q >= 2)
     {
-      Signature sign;
-      ifs.read(&sign.chars[0], sizeof(Signature));
-      if (sign.word != SIGNv1.word) return false;
+      u16 offset = q[0];
+      u16 count = q[1];
+      q += 2;
+      if (count == 0)
+      {
+        base = hash;
+        return true;
+      }
+      if (end - q < count || offset + count > mem.size())
+        break;
+      copy(q, q + count, mem.begin() + offset);
+      q += count;
     }
 
+    return false;
+  }
+
+  u8
+  Snapshot::loadV1(const u8* p, size_t size)
+  {
+    ticks = 0;
+    base = 0;
+
+    size_t runlen = 0;
     runlen += reg.size() * 2;
     if (size > runlen )
     {
-      ifs.read((char*)&reg[0], reg.size() * 2);
+      memcpy(&reg[0], p, reg.size() * 2);
+      p += reg.size() * 2;
     }
 
     runlen += 4;
     if (size > runlen)
     {
-      ifs.read((char*)&ip, 2);
-      ifs.read((char*)&sp, 2);
+      memcpy(&ip, p, 2);
+      memcpy(&sp, p + 2, 2);
+      p += 4;
     }
 
     runlen += sp * 2;
     if (size > runlen )
     {
-      stack.fill(0);
-      ifs.read((char*)&stack[0], sp * 2);
+      stack.clear();
+      memcpy(&stack[0], p, sp * 2);
+      p += sp * 2;
     }
 
-    u16 memUsed;
+    u16 memUsed = 0;
     runlen += 2;
     if (size > runlen)
     {
-      ifs.read((char*)&memUsed, 2);
+      memcpy(&memUsed, p, 2);
+      p += 2;
+    }
+    else
+    {
+      return false;
     }
 
     runlen += memUsed * 2;
     if (size >= runlen )
     {
-      mem.fill(0);
-      ifs.read((char*)&mem[0], memUsed * 2);
-
-      this->fn = fn;
+      mem.clear();
+      memcpy(&mem[0], p, memUsed * 2);
       return true;
     }
 
@@ -487,11 +1178,25 @@ namespace paiv {
   {
     ip = 0;
     sp = 0;
+    ticks = 0;
+    base = addBase(image.data(), image.size());
     reg.fill(0);
-    mem.fill(0);
-    stack.fill(0);
+    mem.clear();
+    stack.clear();
     copy(begin(image), end(image), begin(mem));
     return true;
   }
 
+  u8
+  Snapshot::loadImage(const MappedFile& image)
+  {
+    ip = 0;
+    sp = 0;
+    ticks = 0;
+    base = addBase((const u16*)image.data(), image.size() / 2);
+    reg.fill(0);
+    stack.clear();
+    return mem.map(image);
+  }
+
 }
@@ -0,0 +1,304 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <zmq.hpp>
+
+#include "types.hpp"
+#include "opcodes.hpp"
+#include "memory.hpp"
+#include "textmatch.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  typedef struct
+  {
+    string name;
+    u16 arg;
+    string text;
+  } DebuggerCommand;
+
+  typedef struct
+  {
+    string name;
+    string arg;
+  } VmEvent;
+
+  // Messages between the debugger and the machine's thread: the name, a
+  // NUL, then the argument, and a command's text
+  string pack(const DebuggerCommand& command);
+  string pack(const VmEvent& event);
+  u8 unpack(const zmq::message_t& message, DebuggerCommand& command);
+  u8 unpack(const zmq::message_t& message, VmEvent& event);
+
+  // Counters kept by the machine as it runs, and seconds spent in run()
+  // running, parked waiting for input, and stopped in the debugger
+  typedef struct
+  {
+    array<u64, OpCount> opcodes;
+    u64 instructions;
+    u32 stackDepth;
+    u32 maxStackDepth;
+    u32 callDepth;
+    u32 maxCallDepth;
+    u64 outputChars;
+    u64 inputLines;
+    double running;
+    double waiting;
+    double stopped;
+  } VmStats;
+
+  // input returns the next character, EOF to halt the machine,
+  // or InputPending to leave it parked on the IN instruction
+  typedef function<int()> InputSource;
+  static const int InputPending = -2;
+  typedef function<void(u16)> OutputSink;
+
+
+  typedef union
+  {
+    char chars[8];
+    u64 word;
+  } Signature;
+
+
+  // Machine state at an instruction boundary. Memory is in pages of
+  // PageWords, shared with earlier captures of the same machine where
+  // nothing was written since; to apply, a null page is left as it is.
+
+  static const u16 PageWords = 256;
+
+  typedef struct
+  {
+    array<u16, 8> reg;
+    u16 ip;
+    u16 sp;
+    u64 ticks;
+    u64 base;
+    vector<u16> stack;
+    vector<shared_ptr<const vector<u16>>> pages;
+    // read since the machine was loaded
+    string input;
+  } Capture;
+
+  // same as SynacorVM::hash
+  u64 checksum(const Capture& state);
+
+
+  class SynacorVM;
+  class Profiler;
+  class Coverage;
+  class Heatmap;
+  class TraceWriter;
+  class Watchdog;
+
+  class Snapshot
+  {
+  public:
+
+    void take(const SynacorVM* vm);
+    void take(const Capture& capture);
+    void restore(SynacorVM* vm) const;
+
+    u8 save(const string& fn);
+    u8 load(const string& fn);
+    u8 loadImage(const vector<u16>& image);
+    u8 loadImage(const MappedFile& image);
+
+    string fn;
+
+    Memory<16*32768> mem;
+    array<u16, 8> reg;
+    Memory<1024*1024> stack;
+    u16 ip;
+    u16 sp;
+    u64 ticks;
+
+    // checksum of the memory saved against, see addBase; 0 for none
+    u64 base;
+
+    u16 memoryUsed() const;
+
+  private:
+    u8 loadV1(const u8* p, size_t size);
+    u8 loadV2(const u8* p, size_t size, const string& fn);
+  };
+
+
+  class SynacorVM : public enable_shared_from_this<SynacorVM>
+  {
+  protected:
+    typedef vector<u16> Image;
+
+    Memory<16*32768> mem;
+    array<u16, 8> reg;
+    Memory<1024*1024> stack;
+    u16 ip;
+    u16 sp;
+    u64 ticks;
+    u64 base;
+
+    friend class Snapshot;
+    friend class Debugger;
+    friend class ForkBrancher;
+    friend class NativeMachine;
+    friend class Watchdog;
+
+  public:
+    SynacorVM();
+    ~SynacorVM();
+
+    template<size_t N>
+    void exec(u16 (&image)[N]);
+    void exec(const Image& image);
+
+    void load(const Image& image);
+    void load(const MappedFile& image);
+    void run(zmq::socket_t* controller = nullptr, zmq::socket_t* publisher = nullptr);
+    void step();
+    void runUntil(u64 tick);
+    u8 runUntilInput(u64 budget);
+    void halt();
+    u8 isHalted() const { return halted; }
+    u8 isWaiting() const { return waiting; }
+
+    // number of instructions retired since the image was loaded
+    u64 clock() const { return ticks; }
+
+    // hash of registers, stack and the 15-bit address space
+    u64 hash() const;
+
+    VmStats statistics() const;
+    void resetStatistics();
+
+    void setInput(const InputSource& source) { input = source; }
+
+    // the default input: buffered standard input, pending inside run()
+    // until stdin is readable, so that the machine parks instead of
+    // blocking where a debugger cannot reach it
+    int readStdin();
+    void setOutput(const OutputSink& sink) { output = sink; }
+
+    // counts retired instructions when built with SYNACOR_PROFILE
+    void setProfiler(Profiler* profiler) { this->profiler = profiler; }
+
+    // marks the address of every instruction executed
+    void setCoverage(Coverage* coverage) { this->coverage = coverage; }
+
+    // counts the addresses accessed by RMEM and WMEM
+    void setHeatmap(Heatmap* heatmap) { this->heatmap = heatmap; }
+
+    // records every retired instruction
+    void setTracer(TraceWriter* tracer) { this->tracer = tracer; }
+
+    // stops run() when the output has the text
+    void breakOnText(const string& text) { textBreakpoints.add(text); }
+
+    // stops run() with a diagnostic on runaway recursion or a loop; while
+    // running, the debugger's watchdog command arms and disarms it
+    void setWatchdog(Watchdog* watchdog, u8 armed = true);
+
+    Snapshot save();
+
+    // the state as of now, copying only pages written since the last
+    // capture; from the thread running the machine, or when none does
+    Capture capture();
+
+    // the state at the next instruction boundary in run(), or now when
+    // the machine is not running, from any thread
+    future<Capture> requestCapture();
+
+    // replaces the state in place, from the thread running the machine,
+    // or when none does; only the pages given are written
+    void apply(const Capture& state);
+
+    // runs the task at the next instruction boundary in run(), on the
+    // thread running the machine, or now when none does; for reading and
+    // resetting what the machine updates as it steps
+    future<void> requestCall(const function<void()>& task);
+
+    void load(const Snapshot& snapshot);
+    void load(const Snapshot& snapshot, const MappedFile& memory);
+
+    string messagingEndpoint() const { return receiveEndpoint; }
+    string reportingEndpoint() const { return reportEndpoint; }
+
+  private:
+    u8 dispatch(u16 opcode, u16 a, u16 b, u16 c);
+    u16 xnum(u16 x);
+    u16& regr(u16 x);
+    void report(zmq::socket_t* publisher, const string& name, const string& arg = "") const;
+    void park(zmq::socket_t* controller, u8 forStdin);
+    void wake();
+    void fillInput();
+    void serveRequests();
+    void touch(u16 address) { dirty[address / PageWords] = true; }
+
+  private:
+    u8 id;
+    string receiveEndpoint;
+    string reportEndpoint;
+    u8 halted;
+    u8 stopped;
+    u8 waiting;
+    u16 lastOp;
+    vector<u16> executionBreakpoints;
+    TextMatcher textBreakpoints;
+    string textMatch;
+    InputSource input;
+    OutputSink output;
+    string inputBuffer;
+    size_t inputPos;
+    u8 inputClosed;
+    u8 parking;
+    u8 stdinPending;
+    int wakeFds[2];
+    vector<u8> dirty;
+    vector<shared_ptr<const vector<u16>>> pages;
+    mutex captureLock;
+    atomic<u8> requested;
+    vector<promise<Capture>> captureRequests;
+    vector<pair<function<void()>, promise<void>>> callRequests;
+    string inputLog;
+    Profiler* profiler;
+    Coverage* coverage;
+    Heatmap* heatmap;
+    TraceWriter* tracer;
+    Watchdog* watchdog;
+    Watchdog* watchdogAttached;
+    u32 watchCountdown;
+    string alarm;
+
+    typedef chrono::steady_clock Clock;
+    VmStats stats;
+    Clock::time_point statsSince;
+    u8 statsStopped;
+    u8 statsWaiting;
+    u8 timing;
+    u16 statsInterval;
+
+    void account();
+    void trace(u16 at, u16 opcode, u16 a, u16 b, u16 c);
+    void watch();
+    string statsLine(VmStats& last) const;
+  };
+
+  template<size_t N>
+  void
+  SynacorVM::exec(u16 (&image)[N])
+  {
+    Image v(begin(image), end(image));
+    exec(v);
+  }
+
+}
@@ -0,0 +1,85 @@
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <unistd.h>
+
+#include "warm.hpp"
+#include "cache.hpp"
+#include "hash.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  u8
+  WarmStart::restore(SynacorVM* vm)
+  {
+    string fn = cacheFilename();
+
+    // the snapshot is saved against the image, and saves made from it
+    // against its own memory
+    addBase(image.data(), image.size());
+
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    if (snapshot->load(fn))
+    {
+      ifstream ifs(fn + ".txt", ios::binary);
+      if (ifs.good())
+      {
+        transcript.assign(istreambuf_iterator<char>(ifs), istreambuf_iterator<char>());
+        snapshot->base = addBase(&snapshot->mem[0], snapshot->memoryUsed());
+        vm->load(*snapshot);
+        return true;
+      }
+    }
+
+    return build(vm);
+  }
+
+  u8
+  WarmStart::build(SynacorVM* vm)
+  {
+    transcript.clear();
+
+    vm->load(image);
+    vm->setOutput([this](u16 c) { transcript.push_back((char)c); });
+    u8 parked = vm->runUntilInput(Budget);
+    vm->setOutput(nullptr);
+
+    if (!parked)
+    {
+      vm->load(image);
+      transcript.clear();
+      return false;
+    }
+
+    string fn = cacheFilename();
+    string tmp = fn + ".tmp" + to_string(getpid());
+
+    unique_ptr<Snapshot> snapshot(new Snapshot());
+    snapshot->take(vm);
+
+    ofstream ofs(fn + ".txt", ios::binary | ios::trunc);
+    ofs << transcript;
+    ofs.close();
+
+    if (!ofs.good() || !snapshot->save(tmp) || rename(tmp.c_str(), fn.c_str()) != 0)
+      unlink(tmp.c_str());
+
+    snapshot->base = addBase(&snapshot->mem[0], snapshot->memoryUsed());
+    vm->load(*snapshot);
+
+    return true;
+  }
+
+  string
+  WarmStart::cacheFilename() const
+  {
+    stringstream so;
+    so << cacheDirectory() << "/warm-" << setfill('0') << setw(16) << hex << checksum(image);
+    return so.str();
+  }
+
+}
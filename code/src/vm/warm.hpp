@@ -0,0 +1,40 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // Snapshot of the image parked at its first IN, after the self-test and
+  // decryption prologue, together with everything printed up to that point.
+  // Cached on disk under the image checksum, so a changed image never
+  // matches a stale entry.
+
+  class WarmStart
+  {
+  public:
+    static const u64 Budget = 1 << 28;
+
+    WarmStart(const vector<u16>& image)
+      : image(image)
+    {
+    }
+
+    u8 restore(SynacorVM* vm);
+
+    string transcript;
+
+  private:
+    u8 build(SynacorVM* vm);
+    string cacheFilename() const;
+
+  private:
+    const vector<u16>& image;
+  };
+
+}
@@ -0,0 +1,92 @@
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#include "watchdog.hpp"
+#include "vm.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  // The routine owning the innermost frame, or the one with most frames,
+  // from return addresses on the stack that follow a direct call
+  string
+  Watchdog::routine(const SynacorVM* vm, u8 innermost, u32* frames) const
+  {
+    map<u16, u32> targets;
+    u16 found = 0xFFFF;
+
+    for (u32 p = vm->sp; p > 0; p--)
+    {
+      u16 ret = vm->stack[p - 1];
+      if (ret < 2 || ret >= 32768 || vm->mem[ret - 2] != Op::CALL || vm->mem[ret - 1] >= 32768)
+        continue;
+
+      u16 target = vm->mem[ret - 1];
+      targets[target]++;
+      if (innermost && found == 0xFFFF)
+        found = target;
+    }
+
+    if (!innermost)
+      for (auto& t : targets)
+        if (found == 0xFFFF || t.second > targets[found])
+          found = t.first;
+
+    if (found == 0xFFFF)
+      return "unknown routine";
+
+    if (frames)
+      *frames = targets[found];
+    return names.label(found);
+  }
+
+  string
+  Watchdog::check(const SynacorVM* vm)
+  {
+    VmStats stats = vm->statistics();
+    stringstream so;
+
+    if (stats.callDepth > maxCallDepth || vm->sp > maxStackDepth)
+    {
+      u32 frames = 0;
+      string name = routine(vm, false, &frames);
+      so << "runaway recursion in " << name << ", " << frames << " frames, at call depth "
+        << stats.callDepth << " with " << vm->sp << " words on the stack";
+      return so.str();
+    }
+
+    u64 read = stats.opcodes[Op::IN];
+    if (read != inputs)
+    {
+      inputs = read;
+      power = 1;
+      lambda = 0;
+      tortoise = vm->hash();
+      return "";
+    }
+
+    // Brent: the tortoise waits at powers of two for the hare to come round
+    u64 hare = vm->hash();
+    lambda++;
+    if (hare == tortoise)
+    {
+      so << "infinite loop in " << routine(vm, true) << ", state at " << setfill('0') << setw(4) << hex
+        << uppercase << vm->ip << dec << " repeats after " << lambda * Interval << " instructions without input, at call depth "
+        << stats.callDepth;
+      return so.str();
+    }
+
+    if (lambda == power)
+    {
+      tortoise = hare;
+      power *= 2;
+      lambda = 0;
+    }
+
+    return "";
+  }
+
+}
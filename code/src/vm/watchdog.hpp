@@ -0,0 +1,50 @@
+#pragma once
+
+#include <string>
+
+#include "types.hpp"
+#include "namemap.hpp"
+
+namespace paiv {
+
+  using namespace std;
+
+
+  class SynacorVM;
+
+  // Looks at the machine every Interval instructions for runaway
+  // recursion, by call and stack depth, and for loops, by Brent's cycle
+  // detection over state hashes. The game only changes state without
+  // input when it is stuck, so reading input starts a new search.
+
+  class Watchdog
+  {
+  public:
+    static const u32 Interval = 1 << 16;
+    static const u32 DefaultMaxCallDepth = 1000;
+    static const u32 DefaultMaxStackDepth = 10000;
+
+    Watchdog(u32 maxCallDepth = DefaultMaxCallDepth, u32 maxStackDepth = DefaultMaxStackDepth)
+      : maxCallDepth(maxCallDepth), maxStackDepth(maxStackDepth), inputs(0), power(1), lambda(0), tortoise(0)
+    {
+    }
+
+    void setNames(const NameMap& names) { this->names = names; }
+
+    // diagnostic when the machine has run away, or empty
+    string check(const SynacorVM* vm);
+
+  private:
+    string routine(const SynacorVM* vm, u8 innermost, u32* frames = nullptr) const;
+
+  private:
+    u32 maxCallDepth;
+    u32 maxStackDepth;
+    NameMap names;
+    u64 inputs;
+    u64 power;
+    u64 lambda;
+    u64 tortoise;
+  };
+
+}
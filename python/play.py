@@ -5,6 +5,8 @@ import readline
 import struct
 import sys
 
+import synacor
+
 
 MachineTextColor = '\x1b[95m'
 
@@ -331,6 +333,75 @@ class Machine:
                 self.handle_vm_command(':help')
 
 
+class NativeMachine:
+    """Same session on libsynacor, when the library is available"""
+
+    def __init__(self, fn):
+        self.fn = fn
+        self.vm = synacor.NativeMachine()
+        self.s_halt = not self.vm.load_image(fn)
+        self.printer = TextPrinter()
+
+    @property
+    def is_halted(self):
+        return self.s_halt
+
+    def run(self):
+        status = self.vm.run()
+        for c in self.vm.read_output():
+            self.printer.print_char(c)
+        self.printer.flush()
+
+        match status:
+            case synacor.SYNACOR_HALTED:
+                self.s_halt = True
+            case synacor.SYNACOR_WAITING:
+                try:
+                    while True:
+                        s = input('> ')
+                        if s.startswith(':'):
+                            self.handle_vm_command(s)
+                            return
+                        if s:
+                            self.vm.feed(s + '\n')
+                            return
+                except EOFError:
+                    self.s_halt = True
+
+    def reset(self):
+        self.vm.load_image(self.fn)
+
+    def handle_vm_command(self, command):
+        op,*args = command.split()
+        match op.lower():
+            case ':dump':
+                fn = args[0] if args else 'dump.bin'
+                with open(fn, 'wb') as fp:
+                    fp.write(struct.pack('<32768H', *self.vm.peek(0, 32768)))
+                    print(f'\n{fn!r} dumped', file=sys.stderr)
+            case ':quit':
+                self.s_halt = True
+            case ':reset':
+                self.reset()
+            case ':save':
+                fn = args[0] if args else 'save000'
+                fn = pathlib.Path('saves') / fn
+                fn.parent.mkdir(parents=True, exist_ok=True)
+                if self.vm.save_snapshot(fn):
+                    print(f'\n{fn!s} saved', file=sys.stderr)
+            case ':load':
+                fn = args[0] if args else 'save000'
+                fn = pathlib.Path('saves') / fn
+                if not fn.is_file():
+                    print(f'\n{fn!s} not found', file=sys.stderr)
+                elif self.vm.load_snapshot(fn):
+                    print(f'\n{fn!s} loaded', file=sys.stderr)
+                else:
+                    print(f'\n{fn!s} is not a snapshot', file=sys.stderr)
+            case _:
+                Machine.handle_vm_command(self, command)
+
+
 def vm_load(fp):
     raw = fp.read()
     image = MachineImage(raw)
@@ -428,9 +499,12 @@ def vm_disasm(image, addr=None):
     
 
 def main(image, disasm):
-    with open(image, 'rb') as fp:
-        vm = vm_load(fp)
-    vm.is_disassemble = disasm
+    if not disasm and synacor.available():
+        vm = NativeMachine(image)
+    else:
+        with open(image, 'rb') as fp:
+            vm = vm_load(fp)
+        vm.is_disassemble = disasm
     while not vm.is_halted:
         vm.run()
 
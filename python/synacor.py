@@ -0,0 +1,155 @@
+import ctypes
+import ctypes.util
+import os
+import pathlib
+
+
+SYNACOR_RUNNING = 0
+SYNACOR_WAITING = 1
+SYNACOR_HALTED = 2
+
+SYNACOR_REG_IP = 8
+SYNACOR_REG_SP = 9
+
+
+def _find_library():
+    names = list()
+    if (fn := os.environ.get('SYNACOR_LIB')):
+        names.append(fn)
+    here = pathlib.Path(__file__).resolve().parent
+    for build in ('build', '_build'):
+        names.append(here.parent / build / 'libsynacor' / 'libsynacor.so')
+    if (fn := ctypes.util.find_library('synacor')):
+        names.append(fn)
+    for fn in names:
+        try:
+            return ctypes.CDLL(str(fn))
+        except OSError:
+            pass
+
+
+def _declare(lib):
+    vm = ctypes.c_void_p
+    u16 = ctypes.c_uint16
+    u64 = ctypes.c_uint64
+    size = ctypes.c_size_t
+    text = ctypes.c_char_p
+    signatures = {
+        'synacor_abi_version': (ctypes.c_int, []),
+        'synacor_create': (vm, []),
+        'synacor_destroy': (None, [vm]),
+        'synacor_load_image': (ctypes.c_int, [vm, text]),
+        'synacor_load_image_data': (ctypes.c_int, [vm, ctypes.POINTER(u16), size]),
+        'synacor_load_snapshot': (ctypes.c_int, [vm, text]),
+        'synacor_save_snapshot': (ctypes.c_int, [vm, text]),
+        'synacor_run': (ctypes.c_int, [vm, u64]),
+        'synacor_step': (ctypes.c_int, [vm]),
+        'synacor_clock': (u64, [vm]),
+        'synacor_hash': (u64, [vm]),
+        'synacor_feed': (None, [vm, text, size]),
+        'synacor_read_output': (size, [vm, ctypes.c_char_p, size]),
+        'synacor_get_register': (u16, [vm, ctypes.c_int]),
+        'synacor_set_register': (ctypes.c_int, [vm, ctypes.c_int, u16]),
+        'synacor_peek': (u16, [vm, u16]),
+        'synacor_poke': (ctypes.c_int, [vm, u16, u16]),
+        'synacor_peek_stack': (u16, [vm, u16]),
+    }
+    for name, (restype, argtypes) in signatures.items():
+        fn = getattr(lib, name)
+        fn.restype = restype
+        fn.argtypes = argtypes
+    return lib
+
+
+_lib = _find_library()
+if _lib is not None:
+    _lib = _declare(_lib)
+
+
+def available():
+    return _lib is not None and _lib.synacor_abi_version() >= 1
+
+
+class NativeMachine:
+    """Synacor VM in libsynacor.so, see code/src/libsynacor/synacor.h"""
+
+    def __init__(self):
+        if not available():
+            raise OSError('libsynacor not found, set SYNACOR_LIB')
+        self._vm = _lib.synacor_create()
+        if not self._vm:
+            raise MemoryError()
+
+    def __del__(self):
+        if getattr(self, '_vm', None):
+            _lib.synacor_destroy(self._vm)
+            self._vm = None
+
+    def load_image(self, fn):
+        return _lib.synacor_load_image(self._vm, os.fsencode(fn)) == 0
+
+    def load_image_data(self, raw):
+        n = len(raw) // 2
+        words = (ctypes.c_uint16 * n).from_buffer_copy(raw[:n * 2])
+        return _lib.synacor_load_image_data(self._vm, words, n) == 0
+
+    def load_snapshot(self, fn):
+        return _lib.synacor_load_snapshot(self._vm, os.fsencode(fn)) == 0
+
+    def save_snapshot(self, fn):
+        return _lib.synacor_save_snapshot(self._vm, os.fsencode(fn)) == 0
+
+    def run(self, budget=1 << 32):
+        return _lib.synacor_run(self._vm, budget)
+
+    def step(self):
+        return _lib.synacor_step(self._vm)
+
+    @property
+    def clock(self):
+        return _lib.synacor_clock(self._vm)
+
+    @property
+    def hash(self):
+        return _lib.synacor_hash(self._vm)
+
+    def feed(self, s):
+        data = s.encode('latin-1') if isinstance(s, str) else bytes(s)
+        _lib.synacor_feed(self._vm, data, len(data))
+
+    def read_output(self):
+        chunks = list()
+        buffer = ctypes.create_string_buffer(4096)
+        while (n := _lib.synacor_read_output(self._vm, buffer, len(buffer))):
+            chunks.append(buffer.raw[:n])
+        return b''.join(chunks).decode('latin-1')
+
+    @property
+    def ip(self):
+        return _lib.synacor_get_register(self._vm, SYNACOR_REG_IP)
+
+    @property
+    def sp(self):
+        return _lib.synacor_get_register(self._vm, SYNACOR_REG_SP)
+
+    @property
+    def reg(self):
+        return [_lib.synacor_get_register(self._vm, i) for i in range(8)]
+
+    def set_register(self, index, value):
+        return _lib.synacor_set_register(self._vm, index, value) == 0
+
+    def peek(self, addr, count=1):
+        if count == 1:
+            return _lib.synacor_peek(self._vm, addr)
+        return [_lib.synacor_peek(self._vm, (addr + i) & 0x7fff) for i in range(count)]
+
+    def poke(self, addr, values):
+        if isinstance(values, int):
+            values = [values]
+        for i, x in enumerate(values):
+            _lib.synacor_poke(self._vm, (addr + i) & 0x7fff, x)
+
+    @property
+    def stack(self):
+        return [_lib.synacor_peek_stack(self._vm, i) for i in range(self.sp)]